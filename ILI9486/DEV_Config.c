@@ -53,6 +53,118 @@ uint8_t SPI4W_Read_Byte(uint8_t value)
     return RxData;
 }
 
+/*********************************************
+function:	Reads
+note:
+        SPI4W_Read_Bytes(data, len) :
+                Receive len bytes (8-bit frames), the bytes
+                clocked out are don't care
+        SPI4W_Set_Prescaler(prescaler) :
+                Change the SCK divider (SPI_BAUDRATEPRESCALER_x)
+                between transfers, returns the previous one
+*********************************************/
+uint8_t SPI4W_Read_Bytes(uint8_t* data, uint16_t len)
+{
+    return HAL_SPI_Receive(&hspi2, data, len, 1000) == HAL_OK ? 0 : 1;
+}
+
+uint32_t SPI4W_Set_Prescaler(uint32_t prescaler)
+{
+    uint32_t previous = hspi2.Init.BaudRatePrescaler;
+
+    __HAL_SPI_DISABLE(&hspi2);
+    hspi2.Init.BaudRatePrescaler = prescaler;
+    MODIFY_REG(hspi2.Instance->CR1, SPI_CR1_BR, prescaler);
+    return previous;
+}
+
+/*********************************************
+function:	16-bit frames
+note:
+        SPI4W_Set_Frame16(enable) :
+                Switch SPI2 and its TX DMA stream between 8-bit
+                and 16-bit frames. Must not be called while a
+                transfer is running. Leave 8-bit mode before
+                anything else (touch panel) uses SPI2
+        SPI4W_Write_Words(data, len) :
+                Send len 16-bit frames, MSB first (16-bit mode)
+*********************************************/
+static uint8_t sFrame16;
+
+void SPI4W_Set_Frame16(uint8_t enable)
+{
+    uint32_t align;
+
+    enable = enable ? 1 : 0;
+    if (sFrame16 == enable)
+        return;
+    sFrame16 = enable;
+
+    // DS and FRXTH may only change while the SPI is disabled, the HAL
+    // enables it again with the next transfer
+    __HAL_SPI_DISABLE(&hspi2);
+    hspi2.Init.DataSize = enable ? SPI_DATASIZE_16BIT : SPI_DATASIZE_8BIT;
+    MODIFY_REG(hspi2.Instance->CR2, SPI_CR2_DS | SPI_CR2_FRXTH,
+               enable ? SPI_DATASIZE_16BIT
+                      : (SPI_DATASIZE_8BIT | SPI_RXFIFO_THRESHOLD));
+
+    // Half-word DMA accesses for 16-bit frames
+    align = enable ? (DMA_PDATAALIGN_HALFWORD | DMA_MDATAALIGN_HALFWORD)
+                   : (DMA_PDATAALIGN_BYTE | DMA_MDATAALIGN_BYTE);
+    hspi2.hdmatx->Init.PeriphDataAlignment = align & DMA_SxCR_PSIZE;
+    hspi2.hdmatx->Init.MemDataAlignment    = align & DMA_SxCR_MSIZE;
+    MODIFY_REG(hspi2.hdmatx->Instance->CR, DMA_SxCR_PSIZE | DMA_SxCR_MSIZE,
+               align);
+}
+
+uint8_t SPI4W_Write_Words(const uint16_t* data, uint16_t len)
+{
+    return HAL_SPI_Transmit(&hspi2, (uint8_t*)data, len, 1000) == HAL_OK ? 0
+                                                                          : 1;
+}
+
+/*********************************************
+function:	DMA transmit
+note:
+        SPI4W_Write_DMA(data, len) :
+                Start sending len frames (bytes or 16-bit
+                words, see SPI4W_Set_Frame16()), returns at
+                once. data must stay valid until
+                SPI4W_Wait_DMA()
+        SPI4W_Fill_DMA(data, len) :
+                SPI4W_Write_DMA() sending the first frame of
+                data len times (memory address not incremented)
+        SPI4W_Wait_DMA() :
+                Wait until the last frame left the shifter
+*********************************************/
+static void SPI4W_Set_MemInc(uint8_t enable)
+{
+    // The stream is disabled between transfers, MINC can change
+    hspi2.hdmatx->Init.MemInc = enable ? DMA_MINC_ENABLE : DMA_MINC_DISABLE;
+    MODIFY_REG(hspi2.hdmatx->Instance->CR, DMA_SxCR_MINC,
+               hspi2.hdmatx->Init.MemInc);
+}
+
+uint8_t SPI4W_Write_DMA(const uint8_t* data, uint16_t len)
+{
+    SPI4W_Set_MemInc(1);
+    return HAL_SPI_Transmit_DMA(&hspi2, (uint8_t*)data, len) == HAL_OK ? 0 : 1;
+}
+
+uint8_t SPI4W_Fill_DMA(const uint8_t* data, uint16_t len)
+{
+    SPI4W_Set_MemInc(0);
+    return HAL_SPI_Transmit_DMA(&hspi2, (uint8_t*)data, len) == HAL_OK ? 0 : 1;
+}
+
+void SPI4W_Wait_DMA(void)
+{
+    // The HAL returns to READY from the DMA completion interrupt after the
+    // SPI is no longer busy
+    while (HAL_SPI_GetState(&hspi2) == HAL_SPI_STATE_BUSY_TX)
+        ;
+}
+
 /*****************************************************************************
 function:	Delay function
 note:
@@ -36,17 +36,17 @@ extern "C" {
 #define SPI1_MOSI_1                                                            \
     HAL_GPIO_WritePin(SPI1_MOSI_GPIO_Port, SPI1_MOSI_Pin, GPIO_PIN_SET)
 
-// LCD
-#define LCD_CS_0 HAL_GPIO_WritePin(LCD_CS_GPIO_Port, LCD_CS_Pin, GPIO_PIN_RESET)
-#define LCD_CS_1 HAL_GPIO_WritePin(LCD_CS_GPIO_Port, LCD_CS_Pin, GPIO_PIN_SET)
+// LCD, CS and DC change on every command: single BSRR store, no HAL call
+#define LCD_CS_0 (LCD_CS_GPIO_Port->BSRR = (uint32_t)LCD_CS_Pin << 16U)
+#define LCD_CS_1 (LCD_CS_GPIO_Port->BSRR = (uint32_t)LCD_CS_Pin)
 
 #define LCD_RST_0                                                              \
     HAL_GPIO_WritePin(LCD_RST_GPIO_Port, LCD_RST_Pin, GPIO_PIN_RESET)
 #define LCD_RST_1                                                              \
     HAL_GPIO_WritePin(LCD_RST_GPIO_Port, LCD_RST_Pin, GPIO_PIN_SET)
 
-#define LCD_DC_0 HAL_GPIO_WritePin(LCD_DC_GPIO_Port, LCD_DC_Pin, GPIO_PIN_RESET)
-#define LCD_DC_1 HAL_GPIO_WritePin(LCD_DC_GPIO_Port, LCD_DC_Pin, GPIO_PIN_SET)
+#define LCD_DC_0 (LCD_DC_GPIO_Port->BSRR = (uint32_t)LCD_DC_Pin << 16U)
+#define LCD_DC_1 (LCD_DC_GPIO_Port->BSRR = (uint32_t)LCD_DC_Pin)
 
 // Touch
 #define TP_CS_0 HAL_GPIO_WritePin(TP_CS_GPIO_Port, TP_CS_Pin, GPIO_PIN_RESET)
@@ -66,6 +66,13 @@ void System_Exit(void);
 void PWM_SetValue(uint16_t value);
 uint8_t SPI4W_Write_Byte(uint8_t value);
 uint8_t SPI4W_Read_Byte(uint8_t value);
+uint8_t SPI4W_Read_Bytes(uint8_t* data, uint16_t len);
+uint32_t SPI4W_Set_Prescaler(uint32_t prescaler);
+void SPI4W_Set_Frame16(uint8_t enable);
+uint8_t SPI4W_Write_Words(const uint16_t* data, uint16_t len);
+uint8_t SPI4W_Write_DMA(const uint8_t* data, uint16_t len);
+uint8_t SPI4W_Fill_DMA(const uint8_t* data, uint16_t len);
+void SPI4W_Wait_DMA(void);
 
 void Driver_Delay_ms(uint32_t xms);
 void Driver_Delay_us(uint32_t xus);
@@ -0,0 +1,348 @@
+/*
+ * GUI_Queue.c
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "GUI_Queue.h"
+#include "image_kernels.h"
+#include "memory_config.h"
+#include "perf.h"
+
+#include <string.h>
+
+typedef enum
+{
+    GUI_CMD_FILL = 0,
+    GUI_CMD_BLIT,
+    GUI_CMD_TEXT,
+} GUI_CMD_TYPE;
+
+/// One recorded command, Done counts the rows (fill, blit) or glyphs (text)
+/// already started
+typedef struct
+{
+    uint8_t Type;
+    uint8_t Length; // Characters of Text
+    POINT Xstart;
+    POINT Ystart;
+    POINT Xend;
+    POINT Yend;
+    COLOR Color; // Fill color (read by the DMA) or text foreground
+    COLOR Background;
+    uint16_t Done;
+    const COLOR* Pixels;
+    const sFONT* Font;
+    char Text[GUI_QUEUE_TEXT];
+} GUI_Command;
+
+/// Command ring, the fill color is read by the SPI DMA straight from DTCM
+DTCM_BSS static GUI_Command sQueue[GUI_QUEUE_DEPTH];
+/// Glyph of the running text command
+DTCM_BSS static COLOR sQueueCell[MAX_WIDTH_FONT * MAX_HEIGHT_FONT];
+
+static uint32_t sQueueHead; // Next slot to record
+static uint32_t sQueueTail; // Running command
+static volatile uint32_t sQueueCount;
+/// Set while a command is being executed (a DMA of it is in flight)
+static volatile uint8_t sQueueRunning;
+/// Set while the DMA in flight was started by the queue
+static volatile uint8_t sQueueInFlight;
+static volatile uint32_t sQueueCompleted;
+static uint32_t sQueueSubmitted;
+/// Start of the current busy period, for GUI_QueueStats.BusyUs
+static uint32_t sQueueBusyStart;
+static GUI_QueueStats sQueueStats;
+
+extern LCD_DIS sLCD_DIS;
+
+static inline uint32_t GUI_QueueLock(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    return primask;
+}
+
+static inline void GUI_QueueUnlock(uint32_t primask) { __set_PRIMASK(primask); }
+
+/*******************************************************************************
+ function:	Rows of a window of the given width which fit one DMA transfer
+ *******************************************************************************/
+static uint16_t GUI_QueueRows(POINT Width)
+{
+    return Width == 0 ? 0 : (uint16_t)(0xFFFFU / Width);
+}
+
+/*******************************************************************************
+ function:	Start the next part of a command
+ parameter:
+ Cmd     :   Running command
+ return  :   0 when the command is complete, nothing was started
+ *******************************************************************************/
+static uint8_t GUI_QueueStep(GUI_Command* Cmd)
+{
+    POINT Width = Cmd->Xend - Cmd->Xstart;
+    POINT Rows  = Cmd->Yend - Cmd->Ystart;
+
+    switch (Cmd->Type)
+    {
+        case GUI_CMD_FILL:
+        case GUI_CMD_BLIT:
+        {
+            POINT Chunk = GUI_QueueRows(Width);
+            if (Cmd->Done >= Rows || Chunk == 0)
+                return 0;
+            if (Chunk > Rows - Cmd->Done)
+                Chunk = Rows - Cmd->Done;
+            POINT Y = Cmd->Ystart + Cmd->Done;
+            if (Cmd->Type == GUI_CMD_FILL)
+                LCD_FillWindowDMA(Cmd->Xstart, Y, Cmd->Xend, Y + Chunk,
+                                  &Cmd->Color);
+            else
+                LCD_WriteWindowDMA(Cmd->Xstart, Y, Cmd->Xend, Y + Chunk,
+                                   &Cmd->Pixels[(uint32_t)Cmd->Done * Width]);
+            Cmd->Done += Chunk;
+            return 1;
+        }
+        case GUI_CMD_TEXT:
+        {
+            const sFONT* Font = Cmd->Font;
+            if (Cmd->Done >= Cmd->Length)
+                return 0;
+            uint32_t Row_Bytes = (Font->Width + 7) / 8;
+            char Ch            = Cmd->Text[Cmd->Done];
+            POINT X            = Cmd->Xstart + Cmd->Done * Font->Width;
+            IMG_ExpandGlyph(&Font->table[(uint32_t)(Ch - ' ') * Font->Height *
+                                         Row_Bytes],
+                            Font->Width, Font->Height, Cmd->Color,
+                            Cmd->Background, sQueueCell);
+            LCD_WriteWindowDMA(X, Cmd->Ystart, X + Font->Width,
+                               Cmd->Ystart + Font->Height, sQueueCell);
+            Cmd->Done++;
+            return 1;
+        }
+        default:
+            return 0;
+    }
+}
+
+/*******************************************************************************
+ function:	Execute commands until one of them starts a DMA or the queue is
+            empty. Called with the previous DMA done: from the DMA
+            completion interrupt or with interrupts masked
+ *******************************************************************************/
+static void GUI_QueueRun(void)
+{
+    while (sQueueCount != 0)
+    {
+        if (GUI_QueueStep(&sQueue[sQueueTail]))
+        {
+            if (LCD_DmaBusy())
+            {
+                sQueueInFlight = 1;
+                return;
+            }
+            // Part sent without DMA (8-bit transport), go on
+            continue;
+        }
+        sQueueTail = (sQueueTail + 1) % GUI_QUEUE_DEPTH;
+        sQueueCount--;
+        sQueueCompleted++;
+    }
+    sQueueRunning = 0;
+    sQueueStats.BusyUs += PERF_CyclesToUs(PERF_Cycles() - sQueueBusyStart);
+    // Release CS and return SPI2 to 8-bit frames
+    LCD_WaitDMA();
+}
+
+/*******************************************************************************
+ function:	SPI2 TX DMA completion, to be called from HAL_SPI_TxCpltCallback()
+            (and HAL_SPI_ErrorCallback(), a failed part is dropped)
+ *******************************************************************************/
+void GUI_QueueDmaDone(void)
+{
+    // Transfers started by direct LCD_*DMA() calls are not ours
+    if (!sQueueInFlight)
+        return;
+    sQueueInFlight = 0;
+    GUI_QueueRun();
+}
+
+/*******************************************************************************
+ function:	Take a free slot, waiting for the executor when the ring is
+            full. Returns with interrupts masked, the caller fills the
+            slot and calls GUI_QueueSubmit()
+ *******************************************************************************/
+static GUI_Command* GUI_QueueReserve(uint32_t* Primask)
+{
+    *Primask = GUI_QueueLock();
+    if (sQueueCount == GUI_QUEUE_DEPTH)
+    {
+        uint32_t Start = PERF_Cycles();
+        GUI_QueueUnlock(*Primask);
+        while (sQueueCount == GUI_QUEUE_DEPTH)
+            ;
+        *Primask = GUI_QueueLock();
+        sQueueStats.Stalls++;
+        sQueueStats.StallUs += PERF_CyclesToUs(PERF_Cycles() - Start);
+    }
+    GUI_Command* Cmd = &sQueue[sQueueHead];
+    memset(Cmd, 0, sizeof(*Cmd));
+    return Cmd;
+}
+
+/*******************************************************************************
+ function:	Append the reserved slot and start the executor if it is idle
+ *******************************************************************************/
+static void GUI_QueueSubmit(uint32_t Primask)
+{
+    sQueueHead = (sQueueHead + 1) % GUI_QUEUE_DEPTH;
+    sQueueCount++;
+    sQueueSubmitted++;
+    if (sQueueCount > sQueueStats.MaxDepth)
+        sQueueStats.MaxDepth = sQueueCount;
+
+    if (!sQueueRunning)
+    {
+        sQueueRunning = 1;
+        // A direct LCD_*DMA() transfer may still run, its completion is
+        // ignored (sQueueInFlight clear). Wait for it with interrupts
+        // enabled, then start the first part without being interrupted
+        GUI_QueueUnlock(Primask);
+        LCD_WaitDMA();
+        Primask         = GUI_QueueLock();
+        sQueueBusyStart = PERF_Cycles();
+        GUI_QueueRun();
+    }
+    GUI_QueueUnlock(Primask);
+}
+
+/*******************************************************************************
+ function:	Record a fill of the area [Xstart, Xend) x [Ystart, Yend)
+ *******************************************************************************/
+void GUI_QueueFill(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend,
+                   COLOR Color)
+{
+    uint32_t Primask;
+
+    if (Xend > sLCD_DIS.LCD_Dis_Column)
+        Xend = sLCD_DIS.LCD_Dis_Column;
+    if (Yend > sLCD_DIS.LCD_Dis_Page)
+        Yend = sLCD_DIS.LCD_Dis_Page;
+    if (Xstart >= Xend || Ystart >= Yend)
+        return;
+
+    GUI_Command* Cmd = GUI_QueueReserve(&Primask);
+    Cmd->Type        = GUI_CMD_FILL;
+    Cmd->Xstart      = Xstart;
+    Cmd->Ystart      = Ystart;
+    Cmd->Xend        = Xend;
+    Cmd->Yend        = Yend;
+    Cmd->Color       = Color;
+    GUI_QueueSubmit(Primask);
+}
+
+/*******************************************************************************
+ function:	Record a copy of an RGB565 image to the display
+ parameter:
+ Pixels  :   Width * Height pixels, read by the DMA: DMA_BUFFER or DTCM,
+             unchanged until the command is done (GUI_QueueFence())
+ *******************************************************************************/
+void GUI_QueueBlit(POINT Xpoint, POINT Ypoint, LENGTH Width, LENGTH Height,
+                   const COLOR* Pixels)
+{
+    uint32_t Primask;
+
+    // Only whole rows fit the window, the image must lie on the display
+    if (Width == 0 || Height == 0 ||
+        Xpoint + Width > sLCD_DIS.LCD_Dis_Column ||
+        Ypoint + Height > sLCD_DIS.LCD_Dis_Page)
+        return;
+
+    GUI_Command* Cmd = GUI_QueueReserve(&Primask);
+    Cmd->Type        = GUI_CMD_BLIT;
+    Cmd->Xstart      = Xpoint;
+    Cmd->Ystart      = Ypoint;
+    Cmd->Xend        = Xpoint + Width;
+    Cmd->Yend        = Ypoint + Height;
+    Cmd->Pixels      = Pixels;
+    GUI_QueueSubmit(Primask);
+}
+
+/*******************************************************************************
+ function:	Record a single line of opaque text. The string is copied,
+            characters past the right edge of the display are dropped
+ *******************************************************************************/
+void GUI_QueueString(POINT Xpoint, POINT Ypoint, const char* pString,
+                     sFONT* Font, COLOR Color_Background,
+                     COLOR Color_Foreground)
+{
+    if (Font->Width > MAX_WIDTH_FONT || Font->Height > MAX_HEIGHT_FONT ||
+        Ypoint + Font->Height > sLCD_DIS.LCD_Dis_Page)
+        return;
+
+    while (*pString != '\0' && Xpoint + Font->Width <= sLCD_DIS.LCD_Dis_Column)
+    {
+        uint32_t Primask;
+        GUI_Command* Cmd = GUI_QueueReserve(&Primask);
+
+        Cmd->Type       = GUI_CMD_TEXT;
+        Cmd->Xstart     = Xpoint;
+        Cmd->Ystart     = Ypoint;
+        Cmd->Font       = Font;
+        Cmd->Color      = Color_Foreground;
+        Cmd->Background = Color_Background;
+        while (*pString != '\0' && Cmd->Length < GUI_QUEUE_TEXT &&
+               Xpoint + Font->Width <= sLCD_DIS.LCD_Dis_Column)
+        {
+            // Characters without a glyph are drawn as blanks
+            char Ch = *pString++;
+            Cmd->Text[Cmd->Length++] = (Ch < ' ' || Ch > '~') ? ' ' : Ch;
+            Xpoint += Font->Width;
+        }
+        GUI_QueueSubmit(Primask);
+    }
+}
+
+/*******************************************************************************
+ function:	Marker of the commands recorded so far, see GUI_QueueWait()
+ *******************************************************************************/
+uint32_t GUI_QueueFence(void) { return sQueueSubmitted; }
+
+/*******************************************************************************
+ function:	Wait until all commands recorded before GUI_QueueFence()
+            returned Fence are done
+ *******************************************************************************/
+void GUI_QueueWait(uint32_t Fence)
+{
+    uint32_t Start = PERF_Cycles();
+
+    while ((int32_t)(sQueueCompleted - Fence) < 0)
+        ;
+    sQueueStats.WaitUs += PERF_CyclesToUs(PERF_Cycles() - Start);
+}
+
+/*******************************************************************************
+ function:	Wait until the queue is empty
+ *******************************************************************************/
+void GUI_QueueFlush(void) { GUI_QueueWait(GUI_QueueFence()); }
+
+/*******************************************************************************
+ function:	Snapshot of the queue counters
+ *******************************************************************************/
+void GUI_QueueGetStats(GUI_QueueStats* Stats)
+{
+    uint32_t Primask = GUI_QueueLock();
+    *Stats           = sQueueStats;
+    Stats->Depth     = sQueueCount;
+    Stats->Submitted = sQueueSubmitted;
+    Stats->Completed = sQueueCompleted;
+    GUI_QueueUnlock(Primask);
+}
+
+void GUI_QueueResetStats(void)
+{
+    uint32_t Primask = GUI_QueueLock();
+    sQueueStats      = (GUI_QueueStats){0};
+    GUI_QueueUnlock(Primask);
+}
@@ -0,0 +1,59 @@
+/*
+ * GUI_Queue.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * Asynchronous render command queue.
+ *
+ * GUI_Queue*() calls record fill, blit and text commands into a ring and
+ * return at once. The commands are executed in the background: every
+ * command is cut into windows of at most 65535 pixels, each sent by the
+ * SPI2 TX DMA, and the DMA completion interrupt (GUI_QueueDmaDone()) starts
+ * the next one. The main loop keeps servicing DCMI and UART meanwhile.
+ *
+ * Commands are executed in order. GUI_QueueFence() returns a marker of the
+ * commands recorded so far, GUI_QueueWait() blocks until they are done and
+ * GUI_QueueFlush() waits for the whole queue. Direct LCD_* / GUI_* calls
+ * only wait for the DMA in flight (LCD_WaitDMA()), the queue would start its
+ * next part in the middle of them: call GUI_QueueFlush() first.
+ */
+
+#ifndef GUI_QUEUE_H_
+#define GUI_QUEUE_H_
+
+#include "LCD_Driver.h"
+#include "fonts.h"
+
+/// Number of commands the ring holds
+#define GUI_QUEUE_DEPTH 32U
+/// Characters of one text command, longer strings take several commands
+#define GUI_QUEUE_TEXT 24U
+
+/// Queue counters (see GUI_QueueGetStats())
+typedef struct
+{
+    uint32_t Depth;     // Commands waiting or running now
+    uint32_t MaxDepth;  // Largest Depth since GUI_QueueResetStats()
+    uint32_t Submitted; // Commands recorded
+    uint32_t Completed; // Commands executed
+    uint32_t Stalls;    // Records which waited for a free slot
+    uint32_t StallUs;   // Time spent waiting for free slots
+    uint32_t WaitUs;    // Time spent in GUI_QueueWait() / GUI_QueueFlush()
+    uint32_t BusyUs;    // Time the queue was executing commands
+} GUI_QueueStats;
+
+void GUI_QueueFill(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend,
+                   COLOR Color);
+void GUI_QueueBlit(POINT Xpoint, POINT Ypoint, LENGTH Width, LENGTH Height,
+                   const COLOR* Pixels);
+void GUI_QueueString(POINT Xpoint, POINT Ypoint, const char* pString,
+                     sFONT* Font, COLOR Color_Background,
+                     COLOR Color_Foreground);
+uint32_t GUI_QueueFence(void);
+void GUI_QueueWait(uint32_t Fence);
+void GUI_QueueFlush(void);
+void GUI_QueueDmaDone(void);
+void GUI_QueueGetStats(GUI_QueueStats* Stats);
+void GUI_QueueResetStats(void);
+
+#endif /* GUI_QUEUE_H_ */
@@ -17,8 +17,34 @@
 #include "LCD_Driver.h"
 #include "DEV_Config.h"
 #include "Debug.h"
+#include "LCD_Gram.h"
+#include "memory_config.h"
+#include "perf.h"
 
 LCD_DIS sLCD_DIS;
+/// Non-zero while LCD_WritePixelsDMA() keeps CS asserted
+static volatile uint8_t sLCD_DmaActive;
+
+/// Column / page range last sent with 0x2A / 0x2B (see LCD_AddressWindow())
+static struct
+{
+    POINT Xstart;
+    POINT Xend;
+    POINT Ystart;
+    POINT Yend;
+    uint8_t ColumnValid;
+    uint8_t PageValid;
+} sLCD_Window;
+/// Level last driven on CS / DC, 0xFF until the first write
+static uint8_t sLCD_Cs = 0xFF;
+static uint8_t sLCD_Dc = 0xFF;
+static LCD_Stats sLCD_Stats;
+/// Transport of GRAM pixel data, see LCD_SetPixelMode()
+static LCD_PIXEL_MODE sLCD_PixelMode = LCD_PIXELS_16BIT;
+
+/// SPI bytes of one 0x2A / 0x2B command: command + 4 x 16-bit parameter
+#define LCD_WINDOW_CMD_BYTES 9U
+
 /*******************************************************************************
  function:
  Hardware reset
@@ -31,28 +57,93 @@ static void LCD_Reset(void)
     Driver_Delay_ms(500);
     LCD_RST_1;
     Driver_Delay_ms(500);
+    LCD_InvalidateWindow();
 }
 
 static void LCD_SetBackLight(uint16_t value) { PWM_SetValue(value); }
+
+/*******************************************************************************
+ function:	CS and DC control. The pins are only written when the level
+            changes, sequences keep CS low until LCD_Deselect()
+ *******************************************************************************/
+static inline void LCD_Select(void)
+{
+    if (sLCD_Cs != 0)
+    {
+        LCD_CS_0;
+        sLCD_Cs = 0;
+    }
+}
+
+static inline void LCD_Deselect(void)
+{
+    if (sLCD_Cs != 1)
+    {
+        LCD_CS_1;
+        sLCD_Cs = 1;
+    }
+}
+
+static inline void LCD_DcCommand(void)
+{
+    if (sLCD_Dc != 0)
+    {
+        LCD_DC_0;
+        sLCD_Dc = 0;
+    }
+}
+
+static inline void LCD_DcData(void)
+{
+    if (sLCD_Dc != 1)
+    {
+        LCD_DC_1;
+        sLCD_Dc = 1;
+    }
+}
+
+/*******************************************************************************
+ function:	Command / parameter inside of a sequence (CS already low)
+ *******************************************************************************/
+static void LCD_Command(uint8_t Reg)
+{
+    LCD_DcCommand();
+    SPI4W_Write_Byte(Reg);
+    ++sLCD_Stats.Commands;
+}
+
+static void LCD_Param(uint8_t Data)
+{
+    LCD_DcData();
+    // The board shifts 16 bits into the controller's parallel bus per
+    // write, the high byte of a parameter word is always zero
+    SPI4W_Write_Byte(0x00);
+    SPI4W_Write_Byte(Data);
+}
+
 /*******************************************************************************
  function:
  Write register address and data
  *******************************************************************************/
 void LCD_WriteReg(uint8_t Reg)
 {
-    LCD_DC_0;
-    LCD_CS_0;
-    SPI4W_Write_Byte(Reg);
-    LCD_CS_1;
+    LCD_WaitDMA();
+    // The window is written behind the cache's back
+    if (Reg == 0x2A)
+        sLCD_Window.ColumnValid = 0;
+    else if (Reg == 0x2B)
+        sLCD_Window.PageValid = 0;
+    LCD_Select();
+    LCD_Command(Reg);
+    LCD_Deselect();
 }
 
 void LCD_WriteData(uint8_t Data)
 {
-    LCD_DC_1;
-    LCD_CS_0;
-    SPI4W_Write_Byte((uint8_t)(Data >> 8U));
-    SPI4W_Write_Byte((uint8_t)(Data & 0XFF));
-    LCD_CS_1;
+    LCD_WaitDMA();
+    LCD_Select();
+    LCD_Param(Data);
+    LCD_Deselect();
 }
 
 /*******************************************************************************
@@ -62,14 +153,181 @@ void LCD_WriteData(uint8_t Data)
 static void LCD_Write_AllData(uint16_t Data, uint32_t DataLen)
 {
     uint32_t i;
-    LCD_DC_1;
-    LCD_CS_0;
+    LCD_DcData();
+    LCD_Select();
+    if (sLCD_PixelMode == LCD_PIXELS_16BIT)
+    {
+        COLOR Fill[32];
+        for (i = 0; i < 32; i++)
+            Fill[i] = Data;
+        SPI4W_Set_Frame16(1);
+        for (; DataLen >= 32; DataLen -= 32)
+            SPI4W_Write_Words(Fill, 32);
+        if (DataLen)
+            SPI4W_Write_Words(Fill, (uint16_t)DataLen);
+        SPI4W_Set_Frame16(0);
+        LCD_Deselect();
+        return;
+    }
     for (i = 0; i < DataLen; i++)
     {
         SPI4W_Write_Byte((uint8_t)(Data >> 8));
         SPI4W_Write_Byte((uint8_t)(Data & 0XFF));
     }
-    LCD_CS_1;
+    LCD_Deselect();
+}
+
+/*******************************************************************************
+ function:	Stream pixels inside of a sequence (CS already low)
+ *******************************************************************************/
+static void LCD_StreamPixels(const COLOR* Pixels, uint32_t Count)
+{
+    LCD_DcData();
+    if (sLCD_PixelMode == LCD_PIXELS_16BIT)
+    {
+        // One frame per pixel, MSB first: no byte swapping
+        SPI4W_Set_Frame16(1);
+        while (Count)
+        {
+            uint16_t Chunk = Count > 0xFFFFU ? 0xFFFFU : (uint16_t)Count;
+            SPI4W_Write_Words(Pixels, Chunk);
+            Pixels += Chunk;
+            Count -= Chunk;
+        }
+        SPI4W_Set_Frame16(0);
+        return;
+    }
+    while (Count--)
+    {
+        SPI4W_Write_Byte((uint8_t)(*Pixels >> 8));
+        SPI4W_Write_Byte((uint8_t)(*Pixels & 0XFF));
+        ++Pixels;
+    }
+}
+
+/*******************************************************************************
+ function:	Start the pixel DMA inside of a sequence (CS already low). CS
+            stays low until LCD_WaitDMA(). Only the 16-bit transport uses
+            the DMA, the 8-bit one falls back to LCD_StreamPixels()
+ *******************************************************************************/
+static void LCD_StreamPixelsDMA(const COLOR* Pixels, uint32_t Count)
+{
+    LCD_DcData();
+    if (sLCD_PixelMode == LCD_PIXELS_16BIT && Count <= 0xFFFFU)
+    {
+        SPI4W_Set_Frame16(1);
+        if (SPI4W_Write_DMA((const uint8_t*)Pixels, (uint16_t)Count) == 0U)
+        {
+            sLCD_DmaActive = 1;
+            return;
+        }
+        SPI4W_Set_Frame16(0);
+    }
+    LCD_StreamPixels(Pixels, Count);
+    LCD_Deselect();
+}
+
+/*******************************************************************************
+ function:	LCD_StreamPixelsDMA() sending one color Count times
+ *******************************************************************************/
+static void LCD_StreamColorDMA(const COLOR* Color, uint32_t Count)
+{
+    LCD_DcData();
+    if (sLCD_PixelMode == LCD_PIXELS_16BIT && Count <= 0xFFFFU)
+    {
+        SPI4W_Set_Frame16(1);
+        if (SPI4W_Fill_DMA((const uint8_t*)Color, (uint16_t)Count) == 0U)
+        {
+            sLCD_DmaActive = 1;
+            return;
+        }
+        SPI4W_Set_Frame16(0);
+    }
+    LCD_Write_AllData(*Color, Count);
+}
+
+/*******************************************************************************
+ function:	Stream pixels into the window set by LCD_SetWindow()
+ parameter:
+ Pixels  :   RGB565 pixels
+ Count   :   Number of pixels
+ *******************************************************************************/
+void LCD_WritePixels(const COLOR* Pixels, uint32_t Count)
+{
+    LCD_WaitDMA();
+    LCD_Select();
+    LCD_StreamPixels(Pixels, Count);
+    LCD_Deselect();
+}
+
+/*******************************************************************************
+ function:	Start streaming pixels into the window set by LCD_SetWindow()
+            without waiting. The next register write (or LCD_WaitDMA())
+            waits for the transfer and releases CS.
+ parameter:
+ Pixels  :   RGB565 pixels, must stay unchanged until the transfer is done
+ Count   :   Number of pixels, at most 65535
+ *******************************************************************************/
+void LCD_WritePixelsDMA(const COLOR* Pixels, uint32_t Count)
+{
+    LCD_WaitDMA();
+    LCD_Select();
+    LCD_StreamPixelsDMA(Pixels, Count);
+}
+
+/*******************************************************************************
+ function:	Non-zero while a pixel DMA started by LCD_*DMA() is running or
+            done but not yet released by LCD_WaitDMA()
+ *******************************************************************************/
+uint8_t LCD_DmaBusy(void) { return sLCD_DmaActive; }
+
+/*******************************************************************************
+ function:	Wait for LCD_WritePixelsDMA() to finish and release CS
+ *******************************************************************************/
+void LCD_WaitDMA(void)
+{
+    if (sLCD_DmaActive)
+    {
+        SPI4W_Wait_DMA();
+        SPI4W_Set_Frame16(0);
+        LCD_Deselect();
+        sLCD_DmaActive = 0;
+    }
+}
+
+/*******************************************************************************
+ function:	Select the transport of GRAM pixel data. Commands and
+            parameters always use 8-bit frames
+ parameter:
+ Mode    :   LCD_PIXELS_8BIT  : two byte frames per pixel
+             LCD_PIXELS_16BIT : one 16-bit frame per pixel, DMA capable
+ *******************************************************************************/
+void LCD_SetPixelMode(LCD_PIXEL_MODE Mode)
+{
+    LCD_WaitDMA();
+    sLCD_PixelMode = Mode;
+}
+
+/*******************************************************************************
+ function:	Forget the cached window, the next LCD_SetWindow() sends both
+            ranges (after a reset or a change of the scan direction)
+ *******************************************************************************/
+void LCD_InvalidateWindow(void)
+{
+    sLCD_Window.ColumnValid = 0;
+    sLCD_Window.PageValid   = 0;
+}
+
+/*******************************************************************************
+ function:	Window cache counters
+ parameter:
+ Stats   :   Filled with a copy of the counters
+ *******************************************************************************/
+void LCD_GetStats(LCD_Stats* Stats) { *Stats = sLCD_Stats; }
+
+void LCD_ResetStats(void)
+{
+    sLCD_Stats = (LCD_Stats){0};
 }
 
 /*******************************************************************************
@@ -252,7 +510,9 @@ void LCD_SetGramScanWay(LCD_SCAN_DIR Scan_dir)
         sLCD_DIS.LCD_Dis_Page   = LCD_HEIGHT;
     }
 
-    // Set the read / write scan direction of the frame memory
+    // Set the read / write scan direction of the frame memory, the window
+    // has to be sent again afterwards
+    LCD_InvalidateWindow();
     LCD_WriteReg(0xB6);
     LCD_WriteData(0X00);
     LCD_WriteData(DisFunReg_Data);
@@ -297,24 +557,119 @@ void LCD_Init(LCD_SCAN_DIR LCD_ScanDir, uint16_t LCD_BLval)
  Xend    :   X direction end coordinates
  Yend    :   Y direction end coordinates
  ********************************************************************************/
+static void LCD_AddressRange(POINT Xstart, POINT Ystart, POINT Xend,
+                             POINT Yend)
+{
+    ++sLCD_Stats.Windows;
+
+    // set the X coordinates, unless the column range is already set
+    if (!sLCD_Window.ColumnValid || sLCD_Window.Xstart != Xstart ||
+        sLCD_Window.Xend != Xend)
+    {
+        LCD_Command(0x2A);
+        LCD_Param(Xstart >> 8); // Set the horizontal starting point to the
+                                // high octet
+        LCD_Param(Xstart & 0xff); // Set the horizontal starting point to the
+                                  // low octet
+        LCD_Param((Xend - 1) >> 8);   // Set the horizontal end to the high octet
+        LCD_Param((Xend - 1) & 0xff); // Set the horizontal end to the low octet
+        sLCD_Window.Xstart      = Xstart;
+        sLCD_Window.Xend        = Xend;
+        sLCD_Window.ColumnValid = 1;
+    }
+    else
+    {
+        ++sLCD_Stats.CommandsSkipped;
+        sLCD_Stats.BytesSaved += LCD_WINDOW_CMD_BYTES;
+    }
+
+    // set the Y coordinates, unless the page range is already set
+    if (!sLCD_Window.PageValid || sLCD_Window.Ystart != Ystart ||
+        sLCD_Window.Yend != Yend)
+    {
+        LCD_Command(0x2B);
+        LCD_Param(Ystart >> 8);
+        LCD_Param(Ystart & 0xff);
+        LCD_Param((Yend - 1) >> 8);
+        LCD_Param((Yend - 1) & 0xff);
+        sLCD_Window.Ystart    = Ystart;
+        sLCD_Window.Yend      = Yend;
+        sLCD_Window.PageValid = 1;
+    }
+    else
+    {
+        ++sLCD_Stats.CommandsSkipped;
+        sLCD_Stats.BytesSaved += LCD_WINDOW_CMD_BYTES;
+    }
+}
+
+static void LCD_AddressWindow(POINT Xstart, POINT Ystart, POINT Xend,
+                              POINT Yend)
+{
+    LCD_AddressRange(Xstart, Ystart, Xend, Yend);
+    // Memory write always restarts at the window origin
+    LCD_Command(0x2C);
+}
+
 void LCD_SetWindow(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend)
 {
-    // set the X coordinates
-    LCD_WriteReg(0x2A);
-    LCD_WriteData(Xstart >>
-                  8); // Set the horizontal starting point to the high octet
-    LCD_WriteData(Xstart &
-                  0xff); // Set the horizontal starting point to the low octet
-    LCD_WriteData((Xend - 1) >> 8); // Set the horizontal end to the high octet
-    LCD_WriteData((Xend - 1) & 0xff); // Set the horizontal end to the low octet
+    LCD_WaitDMA();
+    LCD_Select();
+    LCD_AddressWindow(Xstart, Ystart, Xend, Yend);
+    LCD_Deselect();
+}
 
-    // set the Y coordinates
-    LCD_WriteReg(0x2B);
-    LCD_WriteData(Ystart >> 8);
-    LCD_WriteData(Ystart & 0xff);
-    LCD_WriteData((Yend - 1) >> 8);
-    LCD_WriteData((Yend - 1) & 0xff);
-    LCD_WriteReg(0x2C);
+/********************************************************************************
+ function:	Set the display area and stream its pixels in one sequence,
+            CS stays low from the first command to the last pixel
+ parameter:
+ Xstart 	:   X direction Start coordinates
+ Ystart  :   Y direction Start coordinates
+ Xend    :   X direction end coordinates
+ Yend    :   Y direction end coordinates
+ Pixels  :   (Xend - Xstart) * (Yend - Ystart) RGB565 pixels
+ ********************************************************************************/
+void LCD_WriteWindow(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend,
+                     const COLOR* Pixels)
+{
+    LCD_WaitDMA();
+    LCD_Select();
+    LCD_AddressWindow(Xstart, Ystart, Xend, Yend);
+    LCD_StreamPixels(Pixels, (uint32_t)(Xend - Xstart) * (Yend - Ystart));
+    LCD_Deselect();
+}
+
+/********************************************************************************
+ function:	LCD_WriteWindow() with the pixels sent by DMA, see
+            LCD_WritePixelsDMA()
+ ********************************************************************************/
+void LCD_WriteWindowDMA(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend,
+                        const COLOR* Pixels)
+{
+    LCD_WaitDMA();
+    LCD_Select();
+    LCD_AddressWindow(Xstart, Ystart, Xend, Yend);
+    LCD_StreamPixelsDMA(Pixels, (uint32_t)(Xend - Xstart) * (Yend - Ystart));
+}
+
+/********************************************************************************
+ function:	Fill the display area with one color by DMA, the transfer
+            runs on after the function returns (see LCD_WritePixelsDMA())
+ parameter:
+ Xstart 	:   X direction Start coordinates
+ Ystart  :   Y direction Start coordinates
+ Xend    :   X direction end coordinates
+ Yend    :   Y direction end coordinates
+ Color   :   Fill color, read by the DMA: must stay unchanged until the
+             transfer is done. At most 65535 pixels
+ ********************************************************************************/
+void LCD_FillWindowDMA(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend,
+                       const COLOR* Color)
+{
+    LCD_WaitDMA();
+    LCD_Select();
+    LCD_AddressWindow(Xstart, Ystart, Xend, Yend);
+    LCD_StreamColorDMA(Color, (uint32_t)(Xend - Xstart) * (Yend - Ystart));
 }
 
 /********************************************************************************
@@ -352,8 +707,7 @@ void LCD_SetPointlColor(POINT Xpoint, POINT Ypoint, COLOR Color)
     if ((Xpoint <= sLCD_DIS.LCD_Dis_Column) &&
         (Ypoint <= sLCD_DIS.LCD_Dis_Page))
     {
-        LCD_SetCursor(Xpoint, Ypoint);
-        LCD_SetColor(Color, 1, 1);
+        LCD_WriteWindow(Xpoint, Ypoint, Xpoint + 1, Ypoint + 1, &Color);
     }
 }
 
@@ -371,7 +725,9 @@ void LCD_SetArealColor(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend,
 {
     if ((Xend > Xstart) && (Yend > Ystart))
     {
-        LCD_SetWindow(Xstart, Ystart, Xend, Yend);
+        LCD_WaitDMA();
+        LCD_Select();
+        LCD_AddressWindow(Xstart, Ystart, Xend, Yend);
         LCD_SetColor(Color, Xend - Xstart, Yend - Ystart);
     }
 }
@@ -385,3 +741,189 @@ void LCD_Clear(COLOR Color)
     LCD_SetArealColor(0, 0, sLCD_DIS.LCD_Dis_Column, sLCD_DIS.LCD_Dis_Page,
                       Color);
 }
+
+#if LCD_GRAM_READ
+/// Serial read cycle of the ILI9486 is 150 ns at least: 52.5 MHz APB1 / 16
+/// is 3.28 MHz, 305 ns
+#define LCD_READ_PRESCALER SPI_BAUDRATEPRESCALER_16
+/// Pixels converted per SPI read
+#define LCD_READ_CHUNK 32U
+
+/*******************************************************************************
+ function:	Receive pixels of a memory read inside of a sequence (CS low,
+            dummy bytes already read)
+ return  :   0 on success
+ *******************************************************************************/
+static uint8_t LCD_ReceivePixels(COLOR* Pixels, uint32_t Count)
+{
+    uint8_t Raw[LCD_READ_CHUNK * LCD_GRAM_READ_BYTES];
+
+    while (Count)
+    {
+        uint32_t Chunk = Count > LCD_READ_CHUNK ? LCD_READ_CHUNK : Count;
+        if (SPI4W_Read_Bytes(Raw, (uint16_t)(Chunk * LCD_GRAM_READ_BYTES)))
+            return 1;
+        for (uint32_t i = 0; i < Chunk; i++)
+            Pixels[i] = LCD_GramToRgb565(&Raw[i * LCD_GRAM_READ_BYTES]);
+        Pixels += Chunk;
+        Count -= Chunk;
+    }
+    return 0;
+}
+#endif
+
+/********************************************************************************
+ function:	Read a window of GRAM (0x2E). Needs a board with the ILI9486
+            SDO on SPI2 MISO (LCD_GRAM_READ), the Waveshare shield shifts
+            SPI into the parallel bus and cannot be read
+ parameter:
+ Xstart 	:   X direction Start coordinates
+ Ystart  :   Y direction Start coordinates
+ Xend    :   X direction end coordinates
+ Yend    :   Y direction end coordinates
+ Pixels  :   Filled with (Xend - Xstart) * (Yend - Ystart) RGB565 pixels
+ return  :   0 on success, 1 on SPI error or without LCD_GRAM_READ
+ ********************************************************************************/
+uint8_t LCD_ReadWindow(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend,
+                       COLOR* Pixels)
+{
+#if LCD_GRAM_READ
+    uint8_t Dummy[LCD_GRAM_READ_DUMMY];
+    uint32_t Prescaler;
+    uint8_t Result;
+
+    if (Xend <= Xstart || Yend <= Ystart)
+        return 0;
+    LCD_WaitDMA();
+    LCD_Select();
+    LCD_AddressRange(Xstart, Ystart, Xend, Yend);
+    LCD_Command(0x2E);
+    LCD_DcData();
+    Prescaler = SPI4W_Set_Prescaler(LCD_READ_PRESCALER);
+    Result    = SPI4W_Read_Bytes(Dummy, LCD_GRAM_READ_DUMMY);
+    if (Result == 0)
+        Result = LCD_ReceivePixels(
+            Pixels, (uint32_t)(Xend - Xstart) * (Yend - Ystart));
+    SPI4W_Set_Prescaler(Prescaler);
+    // CS high ends the memory read
+    LCD_Deselect();
+    return Result;
+#else
+    (void)Xstart;
+    (void)Ystart;
+    (void)Xend;
+    (void)Yend;
+    (void)Pixels;
+    return 1;
+#endif
+}
+
+/********************************************************************************
+ function:	Read a region of GRAM row by row and hand every row to a sink,
+            no buffer of the whole region is needed
+ parameter:
+ Sink    :   Called for every row, non-zero stops the read
+ Context :   Passed to Sink
+ return  :   0 on success, 1 on read error or when Sink stopped
+ ********************************************************************************/
+uint8_t LCD_ReadRegion(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend,
+                       LCD_ReadSink Sink, void* Context)
+{
+    static COLOR sReadLine[LCD_X_MAXPIXEL];
+
+    if (Xend - Xstart > LCD_X_MAXPIXEL)
+        return 1;
+    for (POINT y = Ystart; y < Yend; y++)
+    {
+        if (LCD_ReadWindow(Xstart, y, Xend, y + 1, sReadLine) ||
+            Sink(Context, sReadLine, y, Xend - Xstart))
+            return 1;
+    }
+    return 0;
+}
+
+/********************************************************************************
+ function:	Compare the pixel transports over a full screen: fill with one
+            color and stream of an image line by line (8-bit frames,
+            16-bit frames, 16-bit frames by DMA). Prints the times over
+            UART and selects the 16-bit transport again
+ ********************************************************************************/
+void LCD_BenchmarkPixelModes(void)
+{
+    static const char* Name[3] = {"8-bit", "16-bit", "16-bit DMA"};
+    /// One gradient line, DTCM is reachable by the SPI DMA
+    DTCM_BSS static COLOR sBenchLine[LCD_X_MAXPIXEL];
+    POINT Width  = sLCD_DIS.LCD_Dis_Column;
+    POINT Height = sLCD_DIS.LCD_Dis_Page;
+    uint32_t Start, FillUs, StreamUs;
+
+    PERF_Init();
+    for (POINT x = 0; x < Width; x++)
+        sBenchLine[x] = (COLOR)(x * 0x0841U);
+
+    my_printf("LCD pixel transport, full screen [us] (fill / stream)\r\n");
+    for (uint32_t Mode = 0; Mode < 3; Mode++)
+    {
+        LCD_SetPixelMode(Mode == 0 ? LCD_PIXELS_8BIT : LCD_PIXELS_16BIT);
+
+        // Fills are not DMA'd, the third pass repeats the 16-bit fill
+        Start = PERF_Cycles();
+        LCD_Clear(Mode & 1 ? 0xFFFF : 0x0000);
+        FillUs = PERF_CyclesToUs(PERF_Cycles() - Start);
+
+        Start = PERF_Cycles();
+        for (POINT y = 0; y < Height; y++)
+        {
+            if (Mode == 2)
+                LCD_WriteWindowDMA(0, y, Width, y + 1, sBenchLine);
+            else
+                LCD_WriteWindow(0, y, Width, y + 1, sBenchLine);
+        }
+        LCD_WaitDMA();
+        StreamUs = PERF_CyclesToUs(PERF_Cycles() - Start);
+
+        my_printf("  %s: %lu / %lu\r\n", Name[Mode], FillUs, StreamUs);
+    }
+    LCD_SetPixelMode(LCD_PIXELS_16BIT);
+}
+
+/********************************************************************************
+ function:	Time a full screen GRAM read, line by line, and check that the
+            gradient written before comes back. Prints the result over UART
+ ********************************************************************************/
+void LCD_BenchmarkReadback(void)
+{
+    DTCM_BSS static COLOR sBenchLine[LCD_X_MAXPIXEL];
+    POINT Width  = sLCD_DIS.LCD_Dis_Column;
+    POINT Height = sLCD_DIS.LCD_Dis_Page;
+    uint32_t Start, ReadUs, Rate, Errors = 0;
+
+    if (LCD_ReadWindow(0, 0, 1, 1, sBenchLine))
+    {
+        my_printf("LCD readback: not available on this board\r\n");
+        return;
+    }
+
+    PERF_Init();
+    for (POINT x = 0; x < Width; x++)
+        sBenchLine[x] = (COLOR)(x * 0x0841U);
+    for (POINT y = 0; y < Height; y++)
+        LCD_WriteWindow(0, y, Width, y + 1, sBenchLine);
+
+    Start = PERF_Cycles();
+    for (POINT y = 0; y < Height; y++)
+    {
+        if (LCD_ReadWindow(0, y, Width, y + 1, sBenchLine))
+            Errors += Width;
+        else
+            for (POINT x = 0; x < Width; x++)
+                Errors += sBenchLine[x] != (COLOR)(x * 0x0841U);
+    }
+    ReadUs = PERF_CyclesToUs(PERF_Cycles() - Start);
+    // KB/s of RGB565 data, kept below 2^32
+    Rate = (uint32_t)Width * Height * 2U * 1000U / 1024U;
+    Rate = ReadUs ? Rate * 1000U / ReadUs : 0;
+
+    my_printf("LCD readback, full screen: %lu us, %lu KB/s, %lu errors\r\n",
+              ReadUs, Rate, Errors);
+}
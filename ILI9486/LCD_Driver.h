@@ -71,6 +71,41 @@ typedef struct
     POINT LCD_Y_Adjust; // LCD y actual display position calibration
 } LCD_DIS;
 
+/********************************************************************************
+function:
+        Transport of GRAM pixel data (see LCD_SetPixelMode())
+********************************************************************************/
+typedef enum {
+    LCD_PIXELS_8BIT = 0, // Two 8-bit SPI frames per pixel
+    LCD_PIXELS_16BIT,    // One 16-bit SPI frame per pixel, DMA capable
+} LCD_PIXEL_MODE;
+
+/********************************************************************************
+function:
+        Window cache counters (see LCD_GetStats())
+********************************************************************************/
+typedef struct
+{
+    uint32_t Windows;         // Windows set, LCD_SetWindow() and friends
+    uint32_t Commands;        // Command bytes sent
+    uint32_t CommandsSkipped; // 0x2A / 0x2B not sent, range unchanged
+    uint32_t BytesSaved;      // SPI bytes not sent thanks to the cache
+} LCD_Stats;
+
+/********************************************************************************
+function:
+        GRAM readback (see LCD_ReadWindow()). The Waveshare shield shifts SPI
+        into the controller's parallel bus and has no read path, set to 1 on
+        a board with the ILI9486 SDO wired to SPI2 MISO
+********************************************************************************/
+#ifndef LCD_GRAM_READ
+#define LCD_GRAM_READ 0
+#endif
+
+/// Receives one row of a GRAM read, non-zero stops the read
+typedef uint8_t (*LCD_ReadSink)(void* Context, const COLOR* Pixels,
+                                POINT Ypoint, LENGTH Width);
+
 /********************************************************************************
 function:
                         Macro definition variable name
@@ -80,15 +115,35 @@ void LCD_SetGramScanWay(LCD_SCAN_DIR Scan_dir);
 
 void LCD_WriteReg(uint8_t Reg);
 void LCD_WriteData(uint8_t Data);
+void LCD_WritePixels(const COLOR* Pixels, uint32_t Count);
+void LCD_WritePixelsDMA(const COLOR* Pixels, uint32_t Count);
+void LCD_WaitDMA(void);
+uint8_t LCD_DmaBusy(void);
+void LCD_SetPixelMode(LCD_PIXEL_MODE Mode);
+void LCD_InvalidateWindow(void);
+void LCD_GetStats(LCD_Stats* Stats);
+void LCD_ResetStats(void);
 
 void LCD_SetWindow(POINT Xstart, POINT Ystart, POINT Xend,
                    POINT Yend);
+void LCD_WriteWindow(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend,
+                     const COLOR* Pixels);
+void LCD_WriteWindowDMA(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend,
+                        const COLOR* Pixels);
+void LCD_FillWindowDMA(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend,
+                       const COLOR* Color);
 void LCD_SetCursor(POINT Xpoint, POINT Ypoint);
 void LCD_SetColor(COLOR Color, POINT Xpoint, POINT Ypoint);
 void LCD_SetPointlColor(POINT Xpoint, POINT Ypoint, COLOR Color);
 void LCD_SetArealColor(POINT Xstart, POINT Ystart, POINT Xend,
                        POINT Yend, COLOR Color);
 void LCD_Clear(COLOR Color);
+uint8_t LCD_ReadWindow(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend,
+                       COLOR* Pixels);
+uint8_t LCD_ReadRegion(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend,
+                       LCD_ReadSink Sink, void* Context);
+void LCD_BenchmarkPixelModes(void);
+void LCD_BenchmarkReadback(void);
 
 #ifdef __cplusplus
 }
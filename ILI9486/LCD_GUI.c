@@ -15,6 +15,27 @@
  ******************************************************************************/
 #include "LCD_GUI.h"
 #include "Debug.h"
+#include "LCD_Gram.h"
+#include "gfx.h"
+#include "glyph_cache.h"
+#include "image_kernels.h"
+#include "image_stats.h"
+
+/// Opaque glyph of a run-length encoded font (DTCM, see GUI_DisCharRle())
+DTCM_BSS static COLOR sRleCell[MAX_WIDTH_FONT * MAX_HEIGHT_FONT];
+/// Anti-aliased glyphs, one is filled while the other is sent by DMA (see
+/// GUI_DisCharAa())
+DTCM_BSS static COLOR sAaCell[2][MAX_WIDTH_FONT * MAX_HEIGHT_FONT];
+static uint8_t sAaBank;
+/// Blend table of the last (foreground, background) pair
+static COLOR sAaLut[16];
+static COLOR sAaLutFg, sAaLutBg;
+static uint8_t sAaLutValid;
+/// One converted image line (DTCM, see GUI_DrawRGB888(), GUI_DrawYUV422())
+DTCM_BSS static COLOR sLineBuffer[LCD_X_MAXPIXEL];
+/// JPEG decoder working memory, its MCU banks are read by the SPI DMA
+/// straight from DTCM (see GUI_DrawJpeg())
+DTCM_BSS static JPEG_Decoder sJpegDecoder;
 
 extern LCD_DIS sLCD_DIS;
 /******************************************************************************
@@ -297,6 +318,298 @@ void GUI_DrawCircle(POINT X_Center, POINT Y_Center, LENGTH Radius, COLOR Color,
     }
 }
 
+/******************************************************************************
+ function:	Run-length encoded copy of a font, NULL if there is none
+ ******************************************************************************/
+static const sFONT_RLE* GUI_RleFont(const sFONT* Font)
+{
+    if (Font == &Font24)
+        return &Font24Rle;
+    if (Font == &Font20)
+        return &Font20Rle;
+    if (Font == &Font16)
+        return &Font16Rle;
+    if (Font == &Font12)
+        return &Font12Rle;
+    if (Font == &Font8)
+        return &Font8Rle;
+    return NULL;
+}
+
+/// Receives one horizontal span of ink, coordinates in the character cell
+typedef void (*GUI_SpanFn)(void* Ctx, POINT X, POINT Y, LENGTH Length);
+
+/******************************************************************************
+ function:	Decode the runs of a glyph into horizontal spans of ink. Ink
+            runs continuing on the next row are split, adjacent runs of
+            one row are merged
+ parameter:
+ Font        :   Run-length encoded font
+ Acsii_Char  :   Character, FONT_RLE_FIRST ... FONT_RLE_FIRST + 94
+ Span        :   Called for every span
+ Ctx         :   Passed to Span
+ ******************************************************************************/
+static void GUI_RleSpans(const sFONT_RLE* Font, char Acsii_Char,
+                         GUI_SpanFn Span, void* Ctx)
+{
+    const sGLYPH_RLE* Glyph = &Font->glyphs[Acsii_Char - FONT_RLE_FIRST];
+    const uint8_t* Run      = &Font->runs[Glyph[0].Offset];
+    const uint8_t* End      = &Font->runs[Glyph[1].Offset];
+    uint32_t Column = 0, Row = 0;
+    uint32_t SpanX = 0, SpanY = 0, SpanLength = 0;
+
+    for (; Run < End; Run++)
+    {
+        uint32_t Ink = *Run & 0x0F;
+
+        Column += *Run >> 4;
+        while (Column >= Glyph->Width)
+        {
+            Column -= Glyph->Width;
+            Row++;
+        }
+        while (Ink != 0)
+        {
+            uint32_t Length = Glyph->Width - Column;
+            if (Length > Ink)
+                Length = Ink;
+
+            if (SpanLength != 0 && SpanY == Row &&
+                SpanX + SpanLength == Column)
+            {
+                SpanLength += Length;
+            }
+            else
+            {
+                if (SpanLength != 0)
+                    Span(Ctx, Glyph->X + SpanX, Glyph->Y + SpanY, SpanLength);
+                SpanX      = Column;
+                SpanY      = Row;
+                SpanLength = Length;
+            }
+
+            Ink -= Length;
+            Column += Length;
+            if (Column == Glyph->Width)
+            {
+                Column = 0;
+                Row++;
+            }
+        }
+    }
+    if (SpanLength != 0)
+        Span(Ctx, Glyph->X + SpanX, Glyph->Y + SpanY, SpanLength);
+}
+
+/// Target of GUI_SpanToLcd() / GUI_SpanToCell()
+typedef struct
+{
+    POINT X; // Cell position on the display
+    POINT Y;
+    COLOR Color;
+    COLOR* Cell; // Font->Width * Font->Height pixels
+    LENGTH Width;
+} GUI_SpanTarget;
+
+static void GUI_SpanToLcd(void* Ctx, POINT X, POINT Y, LENGTH Length)
+{
+    const GUI_SpanTarget* Target = Ctx;
+    POINT Xstart = Target->X + X;
+    POINT Xend   = Xstart + Length;
+
+    if (Target->Y + Y >= sLCD_DIS.LCD_Dis_Page ||
+        Xstart >= sLCD_DIS.LCD_Dis_Column)
+        return;
+    if (Xend > sLCD_DIS.LCD_Dis_Column)
+        Xend = sLCD_DIS.LCD_Dis_Column;
+    LCD_SetArealColor(Xstart, Target->Y + Y, Xend, Target->Y + Y + 1,
+                      Target->Color);
+}
+
+static void GUI_SpanToCell(void* Ctx, POINT X, POINT Y, LENGTH Length)
+{
+    const GUI_SpanTarget* Target = Ctx;
+    COLOR* Pixel                 = &Target->Cell[Y * Target->Width + X];
+
+    while (Length--)
+        *Pixel++ = Target->Color;
+}
+
+/******************************************************************************
+ function:	Show English characters of a run-length encoded font. The
+            work is proportional to the ink of the glyph: a transparent
+            glyph is drawn as one window per span, an opaque glyph is
+            composed in a cell buffer and sent in one window
+ parameter:
+ Xpoint           :   X coordinate
+ Ypoint           :   Y coordinate
+ Acsii_Char       :   To display the English characters
+ Font             :   Run-length encoded font (fonts_rle.c)
+ Color_Background :   FONT_BACKGROUND for a transparent background
+ Color_Foreground :   Ink color
+ ******************************************************************************/
+void GUI_DisCharRle(POINT Xpoint, POINT Ypoint, const char Acsii_Char,
+                    const sFONT_RLE* Font, COLOR Color_Background,
+                    COLOR Color_Foreground)
+{
+    GUI_SpanTarget Target = {Xpoint, Ypoint, Color_Foreground, sRleCell,
+                             Font->Width};
+
+    if (Xpoint >= sLCD_DIS.LCD_Dis_Column || Ypoint >= sLCD_DIS.LCD_Dis_Page ||
+        Acsii_Char < FONT_RLE_FIRST ||
+        Acsii_Char >= FONT_RLE_FIRST + (char)FONT_RLE_GLYPHS)
+        return;
+
+    if (FONT_BACKGROUND == Color_Background)
+    {
+        GUI_RleSpans(Font, Acsii_Char, GUI_SpanToLcd, &Target);
+        return;
+    }
+
+    if (Xpoint + Font->Width <= sLCD_DIS.LCD_Dis_Column &&
+        Ypoint + Font->Height <= sLCD_DIS.LCD_Dis_Page &&
+        Font->Width <= MAX_WIDTH_FONT && Font->Height <= MAX_HEIGHT_FONT)
+    {
+        LCD_WaitDMA(); // sRleCell may still be sent
+        for (uint32_t i = 0; i < (uint32_t)Font->Width * Font->Height; i++)
+            sRleCell[i] = Color_Background;
+        GUI_RleSpans(Font, Acsii_Char, GUI_SpanToCell, &Target);
+        LCD_WriteWindow(Xpoint, Ypoint, Xpoint + Font->Width,
+                        Ypoint + Font->Height, sRleCell);
+        return;
+    }
+
+    // Clipped opaque glyph: background first, then the ink on top
+    POINT Xend = Xpoint + Font->Width;
+    POINT Yend = Ypoint + Font->Height;
+    if (Xend > sLCD_DIS.LCD_Dis_Column)
+        Xend = sLCD_DIS.LCD_Dis_Column;
+    if (Yend > sLCD_DIS.LCD_Dis_Page)
+        Yend = sLCD_DIS.LCD_Dis_Page;
+    LCD_SetArealColor(Xpoint, Ypoint, Xend, Yend, Color_Background);
+    GUI_RleSpans(Font, Acsii_Char, GUI_SpanToLcd, &Target);
+}
+
+/******************************************************************************
+ function:	Fill sAaLut with the 16 coverage levels blended from the
+            background to the foreground color, per RGB565 channel. Only
+            done when the pair of colors changes
+ ******************************************************************************/
+static void GUI_AaBlendLut(COLOR Color_Background, COLOR Color_Foreground)
+{
+    if (sAaLutValid && sAaLutFg == Color_Foreground &&
+        sAaLutBg == Color_Background)
+        return;
+
+    uint32_t BgR = Color_Background >> 11, FgR = Color_Foreground >> 11;
+    uint32_t BgG = (Color_Background >> 5) & 0x3F;
+    uint32_t FgG = (Color_Foreground >> 5) & 0x3F;
+    uint32_t BgB = Color_Background & 0x1F, FgB = Color_Foreground & 0x1F;
+
+    for (uint32_t Alpha = 0; Alpha < 16; Alpha++)
+    {
+        // Rounded to nearest, exact at both ends
+        uint32_t R = (BgR * (15 - Alpha) + FgR * Alpha + 7) / 15;
+        uint32_t G = (BgG * (15 - Alpha) + FgG * Alpha + 7) / 15;
+        uint32_t B = (BgB * (15 - Alpha) + FgB * Alpha + 7) / 15;
+        sAaLut[Alpha] = (COLOR)((R << 11) | (G << 5) | B);
+    }
+    sAaLutFg    = Color_Foreground;
+    sAaLutBg    = Color_Background;
+    sAaLutValid = 1;
+}
+
+/******************************************************************************
+ function:	Show English characters of an anti-aliased 4-bpp font. The
+            glyph is blended against the background color through a 16
+            entry table and sent in one window by DMA while the next
+            glyph is expanded into the other cell buffer
+ parameter:
+ Xpoint           :   X coordinate
+ Ypoint           :   Y coordinate
+ Acsii_Char       :   To display the English characters
+ Font             :   Anti-aliased font (fonts_aa.c)
+ Color_Background :   Background the edges are blended against
+ Color_Foreground :   Ink color
+ ******************************************************************************/
+void GUI_DisCharAa(POINT Xpoint, POINT Ypoint, const char Acsii_Char,
+                   const sFONT_AA* Font, COLOR Color_Background,
+                   COLOR Color_Foreground)
+{
+    if (Xpoint >= sLCD_DIS.LCD_Dis_Column || Ypoint >= sLCD_DIS.LCD_Dis_Page ||
+        Acsii_Char < FONT_AA_FIRST ||
+        Acsii_Char >= FONT_AA_FIRST + (char)FONT_AA_GLYPHS ||
+        Font->Width > MAX_WIDTH_FONT || Font->Height > MAX_HEIGHT_FONT)
+        return;
+
+    uint32_t Row_Bytes = (Font->Width + 1) / 2;
+    const uint8_t* Alpha =
+        &Font->table[(Acsii_Char - FONT_AA_FIRST) * Font->Height * Row_Bytes];
+    COLOR* Cell = sAaCell[sAaBank];
+
+    GUI_AaBlendLut(Color_Background, Color_Foreground);
+    IMG_ExpandGlyphAA(Alpha, Font->Width, Font->Height, sAaLut, Cell);
+
+    if (Xpoint + Font->Width <= sLCD_DIS.LCD_Dis_Column &&
+        Ypoint + Font->Height <= sLCD_DIS.LCD_Dis_Page)
+    {
+        // Starting this transfer waits for the one of the other bank
+        LCD_WriteWindowDMA(Xpoint, Ypoint, Xpoint + Font->Width,
+                           Ypoint + Font->Height, Cell);
+        sAaBank ^= 1;
+        return;
+    }
+
+    // Clipped glyph: the visible part of every row
+    POINT Xend = Xpoint + Font->Width;
+    if (Xend > sLCD_DIS.LCD_Dis_Column)
+        Xend = sLCD_DIS.LCD_Dis_Column;
+    for (POINT Row = 0;
+         Row < Font->Height && Ypoint + Row < sLCD_DIS.LCD_Dis_Page; Row++)
+        LCD_WriteWindow(Xpoint, Ypoint + Row, Xend, Ypoint + Row + 1,
+                        &Cell[Row * Font->Width]);
+}
+
+/******************************************************************************
+ function:	Display a string of an anti-aliased font, wrapped like
+            GUI_DisString_EN()
+ parameter:
+ Xstart           :   X coordinate
+ Ystart           :   Y coordinate
+ pString          :   The first address of the English string
+ Font             :   Anti-aliased font (fonts_aa.c)
+ Color_Background :   Background the edges are blended against
+ Color_Foreground :   Ink color
+ ******************************************************************************/
+void GUI_DisStringAa_EN(POINT Xstart, POINT Ystart, const char* pString,
+                        const sFONT_AA* Font, COLOR Color_Background,
+                        COLOR Color_Foreground)
+{
+    POINT Xpoint = Xstart;
+    POINT Ypoint = Ystart;
+
+    if (Xstart > sLCD_DIS.LCD_Dis_Column || Ystart > sLCD_DIS.LCD_Dis_Page)
+        return;
+
+    while (*pString != '\0')
+    {
+        if ((Xpoint + Font->Width) > sLCD_DIS.LCD_Dis_Column)
+        {
+            Xpoint = Xstart;
+            Ypoint += Font->Height;
+        }
+        if ((Ypoint + Font->Height) > sLCD_DIS.LCD_Dis_Page)
+        {
+            Xpoint = Xstart;
+            Ypoint = Ystart;
+        }
+        GUI_DisCharAa(Xpoint, Ypoint, *pString, Font, Color_Background,
+                      Color_Foreground);
+        pString++;
+        Xpoint += Font->Width;
+    }
+}
+
 /******************************************************************************
  function:	Show English characters
  parameter:
@@ -324,6 +637,33 @@ void GUI_DisChar(POINT Xpoint, POINT Ypoint, const char Acsii_Char, sFONT* Font,
                            (Font->Width / 8 + (Font->Width % 8 ? 1 : 0));
     const unsigned char* ptr = &Font->table[Char_Offset];
 
+    // Transparent glyph: draw only its ink, span by span, from the
+    // run-length encoded copy of the font
+    const sFONT_RLE* Rle = GUI_RleFont(Font);
+    if (FONT_BACKGROUND == Color_Background && Rle != NULL)
+    {
+        GUI_DisCharRle(Xpoint, Ypoint, Acsii_Char, Rle, Color_Background,
+                       Color_Foreground);
+        return;
+    }
+
+    // Opaque glyph fully on screen: take the expanded block from the glyph
+    // cache and send it in one window by DMA. The cache keeps the block
+    // intact while the transfer runs, the next LCD access waits for it
+    if (FONT_BACKGROUND != Color_Background &&
+        Xpoint + Font->Width <= sLCD_DIS.LCD_Dis_Column &&
+        Ypoint + Font->Height <= sLCD_DIS.LCD_Dis_Page)
+    {
+        const COLOR* Glyph = GLYPH_Lookup(Font, Acsii_Char, Color_Foreground,
+                                          Color_Background);
+        if (Glyph != NULL)
+        {
+            LCD_WriteWindowDMA(Xpoint, Ypoint, Xpoint + Font->Width,
+                               Ypoint + Font->Height, Glyph);
+            return;
+        }
+    }
+
     for (Page = 0; Page < Font->Height; Page++)
     {
         for (Column = 0; Column < Font->Width; Column++)
@@ -856,41 +1196,359 @@ void GUI_DisStringInBox(POINT Xbegin, POINT Ybegin, POINT Xend, POINT Yend,
 }
 
 /******************************************************************************
- function:	Draw image
+ function:	Draw RGB888 image
  parameter:
  xPoint		:   The x coordinate of the starting point
  yPoint		:   The y coordinate of the starting point
- image_data	:   Image data
+ width		:   Image width in pixels
+ height		:   Image height in pixels
+ image_data	:   Image data, 3 bytes (R, G, B) per pixel, rows one after
+                 another
  ******************************************************************************/
-void GUI_DrawImage(POINT xPoint, POINT yPoint, const unsigned char* image_data,
-                   int data_size)
+void GUI_DrawRGB888(POINT xPoint, POINT yPoint, LENGTH width, LENGTH height,
+                    const unsigned char* image_data)
 {
     // Wrong arguments
-    if (xPoint > sLCD_DIS.LCD_Dis_Column || yPoint > sLCD_DIS.LCD_Dis_Page)
+    if (xPoint >= sLCD_DIS.LCD_Dis_Column || yPoint >= sLCD_DIS.LCD_Dis_Page)
     {
         return;
     }
 
     // Draw as much as you can place on the display
-    uint16_t xDirNum, yDirNum;
-    for (yDirNum = 0; yDirNum < sLCD_DIS.LCD_Dis_Page; ++yDirNum)
+    LENGTH xDirNum = width;
+    LENGTH yDirNum = height;
+    if (xDirNum > sLCD_DIS.LCD_Dis_Column - xPoint)
+        xDirNum = sLCD_DIS.LCD_Dis_Column - xPoint;
+    if (yDirNum > sLCD_DIS.LCD_Dis_Page - yPoint)
+        yDirNum = sLCD_DIS.LCD_Dis_Page - yPoint;
+    if (xDirNum == 0 || yDirNum == 0)
+        return;
+
+    // Lines are converted to RGB565 one by one (GFX backend, DMA2D when
+    // selected) and streamed into a single window covering the visible part
+    // of the image
+    GFX_Canvas line = {sLineBuffer, xDirNum, 1, xDirNum};
+    LCD_SetWindow(xPoint, yPoint, xPoint + xDirNum, yPoint + yDirNum);
+    for (LENGTH row = 0; row < yDirNum; ++row)
+    {
+        GFX_ConvertRGB888(&line, 0, 0, &image_data[(uint32_t)row * width * 3],
+                          width, xDirNum, 1);
+        LCD_WritePixels(sLineBuffer, xDirNum);
+    }
+}
+
+/******************************************************************************
+ function:	Draw YUV422 image (camera raw output)
+ parameter:
+ xPoint		:   The x coordinate of the starting point
+ yPoint		:   The y coordinate of the starting point
+ width		:   Image width in pixels, even
+ height		:   Image height in pixels
+ image_data	:   Image data, 4 bytes (Y0, U, Y1, V) per pixel pair, rows one
+                 after another
+ ******************************************************************************/
+void GUI_DrawYUV422(POINT xPoint, POINT yPoint, LENGTH width, LENGTH height,
+                    const uint8_t* image_data)
+{
+    if (xPoint >= sLCD_DIS.LCD_Dis_Column || yPoint >= sLCD_DIS.LCD_Dis_Page)
+        return;
+
+    LENGTH xDirNum = width;
+    LENGTH yDirNum = height;
+    if (xDirNum > sLCD_DIS.LCD_Dis_Column - xPoint)
+        xDirNum = sLCD_DIS.LCD_Dis_Column - xPoint;
+    if (yDirNum > sLCD_DIS.LCD_Dis_Page - yPoint)
+        yDirNum = sLCD_DIS.LCD_Dis_Page - yPoint;
+    if (xDirNum == 0 || yDirNum == 0)
+        return;
+
+    GFX_Canvas line = {sLineBuffer, xDirNum, 1, xDirNum};
+    LCD_SetWindow(xPoint, yPoint, xPoint + xDirNum, yPoint + yDirNum);
+    for (LENGTH row = 0; row < yDirNum; ++row)
+    {
+        GFX_ConvertYUV422(&line, 0, 0, &image_data[(uint32_t)row * width * 2],
+                          width, xDirNum, 1);
+        LCD_WritePixels(sLineBuffer, xDirNum);
+    }
+}
+
+/******************************************************************************
+ function:	Bar heights of a luma histogram, scaled to the highest bar
+ parameter:
+ width		:   Number of bars, 1 to STATS_BINS, bins are merged evenly
+ height		:   Height of the highest bar
+ histogram	:   STATS_BINS bins (see image_stats.h)
+ bars		:   Output, width heights
+ ******************************************************************************/
+static void GUI_HistogramBars(LENGTH width, LENGTH height,
+                              const uint32_t* histogram, LENGTH* bars)
+{
+    uint32_t max = 1;
+
+    // Bins of a column are summed twice: for the highest bar, then scaled
+    for (int pass = 0; pass < 2; ++pass)
     {
-        for (xDirNum = 0; xDirNum < sLCD_DIS.LCD_Dis_Column; ++xDirNum)
+        for (LENGTH col = 0; col < width; ++col)
         {
-            if (data_size < xDirNum * yDirNum * 3 + 2)
-                return;
-
-            // Conversion to RGB565
-            int8_t r = image_data[xDirNum * yDirNum * 3];
-            int8_t g = image_data[xDirNum * yDirNum * 3 + 1];
-            int8_t b = image_data[xDirNum * yDirNum * 3 + 2];
-            COLOR color =
-                ((r & 0b11111000) << 8) | ((g & 0b11111100) << 3) | (b >> 3);
-            LCD_SetPointlColor(xPoint + xDirNum, yPoint + yDirNum, color);
+            uint32_t sum = 0;
+            for (uint32_t bin = (uint32_t)col * STATS_BINS / width;
+                 bin < ((uint32_t)col + 1U) * STATS_BINS / width; ++bin)
+                sum += histogram[bin];
+            if (pass == 0 && sum > max)
+                max = sum;
+            else if (pass == 1)
+                bars[col] = (LENGTH)((uint64_t)sum * height / max);
         }
     }
 }
 
+/******************************************************************************
+ function:	One row of a histogram, see GUI_HistogramBars()
+ parameter:
+ bars		:   Bar heights of width bars
+ width		:   Number of bars
+ count		:   Number of pixels to write, at most width
+ level		:   Bars at least this high are drawn in the row
+ Color_Background	:   Background color
+ Color_Foreground	:   Bar color
+ row		:   Output, count pixels
+ ******************************************************************************/
+static void GUI_HistogramRow(const LENGTH* bars, LENGTH width, LENGTH count,
+                             LENGTH level, COLOR Color_Background,
+                             COLOR Color_Foreground, COLOR* row)
+{
+    for (LENGTH col = 0; col < count; ++col)
+    {
+        uint32_t first = (uint32_t)col * STATS_BINS / width;
+        uint32_t last  = ((uint32_t)col + 1U) * STATS_BINS / width;
+        COLOR bar      = first <= STATS_UNDER_LUMA || last > STATS_OVER_LUMA
+                             ? RED
+                             : Color_Foreground;
+
+        row[col] = bars[col] >= level ? bar : Color_Background;
+    }
+}
+
+/******************************************************************************
+ function:	Draw a luma histogram, one bar per column scaled to the highest
+            one. Bins of the under and over exposed ends are drawn in red.
+            Used as an overlay on the camera image.
+ parameter:
+ xPoint		:   The x coordinate of the starting point
+ yPoint		:   The y coordinate of the starting point
+ width		:   Width in pixels, at most STATS_BINS, bins are merged evenly
+ height		:   Height in pixels
+ histogram	:   STATS_BINS bins (see image_stats.h)
+ Color_Background	:   Background color
+ Color_Foreground	:   Bar color
+ ******************************************************************************/
+void GUI_DrawHistogram(POINT xPoint, POINT yPoint, LENGTH width, LENGTH height,
+                       const uint32_t* histogram, COLOR Color_Background,
+                       COLOR Color_Foreground)
+{
+    LENGTH bars[STATS_BINS];
+
+    if (width > STATS_BINS)
+        width = STATS_BINS;
+    if (xPoint >= sLCD_DIS.LCD_Dis_Column || yPoint >= sLCD_DIS.LCD_Dis_Page ||
+        width == 0 || height == 0)
+        return;
+
+    LENGTH xDirNum = width;
+    LENGTH yDirNum = height;
+    if (xDirNum > sLCD_DIS.LCD_Dis_Column - xPoint)
+        xDirNum = sLCD_DIS.LCD_Dis_Column - xPoint;
+    if (yDirNum > sLCD_DIS.LCD_Dis_Page - yPoint)
+        yDirNum = sLCD_DIS.LCD_Dis_Page - yPoint;
+
+    GUI_HistogramBars(width, height, histogram, bars);
+    LCD_SetWindow(xPoint, yPoint, xPoint + xDirNum, yPoint + yDirNum);
+    for (LENGTH row = 0; row < yDirNum; ++row)
+    {
+        GUI_HistogramRow(bars, width, xDirNum, height - row, Color_Background,
+                         Color_Foreground, sLineBuffer);
+        LCD_WritePixels(sLineBuffer, xDirNum);
+    }
+}
+
+/******************************************************************************
+ function:	Render a luma histogram (see GUI_DrawHistogram()) into memory,
+            for GUI_QueueBlit()
+ parameter:
+ width		:   Width in pixels, at most STATS_BINS
+ height		:   Height in pixels
+ histogram	:   STATS_BINS bins (see image_stats.h)
+ Color_Background	:   Background color
+ Color_Foreground	:   Bar color
+ pixels		:   Output, width * height pixels
+ ******************************************************************************/
+void GUI_RenderHistogram(LENGTH width, LENGTH height, const uint32_t* histogram,
+                         COLOR Color_Background, COLOR Color_Foreground,
+                         COLOR* pixels)
+{
+    LENGTH bars[STATS_BINS];
+
+    if (width > STATS_BINS || width == 0 || height == 0)
+        return;
+
+    GUI_HistogramBars(width, height, histogram, bars);
+    for (LENGTH row = 0; row < height; ++row)
+        GUI_HistogramRow(bars, width, width, height - row, Color_Background,
+                         Color_Foreground, &pixels[(uint32_t)row * width]);
+}
+
+/******************************************************************************
+ function:	Draw RGB565 image
+ parameter:
+ xPoint		:   The x coordinate of the starting point
+ yPoint		:   The y coordinate of the starting point
+ width		:   Image width in pixels
+ height		:   Image height in pixels
+ image_data	:   Image data, rows one after another
+ ******************************************************************************/
+void GUI_DrawRGB565(POINT xPoint, POINT yPoint, LENGTH width, LENGTH height,
+                    const COLOR* image_data)
+{
+    // Wrong arguments
+    if (xPoint >= sLCD_DIS.LCD_Dis_Column || yPoint >= sLCD_DIS.LCD_Dis_Page)
+    {
+        return;
+    }
+
+    // Draw as much as you can place on the display
+    LENGTH xDirNum = width;
+    LENGTH yDirNum = height;
+    if (xDirNum > sLCD_DIS.LCD_Dis_Column - xPoint)
+        xDirNum = sLCD_DIS.LCD_Dis_Column - xPoint;
+    if (yDirNum > sLCD_DIS.LCD_Dis_Page - yPoint)
+        yDirNum = sLCD_DIS.LCD_Dis_Page - yPoint;
+    if (xDirNum == 0 || yDirNum == 0)
+        return;
+
+    if (xDirNum == width)
+    {
+        // No clipping, the whole image is one stream
+        LCD_WriteWindow(xPoint, yPoint, xPoint + xDirNum, yPoint + yDirNum,
+                        image_data);
+        return;
+    }
+    LCD_SetWindow(xPoint, yPoint, xPoint + xDirNum, yPoint + yDirNum);
+    for (LENGTH line = 0; line < yDirNum; ++line)
+        LCD_WritePixels(&image_data[(uint32_t)line * width], xDirNum);
+}
+
+/******************************************************************************
+ function:	Draw image
+ parameter:
+ xPoint		:   The x coordinate of the starting point
+ yPoint		:   The y coordinate of the starting point
+ image_data	:   RGB888 image data, rows as wide as the display
+ data_size	:   Number of bytes in image_data
+ ******************************************************************************/
+void GUI_DrawImage(POINT xPoint, POINT yPoint, const unsigned char* image_data,
+                   int data_size)
+{
+    LENGTH width = sLCD_DIS.LCD_Dis_Column;
+
+    if (data_size <= 0)
+        return;
+    GUI_DrawRGB888(xPoint, yPoint, width, (LENGTH)(data_size / (width * 3)),
+                   image_data);
+}
+
+/// Placement of a decoded JPEG image on the display
+typedef struct
+{
+    POINT xPoint;
+    POINT yPoint;
+} GUI_JpegTarget;
+
+/// JPEG_BlockSink: sends one MCU to its window with the SPI DMA
+static int GUI_JpegBlock(void* context, const uint16_t* pixels, uint16_t x,
+                         uint16_t y, uint16_t width, uint16_t height)
+{
+    const GUI_JpegTarget* t = context;
+    uint32_t xStart         = (uint32_t)t->xPoint + x;
+    uint32_t yStart         = (uint32_t)t->yPoint + y;
+
+    // MCUs crossing the right edge are skipped, rows must stay contiguous
+    if (xStart + width > sLCD_DIS.LCD_Dis_Column ||
+        yStart >= sLCD_DIS.LCD_Dis_Page)
+        return 0;
+    if (yStart + height > sLCD_DIS.LCD_Dis_Page)
+        height = (uint16_t)(sLCD_DIS.LCD_Dis_Page - yStart);
+
+    // Waits for the previous MCU, the decoder already filled the other bank.
+    // MCUs of one row share the page range, only 0x2A is sent
+    LCD_WriteWindowDMA((POINT)xStart, (POINT)yStart, (POINT)(xStart + width),
+                       (POINT)(yStart + height), pixels);
+    return 0;
+}
+
+/******************************************************************************
+ function:	Decode a baseline JPEG image and draw it MCU by MCU. Decoding
+            of the next MCU overlaps the SPI DMA transfer of the previous
+            one. Parts outside of the display are not drawn.
+ parameter:
+ xPoint		:   The x coordinate of the starting point
+ yPoint		:   The y coordinate of the starting point
+ jpeg_data	:   Compressed image (SOI ... EOI)
+ data_size	:   Number of bytes in jpeg_data
+ ******************************************************************************/
+JPEG_Status GUI_DrawJpeg(POINT xPoint, POINT yPoint, const uint8_t* jpeg_data,
+                         uint32_t data_size)
+{
+    GUI_JpegTarget target = {xPoint, yPoint};
+    JPEG_Status status;
+
+    // 16-bit SPI frames take the pixels in native byte order
+    JPEG_Init(&sJpegDecoder, 0);
+    status = JPEG_Decode(&sJpegDecoder, jpeg_data, data_size, GUI_JpegBlock,
+                         &target);
+    LCD_WaitDMA();
+    return status;
+}
+
+/// LCD_ReadSink: sends one row read from GRAM over UART
+static uint8_t GUI_ShotRow(void* Context, const COLOR* Pixels, POINT Ypoint,
+                           LENGTH Width)
+{
+    (void)Ypoint;
+    // RGB565 little endian is the native layout of the row
+    return HAL_UART_Transmit((UART_HandleTypeDef*)Context,
+                             (uint8_t*)Pixels, Width * 2U, 1000) != HAL_OK;
+}
+
+/******************************************************************************
+ function:	Read a region back from GRAM and send it over UART, row by row
+            (format in LCD_Gram.h, Tools/lcd_readback converts it to PPM)
+ parameter:
+ Xstart		:   X direction Start coordinates
+ Ystart		:   Y direction Start coordinates
+ Xend		:   X direction end coordinates
+ Yend		:   Y direction end coordinates
+ Uart		:   UART to send on, blocking
+ return		:   0 on success, 1 when GRAM cannot be read or on UART error
+ ******************************************************************************/
+uint8_t GUI_Screenshot(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend,
+                       UART_HandleTypeDef* Uart)
+{
+    uint8_t Header[LCD_SHOT_HEADER_BYTES] = LCD_SHOT_MAGIC;
+    COLOR Probe;
+
+    // Nothing is sent when the board cannot read GRAM
+    if (Xend <= Xstart || Yend <= Ystart ||
+        LCD_ReadWindow(Xstart, Ystart, Xstart + 1, Ystart + 1, &Probe))
+        return 1;
+    Header[4] = (uint8_t)(Xend - Xstart);
+    Header[5] = (uint8_t)((Xend - Xstart) >> 8);
+    Header[6] = (uint8_t)(Yend - Ystart);
+    Header[7] = (uint8_t)((Yend - Ystart) >> 8);
+    if (HAL_UART_Transmit(Uart, Header, sizeof(Header), 1000) != HAL_OK)
+        return 1;
+    return LCD_ReadRegion(Xstart, Ystart, Xend, Yend, GUI_ShotRow, Uart);
+}
+
 /******************************************************************************
  function:	Display new or refresh once used GUI_TextBox
  parameter:
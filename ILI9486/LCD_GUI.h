@@ -141,6 +141,15 @@ void GUI_DisChar(POINT Xstart, POINT Ystart, const char Acsii_Char, sFONT* Font,
 void GUI_DisString_EN(POINT Xstart, POINT Ystart, const char* pString,
                       sFONT* Font, COLOR Color_Background,
                       COLOR Color_Foreground);
+void GUI_DisCharRle(POINT Xpoint, POINT Ypoint, const char Acsii_Char,
+                    const sFONT_RLE* Font, COLOR Color_Background,
+                    COLOR Color_Foreground);
+void GUI_DisCharAa(POINT Xpoint, POINT Ypoint, const char Acsii_Char,
+                   const sFONT_AA* Font, COLOR Color_Background,
+                   COLOR Color_Foreground);
+void GUI_DisStringAa_EN(POINT Xstart, POINT Ystart, const char* pString,
+                        const sFONT_AA* Font, COLOR Color_Background,
+                        COLOR Color_Foreground);
 void GUI_DisNum(POINT Xpoint, POINT Ypoint, int32_t Nummber, sFONT* Font,
                 COLOR Color_Background, COLOR Color_Foreground);
 void GUI_Showtime(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend,
@@ -154,6 +163,7 @@ void GUI_WaveShare_Show(void);
  ********************************************************************************/
 
 // Libraries
+#include "jpeg_decoder.h"
 #include <stdarg.h>
 #include <string.h>
 
@@ -215,8 +225,24 @@ typedef struct
 void GUI_DisStringInBox(POINT Xbegin, POINT Ybegin, POINT Xend, POINT Yend,
                         const char* pString, sFONT* Font,
                         COLOR Color_Background, COLOR Color_Foreground);
+void GUI_DrawRGB888(POINT xPoint, POINT yPoint, LENGTH width, LENGTH height,
+                    const unsigned char* image_data);
+void GUI_DrawRGB565(POINT xPoint, POINT yPoint, LENGTH width, LENGTH height,
+                    const COLOR* image_data);
+void GUI_DrawYUV422(POINT xPoint, POINT yPoint, LENGTH width, LENGTH height,
+                    const uint8_t* image_data);
+void GUI_DrawHistogram(POINT xPoint, POINT yPoint, LENGTH width, LENGTH height,
+                       const uint32_t* histogram, COLOR Color_Background,
+                       COLOR Color_Foreground);
+void GUI_RenderHistogram(LENGTH width, LENGTH height, const uint32_t* histogram,
+                         COLOR Color_Background, COLOR Color_Foreground,
+                         COLOR* pixels);
 void GUI_DrawImage(POINT xPoint, POINT yPoint, const unsigned char* image_data,
                    int data_size);
+JPEG_Status GUI_DrawJpeg(POINT xPoint, POINT yPoint, const uint8_t* jpeg_data,
+                         uint32_t data_size);
+uint8_t GUI_Screenshot(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend,
+                       UART_HandleTypeDef* Uart);
 void GUI_RefreshTextBox(const GUI_TextBox* t);
 void printOnConsole(GUI_Console* c, char* text);
 void printfOnConsole(GUI_Console* c, const char* text, ...);
@@ -0,0 +1,60 @@
+/*
+ * LCD_Gram.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * Formats of the GRAM readback path (see LCD_ReadWindow()), shared with the
+ * host tool in Tools/lcd_readback and therefore free of the HAL.
+ *
+ * A memory read (0x2E, 0x3E to continue) on the serial interface returns
+ * LCD_GRAM_READ_DUMMY dummy bytes and then LCD_GRAM_READ_BYTES bytes per
+ * pixel, whatever the write format set by 0x3A: red, green and blue with 6
+ * significant bits each, MSB aligned. RGB565 written pixels come back
+ * without loss.
+ *
+ * GUI_Screenshot() sends a region over UART as a LCD_SHOT_HEADER_BYTES
+ * header (LCD_SHOT_MAGIC, width and height, little endian 16-bit) followed
+ * by the rows top to bottom, RGB565 little endian.
+ */
+
+#ifndef __LCD_GRAM_H
+#define __LCD_GRAM_H
+
+#include <stdint.h>
+
+/// Bytes clocked out after 0x2E before the first pixel
+#define LCD_GRAM_READ_DUMMY 1U
+/// Bytes of one pixel read from GRAM
+#define LCD_GRAM_READ_BYTES 3U
+
+#define LCD_SHOT_MAGIC "LCDS"
+#define LCD_SHOT_HEADER_BYTES 8U
+
+/**
+ * @param Rgb Pixel as read from GRAM: R, G, B, 6 bits each, MSB aligned.
+ * @return Pixel in RGB565.
+ */
+static inline uint16_t LCD_GramToRgb565(const uint8_t* Rgb)
+{
+    return (uint16_t)(((Rgb[0] & 0xF8U) << 8) | ((Rgb[1] & 0xFCU) << 3) |
+                      (Rgb[2] >> 3));
+}
+
+/**
+ * @param Pixel RGB565 pixel.
+ * @param Rgb Filled with the bytes the controller returns for it.
+ */
+static inline void LCD_Rgb565ToGram(uint16_t Pixel, uint8_t* Rgb)
+{
+    uint8_t R = (uint8_t)(Pixel >> 11);
+    uint8_t G = (uint8_t)((Pixel >> 5) & 0x3FU);
+    uint8_t B = (uint8_t)(Pixel & 0x1FU);
+
+    // 5-bit channels are widened to 6 bits with their MSB, as the
+    // controller does
+    Rgb[0] = (uint8_t)(((R << 1) | (R >> 4)) << 2);
+    Rgb[1] = (uint8_t)(G << 2);
+    Rgb[2] = (uint8_t)(((B << 1) | (B >> 4)) << 2);
+}
+
+#endif
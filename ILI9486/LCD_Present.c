@@ -0,0 +1,242 @@
+/*
+ * LCD_Present.c
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "LCD_Present.h"
+#include "perf.h"
+#include "spi.h"
+
+static LCD_SYNC_MODE sPresentMode;
+static uint32_t sPresentPeriod;   // Cycles of one refresh, porches included
+static uint32_t sPresentAnchor;   // Cycle count at the start of a refresh
+static uint32_t sPresentInterval; // Cycles between frames, 0: no cap
+static uint32_t sPresentLast;     // Cycle count of the last frame
+static LCD_PresentStats sPresentStats;
+
+extern LCD_DIS sLCD_DIS;
+
+/*******************************************************************************
+ function:	Move the anchor to the refresh in progress, so the modulo below
+            stays valid when the cycle counter wraps (every ~20 s)
+ return  :   Cycles since the start of the refresh in progress
+ *******************************************************************************/
+static uint32_t LCD_PresentPhase(uint32_t Now)
+{
+    uint32_t Elapsed = Now - sPresentAnchor;
+    sPresentAnchor += Elapsed - Elapsed % sPresentPeriod;
+    return Elapsed % sPresentPeriod;
+}
+
+/*******************************************************************************
+ function:	Busy wait
+ parameter:
+ Cycles  :   Core clock cycles to wait
+ *******************************************************************************/
+static void LCD_PresentDelay(uint32_t Cycles)
+{
+    uint32_t Start = PERF_Cycles();
+    while (PERF_Cycles() - Start < Cycles)
+        ;
+}
+
+/*******************************************************************************
+ function:	Estimated time of an SPI pixel write, one 16-bit frame per pixel
+ parameter:
+ Pixels  :   Number of pixels written
+ return  :   Core clock cycles
+ *******************************************************************************/
+static uint32_t LCD_PresentWriteCycles(uint32_t Pixels)
+{
+    uint32_t Shift  = (hspi2.Instance->CR1 & SPI_CR1_BR) >> SPI_CR1_BR_Pos;
+    uint32_t SpiHz  = HAL_RCC_GetPCLK1Freq() >> (Shift + 1U);
+    uint32_t PerBit = SpiHz == 0 ? 1U : SystemCoreClock / SpiHz;
+    return Pixels * 16U * PerBit;
+}
+
+#ifdef LCD_TE_Pin
+/*******************************************************************************
+ function:	Wait for the rising edge of the TE output (start of the vertical
+            blanking) and anchor the scan estimate to it
+ return  :   0 when no edge came within two refresh periods
+ *******************************************************************************/
+static uint8_t LCD_PresentWaitTe(void)
+{
+    uint32_t Start = PERF_Cycles();
+
+    while (HAL_GPIO_ReadPin(LCD_TE_GPIO_Port, LCD_TE_Pin) == GPIO_PIN_SET)
+        if (PERF_Cycles() - Start > 2U * sPresentPeriod)
+            return 0;
+    while (HAL_GPIO_ReadPin(LCD_TE_GPIO_Port, LCD_TE_Pin) == GPIO_PIN_RESET)
+        if (PERF_Cycles() - Start > 2U * sPresentPeriod)
+            return 0;
+    sPresentAnchor = PERF_Cycles();
+    return 1;
+}
+#endif
+
+/*******************************************************************************
+ function:	Select the source of the scan position and the frame rate cap
+ parameter:
+ Mode    :   LCD_SYNC_TE falls back to LCD_SYNC_TIMER without LCD_TE_Pin
+ FpsCap  :   Frames per second at most, 0: refresh rate
+ return  :   Mode in use
+ *******************************************************************************/
+LCD_SYNC_MODE LCD_PresentInit(LCD_SYNC_MODE Mode, uint16_t FpsCap)
+{
+    uint32_t Periods;
+
+    PERF_Init();
+    if (Mode == LCD_SYNC_TE)
+    {
+#ifdef LCD_TE_Pin
+        LCD_WriteReg(0x35);  // Tearing effect line on
+        LCD_WriteData(0x00); // V-blanking information only
+#else
+        Mode = LCD_SYNC_TIMER;
+#endif
+    }
+    sPresentMode   = Mode;
+    sPresentPeriod = SystemCoreClock / LCD_PANEL_HZ;
+    sPresentAnchor = PERF_Cycles();
+
+    // Whole refresh periods per frame keep the cadence even
+    Periods = FpsCap == 0 ? 1U : (LCD_PANEL_HZ + FpsCap - 1U) / FpsCap;
+    sPresentInterval = Periods * sPresentPeriod;
+    sPresentLast     = sPresentAnchor - sPresentInterval;
+    LCD_PresentResetStats();
+    return Mode;
+}
+
+/*******************************************************************************
+ function:	Trim the refresh estimate of LCD_SYNC_TIMER. The panel oscillator
+            is not exact and the phase at power up is unknown: adjust both
+            until the tear line stays out of the updated region
+ parameter:
+ PeriodUs:   Refresh period, 0 keeps the current one
+ PhaseUs :   Delay added to the start of the refresh
+ *******************************************************************************/
+void LCD_PresentSetTiming(uint32_t PeriodUs, uint32_t PhaseUs)
+{
+    uint32_t PerUs = SystemCoreClock / 1000000U;
+
+    if (PeriodUs != 0)
+    {
+        sPresentInterval =
+            sPresentInterval / sPresentPeriod * (PeriodUs * PerUs);
+        sPresentPeriod = PeriodUs * PerUs;
+    }
+    sPresentAnchor += PhaseUs * PerUs;
+}
+
+/*******************************************************************************
+ function:	Count a frame dropped by the caller before it was presented
+ *******************************************************************************/
+void LCD_PresentSkip(void) { sPresentStats.Skipped++; }
+
+/*******************************************************************************
+ function:	Time until the refresh scan has just left a region. The region is
+            clamped to the panel, the part of a larger image outside of it
+            is not written
+ parameter:
+ Xstart 	:   X direction Start coordinates
+ Ystart  :   Y direction Start coordinates
+ Xend    :   X direction end coordinates (exclusive)
+ Yend    :   Y direction end coordinates (exclusive)
+ Count   :   1 counts a write longer than the tear free time
+ return  :   Core clock cycles, 0: the region can be written now
+ *******************************************************************************/
+static uint32_t LCD_PresentScanWait(POINT Xstart, POINT Ystart, POINT Xend,
+                                    POINT Yend, uint8_t Count)
+{
+    // Beyond the panel the write and free time estimates would wrap
+    if (Xend > sLCD_DIS.LCD_Dis_Column)
+        Xend = sLCD_DIS.LCD_Dis_Column;
+    if (Yend > sLCD_DIS.LCD_Dis_Page)
+        Yend = sLCD_DIS.LCD_Dis_Page;
+    if (Xend <= Xstart || Yend <= Ystart)
+        return 0;
+
+    // Gate lines run along the 480 pixel side: X in landscape (MV set)
+    uint8_t Landscape = sLCD_DIS.LCD_Scan_Dir >= U2D_L2R;
+    uint32_t First    = Landscape ? Xstart : Ystart;
+    uint32_t Last     = Landscape ? Xend : Yend;
+    uint32_t Line  = sPresentPeriod / (LCD_PANEL_LINES + LCD_PANEL_BLANK_LINES);
+    uint32_t Leave = (LCD_PANEL_BLANK_LINES + Last) * Line;
+    uint32_t Free  = sPresentPeriod - (Last - First) * Line;
+    uint32_t Write =
+        LCD_PresentWriteCycles((uint32_t)(Xend - Xstart) * (Yend - Ystart));
+
+    // Time since the scan left the region
+    uint32_t Late = (LCD_PresentPhase(PERF_Cycles()) + sPresentPeriod - Leave) %
+                    sPresentPeriod;
+    if (Count && Write > Free)
+        sPresentStats.Overruns++;
+    if (Late > Line && Late + Write > Free)
+        return sPresentPeriod - Late;
+    return 0;
+}
+
+/*******************************************************************************
+ function:	Time LCD_PresentBegin() would wait now, for callers which do other
+            work meanwhile instead of waiting in it
+ parameter:
+ Xstart 	:   X direction Start coordinates
+ Ystart  :   Y direction Start coordinates
+ Xend    :   X direction end coordinates (exclusive)
+ Yend    :   Y direction end coordinates (exclusive)
+ return  :   Microseconds, 0: LCD_PresentBegin() returns right away
+ *******************************************************************************/
+uint32_t LCD_PresentWaitUs(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend)
+{
+    uint32_t Elapsed = PERF_Cycles() - sPresentLast;
+
+    if (Elapsed < sPresentInterval)
+        return PERF_CyclesToUs(sPresentInterval - Elapsed);
+    if (sPresentMode == LCD_SYNC_NONE)
+        return 0;
+    return PERF_CyclesToUs(
+        LCD_PresentScanWait(Xstart, Ystart, Xend, Yend, 0));
+}
+
+/*******************************************************************************
+ function:	Wait until the frame rate cap allows the next frame and the
+            refresh scan has just left the region about to be written
+ parameter:
+ Xstart 	:   X direction Start coordinates
+ Ystart  :   Y direction Start coordinates
+ Xend    :   X direction end coordinates (exclusive)
+ Yend    :   Y direction end coordinates (exclusive)
+ *******************************************************************************/
+void LCD_PresentBegin(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend)
+{
+    uint32_t Start = PERF_Cycles();
+
+    while (PERF_Cycles() - sPresentLast < sPresentInterval)
+        ;
+
+    if (sPresentMode != LCD_SYNC_NONE && Xend > Xstart && Yend > Ystart)
+    {
+#ifdef LCD_TE_Pin
+        if (sPresentMode == LCD_SYNC_TE)
+            LCD_PresentWaitTe();
+#endif
+        LCD_PresentDelay(LCD_PresentScanWait(Xstart, Ystart, Xend, Yend, 1));
+    }
+
+    sPresentLast = PERF_Cycles();
+    sPresentStats.Frames++;
+    sPresentStats.LastWaitUs = PERF_CyclesToUs(sPresentLast - Start);
+    sPresentStats.WaitUs += sPresentStats.LastWaitUs;
+}
+
+/*******************************************************************************
+ function:	Copy the presentation counters
+ *******************************************************************************/
+void LCD_PresentGetStats(LCD_PresentStats* Stats) { *Stats = sPresentStats; }
+
+/*******************************************************************************
+ function:	Clear the presentation counters
+ *******************************************************************************/
+void LCD_PresentResetStats(void) { sPresentStats = (LCD_PresentStats){0}; }
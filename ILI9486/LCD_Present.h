@@ -0,0 +1,66 @@
+/*
+ * LCD_Present.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * Frame rate locked presentation.
+ *
+ * The ILI9486 refreshes the glass from GRAM line by line, about 62 times a
+ * second (0xB1 in LCD_InitReg()). A GRAM write which overtakes the refresh
+ * scan shows half of the old and half of the new image (tearing). Before a
+ * region is written, LCD_PresentBegin() waits until the scan has just left
+ * it, so the write has the rest of the refresh period to complete before
+ * the scan comes back to the region.
+ *
+ * The scan position comes from the tearing effect output (0x35) when the
+ * board routes it to a GPIO (LCD_TE_Pin), otherwise it is estimated from
+ * the DWT cycle counter and the nominal refresh rate. The Waveshare shield
+ * has no TE line, so the estimate is the usual source: it keeps the cadence
+ * locked to the refresh and LCD_PresentSetTiming() trims the period and
+ * phase until the tear line is off the updated region.
+ *
+ * The frame rate cap is rounded to a whole number of refresh periods.
+ * LCD_PresentWaitUs() gives the time LCD_PresentBegin() would wait, a
+ * caller with other work can come back later instead of waiting. A caller
+ * which replaces a frame it has not presented yet, so SPI time is not spent
+ * on frames the panel never displays, counts it with LCD_PresentSkip().
+ */
+
+#ifndef __LCD_PRESENT_H
+#define __LCD_PRESENT_H
+
+#include "LCD_Driver.h"
+
+/// Refresh rate set by 0xB1 in LCD_InitReg() (0xA0: 62 Hz)
+#define LCD_PANEL_HZ 62U
+/// Gate lines scanned per refresh, along the 480 pixel side
+#define LCD_PANEL_LINES LCD_X_MAXPIXEL
+/// Vertical porch lines in which nothing is scanned (approximate)
+#define LCD_PANEL_BLANK_LINES 4U
+
+/// Source of the scan position
+typedef enum {
+    LCD_SYNC_NONE = 0, // Only the frame rate cap is applied
+    LCD_SYNC_TIMER,    // Estimated from the nominal refresh rate
+    LCD_SYNC_TE,       // Tearing effect output on LCD_TE_Pin
+} LCD_SYNC_MODE;
+
+/// Presentation counters (see LCD_PresentGetStats())
+typedef struct
+{
+    uint32_t Frames;     // LCD_PresentBegin() calls
+    uint32_t Skipped;    // Frames dropped before presenting (LCD_PresentSkip())
+    uint32_t Overruns;   // Writes estimated longer than the tear free time
+    uint32_t WaitUs;     // Time spent waiting for the scan and the cap
+    uint32_t LastWaitUs; // Wait of the last LCD_PresentBegin()
+} LCD_PresentStats;
+
+LCD_SYNC_MODE LCD_PresentInit(LCD_SYNC_MODE Mode, uint16_t FpsCap);
+void LCD_PresentSetTiming(uint32_t PeriodUs, uint32_t PhaseUs);
+void LCD_PresentSkip(void);
+uint32_t LCD_PresentWaitUs(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend);
+void LCD_PresentBegin(POINT Xstart, POINT Ystart, POINT Xend, POINT Yend);
+void LCD_PresentGetStats(LCD_PresentStats* Stats);
+void LCD_PresentResetStats(void);
+
+#endif
@@ -33,6 +33,9 @@ uint16_t TP_Read_ADC(uint8_t CMD)
 {
     uint16_t Data = 0;
 
+    // SPI2 is shared with the LCD, let its pixel DMA finish first
+    LCD_WaitDMA();
+
     // A cycle of at least 400ns.
     hspi2.Init.BaudRatePrescaler = SPI_BAUDRATEPRESCALER_64;
     HAL_SPI_Init(&hspi2);
@@ -65,6 +65,60 @@ extern sFONT Font16;
 extern sFONT Font12;
 extern sFONT Font8;
 
+/* Run-length encoded fonts (fonts_rle.c, generated by Tools/font_rle) -------*/
+
+/// First character and number of glyphs of every font
+#define FONT_RLE_FIRST ' '
+#define FONT_RLE_GLYPHS 95U
+
+/// Glyph cropped to the bounding box of its ink
+typedef struct
+{
+    uint16_t Offset; // First run byte, the next glyph's Offset ends it
+    uint8_t X;       // Box position in the character cell
+    uint8_t Y;
+    uint8_t Width;   // Box size, 0 for glyphs without ink
+    uint8_t Height;
+} sGLYPH_RLE;
+
+/// The box of a glyph is scanned row by row as alternating background and
+/// ink runs, one byte per pair: high nibble background, low nibble ink
+/// (0..15 pixels each)
+typedef struct
+{
+    uint16_t Width;            // Character cell
+    uint16_t Height;
+    const sGLYPH_RLE* glyphs;  // FONT_RLE_GLYPHS + 1 entries
+    const uint8_t* runs;
+} sFONT_RLE;
+
+extern sFONT_RLE Font24Rle;
+extern sFONT_RLE Font20Rle;
+extern sFONT_RLE Font16Rle;
+extern sFONT_RLE Font12Rle;
+extern sFONT_RLE Font8Rle;
+
+/* Anti-aliased fonts (fonts_aa.c, generated by Tools/font_aa) ---------------*/
+
+/// First character and number of glyphs of every font
+#define FONT_AA_FIRST ' '
+#define FONT_AA_GLYPHS 95U
+
+/// Same layout as sFONT with 4-bit coverage (0 background ... 15 ink) per
+/// pixel: two pixels per byte, high nibble first, rows padded to whole bytes
+typedef struct
+{
+    uint16_t Width;
+    uint16_t Height;
+    const uint8_t* table;
+} sFONT_AA;
+
+extern sFONT_AA Font24Aa;
+extern sFONT_AA Font20Aa;
+extern sFONT_AA Font16Aa;
+extern sFONT_AA Font12Aa;
+extern sFONT_AA Font8Aa;
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,8118 @@
+/*
+ * fonts_aa.c
+ *
+ * Generated by Tools/font_aa from Source Code Pro Regular, do not edit.
+ * 4-bpp anti-aliased glyphs, see sFONT_AA in fonts.h.
+ */
+
+#include "fonts.h"
+
+static const uint8_t Font8Aa_Table[] = {
+    // @0 ' ' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @24 '!' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x90, 0x00, //   @
+    0x00, 0x90, 0x00, //   @
+    0x00, 0x80, 0x00, //   %
+    0x00, 0x50, 0x00, //   +
+    0x01, 0xC0, 0x00, //  .@
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @48 '"' (5 pixels wide)
+    0x09, 0x18, 0x00, //  @.%
+    0x0C, 0x1B, 0x00, //  @.@
+    0x08, 0x08, 0x00, //  % %
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @72 '#' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x05, 0x26, 0x00, //  +:*
+    0x1A, 0x7A, 0x10, // .@#@.
+    0x06, 0x15, 0x00, //  *.+
+    0x2A, 0x89, 0x00, // :@%@
+    0x06, 0x42, 0x00, //  *=:
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @96 '$' (5 pixels wide)
+    0x00, 0x70, 0x00, //   #
+    0x09, 0x97, 0x00, //  @@#
+    0x0B, 0x00, 0x00, //  @
+    0x03, 0xA6, 0x00, //  -@*
+    0x01, 0x0A, 0x00, //  . @
+    0x18, 0xA7, 0x00, // .%@#
+    0x00, 0x70, 0x00, //   #
+    0x00, 0x00, 0x00, //
+    // @120 '%' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x68, 0x32, 0x40, // *%-:=
+    0x71, 0x77, 0x00, // #.##
+    0x49, 0x47, 0x20, // =@=#:
+    0x26, 0x70, 0x70, // :*# #
+    0x40, 0x57, 0x40, // = +#=
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @144 '&' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x09, 0xA1, 0x00, //  @@.
+    0x09, 0x80, 0x00, //  @%
+    0x2C, 0x42, 0x40, // :@=:=
+    0x91, 0x99, 0x10, // @.@@.
+    0x49, 0x99, 0x50, // =@@@+
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @168 ''' (5 pixels wide)
+    0x00, 0x90, 0x00, //   @
+    0x00, 0xC0, 0x00, //   @
+    0x00, 0x80, 0x00, //   %
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @192 '(' (5 pixels wide)
+    0x00, 0x16, 0x00, //   .*
+    0x00, 0x91, 0x00, //   @.
+    0x02, 0x70, 0x00, //  :#
+    0x05, 0x40, 0x00, //  +=
+    0x04, 0x50, 0x00, //  =+
+    0x01, 0x90, 0x00, //  .@
+    0x00, 0x64, 0x00, //   *=
+    0x00, 0x03, 0x00, //    -
+    // @216 ')' (5 pixels wide)
+    0x07, 0x00, 0x00, //  #
+    0x02, 0x70, 0x00, //  :#
+    0x00, 0x90, 0x00, //   @
+    0x00, 0x72, 0x00, //   #:
+    0x00, 0x81, 0x00, //   %.
+    0x00, 0x90, 0x00, //   @
+    0x07, 0x30, 0x00, //  #-
+    0x03, 0x00, 0x00, //  -
+    // @240 '*' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x60, 0x00, //   *
+    0x28, 0xB7, 0x00, // :%@#
+    0x05, 0x93, 0x00, //  +@-
+    0x04, 0x04, 0x00, //  = =
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @264 '+' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x50, 0x00, //   +
+    0x00, 0x80, 0x00, //   %
+    0x28, 0xB8, 0x10, // :%@%.
+    0x00, 0x80, 0x00, //   %
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @288 ',' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x20, 0x00, //   :
+    0x01, 0xF1, 0x00, //  .@.
+    0x00, 0x91, 0x00, //   @.
+    0x03, 0x40, 0x00, //  -=
+    // @312 '-' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x28, 0x88, 0x10, // :%%%.
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @336 '.' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x40, 0x00, //   =
+    0x02, 0xD0, 0x00, //  :@
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @360 '/' (5 pixels wide)
+    0x00, 0x09, 0x00, //    @
+    0x00, 0x27, 0x00, //   :#
+    0x00, 0x81, 0x00, //   %.
+    0x00, 0x90, 0x00, //   @
+    0x04, 0x50, 0x00, //  =+
+    0x09, 0x00, 0x00, //  @
+    0x18, 0x00, 0x00, // .%
+    0x00, 0x00, 0x00, //
+    // @384 '0' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x09, 0x87, 0x00, //  @%#
+    0x45, 0x08, 0x10, // =+ %.
+    0x63, 0xA6, 0x30, // *-@*-
+    0x45, 0x18, 0x10, // =+.%.
+    0x09, 0x87, 0x00, //  @%#
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @408 '1' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x07, 0xC0, 0x00, //  #@
+    0x00, 0xA0, 0x00, //   @
+    0x00, 0xA0, 0x00, //   @
+    0x00, 0xA0, 0x00, //   @
+    0x28, 0xD8, 0x20, // :%@%:
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @432 '2' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x29, 0x87, 0x00, // :@%#
+    0x00, 0x09, 0x00, //    @
+    0x00, 0x47, 0x00, //   =#
+    0x03, 0x80, 0x00, //  -%
+    0x4D, 0x88, 0x10, // =@%%.
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @456 '3' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x29, 0x98, 0x00, // :@@%
+    0x00, 0x0A, 0x00, //    @
+    0x03, 0xB6, 0x00, //  -@*
+    0x00, 0x09, 0x10, //    @.
+    0x39, 0x89, 0x00, // -@%@
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @480 '4' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x78, 0x00, //   #%
+    0x04, 0x68, 0x00, //  =*%
+    0x28, 0x18, 0x00, // :%.%
+    0x78, 0x8C, 0x30, // #%%@-
+    0x00, 0x18, 0x00, //   .%
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @504 '5' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x0C, 0x98, 0x00, //  @@%
+    0x1B, 0x85, 0x00, // .@%+
+    0x00, 0x09, 0x10, //    @.
+    0x00, 0x09, 0x10, //    @.
+    0x49, 0x97, 0x00, // =@@#
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @528 '6' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x07, 0x98, 0x00, //  #@%
+    0x38, 0x00, 0x00, // -%
+    0x58, 0x77, 0x00, // +%##
+    0x46, 0x06, 0x30, // =* *-
+    0x08, 0x89, 0x00, //  %%@
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @552 '7' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x49, 0x9C, 0x20, // =@@@:
+    0x00, 0x36, 0x00, //   -*
+    0x00, 0x90, 0x00, //   @
+    0x00, 0x90, 0x00, //   @
+    0x02, 0x80, 0x00, //  :%
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @576 '8' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x09, 0x88, 0x00, //  @%%
+    0x18, 0x08, 0x00, // .% %
+    0x09, 0x78, 0x00, //  @#%
+    0x63, 0x08, 0x30, // *- %-
+    0x29, 0x79, 0x10, // :@#@.
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @600 '9' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x29, 0x86, 0x00, // :@%*
+    0x63, 0x09, 0x10, // *- @.
+    0x19, 0x7A, 0x20, // .@#@:
+    0x00, 0x0A, 0x00, //    @
+    0x29, 0x95, 0x00, // :@@+
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @624 ':' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x02, 0xD0, 0x00, //  :@
+    0x00, 0x40, 0x00, //   =
+    0x00, 0x40, 0x00, //   =
+    0x02, 0xD0, 0x00, //  :@
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @648 ';' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x02, 0xD0, 0x00, //  :@
+    0x00, 0x40, 0x00, //   =
+    0x00, 0x20, 0x00, //   :
+    0x01, 0xF1, 0x00, //  .@.
+    0x00, 0x91, 0x00, //   @.
+    0x03, 0x40, 0x00, //  -=
+    // @672 '<' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x18, 0x00, //   .%
+    0x04, 0x81, 0x00, //  =%.
+    0x0B, 0x10, 0x00, //  @.
+    0x01, 0x85, 0x00, //  .%+
+    0x00, 0x04, 0x00, //    =
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @696 '=' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x28, 0x88, 0x10, // :%%%.
+    0x28, 0x88, 0x10, // :%%%.
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @720 '>' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x17, 0x00, 0x00, // .#
+    0x02, 0x93, 0x00, //  :@-
+    0x00, 0x3A, 0x00, //   -@
+    0x06, 0x70, 0x00, //  *#
+    0x13, 0x00, 0x00, // .-
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @744 '?' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x08, 0x97, 0x00, //  %@#
+    0x00, 0x19, 0x00, //   .@
+    0x00, 0x90, 0x00, //   @
+    0x00, 0x30, 0x00, //   -
+    0x03, 0xB0, 0x00, //  -@
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @768 '@' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x07, 0x78, 0x00, //  ##%
+    0x44, 0x03, 0x40, // == -=
+    0x70, 0x68, 0x60, // # *%*
+    0x72, 0x63, 0x60, // #:*-*
+    0x71, 0x76, 0x40, // #.#*=
+    0x27, 0x00, 0x00, // :#
+    0x03, 0x76, 0x00, //  -#*
+    // @792 'A' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x02, 0xD0, 0x00, //  :@
+    0x08, 0x75, 0x00, //  %#+
+    0x0A, 0x1A, 0x00, //  @.@
+    0x3C, 0x8D, 0x10, // -@%@.
+    0x92, 0x05, 0x60, // @: +*
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @816 'B' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x3C, 0x89, 0x00, // -@%@
+    0x38, 0x09, 0x00, // -% @
+    0x3B, 0x99, 0x00, // -@@@
+    0x38, 0x06, 0x40, // -% *=
+    0x3C, 0x8A, 0x10, // -@%@.
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @840 'C' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x08, 0x99, 0x10, //  %@@.
+    0x47, 0x00, 0x00, // =#
+    0x64, 0x00, 0x00, // *=
+    0x47, 0x00, 0x00, // =#
+    0x08, 0x99, 0x20, //  %@@:
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @864 'D' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x5B, 0x97, 0x00, // +@@#
+    0x55, 0x08, 0x30, // ++ %-
+    0x55, 0x05, 0x50, // ++ ++
+    0x55, 0x08, 0x30, // ++ %-
+    0x5B, 0x97, 0x00, // +@@#
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @888 'E' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x1C, 0x88, 0x10, // .@%%.
+    0x19, 0x00, 0x00, // .@
+    0x1C, 0x86, 0x00, // .@%*
+    0x19, 0x00, 0x00, // .@
+    0x1C, 0x88, 0x20, // .@%%:
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @912 'F' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x0C, 0x88, 0x20, //  @%%:
+    0x0A, 0x00, 0x00, //  @
+    0x0C, 0x88, 0x00, //  @%%
+    0x0A, 0x00, 0x00, //  @
+    0x0A, 0x00, 0x00, //  @
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @936 'G' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x09, 0x99, 0x10, //  @@@.
+    0x65, 0x00, 0x00, // *+
+    0x82, 0x3A, 0x30, // %:-@-
+    0x65, 0x05, 0x40, // *+ +=
+    0x09, 0x9A, 0x20, //  @@@:
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @960 'H' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x64, 0x08, 0x30, // *= %-
+    0x64, 0x08, 0x30, // *= %-
+    0x6A, 0x8C, 0x30, // *@%@-
+    0x64, 0x08, 0x30, // *= %-
+    0x64, 0x08, 0x30, // *= %-
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @984 'I' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x28, 0xD8, 0x00, // :%@%
+    0x00, 0xA0, 0x00, //   @
+    0x00, 0xA0, 0x00, //   @
+    0x00, 0xA0, 0x00, //   @
+    0x28, 0xD8, 0x00, // :%@%
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1008 'J' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x08, 0x8C, 0x00, //  %%@
+    0x00, 0x0A, 0x00, //    @
+    0x00, 0x0A, 0x00, //    @
+    0x01, 0x0A, 0x00, //  . @
+    0x29, 0x97, 0x00, // :@@#
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1032 'K' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x37, 0x09, 0x20, // -# @:
+    0x37, 0x93, 0x00, // -#@-
+    0x3D, 0xB2, 0x00, // -@@:
+    0x38, 0x1A, 0x00, // -%.@
+    0x37, 0x06, 0x50, // -# *+
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1056 'L' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x0A, 0x00, 0x00, //  @
+    0x0A, 0x00, 0x00, //  @
+    0x0A, 0x00, 0x00, //  @
+    0x0A, 0x00, 0x00, //  @
+    0x0C, 0x88, 0x30, //  @%%-
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1080 'M' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x58, 0x0B, 0x20, // +% @:
+    0x5A, 0x2B, 0x20, // +@:@:
+    0x56, 0xA7, 0x20, // +*@#:
+    0x53, 0x66, 0x20, // +-**:
+    0x53, 0x06, 0x20, // +- *:
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1104 'N' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x59, 0x08, 0x20, // +@ %:
+    0x5A, 0x28, 0x20, // +@:%:
+    0x55, 0x87, 0x20, // ++%#:
+    0x54, 0x5A, 0x20, // +=+@:
+    0x54, 0x0C, 0x20, // += @:
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1128 'O' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x19, 0x98, 0x00, // .@@%
+    0x74, 0x07, 0x30, // #= #-
+    0x92, 0x05, 0x60, // @: +*
+    0x64, 0x07, 0x30, // *= #-
+    0x19, 0x98, 0x00, // .@@%
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1152 'P' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x3B, 0x8A, 0x10, // -@%@.
+    0x37, 0x06, 0x40, // -# *=
+    0x3B, 0x88, 0x00, // -@%%
+    0x37, 0x00, 0x00, // -#
+    0x37, 0x00, 0x00, // -#
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1176 'Q' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x09, 0x98, 0x00, //  @@%
+    0x65, 0x08, 0x20, // *+ %:
+    0x92, 0x05, 0x50, // @: ++
+    0x82, 0x06, 0x40, // %: *=
+    0x39, 0x2A, 0x10, // -@:@.
+    0x04, 0xD3, 0x00, //  =@-
+    0x00, 0x39, 0x30, //   -@-
+    // @1200 'R' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x3B, 0x8A, 0x10, // -@%@.
+    0x37, 0x07, 0x30, // -# #-
+    0x3B, 0xA8, 0x00, // -@@%
+    0x37, 0x38, 0x00, // -#-%
+    0x37, 0x09, 0x20, // -# @:
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1224 'S' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x0A, 0x98, 0x00, //  @@%
+    0x29, 0x00, 0x00, // :@
+    0x04, 0x97, 0x00, //  =@#
+    0x00, 0x07, 0x30, //    #-
+    0x29, 0x99, 0x10, // :@@@.
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1248 'T' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x68, 0xD8, 0x40, // *%@%=
+    0x00, 0xA0, 0x00, //   @
+    0x00, 0xA0, 0x00, //   @
+    0x00, 0xA0, 0x00, //   @
+    0x00, 0xA0, 0x00, //   @
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1272 'U' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x64, 0x07, 0x30, // *= #-
+    0x64, 0x07, 0x30, // *= #-
+    0x64, 0x07, 0x30, // *= #-
+    0x56, 0x08, 0x20, // +* %:
+    0x1A, 0x99, 0x00, // .@@@
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1296 'V' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x73, 0x06, 0x40, // #- *=
+    0x28, 0x09, 0x00, // :% @
+    0x0A, 0x19, 0x00, //  @.@
+    0x07, 0x74, 0x00, //  ##=
+    0x02, 0xD0, 0x00, //  :@
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1320 'W' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0xA0, 0x00, 0x90, // @   @
+    0xA0, 0xB2, 0x70, // @ @:#
+    0x85, 0xA5, 0x50, // %+@++
+    0x5A, 0x3A, 0x30, // +@-@-
+    0x3B, 0x0D, 0x00, // -@ @
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1344 'X' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x38, 0x09, 0x10, // -% @.
+    0x08, 0x65, 0x00, //  %*+
+    0x02, 0xE0, 0x00, //  :@
+    0x09, 0x57, 0x00, //  @+#
+    0x46, 0x09, 0x20, // =* @:
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1368 'Y' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x64, 0x07, 0x30, // *= #-
+    0x0A, 0x19, 0x00, //  @.@
+    0x05, 0xB2, 0x00, //  +@:
+    0x00, 0xA0, 0x00, //   @
+    0x00, 0xA0, 0x00, //   @
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1392 'Z' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x28, 0x8D, 0x20, // :%%@:
+    0x00, 0x47, 0x00, //   =#
+    0x01, 0x90, 0x00, //  .@
+    0x09, 0x10, 0x00, //  @.
+    0x5C, 0x88, 0x30, // +@%%-
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1416 '[' (5 pixels wide)
+    0x03, 0x96, 0x00, //  -@*
+    0x03, 0x50, 0x00, //  -+
+    0x03, 0x50, 0x00, //  -+
+    0x03, 0x50, 0x00, //  -+
+    0x03, 0x50, 0x00, //  -+
+    0x03, 0x50, 0x00, //  -+
+    0x02, 0x76, 0x00, //  :#*
+    0x00, 0x00, 0x00, //
+    // @1440 '\' (5 pixels wide)
+    0x18, 0x00, 0x00, // .%
+    0x09, 0x00, 0x00, //  @
+    0x04, 0x50, 0x00, //  =+
+    0x00, 0x90, 0x00, //   @
+    0x00, 0x81, 0x00, //   %.
+    0x00, 0x27, 0x00, //   :#
+    0x00, 0x09, 0x00, //    @
+    0x00, 0x00, 0x00, //
+    // @1464 ']' (5 pixels wide)
+    0x16, 0xB0, 0x00, // .*@
+    0x00, 0x80, 0x00, //   %
+    0x00, 0x80, 0x00, //   %
+    0x00, 0x80, 0x00, //   %
+    0x00, 0x80, 0x00, //   %
+    0x00, 0x80, 0x00, //   %
+    0x16, 0x80, 0x00, // .*%
+    0x00, 0x00, 0x00, //
+    // @1488 '^' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x02, 0xC0, 0x00, //  :@
+    0x07, 0x54, 0x00, //  #+=
+    0x08, 0x08, 0x00, //  % %
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1512 '_' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x49, 0x99, 0x30, // =@@@-
+    0x00, 0x00, 0x00, //
+    // @1536 '`' (5 pixels wide)
+    0x02, 0x70, 0x00, //  :#
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1560 'a' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x19, 0x89, 0x00, // .@%@
+    0x01, 0x5B, 0x10, //  .+@.
+    0x38, 0x28, 0x20, // -%:%:
+    0x29, 0x6B, 0x20, // :@*@:
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1584 'b' (5 pixels wide)
+    0x46, 0x00, 0x00, // =*
+    0x46, 0x00, 0x00, // =*
+    0x4B, 0x8A, 0x00, // =@%@
+    0x46, 0x07, 0x40, // =* #=
+    0x46, 0x07, 0x30, // =* #-
+    0x4A, 0x89, 0x00, // =@%@
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1608 'c' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x08, 0x89, 0x10, //  %%@.
+    0x47, 0x00, 0x00, // =#
+    0x47, 0x00, 0x00, // =#
+    0x09, 0x98, 0x10, //  @@%.
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1632 'd' (5 pixels wide)
+    0x00, 0x09, 0x10, //    @.
+    0x00, 0x09, 0x10, //    @.
+    0x1A, 0x8C, 0x10, // .@%@.
+    0x64, 0x09, 0x10, // *= @.
+    0x73, 0x09, 0x10, // #- @.
+    0x19, 0x7B, 0x10, // .@#@.
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1656 'e' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x07, 0x89, 0x10, //  #%@.
+    0x59, 0x78, 0x30, // +@#%-
+    0x56, 0x00, 0x00, // +*
+    0x09, 0x89, 0x00, //  @%@
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1680 'f' (5 pixels wide)
+    0x00, 0x88, 0x40, //   %%=
+    0x01, 0xA0, 0x00, //  .@
+    0x19, 0xC8, 0x20, // .@@%:
+    0x01, 0x90, 0x00, //  .@
+    0x01, 0x90, 0x00, //  .@
+    0x01, 0x90, 0x00, //  .@
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1704 'g' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x09, 0x8D, 0x50, //  @%@+
+    0x28, 0x09, 0x00, // :% @
+    0x0A, 0x74, 0x00, //  @#=
+    0x1B, 0x87, 0x10, // .@%#.
+    0x44, 0x04, 0x70, // == =#
+    0x29, 0x78, 0x20, // :@#%:
+    // @1728 'h' (5 pixels wide)
+    0x46, 0x00, 0x00, // =*
+    0x46, 0x00, 0x00, // =*
+    0x4A, 0x8A, 0x00, // =@%@
+    0x47, 0x07, 0x20, // =# #:
+    0x46, 0x07, 0x30, // =* #-
+    0x46, 0x07, 0x30, // =* #-
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1752 'i' (5 pixels wide)
+    0x00, 0x93, 0x00, //   @-
+    0x00, 0x00, 0x00, //
+    0x28, 0xB3, 0x00, // :%@-
+    0x00, 0x73, 0x00, //   #-
+    0x00, 0x73, 0x00, //   #-
+    0x00, 0x73, 0x00, //   #-
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1776 'j' (5 pixels wide)
+    0x00, 0x93, 0x00, //   @-
+    0x00, 0x00, 0x00, //
+    0x28, 0xB3, 0x00, // :%@-
+    0x00, 0x73, 0x00, //   #-
+    0x00, 0x73, 0x00, //   #-
+    0x00, 0x73, 0x00, //   #-
+    0x00, 0x72, 0x00, //   #:
+    0x48, 0x90, 0x00, // =%@
+    // @1800 'k' (5 pixels wide)
+    0x28, 0x00, 0x00, // :%
+    0x28, 0x00, 0x00, // :%
+    0x28, 0x19, 0x10, // :%.@.
+    0x28, 0xB1, 0x00, // :%@.
+    0x2C, 0x57, 0x00, // :@+#
+    0x28, 0x07, 0x40, // :% #=
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1824 'l' (5 pixels wide)
+    0x38, 0x90, 0x00, // -%@
+    0x00, 0x90, 0x00, //   @
+    0x00, 0x90, 0x00, //   @
+    0x00, 0x90, 0x00, //   @
+    0x00, 0xA0, 0x00, //   @
+    0x00, 0xA9, 0x20, //   @@:
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1848 'm' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x88, 0xA9, 0x40, // %%@@=
+    0x82, 0x83, 0x70, // %:%-#
+    0x82, 0x83, 0x70, // %:%-#
+    0x82, 0x83, 0x70, // %:%-#
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1872 'n' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x49, 0x7A, 0x00, // =@#@
+    0x46, 0x07, 0x20, // =* #:
+    0x46, 0x07, 0x30, // =* #-
+    0x46, 0x07, 0x30, // =* #-
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1896 'o' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x19, 0x88, 0x00, // .@%%
+    0x64, 0x07, 0x30, // *= #-
+    0x64, 0x07, 0x30, // *= #-
+    0x19, 0x88, 0x00, // .@%%
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1920 'p' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x4A, 0x79, 0x00, // =@#@
+    0x46, 0x06, 0x40, // =* *=
+    0x46, 0x07, 0x30, // =* #-
+    0x4B, 0x89, 0x00, // =@%@
+    0x46, 0x00, 0x00, // =*
+    0x46, 0x00, 0x00, // =*
+    // @1944 'q' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x1A, 0x8B, 0x10, // .@%@.
+    0x64, 0x09, 0x10, // *= @.
+    0x74, 0x09, 0x10, // #= @.
+    0x1A, 0x8C, 0x10, // .@%@.
+    0x00, 0x09, 0x10, //    @.
+    0x00, 0x09, 0x10, //    @.
+    // @1968 'r' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x09, 0x78, 0x20, //  @#%:
+    0x0B, 0x10, 0x00, //  @.
+    0x0A, 0x00, 0x00, //  @
+    0x0A, 0x00, 0x00, //  @
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @1992 's' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x19, 0x87, 0x00, // .@%#
+    0x1A, 0x51, 0x00, // .@+.
+    0x00, 0x3A, 0x10, //   -@.
+    0x28, 0x89, 0x10, // :%%@.
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @2016 't' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x04, 0x40, 0x00, //  ==
+    0x3A, 0xA8, 0x20, // -@@%:
+    0x05, 0x40, 0x00, //  +=
+    0x05, 0x50, 0x00, //  ++
+    0x01, 0xA8, 0x20, //  .@%:
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @2040 'u' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x64, 0x09, 0x10, // *= @.
+    0x64, 0x09, 0x10, // *= @.
+    0x65, 0x0A, 0x10, // *+ @.
+    0x2A, 0x7B, 0x10, // :@#@.
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @2064 'v' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x64, 0x07, 0x30, // *= #-
+    0x19, 0x09, 0x00, // .@ @
+    0x08, 0x46, 0x00, //  %=*
+    0x02, 0xD1, 0x00, //  :@.
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @2088 'w' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0xA0, 0x80, 0x90, // @ % @
+    0x93, 0xA3, 0x60, // @-@-*
+    0x69, 0x59, 0x30, // *@+@-
+    0x3C, 0x1E, 0x00, // -@.@
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @2112 'x' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x19, 0x09, 0x00, // .@ @
+    0x05, 0xB2, 0x00, //  +@:
+    0x06, 0xA3, 0x00, //  *@-
+    0x28, 0x0A, 0x10, // :% @.
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @2136 'y' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x64, 0x06, 0x30, // *= *-
+    0x19, 0x09, 0x00, // .@ @
+    0x08, 0x37, 0x00, //  %-#
+    0x02, 0xD2, 0x00, //  :@:
+    0x00, 0x90, 0x00, //   @
+    0x3A, 0x30, 0x00, // -@-
+    // @2160 'z' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x18, 0x8D, 0x10, // .%%@.
+    0x00, 0x83, 0x00, //   %-
+    0x07, 0x50, 0x00, //  #+
+    0x4D, 0x88, 0x20, // =@%%:
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    // @2184 '{' (5 pixels wide)
+    0x00, 0x86, 0x00, //   %*
+    0x00, 0x80, 0x00, //   %
+    0x00, 0x80, 0x00, //   %
+    0x09, 0x60, 0x00, //  @*
+    0x00, 0x80, 0x00, //   %
+    0x00, 0x80, 0x00, //   %
+    0x00, 0x66, 0x00, //   **
+    0x00, 0x00, 0x00, //
+    // @2208 '|' (5 pixels wide)
+    0x00, 0x90, 0x00, //   @
+    0x00, 0x90, 0x00, //   @
+    0x00, 0x90, 0x00, //   @
+    0x00, 0x90, 0x00, //   @
+    0x00, 0x90, 0x00, //   @
+    0x00, 0x90, 0x00, //   @
+    0x00, 0x90, 0x00, //   @
+    0x00, 0x90, 0x00, //   @
+    // @2232 '}' (5 pixels wide)
+    0x16, 0x70, 0x00, // .*#
+    0x00, 0x80, 0x00, //   %
+    0x00, 0x80, 0x00, //   %
+    0x00, 0x86, 0x00, //   %*
+    0x00, 0x80, 0x00, //   %
+    0x00, 0x80, 0x00, //   %
+    0x16, 0x40, 0x00, // .*=
+    0x00, 0x00, 0x00, //
+    // @2256 '~' (5 pixels wide)
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x18, 0x44, 0x10, // .%==.
+    0x32, 0x57, 0x00, // -:+#
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, //
+};
+
+sFONT_AA Font8Aa = {5, /* Width */
+                    8, /* Height */
+                    Font8Aa_Table};
+
+static const uint8_t Font12Aa_Table[] = {
+    // @0 ' ' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @48 '!' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x66, 0x00, 0x00, //   **
+    0x00, 0x55, 0x00, 0x00, //   ++
+    0x00, 0x55, 0x00, 0x00, //   ++
+    0x00, 0x55, 0x00, 0x00, //   ++
+    0x00, 0x22, 0x00, 0x00, //   ::
+    0x00, 0x44, 0x00, 0x00, //   ==
+    0x00, 0x88, 0x00, 0x00, //   %%
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @96 '"' (7 pixels wide)
+    0x04, 0x22, 0x40, 0x00, //  =::=
+    0x0A, 0x66, 0xA0, 0x00, //  @**@
+    0x09, 0x54, 0x90, 0x00, //  @+=@
+    0x07, 0x33, 0x70, 0x00, //  #--#
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @144 '#' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x80, 0x80, 0x00, //   % %
+    0x00, 0x81, 0x60, 0x00, //   %.*
+    0x09, 0xBA, 0xB2, 0x00, //  @@@@:
+    0x03, 0x55, 0x30, 0x00, //  -++-
+    0x1A, 0xAB, 0x90, 0x00, // .@@@@
+    0x06, 0x28, 0x00, 0x00, //  *:%
+    0x08, 0x08, 0x00, 0x00, //  % %
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @192 '$' (7 pixels wide)
+    0x00, 0x35, 0x00, 0x00, //   -+
+    0x02, 0xAB, 0x40, 0x00, //  :@@=
+    0x0B, 0x31, 0x50, 0x00, //  @-.+
+    0x0A, 0x70, 0x00, 0x00, //  @#
+    0x01, 0x8D, 0x50, 0x00, //  .%@+
+    0x00, 0x01, 0xD1, 0x00, //    .@.
+    0x09, 0x43, 0xC0, 0x00, //  @=-@
+    0x02, 0x9A, 0x20, 0x00, //  :@@:
+    0x00, 0x45, 0x00, 0x00, //   =+
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @240 '%' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x48, 0x80, 0x15, 0x00, // =%% .+
+    0x90, 0x90, 0x93, 0x00, // @ @ @-
+    0x90, 0x94, 0x50, 0x00, // @ @=+
+    0x28, 0x65, 0x82, 0x00, // :%*+%:
+    0x07, 0x39, 0x09, 0x00, //  #-@ @
+    0x47, 0x09, 0x09, 0x00, // =# @ @
+    0x40, 0x07, 0x94, 0x00, // =  #@=
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @288 '&' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x05, 0xA8, 0x00, 0x00, //  +@%
+    0x0B, 0x0A, 0x00, 0x00, //  @ @
+    0x09, 0x86, 0x00, 0x00, //  @%*
+    0x0A, 0xB0, 0x26, 0x00, //  @@ :*
+    0x66, 0x86, 0x83, 0x00, // **%*%-
+    0x85, 0x0A, 0xC0, 0x00, // %+ @@
+    0x1B, 0xAA, 0x78, 0x00, // .@@@#%
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @336 ''' (7 pixels wide)
+    0x00, 0x33, 0x00, 0x00, //   --
+    0x00, 0x88, 0x00, 0x00, //   %%
+    0x00, 0x77, 0x00, 0x00, //   ##
+    0x00, 0x55, 0x00, 0x00, //   ++
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @384 '(' (7 pixels wide)
+    0x00, 0x00, 0x20, 0x00, //     :
+    0x00, 0x08, 0x60, 0x00, //    %*
+    0x00, 0x38, 0x00, 0x00, //   -%
+    0x00, 0xA2, 0x00, 0x00, //   @:
+    0x00, 0xB0, 0x00, 0x00, //   @
+    0x00, 0xB0, 0x00, 0x00, //   @
+    0x00, 0xB0, 0x00, 0x00, //   @
+    0x00, 0x65, 0x00, 0x00, //   *+
+    0x00, 0x0B, 0x10, 0x00, //    @.
+    0x00, 0x02, 0x60, 0x00, //    :*
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @432 ')' (7 pixels wide)
+    0x02, 0x00, 0x00, 0x00, //  :
+    0x06, 0x80, 0x00, 0x00, //  *%
+    0x00, 0x83, 0x00, 0x00, //   %-
+    0x00, 0x2A, 0x00, 0x00, //   :@
+    0x00, 0x0B, 0x00, 0x00, //    @
+    0x00, 0x0B, 0x00, 0x00, //    @
+    0x00, 0x0B, 0x00, 0x00, //    @
+    0x00, 0x56, 0x00, 0x00, //   +*
+    0x01, 0xB0, 0x00, 0x00, //  .@
+    0x06, 0x20, 0x00, 0x00, //  *:
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @480 '*' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x44, 0x00, 0x00, //   ==
+    0x17, 0x77, 0x71, 0x00, // .####.
+    0x02, 0xCC, 0x20, 0x00, //  :@@:
+    0x03, 0x88, 0x30, 0x00, //  -%%-
+    0x03, 0x00, 0x30, 0x00, //  -  -
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @528 '+' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x33, 0x00, 0x00, //   --
+    0x00, 0x55, 0x00, 0x00, //   ++
+    0x19, 0xBB, 0x91, 0x00, // .@@@@.
+    0x00, 0x55, 0x00, 0x00, //   ++
+    0x00, 0x55, 0x00, 0x00, //   ++
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @576 ',' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x34, 0x00, 0x00, //   -=
+    0x00, 0x9D, 0x00, 0x00, //   @@
+    0x00, 0x0B, 0x00, 0x00, //    @
+    0x00, 0x94, 0x00, 0x00, //   @=
+    0x00, 0x10, 0x00, 0x00, //   .
+    0x00, 0x00, 0x00, 0x00, //
+    // @624 '-' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x19, 0x99, 0x91, 0x00, // .@@@@.
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @672 '.' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x66, 0x00, 0x00, //   **
+    0x00, 0x99, 0x00, 0x00, //   @@
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @720 '/' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0xB0, 0x00, //     @
+    0x00, 0x05, 0x70, 0x00, //    +#
+    0x00, 0x0A, 0x10, 0x00, //    @.
+    0x00, 0x1A, 0x00, 0x00, //   .@
+    0x00, 0x74, 0x00, 0x00, //   #=
+    0x00, 0xB0, 0x00, 0x00, //   @
+    0x04, 0x80, 0x00, 0x00, //  =%
+    0x09, 0x20, 0x00, 0x00, //  @:
+    0x06, 0x00, 0x00, 0x00, //  *
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @768 '0' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x04, 0xBB, 0x40, 0x00, //  =@@=
+    0x0C, 0x00, 0xB0, 0x00, //  @  @
+    0x39, 0x00, 0x93, 0x00, // -@  @-
+    0x48, 0x88, 0x84, 0x00, // =%%%%=
+    0x39, 0x11, 0x93, 0x00, // -@..@-
+    0x0C, 0x00, 0xB0, 0x00, //  @  @
+    0x04, 0xBB, 0x40, 0x00, //  =@@=
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @816 '1' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x05, 0xC9, 0x00, 0x00, //  +@@
+    0x01, 0x59, 0x00, 0x00, //  .+@
+    0x00, 0x39, 0x00, 0x00, //   -@
+    0x00, 0x39, 0x00, 0x00, //   -@
+    0x00, 0x39, 0x00, 0x00, //   -@
+    0x00, 0x39, 0x00, 0x00, //   -@
+    0x0A, 0xBD, 0xA3, 0x00, //  @@@@-
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @864 '2' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x19, 0xBB, 0x40, 0x00, // .@@@=
+    0x13, 0x01, 0xB0, 0x00, // .- .@
+    0x00, 0x01, 0xB0, 0x00, //    .@
+    0x00, 0x08, 0x50, 0x00, //    %+
+    0x00, 0x59, 0x00, 0x00, //   +@
+    0x04, 0xA0, 0x00, 0x00, //  =@
+    0x2F, 0xBA, 0xA2, 0x00, // :@@@@:
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @912 '3' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x09, 0xAB, 0x50, 0x00, //  @@@+
+    0x03, 0x00, 0xC0, 0x00, //  -  @
+    0x00, 0x03, 0xB0, 0x00, //    -@
+    0x00, 0xBD, 0x20, 0x00, //   @@:
+    0x00, 0x01, 0xC1, 0x00, //    .@.
+    0x12, 0x00, 0xC1, 0x00, // .:  @.
+    0x2A, 0xBB, 0x60, 0x00, // :@@@*
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @960 '4' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x0C, 0x70, 0x00, //    @#
+    0x00, 0x89, 0x70, 0x00, //   %@#
+    0x04, 0x85, 0x70, 0x00, //  =%+#
+    0x2B, 0x05, 0x70, 0x00, // :@ +#
+    0x7B, 0xAB, 0xC4, 0x00, // #@@@@=
+    0x00, 0x05, 0x70, 0x00, //    +#
+    0x00, 0x05, 0x70, 0x00, //    +#
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @1008 '5' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x0B, 0xBB, 0xA0, 0x00, //  @@@@
+    0x0B, 0x00, 0x00, 0x00, //  @
+    0x0B, 0x00, 0x00, 0x00, //  @
+    0x0C, 0x8A, 0x50, 0x00, //  @%@+
+    0x01, 0x00, 0xC2, 0x00, //  .  @:
+    0x11, 0x00, 0xC2, 0x00, // ..  @:
+    0x2A, 0xAB, 0x60, 0x00, // :@@@*
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @1056 '6' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x02, 0xBA, 0xA1, 0x00, //  :@@@.
+    0x0C, 0x30, 0x10, 0x00, //  @- .
+    0x2B, 0x00, 0x00, 0x00, // :@
+    0x3A, 0x89, 0x70, 0x00, // -@%@#
+    0x2B, 0x10, 0x93, 0x00, // :@. @-
+    0x0B, 0x00, 0x93, 0x00, //  @  @-
+    0x03, 0xAA, 0x80, 0x00, //  -@@%
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @1104 '7' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x3B, 0xBB, 0xE3, 0x00, // -@@@@-
+    0x00, 0x02, 0x90, 0x00, //    :@
+    0x00, 0x0A, 0x20, 0x00, //    @:
+    0x00, 0x2A, 0x00, 0x00, //   :@
+    0x00, 0x66, 0x00, 0x00, //   **
+    0x00, 0x94, 0x00, 0x00, //   @=
+    0x00, 0xA2, 0x00, 0x00, //   @:
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @1152 '8' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x05, 0xAA, 0x60, 0x00, //  +@@*
+    0x0B, 0x00, 0xB0, 0x00, //  @  @
+    0x0A, 0x62, 0xB0, 0x00, //  @*:@
+    0x05, 0xBE, 0x50, 0x00, //  +@@+
+    0x29, 0x01, 0xB2, 0x00, // :@ .@:
+    0x38, 0x00, 0x94, 0x00, // -%  @=
+    0x08, 0xA9, 0x80, 0x00, //  %@@%
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @1200 '9' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x06, 0xAA, 0x30, 0x00, //  *@@-
+    0x2A, 0x01, 0xC0, 0x00, // :@ .@
+    0x47, 0x00, 0xA2, 0x00, // =#  @:
+    0x2A, 0x01, 0xD3, 0x00, // :@ .@-
+    0x06, 0xA8, 0xA2, 0x00, //  *@%@:
+    0x01, 0x01, 0xB0, 0x00, //  . .@
+    0x1A, 0xAA, 0x20, 0x00, // .@@@:
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @1248 ':' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x99, 0x00, 0x00, //   @@
+    0x00, 0x66, 0x00, 0x00, //   **
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x66, 0x00, 0x00, //   **
+    0x00, 0x99, 0x00, 0x00, //   @@
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @1296 ';' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x99, 0x00, 0x00, //   @@
+    0x00, 0x66, 0x00, 0x00, //   **
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x34, 0x00, 0x00, //   -=
+    0x00, 0x9D, 0x00, 0x00, //   @@
+    0x00, 0x0B, 0x00, 0x00, //    @
+    0x00, 0x94, 0x00, 0x00, //   @=
+    0x00, 0x10, 0x00, 0x00, //   .
+    0x00, 0x00, 0x00, 0x00, //
+    // @1344 '<' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x03, 0xA0, 0x00, //    -@
+    0x00, 0x89, 0x10, 0x00, //   %@.
+    0x0A, 0x50, 0x00, 0x00, //  @+
+    0x03, 0xB4, 0x00, 0x00, //  -@=
+    0x00, 0x08, 0x80, 0x00, //    %%
+    0x00, 0x00, 0x30, 0x00, //     -
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @1392 '=' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x19, 0x99, 0x91, 0x00, // .@@@@.
+    0x00, 0x00, 0x00, 0x00, //
+    0x19, 0x99, 0x91, 0x00, // .@@@@.
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @1440 '>' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x0A, 0x30, 0x00, 0x00, //  @-
+    0x01, 0x98, 0x00, 0x00, //  .@%
+    0x00, 0x05, 0xA0, 0x00, //    +@
+    0x00, 0x4B, 0x30, 0x00, //   =@-
+    0x08, 0x80, 0x00, 0x00, //  %%
+    0x03, 0x00, 0x00, 0x00, //  -
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @1488 '?' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x07, 0xAB, 0x40, 0x00, //  #@@=
+    0x01, 0x01, 0xB0, 0x00, //  . .@
+    0x00, 0x07, 0x60, 0x00, //    #*
+    0x00, 0x58, 0x00, 0x00, //   +%
+    0x00, 0x51, 0x00, 0x00, //   +.
+    0x00, 0x53, 0x00, 0x00, //   +-
+    0x00, 0xB6, 0x00, 0x00, //   @*
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @1536 '@' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x03, 0x99, 0x80, 0x00, //  -@@%
+    0x1B, 0x00, 0x54, 0x00, // .@  +=
+    0x55, 0x01, 0x67, 0x00, // ++ .*#
+    0x73, 0x69, 0x67, 0x00, // #-*@*#
+    0x63, 0xA0, 0x57, 0x00, // *-@ +#
+    0x46, 0x49, 0x65, 0x00, // =*=@*+
+    0x0A, 0x20, 0x00, 0x00, //  @:
+    0x01, 0x88, 0x70, 0x00, //  .%%#
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @1584 'A' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x99, 0x00, 0x00, //   @@
+    0x00, 0xAB, 0x00, 0x00, //   @@
+    0x04, 0x78, 0x40, 0x00, //  =#%=
+    0x09, 0x33, 0x90, 0x00, //  @--@
+    0x0D, 0xAA, 0xD0, 0x00, //  @@@@
+    0x39, 0x00, 0x93, 0x00, // -@  @-
+    0x85, 0x00, 0x58, 0x00, // %+  +%
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @1632 'B' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x0E, 0xAB, 0x70, 0x00, //  @@@#
+    0x0D, 0x00, 0xC0, 0x00, //  @  @
+    0x0D, 0x01, 0xC0, 0x00, //  @ .@
+    0x0E, 0x9C, 0x70, 0x00, //  @@@#
+    0x0D, 0x00, 0x85, 0x00, //  @  %+
+    0x0D, 0x00, 0x85, 0x00, //  @  %+
+    0x0E, 0xAA, 0x90, 0x00, //  @@@@
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @1680 'C' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x02, 0xAB, 0xB2, 0x00, //  :@@@:
+    0x0C, 0x30, 0x20, 0x00, //  @- :
+    0x3A, 0x00, 0x00, 0x00, // -@
+    0x58, 0x00, 0x00, 0x00, // +%
+    0x3A, 0x00, 0x00, 0x00, // -@
+    0x0C, 0x30, 0x22, 0x00, //  @- ::
+    0x02, 0xBB, 0xB2, 0x00, //  :@@@:
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @1728 'D' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x2E, 0xAB, 0x40, 0x00, // :@@@=
+    0x2A, 0x01, 0xC1, 0x00, // :@ .@.
+    0x2A, 0x00, 0x85, 0x00, // :@  %+
+    0x2A, 0x00, 0x67, 0x00, // :@  *#
+    0x2A, 0x00, 0x85, 0x00, // :@  %+
+    0x2A, 0x01, 0xC1, 0x00, // :@ .@.
+    0x2E, 0xAB, 0x40, 0x00, // :@@@=
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @1776 'E' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x0D, 0xBB, 0xB2, 0x00, //  @@@@:
+    0x0C, 0x00, 0x00, 0x00, //  @
+    0x0C, 0x00, 0x00, 0x00, //  @
+    0x0D, 0xBB, 0x80, 0x00, //  @@@%
+    0x0C, 0x00, 0x00, 0x00, //  @
+    0x0C, 0x00, 0x00, 0x00, //  @
+    0x0D, 0xBB, 0xB3, 0x00, //  @@@@-
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @1824 'F' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x0A, 0xBB, 0xB4, 0x00, //  @@@@=
+    0x0A, 0x30, 0x00, 0x00, //  @-
+    0x0A, 0x30, 0x00, 0x00, //  @-
+    0x0A, 0xBA, 0x90, 0x00, //  @@@@
+    0x0A, 0x30, 0x00, 0x00, //  @-
+    0x0A, 0x30, 0x00, 0x00, //  @-
+    0x0A, 0x30, 0x00, 0x00, //  @-
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @1872 'G' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x03, 0xBB, 0xA1, 0x00, //  -@@@.
+    0x1C, 0x20, 0x10, 0x00, // .@: .
+    0x58, 0x00, 0x00, 0x00, // +%
+    0x77, 0x08, 0xB4, 0x00, // ## %@=
+    0x58, 0x00, 0x75, 0x00, // +%  #+
+    0x1C, 0x10, 0x75, 0x00, // .@. #+
+    0x03, 0xBB, 0xB2, 0x00, //  -@@@:
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @1920 'H' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x39, 0x00, 0x93, 0x00, // -@  @-
+    0x39, 0x00, 0x93, 0x00, // -@  @-
+    0x39, 0x00, 0x93, 0x00, // -@  @-
+    0x3D, 0xBB, 0xD3, 0x00, // -@@@@-
+    0x39, 0x00, 0x93, 0x00, // -@  @-
+    0x39, 0x00, 0x93, 0x00, // -@  @-
+    0x39, 0x00, 0x93, 0x00, // -@  @-
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @1968 'I' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x0B, 0xCC, 0xB0, 0x00, //  @@@@
+    0x00, 0x66, 0x00, 0x00, //   **
+    0x00, 0x66, 0x00, 0x00, //   **
+    0x00, 0x66, 0x00, 0x00, //   **
+    0x00, 0x66, 0x00, 0x00, //   **
+    0x00, 0x66, 0x00, 0x00, //   **
+    0x0B, 0xDD, 0xB0, 0x00, //  @@@@
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @2016 'J' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x07, 0xBB, 0xE0, 0x00, //  #@@@
+    0x00, 0x00, 0xD0, 0x00, //     @
+    0x00, 0x00, 0xD0, 0x00, //     @
+    0x00, 0x00, 0xD0, 0x00, //     @
+    0x00, 0x00, 0xD0, 0x00, //     @
+    0x05, 0x01, 0xC0, 0x00, //  + .@
+    0x09, 0xCB, 0x40, 0x00, //  @@@=
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @2064 'K' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x0C, 0x00, 0xB3, 0x00, //  @  @-
+    0x0C, 0x09, 0x60, 0x00, //  @ @*
+    0x0C, 0x5A, 0x00, 0x00, //  @+@
+    0x0E, 0xCC, 0x00, 0x00, //  @@@
+    0x0E, 0x27, 0x70, 0x00, //  @:##
+    0x0C, 0x00, 0xC1, 0x00, //  @  @.
+    0x0C, 0x00, 0x68, 0x00, //  @  *%
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @2112 'L' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x0A, 0x20, 0x00, 0x00, //  @:
+    0x0A, 0x20, 0x00, 0x00, //  @:
+    0x0A, 0x20, 0x00, 0x00, //  @:
+    0x0A, 0x20, 0x00, 0x00, //  @:
+    0x0A, 0x20, 0x00, 0x00, //  @:
+    0x0A, 0x20, 0x00, 0x00, //  @:
+    0x0A, 0xBB, 0xB4, 0x00, //  @@@@=
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @2160 'M' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x3D, 0x00, 0xD3, 0x00, // -@  @-
+    0x3C, 0x33, 0xD3, 0x00, // -@--@-
+    0x39, 0x78, 0x93, 0x00, // -@#%@-
+    0x38, 0x98, 0x83, 0x00, // -%@%%-
+    0x38, 0x76, 0x83, 0x00, // -%#*%-
+    0x38, 0x00, 0x83, 0x00, // -%  %-
+    0x38, 0x00, 0x83, 0x00, // -%  %-
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @2208 'N' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x3D, 0x00, 0x93, 0x00, // -@  @-
+    0x3D, 0x60, 0x93, 0x00, // -@* @-
+    0x39, 0xB0, 0x93, 0x00, // -@@ @-
+    0x39, 0x66, 0x93, 0x00, // -@**@-
+    0x39, 0x0B, 0x93, 0x00, // -@ @@-
+    0x39, 0x06, 0xD3, 0x00, // -@ *@-
+    0x39, 0x00, 0xE3, 0x00, // -@  @-
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @2256 'O' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x05, 0xBB, 0x50, 0x00, //  +@@+
+    0x2C, 0x01, 0xC2, 0x00, // :@ .@:
+    0x67, 0x00, 0x76, 0x00, // *#  #*
+    0x76, 0x00, 0x67, 0x00, // #*  *#
+    0x67, 0x00, 0x76, 0x00, // *#  #*
+    0x2C, 0x11, 0xC1, 0x00, // :@..@.
+    0x05, 0xBB, 0x50, 0x00, //  +@@+
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @2304 'P' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x0E, 0xAB, 0x90, 0x00, //  @@@@
+    0x0C, 0x00, 0x94, 0x00, //  @  @=
+    0x0C, 0x00, 0x66, 0x00, //  @  **
+    0x0C, 0x00, 0xA3, 0x00, //  @  @-
+    0x0E, 0xAB, 0x60, 0x00, //  @@@*
+    0x0C, 0x00, 0x00, 0x00, //  @
+    0x0C, 0x00, 0x00, 0x00, //  @
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @2352 'Q' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x06, 0xBB, 0x50, 0x00, //  *@@+
+    0x2B, 0x00, 0xC2, 0x00, // :@  @:
+    0x66, 0x00, 0x76, 0x00, // **  #*
+    0x76, 0x00, 0x67, 0x00, // #*  *#
+    0x49, 0x00, 0x94, 0x00, // =@  @=
+    0x0B, 0x77, 0xB0, 0x00, //  @##@
+    0x00, 0x7C, 0x00, 0x00, //   #@
+    0x00, 0x07, 0xB5, 0x00, //    #@+
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @2400 'R' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x0E, 0xAB, 0x90, 0x00, //  @@@@
+    0x0C, 0x00, 0x94, 0x00, //  @  @=
+    0x0C, 0x00, 0xB3, 0x00, //  @  @-
+    0x0E, 0xAD, 0x60, 0x00, //  @@@*
+    0x0C, 0x0A, 0x40, 0x00, //  @ @=
+    0x0C, 0x03, 0xB0, 0x00, //  @ -@
+    0x0C, 0x00, 0xA4, 0x00, //  @  @=
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @2448 'S' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x05, 0xBB, 0x90, 0x00, //  +@@@
+    0x0D, 0x00, 0x20, 0x00, //  @  :
+    0x0C, 0x60, 0x00, 0x00, //  @*
+    0x01, 0x9D, 0x60, 0x00, //  .@@*
+    0x00, 0x01, 0xC3, 0x00, //    .@-
+    0x15, 0x00, 0x94, 0x00, // .+  @=
+    0x19, 0xCB, 0x80, 0x00, // .@@@%
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @2496 'T' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x6B, 0xCC, 0xB6, 0x00, // *@@@@*
+    0x00, 0x66, 0x00, 0x00, //   **
+    0x00, 0x66, 0x00, 0x00, //   **
+    0x00, 0x66, 0x00, 0x00, //   **
+    0x00, 0x66, 0x00, 0x00, //   **
+    0x00, 0x66, 0x00, 0x00, //   **
+    0x00, 0x66, 0x00, 0x00, //   **
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @2544 'U' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x39, 0x00, 0x93, 0x00, // -@  @-
+    0x39, 0x00, 0x93, 0x00, // -@  @-
+    0x39, 0x00, 0x93, 0x00, // -@  @-
+    0x39, 0x00, 0x93, 0x00, // -@  @-
+    0x3A, 0x00, 0x92, 0x00, // -@  @:
+    0x1C, 0x00, 0xC1, 0x00, // .@  @.
+    0x06, 0xCC, 0x60, 0x00, //  *@@*
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @2592 'V' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x67, 0x00, 0x66, 0x00, // *#  **
+    0x2B, 0x00, 0xA2, 0x00, // :@  @:
+    0x0C, 0x10, 0xC0, 0x00, //  @. @
+    0x08, 0x44, 0x80, 0x00, //  %==%
+    0x03, 0x88, 0x30, 0x00, //  -%%-
+    0x00, 0xBB, 0x00, 0x00, //   @@
+    0x00, 0xA9, 0x00, 0x00, //   @@
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @2640 'W' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0xC0, 0x00, 0x0C, 0x00, // @    @
+    0xA2, 0x00, 0x1A, 0x00, // @:  .@
+    0x83, 0x67, 0x38, 0x00, // %-*#-%
+    0x65, 0x89, 0x46, 0x00, // *+%@=*
+    0x47, 0x99, 0x74, 0x00, // =#@@#=
+    0x2B, 0x66, 0xB2, 0x00, // :@**@:
+    0x0E, 0x22, 0xF0, 0x00, //  @::@
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @2688 'X' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x1C, 0x00, 0xB1, 0x00, // .@  @.
+    0x08, 0x55, 0x80, 0x00, //  %++%
+    0x01, 0xCB, 0x10, 0x00, //  .@@.
+    0x00, 0xAA, 0x00, 0x00, //   @@
+    0x02, 0xAB, 0x20, 0x00, //  :@@:
+    0x0A, 0x34, 0x90, 0x00, //  @-=@
+    0x3A, 0x00, 0xB3, 0x00, // -@  @-
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @2736 'Y' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x68, 0x00, 0x76, 0x00, // *%  #*
+    0x0C, 0x10, 0xC0, 0x00, //  @. @
+    0x06, 0x76, 0x60, 0x00, //  *#**
+    0x00, 0xBB, 0x00, 0x00, //   @@
+    0x00, 0x77, 0x00, 0x00, //   ##
+    0x00, 0x66, 0x00, 0x00, //   **
+    0x00, 0x66, 0x00, 0x00, //   **
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @2784 'Z' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x0B, 0xBB, 0xE4, 0x00, //  @@@@=
+    0x00, 0x03, 0xA0, 0x00, //    -@
+    0x00, 0x0B, 0x20, 0x00, //    @:
+    0x00, 0x76, 0x00, 0x00, //   #*
+    0x02, 0xB0, 0x00, 0x00, //  :@
+    0x0A, 0x30, 0x00, 0x00, //  @-
+    0x4E, 0xBB, 0xB4, 0x00, // =@@@@=
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @2832 '[' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0xA7, 0x70, 0x00, //   @##
+    0x00, 0xA0, 0x00, 0x00, //   @
+    0x00, 0xA0, 0x00, 0x00, //   @
+    0x00, 0xA0, 0x00, 0x00, //   @
+    0x00, 0xA0, 0x00, 0x00, //   @
+    0x00, 0xA0, 0x00, 0x00, //   @
+    0x00, 0xA0, 0x00, 0x00, //   @
+    0x00, 0xA0, 0x00, 0x00, //   @
+    0x00, 0x87, 0x70, 0x00, //   %##
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @2880 '\' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x0B, 0x00, 0x00, 0x00, //  @
+    0x07, 0x50, 0x00, 0x00, //  #+
+    0x01, 0xA0, 0x00, 0x00, //  .@
+    0x00, 0xA1, 0x00, 0x00, //   @.
+    0x00, 0x47, 0x00, 0x00, //   =#
+    0x00, 0x0B, 0x00, 0x00, //    @
+    0x00, 0x08, 0x40, 0x00, //    %=
+    0x00, 0x02, 0x90, 0x00, //    :@
+    0x00, 0x00, 0x60, 0x00, //     *
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @2928 ']' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x07, 0x7B, 0x00, 0x00, //  ##@
+    0x00, 0x0A, 0x00, 0x00, //    @
+    0x00, 0x0A, 0x00, 0x00, //    @
+    0x00, 0x0A, 0x00, 0x00, //    @
+    0x00, 0x0A, 0x00, 0x00, //    @
+    0x00, 0x0A, 0x00, 0x00, //    @
+    0x00, 0x0A, 0x00, 0x00, //    @
+    0x00, 0x0A, 0x00, 0x00, //    @
+    0x07, 0x78, 0x00, 0x00, //  ##%
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @2976 '^' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x88, 0x00, 0x00, //   %%
+    0x00, 0xAA, 0x00, 0x00, //   @@
+    0x05, 0x66, 0x50, 0x00, //  +**+
+    0x0A, 0x11, 0xA0, 0x00, //  @..@
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @3024 '_' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x4B, 0xBB, 0xB4, 0x00, // =@@@@=
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @3072 '`' (7 pixels wide)
+    0x00, 0x60, 0x00, 0x00, //   *
+    0x00, 0x65, 0x00, 0x00, //   *+
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @3120 'a' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x08, 0xAB, 0x80, 0x00, //  %@@%
+    0x01, 0x01, 0xC1, 0x00, //  . .@.
+    0x06, 0x87, 0xC2, 0x00, //  *%#@:
+    0x2A, 0x00, 0xB2, 0x00, // :@  @:
+    0x0A, 0xA9, 0xA2, 0x00, //  @@@@:
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @3168 'b' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x1B, 0x00, 0x00, 0x00, // .@
+    0x1B, 0x00, 0x00, 0x00, // .@
+    0x1C, 0x9B, 0x90, 0x00, // .@@@@
+    0x1C, 0x00, 0xA4, 0x00, // .@  @=
+    0x1B, 0x00, 0x75, 0x00, // .@  #+
+    0x1C, 0x00, 0xB3, 0x00, // .@  @-
+    0x1C, 0xAB, 0x70, 0x00, // .@@@#
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @3216 'c' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x03, 0xBA, 0xA1, 0x00, //  -@@@.
+    0x0D, 0x10, 0x10, 0x00, //  @. .
+    0x2B, 0x00, 0x00, 0x00, // :@
+    0x0D, 0x10, 0x11, 0x00, //  @. ..
+    0x04, 0xBA, 0xA2, 0x00, //  =@@@:
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @3264 'd' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0xB1, 0x00, //     @.
+    0x00, 0x00, 0xB1, 0x00, //     @.
+    0x07, 0xBA, 0xD1, 0x00, //  #@@@.
+    0x3B, 0x00, 0xC1, 0x00, // -@  @.
+    0x57, 0x00, 0xB1, 0x00, // +#  @.
+    0x3A, 0x00, 0xC1, 0x00, // -@  @.
+    0x09, 0xB9, 0xB1, 0x00, //  @@@@.
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @3312 'e' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x05, 0xBA, 0x80, 0x00, //  +@@%
+    0x1B, 0x00, 0x83, 0x00, // .@  %-
+    0x4C, 0x99, 0xA4, 0x00, // =@@@@=
+    0x1B, 0x00, 0x00, 0x00, // .@
+    0x05, 0xBA, 0x90, 0x00, //  +@@@
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @3360 'f' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x2B, 0xA7, 0x00, //   :@@#
+    0x00, 0x84, 0x00, 0x00, //   %=
+    0x0A, 0xDB, 0xA3, 0x00, //  @@@@-
+    0x00, 0x94, 0x00, 0x00, //   @=
+    0x00, 0x94, 0x00, 0x00, //   @=
+    0x00, 0x94, 0x00, 0x00, //   @=
+    0x00, 0x94, 0x00, 0x00, //   @=
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @3408 'g' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x07, 0xAC, 0xC6, 0x00, //  #@@@*
+    0x0C, 0x01, 0xB0, 0x00, //  @ .@
+    0x09, 0x99, 0x30, 0x00, //  @@@-
+    0x0A, 0x00, 0x00, 0x00, //  @
+    0x0A, 0xBA, 0x93, 0x00, //  @@@@-
+    0x28, 0x00, 0x59, 0x00, // :%  +@
+    0x1A, 0x99, 0x92, 0x00, // .@@@@:
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @3456 'h' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x1B, 0x00, 0x00, 0x00, // .@
+    0x1B, 0x00, 0x00, 0x00, // .@
+    0x1C, 0x9B, 0xA0, 0x00, // .@@@@
+    0x1D, 0x10, 0xB3, 0x00, // .@. @-
+    0x1B, 0x00, 0x94, 0x00, // .@  @=
+    0x1B, 0x00, 0x94, 0x00, // .@  @=
+    0x1B, 0x00, 0x94, 0x00, // .@  @=
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @3504 'i' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x1E, 0x10, 0x00, //   .@.
+    0x00, 0x03, 0x00, 0x00, //    -
+    0x1A, 0xAE, 0x00, 0x00, // .@@@
+    0x00, 0x0C, 0x00, 0x00, //    @
+    0x00, 0x0C, 0x00, 0x00, //    @
+    0x00, 0x0C, 0x00, 0x00, //    @
+    0x00, 0x0C, 0x00, 0x00, //    @
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @3552 'j' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x1E, 0x10, 0x00, //   .@.
+    0x00, 0x03, 0x00, 0x00, //    -
+    0x1A, 0xAE, 0x00, 0x00, // .@@@
+    0x00, 0x0C, 0x00, 0x00, //    @
+    0x00, 0x0C, 0x00, 0x00, //    @
+    0x00, 0x0C, 0x00, 0x00, //    @
+    0x00, 0x0C, 0x00, 0x00, //    @
+    0x00, 0x0C, 0x00, 0x00, //    @
+    0x3A, 0xB6, 0x00, 0x00, // -@@*
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @3600 'k' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x0C, 0x00, 0x00, 0x00, //  @
+    0x0C, 0x00, 0x00, 0x00, //  @
+    0x0C, 0x01, 0xB2, 0x00, //  @ .@:
+    0x0C, 0x1B, 0x20, 0x00, //  @.@:
+    0x0D, 0xBB, 0x10, 0x00, //  @@@.
+    0x0D, 0x24, 0xA0, 0x00, //  @:=@
+    0x0C, 0x00, 0x86, 0x00, //  @  %*
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @3648 'l' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x2A, 0xD4, 0x00, 0x00, // :@@=
+    0x00, 0x84, 0x00, 0x00, //   %=
+    0x00, 0x84, 0x00, 0x00, //   %=
+    0x00, 0x84, 0x00, 0x00, //   %=
+    0x00, 0x84, 0x00, 0x00, //   %=
+    0x00, 0x75, 0x00, 0x00, //   #+
+    0x00, 0x3C, 0xB3, 0x00, //   -@@-
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @3696 'm' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x6A, 0xC7, 0xC4, 0x00, // *@@#@=
+    0x67, 0x47, 0x48, 0x00, // *#=#=%
+    0x66, 0x46, 0x48, 0x00, // **=*=%
+    0x66, 0x46, 0x48, 0x00, // **=*=%
+    0x66, 0x46, 0x48, 0x00, // **=*=%
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @3744 'n' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x1A, 0x9B, 0xA0, 0x00, // .@@@@
+    0x1D, 0x10, 0xB3, 0x00, // .@. @-
+    0x1B, 0x00, 0x94, 0x00, // .@  @=
+    0x1B, 0x00, 0x94, 0x00, // .@  @=
+    0x1B, 0x00, 0x94, 0x00, // .@  @=
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @3792 'o' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x06, 0xBB, 0x60, 0x00, //  *@@*
+    0x3B, 0x00, 0xB3, 0x00, // -@  @-
+    0x57, 0x00, 0x75, 0x00, // +#  #+
+    0x3B, 0x00, 0xB3, 0x00, // -@  @-
+    0x07, 0xBB, 0x60, 0x00, //  #@@*
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @3840 'p' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x1B, 0x9B, 0x90, 0x00, // .@@@@
+    0x1C, 0x00, 0xA4, 0x00, // .@  @=
+    0x1B, 0x00, 0x75, 0x00, // .@  #+
+    0x1C, 0x00, 0xB3, 0x00, // .@  @-
+    0x1D, 0xAB, 0x70, 0x00, // .@@@#
+    0x1B, 0x00, 0x00, 0x00, // .@
+    0x1B, 0x00, 0x00, 0x00, // .@
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @3888 'q' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x07, 0xBA, 0xC1, 0x00, //  #@@@.
+    0x3B, 0x00, 0xC1, 0x00, // -@  @.
+    0x57, 0x00, 0xB1, 0x00, // +#  @.
+    0x3A, 0x00, 0xC1, 0x00, // -@  @.
+    0x09, 0xB9, 0xC1, 0x00, //  @@@@.
+    0x00, 0x00, 0xB1, 0x00, //     @.
+    0x00, 0x00, 0xB1, 0x00, //     @.
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @3936 'r' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x08, 0x4B, 0xC4, 0x00, //  %=@@=
+    0x08, 0xA1, 0x00, 0x00, //  %@.
+    0x08, 0x40, 0x00, 0x00, //  %=
+    0x08, 0x40, 0x00, 0x00, //  %=
+    0x08, 0x40, 0x00, 0x00, //  %=
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @3984 's' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x07, 0xAA, 0x80, 0x00, //  #@@%
+    0x0D, 0x20, 0x00, 0x00, //  @:
+    0x02, 0x9A, 0x60, 0x00, //  :@@*
+    0x02, 0x00, 0xB3, 0x00, //  :  @-
+    0x19, 0xAA, 0x90, 0x00, // .@@@@
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @4032 't' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x50, 0x00, 0x00, //   +
+    0x00, 0xB0, 0x00, 0x00, //   @
+    0x3A, 0xEA, 0xA3, 0x00, // -@@@@-
+    0x00, 0xC0, 0x00, 0x00, //   @
+    0x00, 0xC0, 0x00, 0x00, //   @
+    0x00, 0xC0, 0x00, 0x00, //   @
+    0x00, 0x6B, 0xA4, 0x00, //   *@@=
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @4080 'u' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x49, 0x00, 0xC1, 0x00, // =@  @.
+    0x49, 0x00, 0xC1, 0x00, // =@  @.
+    0x49, 0x00, 0xC1, 0x00, // =@  @.
+    0x3A, 0x01, 0xD1, 0x00, // -@ .@.
+    0x0A, 0xB9, 0xA1, 0x00, //  @@@@.
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @4128 'v' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x48, 0x00, 0x74, 0x00, // =%  #=
+    0x0C, 0x00, 0xB0, 0x00, //  @  @
+    0x07, 0x54, 0x70, 0x00, //  #+=#
+    0x01, 0xAA, 0x10, 0x00, //  .@@.
+    0x00, 0x9A, 0x00, 0x00, //   @@
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @4176 'w' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0xC1, 0x45, 0x0B, 0x00, // @.=+ @
+    0x93, 0x88, 0x39, 0x00, // @-%%-@
+    0x67, 0x89, 0x66, 0x00, // *#%@**
+    0x2A, 0x77, 0xA3, 0x00, // :@##@-
+    0x0E, 0x44, 0xE0, 0x00, //  @==@
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @4224 'x' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x0B, 0x21, 0xB0, 0x00, //  @:.@
+    0x03, 0xA9, 0x30, 0x00, //  -@@-
+    0x00, 0xAA, 0x00, 0x00, //   @@
+    0x04, 0x8A, 0x40, 0x00, //  =%@=
+    0x1B, 0x01, 0xB1, 0x00, // .@ .@.
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @4272 'y' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x48, 0x00, 0x75, 0x00, // =%  #+
+    0x0B, 0x10, 0xB0, 0x00, //  @. @
+    0x05, 0x64, 0x80, 0x00, //  +*=%
+    0x00, 0xB9, 0x20, 0x00, //   @@:
+    0x00, 0x7A, 0x00, 0x00, //   #@
+    0x00, 0x84, 0x00, 0x00, //   %=
+    0x2A, 0x80, 0x00, 0x00, // :@%
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @4320 'z' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x09, 0xAB, 0xE2, 0x00, //  @@@@:
+    0x00, 0x0A, 0x50, 0x00, //    @+
+    0x00, 0x87, 0x00, 0x00, //   %#
+    0x06, 0x90, 0x00, 0x00, //  *@
+    0x3F, 0xAA, 0xA3, 0x00, // -@@@@-
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @4368 '{' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x2A, 0x70, 0x00, //   :@#
+    0x00, 0x64, 0x00, 0x00, //   *=
+    0x00, 0x64, 0x00, 0x00, //   *=
+    0x00, 0x64, 0x00, 0x00, //   *=
+    0x07, 0xC1, 0x00, 0x00, //  #@.
+    0x00, 0x64, 0x00, 0x00, //   *=
+    0x00, 0x64, 0x00, 0x00, //   *=
+    0x00, 0x64, 0x00, 0x00, //   *=
+    0x00, 0x18, 0x70, 0x00, //   .%#
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @4416 '|' (7 pixels wide)
+    0x00, 0x66, 0x00, 0x00, //   **
+    0x00, 0x66, 0x00, 0x00, //   **
+    0x00, 0x66, 0x00, 0x00, //   **
+    0x00, 0x66, 0x00, 0x00, //   **
+    0x00, 0x66, 0x00, 0x00, //   **
+    0x00, 0x66, 0x00, 0x00, //   **
+    0x00, 0x66, 0x00, 0x00, //   **
+    0x00, 0x66, 0x00, 0x00, //   **
+    0x00, 0x66, 0x00, 0x00, //   **
+    0x00, 0x66, 0x00, 0x00, //   **
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @4464 '}' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x07, 0x92, 0x00, 0x00, //  #@:
+    0x00, 0x46, 0x00, 0x00, //   =*
+    0x00, 0x46, 0x00, 0x00, //   =*
+    0x00, 0x46, 0x00, 0x00, //   =*
+    0x00, 0x1C, 0x70, 0x00, //   .@#
+    0x00, 0x46, 0x00, 0x00, //   =*
+    0x00, 0x46, 0x00, 0x00, //   =*
+    0x00, 0x46, 0x00, 0x00, //   =*
+    0x07, 0x81, 0x00, 0x00, //  #%.
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    // @4512 '~' (7 pixels wide)
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x07, 0x91, 0x51, 0x00, //  #@.+.
+    0x15, 0x19, 0x70, 0x00, // .+.@#
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, //
+};
+
+sFONT_AA Font12Aa = {7, /* Width */
+                     12, /* Height */
+                     Font12Aa_Table};
+
+static const uint8_t Font16Aa_Table[] = {
+    // @0 ' ' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @96 '!' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0xD6, 0x00, 0x00, 0x00, //     @*
+    0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, //     @*
+    0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, //     @*
+    0x00, 0x00, 0xB5, 0x00, 0x00, 0x00, //     @+
+    0x00, 0x00, 0xB5, 0x00, 0x00, 0x00, //     @+
+    0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, //     @=
+    0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, //     @=
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x63, 0x00, 0x00, 0x00, //     *-
+    0x00, 0x05, 0xFE, 0x00, 0x00, 0x00, //    +@@
+    0x00, 0x02, 0xEA, 0x00, 0x00, 0x00, //    :@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @192 '"' (11 pixels wide)
+    0x00, 0x55, 0x01, 0x63, 0x00, 0x00, //   ++ .*-
+    0x00, 0xDD, 0x03, 0xF7, 0x00, 0x00, //   @@ -@#
+    0x00, 0xDC, 0x03, 0xF7, 0x00, 0x00, //   @@ -@#
+    0x00, 0xBB, 0x01, 0xF5, 0x00, 0x00, //   @@ .@+
+    0x00, 0xA9, 0x00, 0xF4, 0x00, 0x00, //   @@  @=
+    0x00, 0x87, 0x00, 0xD2, 0x00, 0x00, //   %#  @:
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @288 '#' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x08, 0x50, 0x85, 0x00, 0x00, //    %+ %+
+    0x00, 0x0A, 0x30, 0xA3, 0x00, 0x00, //    @- @-
+    0x00, 0x0C, 0x10, 0xC1, 0x00, 0x00, //    @. @.
+    0x04, 0xEF, 0xEE, 0xFE, 0x40, 0x00, //  =@@@@@@=
+    0x00, 0x0D, 0x00, 0xD0, 0x00, 0x00, //    @  @
+    0x00, 0x1C, 0x02, 0xB0, 0x00, 0x00, //   .@ :@
+    0x00, 0x3A, 0x03, 0xA0, 0x00, 0x00, //   -@ -@
+    0x08, 0xEE, 0xEE, 0xED, 0x00, 0x00, //  %@@@@@@
+    0x00, 0x67, 0x06, 0x60, 0x00, 0x00, //   *# **
+    0x00, 0x85, 0x08, 0x40, 0x00, 0x00, //   %+ %=
+    0x00, 0xA3, 0x0A, 0x30, 0x00, 0x00, //   @- @-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @384 '$' (11 pixels wide)
+    0x00, 0x00, 0x96, 0x00, 0x00, 0x00, //     @*
+    0x00, 0x00, 0x96, 0x00, 0x00, 0x00, //     @*
+    0x00, 0x29, 0xED, 0x91, 0x00, 0x00, //   :@@@@.
+    0x00, 0xDA, 0x44, 0xAA, 0x00, 0x00, //   @@==@@
+    0x02, 0xF2, 0x00, 0x00, 0x00, 0x00, //  :@:
+    0x00, 0xEB, 0x20, 0x00, 0x00, 0x00, //   @@:
+    0x00, 0x2C, 0xFA, 0x30, 0x00, 0x00, //   :@@@-
+    0x00, 0x00, 0x4B, 0xF7, 0x00, 0x00, //     =@@#
+    0x00, 0x00, 0x00, 0x6F, 0x10, 0x00, //       *@.
+    0x02, 0x30, 0x00, 0x3F, 0x10, 0x00, //  :-   -@.
+    0x05, 0xEA, 0x77, 0xD9, 0x00, 0x00, //  +@@##@@
+    0x00, 0x27, 0xDB, 0x50, 0x00, 0x00, //   :#@@+
+    0x00, 0x00, 0x96, 0x00, 0x00, 0x00, //     @*
+    0x00, 0x00, 0x96, 0x00, 0x00, 0x00, //     @*
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @480 '%' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x09, 0xCB, 0x20, 0x00, 0x40, 0x00, //  @@@:   =
+    0x4B, 0x06, 0x90, 0x06, 0xD0, 0x00, // =@ *@  *@
+    0x77, 0x02, 0xD0, 0x2D, 0x20, 0x00, // ## :@ :@:
+    0x77, 0x02, 0xC0, 0xC4, 0x00, 0x00, // ## :@ @=
+    0x3C, 0x07, 0x81, 0x50, 0x00, 0x00, // -@ #%.+
+    0x07, 0xCA, 0x10, 0x00, 0x00, 0x00, //  #@@.
+    0x00, 0x00, 0x05, 0xCB, 0x40, 0x00, //      +@@=
+    0x00, 0x49, 0x1D, 0x12, 0xE0, 0x00, //   =@.@.:@
+    0x05, 0xC1, 0x4B, 0x00, 0xD2, 0x00, //  +@.=@  @:
+    0x4D, 0x10, 0x2D, 0x11, 0xE0, 0x00, // =@. :@..@
+    0x01, 0x00, 0x06, 0xCC, 0x50, 0x00, //  .   *@@+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @576 '&' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x3C, 0xE8, 0x00, 0x00, 0x00, //   -@@%
+    0x00, 0xD6, 0x1E, 0x20, 0x00, 0x00, //   @*.@:
+    0x00, 0xF2, 0x0D, 0x30, 0x00, 0x00, //   @: @-
+    0x00, 0xE4, 0x7B, 0x00, 0x00, 0x00, //   @=#@
+    0x00, 0x9E, 0xC1, 0x00, 0x00, 0x00, //   @@@.
+    0x02, 0xCF, 0x40, 0x03, 0xD0, 0x00, //  :@@=  -@
+    0x0C, 0x97, 0xD1, 0x08, 0x90, 0x00, //  @@#@. %@
+    0x4F, 0x10, 0xAC, 0x2E, 0x30, 0x00, // =@. @@:@-
+    0x4F, 0x10, 0x0B, 0xFA, 0x00, 0x00, // =@.  @@@
+    0x1D, 0xA2, 0x3A, 0xEE, 0x60, 0x00, // .@@:-@@@*
+    0x02, 0xBE, 0xE9, 0x15, 0xC1, 0x00, //  :@@@@.+@.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @672 ''' (11 pixels wide)
+    0x00, 0x00, 0x64, 0x00, 0x00, 0x00, //     *=
+    0x00, 0x01, 0xFA, 0x00, 0x00, 0x00, //    .@@
+    0x00, 0x00, 0xF9, 0x00, 0x00, 0x00, //     @@
+    0x00, 0x00, 0xE8, 0x00, 0x00, 0x00, //     @%
+    0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, //     @*
+    0x00, 0x00, 0xA5, 0x00, 0x00, 0x00, //     @+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @768 '(' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x54, 0x00, 0x00, //       +=
+    0x00, 0x00, 0x06, 0xE2, 0x00, 0x00, //      *@:
+    0x00, 0x00, 0x2E, 0x30, 0x00, 0x00, //     :@-
+    0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, //     @%
+    0x00, 0x02, 0xF1, 0x00, 0x00, 0x00, //    :@.
+    0x00, 0x07, 0xB0, 0x00, 0x00, 0x00, //    #@
+    0x00, 0x08, 0x90, 0x00, 0x00, 0x00, //    %@
+    0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, //    @%
+    0x00, 0x09, 0x90, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x07, 0xB0, 0x00, 0x00, 0x00, //    #@
+    0x00, 0x02, 0xF1, 0x00, 0x00, 0x00, //    :@.
+    0x00, 0x00, 0xB7, 0x00, 0x00, 0x00, //     @#
+    0x00, 0x00, 0x3E, 0x20, 0x00, 0x00, //     -@:
+    0x00, 0x00, 0x06, 0xD2, 0x00, 0x00, //      *@:
+    0x00, 0x00, 0x00, 0x64, 0x00, 0x00, //       *=
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @864 ')' (11 pixels wide)
+    0x00, 0x72, 0x00, 0x00, 0x00, 0x00, //   #:
+    0x00, 0x7D, 0x10, 0x00, 0x00, 0x00, //   #@.
+    0x00, 0x09, 0xB0, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x01, 0xD5, 0x00, 0x00, 0x00, //    .@+
+    0x00, 0x00, 0x7B, 0x00, 0x00, 0x00, //     #@
+    0x00, 0x00, 0x2F, 0x10, 0x00, 0x00, //     :@.
+    0x00, 0x00, 0x0F, 0x20, 0x00, 0x00, //      @:
+    0x00, 0x00, 0x0E, 0x40, 0x00, 0x00, //      @=
+    0x00, 0x00, 0x0F, 0x20, 0x00, 0x00, //      @:
+    0x00, 0x00, 0x2F, 0x10, 0x00, 0x00, //     :@.
+    0x00, 0x00, 0x7B, 0x00, 0x00, 0x00, //     #@
+    0x00, 0x00, 0xD5, 0x00, 0x00, 0x00, //     @+
+    0x00, 0x08, 0xB0, 0x00, 0x00, 0x00, //    %@
+    0x00, 0x6D, 0x20, 0x00, 0x00, 0x00, //   *@:
+    0x00, 0x82, 0x00, 0x00, 0x00, 0x00, //   %:
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @960 '*' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x93, 0x00, 0x00, 0x00, //     @-
+    0x00, 0x00, 0xA4, 0x00, 0x00, 0x00, //     @=
+    0x06, 0x83, 0xB5, 0x5A, 0x20, 0x00, //  *%-@++@:
+    0x01, 0x6C, 0xFF, 0xA3, 0x00, 0x00, //  .*@@@@-
+    0x00, 0x06, 0xDD, 0x10, 0x00, 0x00, //    *@@.
+    0x00, 0x1D, 0x28, 0x90, 0x00, 0x00, //   .@:%@
+    0x00, 0x95, 0x00, 0xB3, 0x00, 0x00, //   @+  @-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @1056 '+' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x31, 0x00, 0x00, 0x00, //     -.
+    0x00, 0x00, 0xB5, 0x00, 0x00, 0x00, //     @+
+    0x00, 0x00, 0xB5, 0x00, 0x00, 0x00, //     @+
+    0x00, 0x00, 0xB5, 0x00, 0x00, 0x00, //     @+
+    0x0A, 0xFF, 0xFF, 0xFF, 0x40, 0x00, //  @@@@@@@=
+    0x00, 0x00, 0xB5, 0x00, 0x00, 0x00, //     @+
+    0x00, 0x00, 0xB5, 0x00, 0x00, 0x00, //     @+
+    0x00, 0x00, 0xB5, 0x00, 0x00, 0x00, //     @+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @1152 ',' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x53, 0x00, 0x00, 0x00, //     +-
+    0x00, 0x05, 0xFF, 0x20, 0x00, 0x00, //    +@@:
+    0x00, 0x02, 0xEF, 0x50, 0x00, 0x00, //    :@@+
+    0x00, 0x00, 0x0E, 0x30, 0x00, 0x00, //      @-
+    0x00, 0x00, 0x5D, 0x00, 0x00, 0x00, //     +@
+    0x00, 0x07, 0xD3, 0x00, 0x00, 0x00, //    #@-
+    0x00, 0x03, 0x10, 0x00, 0x00, 0x00, //    -.
+    // @1248 '-' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x0A, 0xFF, 0xFF, 0xFF, 0x40, 0x00, //  @@@@@@@=
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @1344 '.' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x01, 0x96, 0x00, 0x00, 0x00, //    .@*
+    0x00, 0x07, 0xFF, 0x10, 0x00, 0x00, //    #@@.
+    0x00, 0x03, 0xEB, 0x00, 0x00, 0x00, //    -@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @1440 '/' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, //       +@
+    0x00, 0x00, 0x00, 0xB7, 0x00, 0x00, //       @#
+    0x00, 0x00, 0x02, 0xF1, 0x00, 0x00, //      :@.
+    0x00, 0x00, 0x07, 0xB0, 0x00, 0x00, //      #@
+    0x00, 0x00, 0x0D, 0x50, 0x00, 0x00, //      @+
+    0x00, 0x00, 0x4E, 0x00, 0x00, 0x00, //     =@
+    0x00, 0x00, 0x99, 0x00, 0x00, 0x00, //     @@
+    0x00, 0x01, 0xE3, 0x00, 0x00, 0x00, //    .@-
+    0x00, 0x05, 0xC0, 0x00, 0x00, 0x00, //    +@
+    0x00, 0x0B, 0x70, 0x00, 0x00, 0x00, //    @#
+    0x00, 0x2F, 0x10, 0x00, 0x00, 0x00, //   :@.
+    0x00, 0x7B, 0x00, 0x00, 0x00, 0x00, //   #@
+    0x00, 0xD5, 0x00, 0x00, 0x00, 0x00, //   @+
+    0x04, 0xE0, 0x00, 0x00, 0x00, 0x00, //  =@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @1536 '0' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x2B, 0xEE, 0x80, 0x00, 0x00, //   :@@@%
+    0x01, 0xD9, 0x24, 0xD8, 0x00, 0x00, //  .@@:=@%
+    0x06, 0xD0, 0x00, 0x4F, 0x10, 0x00, //  *@   =@.
+    0x0A, 0x80, 0x00, 0x0E, 0x40, 0x00, //  @%    @=
+    0x0C, 0x60, 0x10, 0x0C, 0x60, 0x00, //  @* .  @*
+    0x0D, 0x61, 0xEA, 0x0C, 0x70, 0x00, //  @*.@@ @#
+    0x0C, 0x61, 0xD9, 0x0C, 0x60, 0x00, //  @*.@@ @*
+    0x0A, 0x80, 0x00, 0x0E, 0x40, 0x00, //  @%    @=
+    0x06, 0xD0, 0x00, 0x4E, 0x10, 0x00, //  *@   =@.
+    0x00, 0xD9, 0x24, 0xD7, 0x00, 0x00, //   @@:=@#
+    0x00, 0x2B, 0xEE, 0x70, 0x00, 0x00, //   :@@@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @1632 '1' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x37, 0xDC, 0x00, 0x00, 0x00, //   -#@@
+    0x00, 0x8B, 0xDC, 0x00, 0x00, 0x00, //   %@@@
+    0x00, 0x00, 0x8C, 0x00, 0x00, 0x00, //     %@
+    0x00, 0x00, 0x8C, 0x00, 0x00, 0x00, //     %@
+    0x00, 0x00, 0x8C, 0x00, 0x00, 0x00, //     %@
+    0x00, 0x00, 0x8C, 0x00, 0x00, 0x00, //     %@
+    0x00, 0x00, 0x8C, 0x00, 0x00, 0x00, //     %@
+    0x00, 0x00, 0x8C, 0x00, 0x00, 0x00, //     %@
+    0x00, 0x00, 0x8C, 0x00, 0x00, 0x00, //     %@
+    0x01, 0x11, 0x9C, 0x11, 0x10, 0x00, //  ...@@...
+    0x07, 0xFF, 0xFF, 0xFF, 0x70, 0x00, //  #@@@@@@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @1728 '2' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x7D, 0xEC, 0x50, 0x00, 0x00, //   #@@@+
+    0x09, 0xC4, 0x26, 0xF5, 0x00, 0x00, //  @@=:*@+
+    0x02, 0x10, 0x00, 0x9A, 0x00, 0x00, //  :.   @@
+    0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, //       %@
+    0x00, 0x00, 0x00, 0xC8, 0x00, 0x00, //       @%
+    0x00, 0x00, 0x06, 0xE1, 0x00, 0x00, //      *@.
+    0x00, 0x00, 0x3E, 0x50, 0x00, 0x00, //     -@+
+    0x00, 0x02, 0xE7, 0x00, 0x00, 0x00, //    :@#
+    0x00, 0x2E, 0x80, 0x00, 0x00, 0x00, //   :@%
+    0x03, 0xE9, 0x11, 0x11, 0x00, 0x00, //  -@@....
+    0x0C, 0xFF, 0xFF, 0xFF, 0x50, 0x00, //  @@@@@@@+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @1824 '3' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x7D, 0xFD, 0x70, 0x00, 0x00, //   #@@@#
+    0x07, 0xD4, 0x25, 0xE8, 0x00, 0x00, //  #@=:+@%
+    0x00, 0x10, 0x00, 0x7D, 0x00, 0x00, //   .   #@
+    0x00, 0x00, 0x00, 0x8C, 0x00, 0x00, //       %@
+    0x00, 0x00, 0x16, 0xE4, 0x00, 0x00, //     .*@=
+    0x00, 0x0A, 0xFE, 0x50, 0x00, 0x00, //    @@@+
+    0x00, 0x01, 0x36, 0xD8, 0x00, 0x00, //    .-*@%
+    0x00, 0x00, 0x00, 0x3F, 0x20, 0x00, //       -@:
+    0x02, 0x00, 0x00, 0x2F, 0x30, 0x00, //  :    :@-
+    0x0D, 0xA3, 0x24, 0xCC, 0x00, 0x00, //  @@-:=@@
+    0x02, 0x9D, 0xFD, 0x91, 0x00, 0x00, //  :@@@@@.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @1920 '4' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x09, 0xF2, 0x00, 0x00, //      @@:
+    0x00, 0x00, 0x5D, 0xF2, 0x00, 0x00, //     +@@:
+    0x00, 0x02, 0xE5, 0xF2, 0x00, 0x00, //    :@+@:
+    0x00, 0x0B, 0x92, 0xF2, 0x00, 0x00, //    @@:@:
+    0x00, 0x7D, 0x12, 0xF2, 0x00, 0x00, //   #@.:@:
+    0x03, 0xE3, 0x02, 0xF2, 0x00, 0x00, //  -@- :@:
+    0x0C, 0x70, 0x02, 0xF2, 0x00, 0x00, //  @#  :@:
+    0x5F, 0xEE, 0xEE, 0xFE, 0xA0, 0x00, // +@@@@@@@@
+    0x12, 0x22, 0x23, 0xF4, 0x10, 0x00, // .::::-@=.
+    0x00, 0x00, 0x02, 0xF2, 0x00, 0x00, //      :@:
+    0x00, 0x00, 0x02, 0xF2, 0x00, 0x00, //      :@:
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @2016 '5' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0xFF, 0xFF, 0xFD, 0x00, 0x00, //   @@@@@@
+    0x01, 0xF5, 0x22, 0x22, 0x00, 0x00, //  .@+::::
+    0x01, 0xF2, 0x00, 0x00, 0x00, 0x00, //  .@:
+    0x02, 0xF0, 0x00, 0x00, 0x00, 0x00, //  :@
+    0x03, 0xFB, 0xED, 0x91, 0x00, 0x00, //  -@@@@@.
+    0x01, 0x83, 0x03, 0xCC, 0x00, 0x00, //  .%- -@@
+    0x00, 0x00, 0x00, 0x2F, 0x40, 0x00, //       :@=
+    0x00, 0x00, 0x00, 0x0F, 0x50, 0x00, //        @+
+    0x01, 0x00, 0x00, 0x4F, 0x30, 0x00, //  .    =@-
+    0x0D, 0x93, 0x25, 0xD9, 0x00, 0x00, //  @@-:+@@
+    0x02, 0x9D, 0xFD, 0x70, 0x00, 0x00, //  :@@@@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @2112 '6' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x07, 0xDF, 0xD7, 0x00, 0x00, //    #@@@#
+    0x00, 0x8E, 0x62, 0x5B, 0x10, 0x00, //   %@*:+@.
+    0x02, 0xF5, 0x00, 0x00, 0x00, 0x00, //  :@+
+    0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, //  #@
+    0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, //  @@
+    0x0B, 0x86, 0xDE, 0xC5, 0x00, 0x00, //  @%*@@@+
+    0x0B, 0xE7, 0x11, 0x6F, 0x30, 0x00, //  @@#..*@-
+    0x09, 0x90, 0x00, 0x0C, 0x70, 0x00, //  @@    @#
+    0x05, 0xD0, 0x00, 0x0C, 0x70, 0x00, //  +@    @#
+    0x00, 0xCA, 0x21, 0x8E, 0x20, 0x00, //   @@:.%@:
+    0x00, 0x19, 0xEE, 0xB2, 0x00, 0x00, //   .@@@@:
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @2208 '7' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x0D, 0xFF, 0xFF, 0xFF, 0x80, 0x00, //  @@@@@@@%
+    0x02, 0x22, 0x22, 0x6E, 0x10, 0x00, //  :::::*@.
+    0x00, 0x00, 0x01, 0xD4, 0x00, 0x00, //      .@=
+    0x00, 0x00, 0x08, 0xB0, 0x00, 0x00, //      %@
+    0x00, 0x00, 0x1E, 0x40, 0x00, 0x00, //     .@=
+    0x00, 0x00, 0x6C, 0x00, 0x00, 0x00, //     *@
+    0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, //     @%
+    0x00, 0x00, 0xE5, 0x00, 0x00, 0x00, //     @+
+    0x00, 0x02, 0xF3, 0x00, 0x00, 0x00, //    :@-
+    0x00, 0x04, 0xF1, 0x00, 0x00, 0x00, //    =@.
+    0x00, 0x05, 0xF0, 0x00, 0x00, 0x00, //    +@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @2304 '8' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x2B, 0xEE, 0x91, 0x00, 0x00, //   :@@@@.
+    0x00, 0xD7, 0x01, 0xAA, 0x00, 0x00, //   @# .@@
+    0x03, 0xF0, 0x00, 0x2F, 0x00, 0x00, //  -@   :@
+    0x02, 0xF4, 0x00, 0x4E, 0x00, 0x00, //  :@=  =@
+    0x00, 0x7F, 0x94, 0xD5, 0x00, 0x00, //   #@@=@+
+    0x00, 0x4D, 0xCF, 0xC1, 0x00, 0x00, //   =@@@@.
+    0x05, 0xD2, 0x03, 0xBD, 0x10, 0x00, //  +@: -@@.
+    0x0C, 0x60, 0x00, 0x0E, 0x60, 0x00, //  @*    @*
+    0x0C, 0x60, 0x00, 0x0D, 0x60, 0x00, //  @*    @*
+    0x07, 0xE4, 0x01, 0x7E, 0x20, 0x00, //  #@= .#@:
+    0x00, 0x6C, 0xEE, 0xB3, 0x00, 0x00, //   *@@@@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @2400 '9' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x4C, 0xFD, 0x60, 0x00, 0x00, //   =@@@*
+    0x04, 0xE5, 0x15, 0xE6, 0x00, 0x00, //  =@+.+@*
+    0x0B, 0x80, 0x00, 0x6E, 0x00, 0x00, //  @%   *@
+    0x0D, 0x50, 0x00, 0x1F, 0x30, 0x00, //  @+   .@-
+    0x0C, 0x70, 0x00, 0x1E, 0x50, 0x00, //  @#   .@+
+    0x07, 0xE4, 0x14, 0xCE, 0x50, 0x00, //  #@=.=@@+
+    0x00, 0x7D, 0xEB, 0x2E, 0x40, 0x00, //   #@@@:@=
+    0x00, 0x00, 0x00, 0x2F, 0x10, 0x00, //       :@.
+    0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, //       %@
+    0x05, 0x93, 0x37, 0xE3, 0x00, 0x00, //  +@--#@-
+    0x02, 0xAE, 0xEB, 0x30, 0x00, 0x00, //  :@@@@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @2496 ':' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x03, 0xEB, 0x00, 0x00, 0x00, //    -@@
+    0x00, 0x07, 0xFF, 0x10, 0x00, 0x00, //    #@@.
+    0x00, 0x01, 0x96, 0x00, 0x00, 0x00, //    .@*
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x01, 0x96, 0x00, 0x00, 0x00, //    .@*
+    0x00, 0x07, 0xFF, 0x10, 0x00, 0x00, //    #@@.
+    0x00, 0x03, 0xEB, 0x00, 0x00, 0x00, //    -@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @2592 ';' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x03, 0xEB, 0x00, 0x00, 0x00, //    -@@
+    0x00, 0x07, 0xFF, 0x10, 0x00, 0x00, //    #@@.
+    0x00, 0x01, 0x96, 0x00, 0x00, 0x00, //    .@*
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x53, 0x00, 0x00, 0x00, //     +-
+    0x00, 0x05, 0xFF, 0x20, 0x00, 0x00, //    +@@:
+    0x00, 0x02, 0xEF, 0x50, 0x00, 0x00, //    :@@+
+    0x00, 0x00, 0x0E, 0x30, 0x00, 0x00, //      @-
+    0x00, 0x00, 0x5D, 0x00, 0x00, 0x00, //     +@
+    0x00, 0x07, 0xD3, 0x00, 0x00, 0x00, //    #@-
+    0x00, 0x03, 0x10, 0x00, 0x00, 0x00, //    -.
+    // @2688 '<' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x18, 0x00, 0x00, //       .%
+    0x00, 0x00, 0x04, 0xD9, 0x00, 0x00, //      =@@
+    0x00, 0x01, 0x9E, 0x50, 0x00, 0x00, //    .@@+
+    0x00, 0x3D, 0xA1, 0x00, 0x00, 0x00, //   -@@.
+    0x01, 0xF7, 0x00, 0x00, 0x00, 0x00, //  .@#
+    0x00, 0x9E, 0x50, 0x00, 0x00, 0x00, //   @@+
+    0x00, 0x04, 0xDA, 0x10, 0x00, 0x00, //    =@@.
+    0x00, 0x00, 0x19, 0xE5, 0x00, 0x00, //     .@@+
+    0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, //       =@
+    0x00, 0x00, 0x00, 0x01, 0x00, 0x00, //        .
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @2784 '=' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x0A, 0xFF, 0xFF, 0xFF, 0x40, 0x00, //  @@@@@@@=
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x0A, 0xFF, 0xFF, 0xFF, 0x40, 0x00, //  @@@@@@@=
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @2880 '>' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x03, 0x50, 0x00, 0x00, 0x00, 0x00, //  -+
+    0x02, 0xDA, 0x10, 0x00, 0x00, 0x00, //  :@@.
+    0x00, 0x19, 0xE5, 0x00, 0x00, 0x00, //   .@@+
+    0x00, 0x00, 0x4D, 0xA1, 0x00, 0x00, //     =@@.
+    0x00, 0x00, 0x01, 0xCA, 0x00, 0x00, //      .@@
+    0x00, 0x00, 0x19, 0xE4, 0x00, 0x00, //     .@@=
+    0x00, 0x04, 0xDA, 0x10, 0x00, 0x00, //    =@@.
+    0x01, 0x9E, 0x50, 0x00, 0x00, 0x00, //  .@@+
+    0x04, 0xB1, 0x00, 0x00, 0x00, 0x00, //  =@.
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, //  .
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @2976 '?' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x4C, 0xFD, 0x70, 0x00, 0x00, //   =@@@#
+    0x01, 0xC6, 0x25, 0xE6, 0x00, 0x00, //  .@*:+@*
+    0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x01, 0xE5, 0x00, 0x00, //      .@+
+    0x00, 0x00, 0x1C, 0x80, 0x00, 0x00, //     .@%
+    0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, //     @@
+    0x00, 0x01, 0xF1, 0x00, 0x00, 0x00, //    .@.
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, //     :
+    0x00, 0x01, 0x62, 0x00, 0x00, 0x00, //    .*:
+    0x00, 0x08, 0xFA, 0x00, 0x00, 0x00, //    %@@
+    0x00, 0x05, 0xE7, 0x00, 0x00, 0x00, //    +@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @3072 '@' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x07, 0xDE, 0xD4, 0x00, 0x00, //    #@@@=
+    0x00, 0xBA, 0x10, 0x3D, 0x20, 0x00, //   @@. -@:
+    0x06, 0xB0, 0x00, 0x07, 0x80, 0x00, //  *@    #%
+    0x0C, 0x40, 0x00, 0x03, 0xA0, 0x00, //  @=    -@
+    0x1F, 0x00, 0x16, 0xAD, 0xB0, 0x00, // .@  .*@@@
+    0x2D, 0x01, 0xDA, 0x35, 0xB0, 0x00, // :@ .@@-+@
+    0x3C, 0x06, 0xB0, 0x04, 0xB0, 0x00, // -@ *@  =@
+    0x2D, 0x04, 0xC0, 0x1A, 0xB0, 0x00, // :@ =@ .@@
+    0x0E, 0x00, 0x7B, 0xA4, 0x90, 0x00, //  @  #@@=@
+    0x0B, 0x50, 0x00, 0x00, 0x00, 0x00, //  @+
+    0x04, 0xC0, 0x00, 0x00, 0x00, 0x00, //  =@
+    0x00, 0x9B, 0x20, 0x27, 0x00, 0x00, //   @@: :#
+    0x00, 0x06, 0xCD, 0xC6, 0x00, 0x00, //    *@@@*
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @3168 'A' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x02, 0xFB, 0x00, 0x00, 0x00, //    :@@
+    0x00, 0x07, 0xCF, 0x10, 0x00, 0x00, //    #@@.
+    0x00, 0x0B, 0x6D, 0x50, 0x00, 0x00, //    @*@+
+    0x00, 0x1F, 0x39, 0xA0, 0x00, 0x00, //   .@-@@
+    0x00, 0x6E, 0x05, 0xE1, 0x00, 0x00, //   *@ +@.
+    0x00, 0xBA, 0x01, 0xF5, 0x00, 0x00, //   @@ .@+
+    0x01, 0xF6, 0x00, 0xCA, 0x00, 0x00, //  .@*  @@
+    0x05, 0xFE, 0xEE, 0xFE, 0x00, 0x00, //  +@@@@@@
+    0x0A, 0xB2, 0x22, 0x4F, 0x40, 0x00, //  @@:::=@=
+    0x1E, 0x60, 0x00, 0x0D, 0x90, 0x00, // .@*    @@
+    0x5F, 0x10, 0x00, 0x07, 0xE0, 0x00, // +@.    #@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @3264 'B' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x05, 0xFF, 0xFD, 0x91, 0x00, 0x00, //  +@@@@@.
+    0x05, 0xF1, 0x13, 0xCC, 0x00, 0x00, //  +@..-@@
+    0x05, 0xF0, 0x00, 0x4F, 0x10, 0x00, //  +@   =@.
+    0x05, 0xF0, 0x00, 0x4F, 0x10, 0x00, //  +@   =@.
+    0x05, 0xF0, 0x03, 0xC8, 0x00, 0x00, //  +@  -@%
+    0x05, 0xFF, 0xFF, 0xB2, 0x00, 0x00, //  +@@@@@:
+    0x05, 0xF0, 0x01, 0x6E, 0x40, 0x00, //  +@  .*@=
+    0x05, 0xF0, 0x00, 0x0A, 0xA0, 0x00, //  +@    @@
+    0x05, 0xF0, 0x00, 0x0B, 0xA0, 0x00, //  +@    @@
+    0x05, 0xF1, 0x12, 0x8F, 0x40, 0x00, //  +@..:%@=
+    0x05, 0xFF, 0xFE, 0xB4, 0x00, 0x00, //  +@@@@@=
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @3360 'C' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x06, 0xCF, 0xE8, 0x00, 0x00, //    *@@@%
+    0x00, 0x9E, 0x73, 0x5D, 0x50, 0x00, //   @@#-+@+
+    0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, //  =@=
+    0x0A, 0xC0, 0x00, 0x00, 0x00, 0x00, //  @@
+    0x0D, 0x80, 0x00, 0x00, 0x00, 0x00, //  @%
+    0x0E, 0x70, 0x00, 0x00, 0x00, 0x00, //  @#
+    0x0D, 0x80, 0x00, 0x00, 0x00, 0x00, //  @%
+    0x0A, 0xC0, 0x00, 0x00, 0x00, 0x00, //  @@
+    0x04, 0xF4, 0x00, 0x01, 0x10, 0x00, //  =@=   ..
+    0x00, 0xAF, 0x73, 0x5C, 0x90, 0x00, //   @@#-+@@
+    0x00, 0x07, 0xDF, 0xD8, 0x10, 0x00, //    #@@@%.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @3456 'D' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x0A, 0xFF, 0xEC, 0x60, 0x00, 0x00, //  @@@@@*
+    0x0A, 0xB1, 0x27, 0xE8, 0x00, 0x00, //  @@.:#@%
+    0x0A, 0xA0, 0x00, 0x5F, 0x30, 0x00, //  @@   +@-
+    0x0A, 0xA0, 0x00, 0x0D, 0x80, 0x00, //  @@    @%
+    0x0A, 0xA0, 0x00, 0x0A, 0xB0, 0x00, //  @@    @@
+    0x0A, 0xA0, 0x00, 0x09, 0xB0, 0x00, //  @@    @@
+    0x0A, 0xA0, 0x00, 0x0B, 0xB0, 0x00, //  @@    @@
+    0x0A, 0xA0, 0x00, 0x0E, 0x80, 0x00, //  @@    @%
+    0x0A, 0xA0, 0x00, 0x6F, 0x30, 0x00, //  @@   *@-
+    0x0A, 0xB1, 0x27, 0xF8, 0x00, 0x00, //  @@.:#@%
+    0x0A, 0xFF, 0xEC, 0x50, 0x00, 0x00, //  @@@@@+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @3552 'E' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x02, 0xFF, 0xFF, 0xFF, 0x50, 0x00, //  :@@@@@@+
+    0x02, 0xF4, 0x22, 0x22, 0x10, 0x00, //  :@=::::.
+    0x02, 0xF3, 0x00, 0x00, 0x00, 0x00, //  :@-
+    0x02, 0xF3, 0x00, 0x00, 0x00, 0x00, //  :@-
+    0x02, 0xF3, 0x00, 0x00, 0x00, 0x00, //  :@-
+    0x02, 0xFF, 0xFF, 0xF7, 0x00, 0x00, //  :@@@@@#
+    0x02, 0xF5, 0x22, 0x21, 0x00, 0x00, //  :@+:::.
+    0x02, 0xF3, 0x00, 0x00, 0x00, 0x00, //  :@-
+    0x02, 0xF3, 0x00, 0x00, 0x00, 0x00, //  :@-
+    0x02, 0xF5, 0x22, 0x22, 0x10, 0x00, //  :@+::::.
+    0x02, 0xFF, 0xFF, 0xFF, 0x70, 0x00, //  :@@@@@@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @3648 'F' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0xDF, 0xFF, 0xFF, 0x90, 0x00, //   @@@@@@@
+    0x00, 0xD8, 0x22, 0x22, 0x10, 0x00, //   @%::::.
+    0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, //   @#
+    0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, //   @#
+    0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, //   @#
+    0x00, 0xDF, 0xFF, 0xFC, 0x00, 0x00, //   @@@@@@
+    0x00, 0xD8, 0x22, 0x22, 0x00, 0x00, //   @%::::
+    0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, //   @#
+    0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, //   @#
+    0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, //   @#
+    0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, //   @#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @3744 'G' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x18, 0xDF, 0xC6, 0x00, 0x00, //   .%@@@*
+    0x01, 0xCD, 0x53, 0x5D, 0x20, 0x00, //  .@@+-+@:
+    0x08, 0xE2, 0x00, 0x00, 0x00, 0x00, //  %@:
+    0x0D, 0x90, 0x00, 0x00, 0x00, 0x00, //  @@
+    0x1F, 0x50, 0x00, 0x00, 0x00, 0x00, // .@+
+    0x2F, 0x40, 0x0B, 0xEE, 0x80, 0x00, // :@=  @@@%
+    0x1F, 0x50, 0x02, 0x2B, 0x80, 0x00, // .@+  ::@%
+    0x0E, 0x80, 0x00, 0x0B, 0x80, 0x00, //  @%    @%
+    0x08, 0xE2, 0x00, 0x0B, 0x80, 0x00, //  %@:   @%
+    0x01, 0xDD, 0x53, 0x6E, 0x80, 0x00, //  .@@+-*@%
+    0x00, 0x19, 0xDF, 0xD7, 0x00, 0x00, //   .@@@@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @3840 'H' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x0B, 0x90, 0x00, 0x0F, 0x50, 0x00, //  @@    @+
+    0x0B, 0x90, 0x00, 0x0F, 0x50, 0x00, //  @@    @+
+    0x0B, 0x90, 0x00, 0x0F, 0x50, 0x00, //  @@    @+
+    0x0B, 0x90, 0x00, 0x0F, 0x50, 0x00, //  @@    @+
+    0x0B, 0x90, 0x00, 0x0F, 0x50, 0x00, //  @@    @+
+    0x0B, 0xFF, 0xFF, 0xFF, 0x50, 0x00, //  @@@@@@@+
+    0x0B, 0xA3, 0x33, 0x3F, 0x50, 0x00, //  @@----@+
+    0x0B, 0x90, 0x00, 0x0F, 0x50, 0x00, //  @@    @+
+    0x0B, 0x90, 0x00, 0x0F, 0x50, 0x00, //  @@    @+
+    0x0B, 0x90, 0x00, 0x0F, 0x50, 0x00, //  @@    @+
+    0x0B, 0x90, 0x00, 0x0F, 0x50, 0x00, //  @@    @+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @3936 'I' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x07, 0xFF, 0xFF, 0xFF, 0x10, 0x00, //  #@@@@@@.
+    0x01, 0x22, 0xD8, 0x22, 0x00, 0x00, //  .::@%::
+    0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, //     @#
+    0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, //     @#
+    0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, //     @#
+    0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, //     @#
+    0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, //     @#
+    0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, //     @#
+    0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, //     @#
+    0x01, 0x22, 0xD8, 0x22, 0x00, 0x00, //  .::@%::
+    0x07, 0xFF, 0xFF, 0xFF, 0x10, 0x00, //  #@@@@@@.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @4032 'J' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0xDF, 0xFF, 0xFD, 0x00, 0x00, //   @@@@@@
+    0x00, 0x22, 0x22, 0x8D, 0x00, 0x00, //   ::::%@
+    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, //       #@
+    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, //       #@
+    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, //       #@
+    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, //       #@
+    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, //       #@
+    0x00, 0x00, 0x00, 0x7D, 0x00, 0x00, //       #@
+    0x01, 0x30, 0x00, 0xAB, 0x00, 0x00, //  .-   @@
+    0x07, 0xE6, 0x37, 0xF5, 0x00, 0x00, //  #@*-#@+
+    0x00, 0x7D, 0xFD, 0x70, 0x00, 0x00, //   #@@@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @4128 'K' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x07, 0xE0, 0x00, 0x2E, 0x70, 0x00, //  #@   :@#
+    0x07, 0xE0, 0x00, 0xCA, 0x00, 0x00, //  #@   @@
+    0x07, 0xE0, 0x09, 0xD1, 0x00, 0x00, //  #@  @@.
+    0x07, 0xE0, 0x6E, 0x20, 0x00, 0x00, //  #@ *@:
+    0x07, 0xE4, 0xFB, 0x00, 0x00, 0x00, //  #@=@@
+    0x07, 0xEE, 0xAF, 0x40, 0x00, 0x00, //  #@@@@=
+    0x07, 0xFB, 0x09, 0xC0, 0x00, 0x00, //  #@@ @@
+    0x07, 0xE1, 0x02, 0xF5, 0x00, 0x00, //  #@. :@+
+    0x07, 0xE0, 0x00, 0x8D, 0x00, 0x00, //  #@   %@
+    0x07, 0xE0, 0x00, 0x1E, 0x70, 0x00, //  #@   .@#
+    0x07, 0xE0, 0x00, 0x07, 0xE1, 0x00, //  #@    #@.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @4224 'L' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, //   @#
+    0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, //   @#
+    0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, //   @#
+    0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, //   @#
+    0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, //   @#
+    0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, //   @#
+    0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, //   @#
+    0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, //   @#
+    0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, //   @#
+    0x00, 0xD8, 0x22, 0x22, 0x10, 0x00, //   @%::::.
+    0x00, 0xDF, 0xFF, 0xFF, 0xA0, 0x00, //   @@@@@@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @4320 'M' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x0B, 0xE0, 0x00, 0x5F, 0x40, 0x00, //  @@   +@=
+    0x0B, 0xE4, 0x00, 0xAE, 0x40, 0x00, //  @@=  @@=
+    0x0B, 0xA8, 0x00, 0xDC, 0x40, 0x00, //  @@%  @@=
+    0x0B, 0x7D, 0x04, 0xAC, 0x40, 0x00, //  @#@ =@@=
+    0x0B, 0x6C, 0x39, 0x5C, 0x40, 0x00, //  @*@-@+@=
+    0x0B, 0x66, 0x7D, 0x1C, 0x40, 0x00, //  @**#@.@=
+    0x0B, 0x61, 0xEA, 0x0C, 0x40, 0x00, //  @*.@@ @=
+    0x0B, 0x60, 0xB5, 0x0C, 0x40, 0x00, //  @* @+ @=
+    0x0B, 0x60, 0x00, 0x0C, 0x40, 0x00, //  @*    @=
+    0x0B, 0x60, 0x00, 0x0C, 0x40, 0x00, //  @*    @=
+    0x0B, 0x60, 0x00, 0x0C, 0x40, 0x00, //  @*    @=
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @4416 'N' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x0A, 0xE0, 0x00, 0x0F, 0x40, 0x00, //  @@    @=
+    0x0A, 0xF6, 0x00, 0x0F, 0x40, 0x00, //  @@*   @=
+    0x0A, 0xAD, 0x00, 0x0F, 0x40, 0x00, //  @@@   @=
+    0x0A, 0x8B, 0x60, 0x0F, 0x40, 0x00, //  @%@*  @=
+    0x0A, 0x84, 0xD0, 0x0F, 0x40, 0x00, //  @%=@  @=
+    0x0A, 0x90, 0xC6, 0x0F, 0x40, 0x00, //  @@ @* @=
+    0x0A, 0x90, 0x5D, 0x0E, 0x40, 0x00, //  @@ +@ @=
+    0x0A, 0x90, 0x0C, 0x5E, 0x40, 0x00, //  @@  @+@=
+    0x0A, 0x90, 0x05, 0xCD, 0x40, 0x00, //  @@  +@@=
+    0x0A, 0x90, 0x00, 0xCF, 0x40, 0x00, //  @@   @@=
+    0x0A, 0x90, 0x00, 0x5F, 0x40, 0x00, //  @@   +@=
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @4512 'O' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x3B, 0xEE, 0x80, 0x00, 0x00, //   -@@@%
+    0x02, 0xEA, 0x35, 0xDA, 0x00, 0x00, //  :@@-+@@
+    0x0A, 0xC0, 0x00, 0x3F, 0x40, 0x00, //  @@   -@=
+    0x0F, 0x60, 0x00, 0x0C, 0x90, 0x00, //  @*    @@
+    0x3F, 0x40, 0x00, 0x0A, 0xB0, 0x00, // -@=    @@
+    0x3F, 0x20, 0x00, 0x09, 0xC0, 0x00, // -@:    @@
+    0x2F, 0x40, 0x00, 0x0A, 0xB0, 0x00, // :@=    @@
+    0x0F, 0x60, 0x00, 0x0D, 0x90, 0x00, //  @*    @@
+    0x0A, 0xC0, 0x00, 0x4F, 0x40, 0x00, //  @@   =@=
+    0x02, 0xEA, 0x35, 0xDA, 0x00, 0x00, //  :@@-+@@
+    0x00, 0x3B, 0xEE, 0x80, 0x00, 0x00, //   -@@@%
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @4608 'P' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x06, 0xFF, 0xFE, 0xB4, 0x00, 0x00, //  *@@@@@=
+    0x06, 0xE1, 0x12, 0x8F, 0x40, 0x00, //  *@..:%@=
+    0x06, 0xE0, 0x00, 0x0C, 0x90, 0x00, //  *@    @@
+    0x06, 0xE0, 0x00, 0x0A, 0xA0, 0x00, //  *@    @@
+    0x06, 0xE0, 0x00, 0x0C, 0x90, 0x00, //  *@    @@
+    0x06, 0xE0, 0x01, 0x7F, 0x30, 0x00, //  *@  .#@-
+    0x06, 0xFE, 0xEF, 0xD4, 0x00, 0x00, //  *@@@@@=
+    0x06, 0xE2, 0x21, 0x00, 0x00, 0x00, //  *@::.
+    0x06, 0xE0, 0x00, 0x00, 0x00, 0x00, //  *@
+    0x06, 0xE0, 0x00, 0x00, 0x00, 0x00, //  *@
+    0x06, 0xE0, 0x00, 0x00, 0x00, 0x00, //  *@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @4704 'Q' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x3B, 0xEE, 0x80, 0x00, 0x00, //   -@@@%
+    0x02, 0xE9, 0x35, 0xDA, 0x00, 0x00, //  :@@-+@@
+    0x0A, 0xC0, 0x00, 0x3F, 0x30, 0x00, //  @@   -@-
+    0x0F, 0x60, 0x00, 0x0D, 0x80, 0x00, //  @*    @%
+    0x2F, 0x30, 0x00, 0x0A, 0xB0, 0x00, // :@-    @@
+    0x3F, 0x30, 0x00, 0x09, 0xB0, 0x00, // -@-    @@
+    0x1F, 0x40, 0x00, 0x0B, 0x90, 0x00, // .@=    @@
+    0x0E, 0x70, 0x00, 0x0E, 0x70, 0x00, //  @#    @#
+    0x08, 0xD1, 0x00, 0x6F, 0x10, 0x00, //  %@.  *@.
+    0x01, 0xCC, 0x68, 0xF6, 0x00, 0x00, //  .@@*%@*
+    0x00, 0x18, 0xED, 0x50, 0x00, 0x00, //   .%@@+
+    0x00, 0x00, 0x6E, 0x50, 0x00, 0x00, //     *@+
+    0x00, 0x00, 0x07, 0xEF, 0xB0, 0x00, //      #@@@
+    0x00, 0x00, 0x00, 0x02, 0x10, 0x00, //        :.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @4800 'R' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x06, 0xFF, 0xFE, 0xB4, 0x00, 0x00, //  *@@@@@=
+    0x06, 0xE1, 0x12, 0x8F, 0x30, 0x00, //  *@..:%@-
+    0x06, 0xE0, 0x00, 0x0D, 0x70, 0x00, //  *@    @#
+    0x06, 0xE0, 0x00, 0x0D, 0x70, 0x00, //  *@    @#
+    0x06, 0xE0, 0x01, 0x8F, 0x20, 0x00, //  *@  .%@:
+    0x06, 0xFE, 0xEF, 0xD5, 0x00, 0x00, //  *@@@@@+
+    0x06, 0xE2, 0x3E, 0x70, 0x00, 0x00, //  *@:-@#
+    0x06, 0xE0, 0x07, 0xE1, 0x00, 0x00, //  *@  #@.
+    0x06, 0xE0, 0x01, 0xE8, 0x00, 0x00, //  *@  .@%
+    0x06, 0xE0, 0x00, 0x7E, 0x10, 0x00, //  *@   #@.
+    0x06, 0xE0, 0x00, 0x1D, 0x90, 0x00, //  *@   .@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @4896 'S' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x2A, 0xEE, 0xB3, 0x00, 0x00, //   :@@@@-
+    0x01, 0xEA, 0x43, 0x8D, 0x10, 0x00, //  .@@=-%@.
+    0x05, 0xF0, 0x00, 0x00, 0x00, 0x00, //  +@
+    0x04, 0xF4, 0x00, 0x00, 0x00, 0x00, //  =@=
+    0x00, 0xBF, 0x93, 0x00, 0x00, 0x00, //   @@@-
+    0x00, 0x06, 0xDF, 0xB3, 0x00, 0x00, //    *@@@-
+    0x00, 0x00, 0x04, 0xCE, 0x20, 0x00, //      =@@:
+    0x00, 0x00, 0x00, 0x1E, 0x80, 0x00, //       .@%
+    0x02, 0x20, 0x00, 0x0D, 0x80, 0x00, //  ::    @%
+    0x0A, 0xE7, 0x34, 0x9E, 0x20, 0x00, //  @@#-=@@:
+    0x00, 0x6C, 0xEE, 0xB3, 0x00, 0x00, //   *@@@@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @4992 'T' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x5F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, // +@@@@@@@@
+    0x12, 0x22, 0xD8, 0x22, 0x20, 0x00, // .:::@%:::
+    0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, //     @#
+    0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, //     @#
+    0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, //     @#
+    0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, //     @#
+    0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, //     @#
+    0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, //     @#
+    0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, //     @#
+    0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, //     @#
+    0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, //     @#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @5088 'U' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x0B, 0x90, 0x00, 0x0E, 0x50, 0x00, //  @@    @+
+    0x0B, 0x90, 0x00, 0x0E, 0x50, 0x00, //  @@    @+
+    0x0B, 0x90, 0x00, 0x0E, 0x50, 0x00, //  @@    @+
+    0x0B, 0x90, 0x00, 0x0E, 0x50, 0x00, //  @@    @+
+    0x0B, 0x90, 0x00, 0x0E, 0x50, 0x00, //  @@    @+
+    0x0B, 0x90, 0x00, 0x0E, 0x50, 0x00, //  @@    @+
+    0x0B, 0x90, 0x00, 0x0E, 0x50, 0x00, //  @@    @+
+    0x0A, 0xA0, 0x00, 0x0F, 0x40, 0x00, //  @@    @=
+    0x08, 0xD0, 0x00, 0x4F, 0x20, 0x00, //  %@   =@:
+    0x02, 0xEA, 0x35, 0xDA, 0x00, 0x00, //  :@@-+@@
+    0x00, 0x4C, 0xED, 0x91, 0x00, 0x00, //   =@@@@.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @5184 'V' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x2F, 0x40, 0x00, 0x09, 0xB0, 0x00, // :@=    @@
+    0x0D, 0x80, 0x00, 0x0D, 0x70, 0x00, //  @%    @#
+    0x08, 0xC0, 0x00, 0x2F, 0x20, 0x00, //  %@   :@:
+    0x04, 0xF1, 0x00, 0x7D, 0x00, 0x00, //  =@.  #@
+    0x00, 0xE6, 0x00, 0xB8, 0x00, 0x00, //   @*  @%
+    0x00, 0xAA, 0x01, 0xF4, 0x00, 0x00, //   @@ .@=
+    0x00, 0x5E, 0x04, 0xE0, 0x00, 0x00, //   +@ =@
+    0x00, 0x1F, 0x38, 0xA0, 0x00, 0x00, //   .@-%@
+    0x00, 0x0B, 0x7C, 0x50, 0x00, 0x00, //    @#@+
+    0x00, 0x06, 0xDF, 0x10, 0x00, 0x00, //    *@@.
+    0x00, 0x02, 0xFB, 0x00, 0x00, 0x00, //    :@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @5280 'W' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0xC8, 0x00, 0x00, 0x00, 0xD5, 0x00, // @%      @+
+    0x9A, 0x00, 0x00, 0x00, 0xF3, 0x00, // @@      @-
+    0x7C, 0x00, 0x00, 0x02, 0xF1, 0x00, // #@     :@.
+    0x5E, 0x00, 0xB7, 0x04, 0xE0, 0x00, // +@  @# =@
+    0x3F, 0x11, 0xEB, 0x05, 0xC0, 0x00, // -@..@@ +@
+    0x1F, 0x25, 0x9E, 0x17, 0xA0, 0x00, // .@:+@@.#@
+    0x0D, 0x49, 0x5C, 0x59, 0x80, 0x00, //  @=@+@+@%
+    0x0B, 0x6D, 0x28, 0x8A, 0x60, 0x00, //  @*@:%%@*
+    0x09, 0x8D, 0x04, 0xCB, 0x40, 0x00, //  @%@ =@@=
+    0x07, 0xD9, 0x00, 0xEE, 0x10, 0x00, //  #@@  @@.
+    0x04, 0xF5, 0x00, 0xBE, 0x00, 0x00, //  =@+  @@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @5376 'X' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x0A, 0xC0, 0x00, 0x2F, 0x40, 0x00, //  @@   :@=
+    0x02, 0xF5, 0x00, 0xAB, 0x00, 0x00, //  :@+  @@
+    0x00, 0x8D, 0x02, 0xF3, 0x00, 0x00, //   %@ :@-
+    0x00, 0x1E, 0x6A, 0x90, 0x00, 0x00, //   .@*@@
+    0x00, 0x07, 0xEE, 0x20, 0x00, 0x00, //    #@@:
+    0x00, 0x02, 0xFB, 0x00, 0x00, 0x00, //    :@@
+    0x00, 0x0A, 0xBF, 0x30, 0x00, 0x00, //    @@@-
+    0x00, 0x3F, 0x29, 0xC0, 0x00, 0x00, //   -@:@@
+    0x00, 0xB9, 0x02, 0xE5, 0x00, 0x00, //   @@ :@+
+    0x05, 0xE2, 0x00, 0x8D, 0x00, 0x00, //  +@:  %@
+    0x0D, 0x80, 0x00, 0x1E, 0x70, 0x00, //  @%   .@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @5472 'Y' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x2F, 0x40, 0x00, 0x09, 0xB0, 0x00, // :@=    @@
+    0x0A, 0xB0, 0x00, 0x2F, 0x40, 0x00, //  @@   :@=
+    0x02, 0xF3, 0x00, 0x8B, 0x00, 0x00, //  :@-  %@
+    0x00, 0xAB, 0x01, 0xE4, 0x00, 0x00, //   @@ .@=
+    0x00, 0x2F, 0x38, 0xB0, 0x00, 0x00, //   :@-%@
+    0x00, 0x0A, 0xAE, 0x40, 0x00, 0x00, //    @@@=
+    0x00, 0x03, 0xFB, 0x00, 0x00, 0x00, //    -@@
+    0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, //     @#
+    0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, //     @#
+    0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, //     @#
+    0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, //     @#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @5568 'Z' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, //  #@@@@@@%
+    0x01, 0x22, 0x22, 0x7E, 0x20, 0x00, //  .::::#@:
+    0x00, 0x00, 0x01, 0xE7, 0x00, 0x00, //      .@#
+    0x00, 0x00, 0x09, 0xC0, 0x00, 0x00, //      @@
+    0x00, 0x00, 0x4F, 0x20, 0x00, 0x00, //     =@:
+    0x00, 0x01, 0xD7, 0x00, 0x00, 0x00, //    .@#
+    0x00, 0x08, 0xC0, 0x00, 0x00, 0x00, //    %@
+    0x00, 0x3F, 0x30, 0x00, 0x00, 0x00, //   -@-
+    0x00, 0xC8, 0x00, 0x00, 0x00, 0x00, //   @%
+    0x08, 0xE3, 0x22, 0x22, 0x10, 0x00, //  %@-::::.
+    0x0E, 0xFF, 0xFF, 0xFF, 0x90, 0x00, //  @@@@@@@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @5664 '[' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x06, 0xEC, 0xCC, 0x00, 0x00, //    *@@@@
+    0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, //    *@
+    0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, //    *@
+    0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, //    *@
+    0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, //    *@
+    0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, //    *@
+    0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, //    *@
+    0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, //    *@
+    0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, //    *@
+    0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, //    *@
+    0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, //    *@
+    0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, //    *@
+    0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, //    *@
+    0x00, 0x05, 0xDB, 0xBB, 0x00, 0x00, //    +@@@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @5760 '\' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x04, 0xE0, 0x00, 0x00, 0x00, 0x00, //  =@
+    0x00, 0xD5, 0x00, 0x00, 0x00, 0x00, //   @+
+    0x00, 0x7B, 0x00, 0x00, 0x00, 0x00, //   #@
+    0x00, 0x2F, 0x10, 0x00, 0x00, 0x00, //   :@.
+    0x00, 0x0B, 0x70, 0x00, 0x00, 0x00, //    @#
+    0x00, 0x05, 0xC0, 0x00, 0x00, 0x00, //    +@
+    0x00, 0x01, 0xE3, 0x00, 0x00, 0x00, //    .@-
+    0x00, 0x00, 0x99, 0x00, 0x00, 0x00, //     @@
+    0x00, 0x00, 0x4E, 0x00, 0x00, 0x00, //     =@
+    0x00, 0x00, 0x0D, 0x50, 0x00, 0x00, //      @+
+    0x00, 0x00, 0x07, 0xB0, 0x00, 0x00, //      #@
+    0x00, 0x00, 0x02, 0xF1, 0x00, 0x00, //      :@.
+    0x00, 0x00, 0x00, 0xB7, 0x00, 0x00, //       @#
+    0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, //       +@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @5856 ']' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x05, 0xCC, 0xCF, 0x00, 0x00, 0x00, //  +@@@@
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, //     .@
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, //     .@
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, //     .@
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, //     .@
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, //     .@
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, //     .@
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, //     .@
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, //     .@
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, //     .@
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, //     .@
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, //     .@
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, //     .@
+    0x05, 0xBB, 0xBD, 0x00, 0x00, 0x00, //  +@@@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @5952 '^' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x01, 0xE9, 0x00, 0x00, 0x00, //    .@@
+    0x00, 0x06, 0xBE, 0x10, 0x00, 0x00, //    *@@.
+    0x00, 0x0C, 0x4A, 0x60, 0x00, 0x00, //    @=@*
+    0x00, 0x3D, 0x04, 0xC0, 0x00, 0x00, //   -@ =@
+    0x00, 0x98, 0x00, 0xD3, 0x00, 0x00, //   @%  @-
+    0x01, 0xE2, 0x00, 0x89, 0x00, 0x00, //  .@:  %@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @6048 '_' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x1F, 0xFF, 0xFF, 0xFF, 0x90, 0x00, // .@@@@@@@@
+    0x02, 0x22, 0x22, 0x22, 0x10, 0x00, //  :::::::.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @6144 '`' (11 pixels wide)
+    0x00, 0x06, 0x40, 0x00, 0x00, 0x00, //    *=
+    0x00, 0x05, 0xE1, 0x00, 0x00, 0x00, //    +@.
+    0x00, 0x00, 0x88, 0x00, 0x00, 0x00, //     %%
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @6240 'a' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x5B, 0xEE, 0xB2, 0x00, 0x00, //   +@@@@:
+    0x02, 0xC6, 0x23, 0xCC, 0x00, 0x00, //  :@*:-@@
+    0x00, 0x00, 0x00, 0x3F, 0x20, 0x00, //       -@:
+    0x00, 0x16, 0x9C, 0xDF, 0x30, 0x00, //   .*@@@@-
+    0x03, 0xEA, 0x41, 0x1F, 0x40, 0x00, //  -@@=..@=
+    0x0A, 0xB0, 0x00, 0x1F, 0x40, 0x00, //  @@   .@=
+    0x08, 0xC1, 0x02, 0xBF, 0x40, 0x00, //  %@. :@@=
+    0x01, 0xAE, 0xDA, 0x3D, 0x40, 0x00, //  .@@@@-@=
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @6336 'b' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, //  %@
+    0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, //  %@
+    0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, //  %@
+    0x08, 0xC5, 0xDF, 0xC3, 0x00, 0x00, //  %@+@@@-
+    0x08, 0xFA, 0x33, 0xAE, 0x10, 0x00, //  %@@--@@.
+    0x08, 0xC0, 0x00, 0x1E, 0x60, 0x00, //  %@   .@*
+    0x08, 0xC0, 0x00, 0x0B, 0x90, 0x00, //  %@    @@
+    0x08, 0xC0, 0x00, 0x0C, 0x90, 0x00, //  %@    @@
+    0x08, 0xC0, 0x00, 0x2F, 0x50, 0x00, //  %@   :@+
+    0x08, 0xF8, 0x34, 0xCC, 0x00, 0x00, //  %@%-=@@
+    0x08, 0x97, 0xDE, 0xA1, 0x00, 0x00, //  %@#@@@.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @6432 'c' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x18, 0xDF, 0xD7, 0x00, 0x00, //   .%@@@#
+    0x00, 0xBD, 0x52, 0x4B, 0x30, 0x00, //   @@+:=@-
+    0x06, 0xE2, 0x00, 0x00, 0x00, 0x00, //  *@:
+    0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, //  @@
+    0x0A, 0xB0, 0x00, 0x00, 0x00, 0x00, //  @@
+    0x07, 0xE2, 0x00, 0x00, 0x00, 0x00, //  #@:
+    0x00, 0xCD, 0x52, 0x3B, 0x60, 0x00, //   @@+:-@*
+    0x00, 0x18, 0xDF, 0xD7, 0x00, 0x00, //   .%@@@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @6528 'd' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x3F, 0x20, 0x00, //       -@:
+    0x00, 0x00, 0x00, 0x3F, 0x20, 0x00, //       -@:
+    0x00, 0x00, 0x00, 0x3F, 0x20, 0x00, //       -@:
+    0x00, 0x4C, 0xFC, 0x6F, 0x20, 0x00, //   =@@@*@:
+    0x03, 0xF9, 0x34, 0xCF, 0x20, 0x00, //  -@@-=@@:
+    0x0C, 0xB0, 0x00, 0x3F, 0x20, 0x00, //  @@   -@:
+    0x0F, 0x60, 0x00, 0x3F, 0x20, 0x00, //  @*   -@:
+    0x0F, 0x50, 0x00, 0x3F, 0x20, 0x00, //  @+   -@:
+    0x0C, 0x80, 0x00, 0x3F, 0x20, 0x00, //  @%   -@:
+    0x06, 0xE4, 0x02, 0xCF, 0x20, 0x00, //  *@= :@@:
+    0x00, 0x6D, 0xEB, 0x4F, 0x20, 0x00, //   *@@@=@:
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @6624 'e' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x2A, 0xEE, 0xB3, 0x00, 0x00, //   :@@@@-
+    0x01, 0xD8, 0x22, 0x7E, 0x20, 0x00, //  .@%::#@:
+    0x09, 0xA0, 0x00, 0x0B, 0x70, 0x00, //  @@    @#
+    0x0D, 0xFE, 0xEE, 0xEE, 0x80, 0x00, //  @@@@@@@%
+    0x0D, 0x90, 0x00, 0x00, 0x00, 0x00, //  @@
+    0x09, 0xD1, 0x00, 0x00, 0x00, 0x00, //  @@.
+    0x01, 0xEB, 0x42, 0x4A, 0x10, 0x00, //  .@@=:=@.
+    0x00, 0x29, 0xEF, 0xD7, 0x10, 0x00, //   :@@@@#.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @6720 'f' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x3B, 0xEE, 0xC1, 0x00, //     -@@@@.
+    0x00, 0x00, 0xDA, 0x22, 0x40, 0x00, //     @@::=
+    0x00, 0x02, 0xF3, 0x00, 0x00, 0x00, //    :@-
+    0x05, 0xFF, 0xFF, 0xFF, 0x70, 0x00, //  +@@@@@@#
+    0x00, 0x13, 0xF4, 0x11, 0x00, 0x00, //   .-@=..
+    0x00, 0x02, 0xF3, 0x00, 0x00, 0x00, //    :@-
+    0x00, 0x02, 0xF3, 0x00, 0x00, 0x00, //    :@-
+    0x00, 0x02, 0xF3, 0x00, 0x00, 0x00, //    :@-
+    0x00, 0x02, 0xF3, 0x00, 0x00, 0x00, //    :@-
+    0x00, 0x02, 0xF3, 0x00, 0x00, 0x00, //    :@-
+    0x00, 0x02, 0xF3, 0x00, 0x00, 0x00, //    :@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @6816 'g' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x4C, 0xEF, 0xFF, 0xF0, 0x00, //   =@@@@@@
+    0x02, 0xF6, 0x03, 0xE6, 0x30, 0x00, //  :@* -@*-
+    0x05, 0xE0, 0x00, 0x99, 0x00, 0x00, //  +@   @@
+    0x02, 0xE5, 0x02, 0xD6, 0x00, 0x00, //  :@+ :@*
+    0x00, 0xAC, 0xDC, 0x70, 0x00, 0x00, //   @@@@#
+    0x04, 0xC0, 0x00, 0x00, 0x00, 0x00, //  =@
+    0x04, 0xE4, 0x11, 0x10, 0x00, 0x00, //  =@=...
+    0x00, 0xCE, 0xFF, 0xFE, 0x80, 0x00, //   @@@@@@%
+    0x09, 0x80, 0x00, 0x07, 0xF0, 0x00, //  @%    #@
+    0x0B, 0x91, 0x00, 0x2B, 0xA0, 0x00, //  @@.  :@@
+    0x02, 0xAD, 0xED, 0xC6, 0x00, 0x00, //  :@@@@@*
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @6912 'h' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, //  %@
+    0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, //  %@
+    0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, //  %@
+    0x08, 0xC2, 0xBE, 0xD5, 0x00, 0x00, //  %@:@@@+
+    0x08, 0xDC, 0x53, 0x9F, 0x10, 0x00, //  %@@+-@@.
+    0x08, 0xD1, 0x00, 0x1F, 0x40, 0x00, //  %@.  .@=
+    0x08, 0xC0, 0x00, 0x0E, 0x60, 0x00, //  %@    @*
+    0x08, 0xC0, 0x00, 0x0E, 0x60, 0x00, //  %@    @*
+    0x08, 0xC0, 0x00, 0x0E, 0x60, 0x00, //  %@    @*
+    0x08, 0xC0, 0x00, 0x0E, 0x60, 0x00, //  %@    @*
+    0x08, 0xC0, 0x00, 0x0E, 0x60, 0x00, //  %@    @*
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @7008 'i' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x4E, 0x60, 0x00, 0x00, //     =@*
+    0x00, 0x00, 0x5F, 0x70, 0x00, 0x00, //     +@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x08, 0xFF, 0xFF, 0x60, 0x00, 0x00, //  %@@@@*
+    0x01, 0x11, 0x1E, 0x60, 0x00, 0x00, //  ....@*
+    0x00, 0x00, 0x0E, 0x60, 0x00, 0x00, //      @*
+    0x00, 0x00, 0x0E, 0x60, 0x00, 0x00, //      @*
+    0x00, 0x00, 0x0E, 0x60, 0x00, 0x00, //      @*
+    0x00, 0x00, 0x0E, 0x60, 0x00, 0x00, //      @*
+    0x00, 0x00, 0x0E, 0x60, 0x00, 0x00, //      @*
+    0x00, 0x00, 0x0E, 0x60, 0x00, 0x00, //      @*
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @7104 'j' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x4E, 0x60, 0x00, 0x00, //     =@*
+    0x00, 0x00, 0x5F, 0x70, 0x00, 0x00, //     +@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x08, 0xFF, 0xFF, 0x60, 0x00, 0x00, //  %@@@@*
+    0x01, 0x11, 0x1E, 0x60, 0x00, 0x00, //  ....@*
+    0x00, 0x00, 0x0E, 0x60, 0x00, 0x00, //      @*
+    0x00, 0x00, 0x0E, 0x60, 0x00, 0x00, //      @*
+    0x00, 0x00, 0x0E, 0x60, 0x00, 0x00, //      @*
+    0x00, 0x00, 0x0E, 0x60, 0x00, 0x00, //      @*
+    0x00, 0x00, 0x0E, 0x60, 0x00, 0x00, //      @*
+    0x00, 0x00, 0x0E, 0x60, 0x00, 0x00, //      @*
+    0x00, 0x00, 0x0F, 0x40, 0x00, 0x00, //      @=
+    0x05, 0x22, 0x8E, 0x10, 0x00, 0x00, //  +::%@.
+    0x0A, 0xEF, 0xC3, 0x00, 0x00, 0x00, //  @@@@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @7200 'k' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x04, 0xF0, 0x00, 0x00, 0x00, 0x00, //  =@
+    0x04, 0xF0, 0x00, 0x00, 0x00, 0x00, //  =@
+    0x04, 0xF0, 0x00, 0x00, 0x00, 0x00, //  =@
+    0x04, 0xF0, 0x00, 0x4E, 0x40, 0x00, //  =@   =@=
+    0x04, 0xF0, 0x04, 0xE5, 0x00, 0x00, //  =@  =@+
+    0x04, 0xF0, 0x4E, 0x50, 0x00, 0x00, //  =@ =@+
+    0x04, 0xF4, 0xED, 0x10, 0x00, 0x00, //  =@=@@.
+    0x04, 0xFE, 0x6C, 0x90, 0x00, 0x00, //  =@@*@@
+    0x04, 0xF5, 0x02, 0xE5, 0x00, 0x00, //  =@+ :@+
+    0x04, 0xF0, 0x00, 0x5E, 0x20, 0x00, //  =@   +@:
+    0x04, 0xF0, 0x00, 0x0A, 0xC0, 0x00, //  =@    @@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @7296 'l' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, //  @@@@=
+    0x01, 0x12, 0xF4, 0x00, 0x00, 0x00, //  ..:@=
+    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, //    .@=
+    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, //    .@=
+    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, //    .@=
+    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, //    .@=
+    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, //    .@=
+    0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, //    .@=
+    0x00, 0x00, 0xF4, 0x00, 0x00, 0x00, //     @=
+    0x00, 0x00, 0xDA, 0x23, 0x20, 0x00, //     @@:-:
+    0x00, 0x00, 0x3C, 0xFD, 0x50, 0x00, //     -@@@+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @7392 'm' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x1F, 0x6E, 0xD3, 0xCE, 0x40, 0x00, // .@*@@-@@=
+    0x1F, 0xA0, 0xCC, 0x18, 0xC0, 0x00, // .@@ @@.%@
+    0x1F, 0x30, 0x97, 0x06, 0xD0, 0x00, // .@- @# *@
+    0x1F, 0x30, 0x97, 0x06, 0xD0, 0x00, // .@- @# *@
+    0x1F, 0x30, 0x97, 0x06, 0xD0, 0x00, // .@- @# *@
+    0x1F, 0x30, 0x97, 0x06, 0xD0, 0x00, // .@- @# *@
+    0x1F, 0x30, 0x97, 0x06, 0xD0, 0x00, // .@- @# *@
+    0x1F, 0x30, 0x97, 0x06, 0xD0, 0x00, // .@- @# *@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @7488 'n' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x08, 0x93, 0xCE, 0xD5, 0x00, 0x00, //  %@-@@@+
+    0x08, 0xEB, 0x20, 0x7F, 0x10, 0x00, //  %@@: #@.
+    0x08, 0xD0, 0x00, 0x0F, 0x40, 0x00, //  %@    @=
+    0x08, 0xC0, 0x00, 0x0E, 0x60, 0x00, //  %@    @*
+    0x08, 0xC0, 0x00, 0x0E, 0x60, 0x00, //  %@    @*
+    0x08, 0xC0, 0x00, 0x0E, 0x60, 0x00, //  %@    @*
+    0x08, 0xC0, 0x00, 0x0E, 0x60, 0x00, //  %@    @*
+    0x08, 0xC0, 0x00, 0x0E, 0x60, 0x00, //  %@    @*
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @7584 'o' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x4C, 0xFE, 0x91, 0x00, 0x00, //   =@@@@.
+    0x03, 0xF8, 0x24, 0xCB, 0x00, 0x00, //  -@%:=@@
+    0x0C, 0xA0, 0x00, 0x2F, 0x50, 0x00, //  @@   :@+
+    0x0F, 0x60, 0x00, 0x0C, 0x90, 0x00, //  @*    @@
+    0x0F, 0x60, 0x00, 0x0C, 0x90, 0x00, //  @*    @@
+    0x0C, 0xA0, 0x00, 0x2F, 0x60, 0x00, //  @@   :@*
+    0x03, 0xF8, 0x24, 0xCC, 0x00, 0x00, //  -@%:=@@
+    0x00, 0x3B, 0xFE, 0x91, 0x00, 0x00, //   -@@@@.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @7680 'p' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x08, 0xA7, 0xDE, 0xC3, 0x00, 0x00, //  %@#@@@-
+    0x08, 0xF8, 0x10, 0x8E, 0x10, 0x00, //  %@%. %@.
+    0x08, 0xC0, 0x00, 0x0E, 0x60, 0x00, //  %@    @*
+    0x08, 0xC0, 0x00, 0x0B, 0x90, 0x00, //  %@    @@
+    0x08, 0xC0, 0x00, 0x0C, 0x90, 0x00, //  %@    @@
+    0x08, 0xC0, 0x00, 0x2F, 0x50, 0x00, //  %@   :@+
+    0x08, 0xF8, 0x34, 0xCC, 0x00, 0x00, //  %@%-=@@
+    0x08, 0xC7, 0xEE, 0xA1, 0x00, 0x00, //  %@#@@@.
+    0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, //  %@
+    0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, //  %@
+    0x08, 0xC0, 0x00, 0x00, 0x00, 0x00, //  %@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @7776 'q' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x4C, 0xFC, 0x4F, 0x20, 0x00, //   =@@@=@:
+    0x03, 0xF9, 0x34, 0xBF, 0x20, 0x00, //  -@@-=@@:
+    0x0C, 0xA0, 0x00, 0x3F, 0x20, 0x00, //  @@   -@:
+    0x0F, 0x60, 0x00, 0x3F, 0x20, 0x00, //  @*   -@:
+    0x0F, 0x60, 0x00, 0x3F, 0x20, 0x00, //  @*   -@:
+    0x0C, 0x90, 0x00, 0x4F, 0x20, 0x00, //  @@   =@:
+    0x06, 0xF7, 0x25, 0xDF, 0x20, 0x00, //  *@#:+@@:
+    0x00, 0x6D, 0xFB, 0x5F, 0x20, 0x00, //   *@@@+@:
+    0x00, 0x00, 0x00, 0x3F, 0x20, 0x00, //       -@:
+    0x00, 0x00, 0x00, 0x3F, 0x20, 0x00, //       -@:
+    0x00, 0x00, 0x00, 0x3F, 0x20, 0x00, //       -@:
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @7872 'r' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0xA7, 0x2A, 0xEF, 0x70, 0x00, //   @#:@@@#
+    0x00, 0xAA, 0xD6, 0x11, 0x10, 0x00, //   @@@*...
+    0x00, 0xAF, 0x30, 0x00, 0x00, 0x00, //   @@-
+    0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, //   @@
+    0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, //   @@
+    0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, //   @@
+    0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, //   @@
+    0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, //   @@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @7968 's' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x5C, 0xEE, 0xB4, 0x00, 0x00, //   +@@@@=
+    0x03, 0xF5, 0x12, 0x68, 0x00, 0x00, //  -@+.:*%
+    0x04, 0xF3, 0x00, 0x00, 0x00, 0x00, //  =@-
+    0x00, 0x7E, 0xC7, 0x20, 0x00, 0x00, //   #@@#:
+    0x00, 0x01, 0x59, 0xEA, 0x10, 0x00, //    .+@@@.
+    0x00, 0x00, 0x00, 0x2F, 0x50, 0x00, //       :@+
+    0x08, 0xA3, 0x11, 0x6F, 0x30, 0x00, //  %@-..*@-
+    0x01, 0x7C, 0xEE, 0xC4, 0x00, 0x00, //  .#@@@@=
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @8064 't' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x08, 0x90, 0x00, 0x00, 0x00, //    %@
+    0x00, 0x09, 0x90, 0x00, 0x00, 0x00, //    @@
+    0x0D, 0xFF, 0xFF, 0xFF, 0x70, 0x00, //  @@@@@@@#
+    0x00, 0x0B, 0x90, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x0B, 0x90, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x0B, 0x90, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x0B, 0x90, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x09, 0xA0, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x05, 0xF5, 0x23, 0x30, 0x00, //    +@+:--
+    0x00, 0x00, 0x8E, 0xFD, 0x60, 0x00, //     %@@@*
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @8160 'u' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x0C, 0x80, 0x00, 0x4F, 0x10, 0x00, //  @%   =@.
+    0x0C, 0x80, 0x00, 0x4F, 0x10, 0x00, //  @%   =@.
+    0x0C, 0x80, 0x00, 0x4F, 0x10, 0x00, //  @%   =@.
+    0x0C, 0x80, 0x00, 0x4F, 0x10, 0x00, //  @%   =@.
+    0x0B, 0x80, 0x00, 0x4F, 0x10, 0x00, //  @%   =@.
+    0x0A, 0xA0, 0x00, 0x5F, 0x10, 0x00, //  @@   +@.
+    0x07, 0xE3, 0x05, 0xCF, 0x10, 0x00, //  #@- +@@.
+    0x01, 0xAE, 0xE9, 0x1F, 0x10, 0x00, //  .@@@@.@.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @8256 'v' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x1E, 0x50, 0x00, 0x0A, 0x90, 0x00, // .@+    @@
+    0x09, 0xB0, 0x00, 0x1F, 0x30, 0x00, //  @@   .@-
+    0x02, 0xF2, 0x00, 0x7C, 0x00, 0x00, //  :@:  #@
+    0x00, 0xB8, 0x00, 0xD6, 0x00, 0x00, //   @%  @*
+    0x00, 0x5E, 0x04, 0xE1, 0x00, 0x00, //   +@ =@.
+    0x00, 0x0E, 0x49, 0x80, 0x00, 0x00, //    @=@%
+    0x00, 0x08, 0xBE, 0x20, 0x00, 0x00, //    %@@:
+    0x00, 0x02, 0xFB, 0x00, 0x00, 0x00, //    :@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @8352 'w' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0xC9, 0x00, 0x63, 0x00, 0xD5, 0x00, // @@  *-  @+
+    0x8C, 0x00, 0xE9, 0x01, 0xF2, 0x00, // %@  @@ .@:
+    0x5F, 0x03, 0xAD, 0x04, 0xE0, 0x00, // +@ -@@ =@
+    0x2F, 0x36, 0x6C, 0x17, 0xB0, 0x00, // :@-**@.#@
+    0x0D, 0x6A, 0x39, 0x5A, 0x80, 0x00, //  @*@-@+@%
+    0x0A, 0x9D, 0x06, 0x8D, 0x50, 0x00, //  @@@ *%@+
+    0x07, 0xCC, 0x02, 0xCF, 0x10, 0x00, //  #@@ :@@.
+    0x04, 0xF8, 0x00, 0xED, 0x00, 0x00, //  =@%  @@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @8448 'x' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x06, 0xE2, 0x00, 0x6E, 0x10, 0x00, //  *@:  *@.
+    0x00, 0xAB, 0x02, 0xE5, 0x00, 0x00, //   @@ :@+
+    0x00, 0x1E, 0x6A, 0x90, 0x00, 0x00, //   .@*@@
+    0x00, 0x04, 0xFD, 0x10, 0x00, 0x00, //    =@@.
+    0x00, 0x07, 0xED, 0x10, 0x00, 0x00, //    #@@.
+    0x00, 0x3E, 0x3B, 0xB0, 0x00, 0x00, //   -@-@@
+    0x01, 0xD7, 0x01, 0xE7, 0x00, 0x00, //  .@# .@#
+    0x09, 0xC0, 0x00, 0x4F, 0x30, 0x00, //  @@   =@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @8544 'y' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x1E, 0x50, 0x00, 0x0A, 0x90, 0x00, // .@+    @@
+    0x08, 0xC0, 0x00, 0x1F, 0x30, 0x00, //  %@   .@-
+    0x01, 0xE3, 0x00, 0x6C, 0x00, 0x00, //  .@-  *@
+    0x00, 0x8A, 0x00, 0xC6, 0x00, 0x00, //   %@  @*
+    0x00, 0x2F, 0x23, 0xE0, 0x00, 0x00, //   :@:-@
+    0x00, 0x09, 0x89, 0x80, 0x00, 0x00, //    @%@%
+    0x00, 0x02, 0xEE, 0x20, 0x00, 0x00, //    :@@:
+    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, //     @@
+    0x00, 0x01, 0xE5, 0x00, 0x00, 0x00, //    .@+
+    0x01, 0x3B, 0xB0, 0x00, 0x00, 0x00, //  .-@@
+    0x0B, 0xEA, 0x10, 0x00, 0x00, 0x00, //  @@@.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @8640 'z' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x04, 0xFF, 0xFF, 0xFF, 0x50, 0x00, //  =@@@@@@+
+    0x00, 0x11, 0x12, 0xDA, 0x00, 0x00, //   ...:@@
+    0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, //      @@
+    0x00, 0x00, 0x9D, 0x10, 0x00, 0x00, //     @@.
+    0x00, 0x07, 0xE2, 0x00, 0x00, 0x00, //    #@:
+    0x00, 0x5F, 0x40, 0x00, 0x00, 0x00, //   +@=
+    0x03, 0xE7, 0x11, 0x11, 0x10, 0x00, //  -@#.....
+    0x0C, 0xFF, 0xFF, 0xFF, 0x80, 0x00, //  @@@@@@@%
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @8736 '{' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x4C, 0xCC, 0x00, 0x00, //     =@@@
+    0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, //     @*
+    0x00, 0x00, 0xD3, 0x00, 0x00, 0x00, //     @-
+    0x00, 0x00, 0xD4, 0x00, 0x00, 0x00, //     @=
+    0x00, 0x00, 0xC4, 0x00, 0x00, 0x00, //     @=
+    0x00, 0x03, 0xE3, 0x00, 0x00, 0x00, //    -@-
+    0x01, 0xEF, 0x70, 0x00, 0x00, 0x00, //  .@@#
+    0x00, 0x04, 0xE2, 0x00, 0x00, 0x00, //    =@:
+    0x00, 0x00, 0xC4, 0x00, 0x00, 0x00, //     @=
+    0x00, 0x00, 0xC4, 0x00, 0x00, 0x00, //     @=
+    0x00, 0x00, 0xD4, 0x00, 0x00, 0x00, //     @=
+    0x00, 0x00, 0xD3, 0x00, 0x00, 0x00, //     @-
+    0x00, 0x00, 0xB7, 0x00, 0x00, 0x00, //     @#
+    0x00, 0x00, 0x2A, 0xBB, 0x00, 0x00, //     :@@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @8832 '|' (11 pixels wide)
+    0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, //     @*
+    0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, //     @*
+    0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, //     @*
+    0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, //     @*
+    0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, //     @*
+    0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, //     @*
+    0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, //     @*
+    0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, //     @*
+    0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, //     @*
+    0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, //     @*
+    0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, //     @*
+    0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, //     @*
+    0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, //     @*
+    0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, //     @*
+    0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, //     @*
+    0x00, 0x00, 0xC6, 0x00, 0x00, 0x00, //     @*
+    // @8928 '}' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x05, 0xCC, 0xA1, 0x00, 0x00, 0x00, //  +@@@.
+    0x00, 0x00, 0xB6, 0x00, 0x00, 0x00, //     @*
+    0x00, 0x00, 0x97, 0x00, 0x00, 0x00, //     @#
+    0x00, 0x00, 0xA6, 0x00, 0x00, 0x00, //     @*
+    0x00, 0x00, 0xA6, 0x00, 0x00, 0x00, //     @*
+    0x00, 0x00, 0x9A, 0x10, 0x00, 0x00, //     @@.
+    0x00, 0x00, 0x1C, 0xF9, 0x00, 0x00, //     .@@@
+    0x00, 0x00, 0x8B, 0x10, 0x00, 0x00, //     %@.
+    0x00, 0x00, 0xA6, 0x00, 0x00, 0x00, //     @*
+    0x00, 0x00, 0xA6, 0x00, 0x00, 0x00, //     @*
+    0x00, 0x00, 0xA7, 0x00, 0x00, 0x00, //     @#
+    0x00, 0x00, 0x97, 0x00, 0x00, 0x00, //     @#
+    0x00, 0x01, 0xC5, 0x00, 0x00, 0x00, //    .@+
+    0x05, 0xBB, 0x70, 0x00, 0x00, 0x00, //  +@@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @9024 '~' (11 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x01, 0xBE, 0xB3, 0x1B, 0x20, 0x00, //  .@@@-.@:
+    0x08, 0x71, 0x6D, 0xE8, 0x00, 0x00, //  %#.*@@%
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+};
+
+sFONT_AA Font16Aa = {11, /* Width */
+                     16, /* Height */
+                     Font16Aa_Table};
+
+static const uint8_t Font20Aa_Table[] = {
+    // @0 ' ' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @140 '!' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xA9, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, //       ##
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x02, 0xEE, 0x20, 0x00, 0x00, //      :@@:
+    0x00, 0x00, 0x06, 0xFF, 0x60, 0x00, 0x00, //      *@@*
+    0x00, 0x00, 0x02, 0xDD, 0x20, 0x00, 0x00, //      :@@:
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @280 '"' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x04, 0xB9, 0x00, 0x9B, 0x40, 0x00, //    =@@  @@=
+    0x00, 0x05, 0xFC, 0x00, 0xCF, 0x60, 0x00, //    +@@  @@*
+    0x00, 0x05, 0xFC, 0x00, 0xBF, 0x50, 0x00, //    +@@  @@+
+    0x00, 0x04, 0xFA, 0x00, 0xAF, 0x40, 0x00, //    =@@  @@=
+    0x00, 0x02, 0xF8, 0x00, 0x8F, 0x20, 0x00, //    :@%  %@:
+    0x00, 0x00, 0xF7, 0x00, 0x7F, 0x00, 0x00, //     @#  #@
+    0x00, 0x00, 0xE5, 0x00, 0x5E, 0x00, 0x00, //     @+  +@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @420 '#' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x0A, 0x60, 0x0E, 0x20, 0x00, //      @*  @:
+    0x00, 0x00, 0x0C, 0x40, 0x1F, 0x00, 0x00, //      @= .@
+    0x00, 0x00, 0x0E, 0x20, 0x4D, 0x00, 0x00, //      @: =@
+    0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, //    @@@@@@@@*
+    0x00, 0x02, 0x5D, 0x33, 0x9A, 0x31, 0x00, //    :+@--@@-.
+    0x00, 0x00, 0x4C, 0x00, 0x98, 0x00, 0x00, //     =@  @%
+    0x00, 0x00, 0x6A, 0x00, 0xA6, 0x00, 0x00, //     *@  @*
+    0x00, 0x00, 0x79, 0x00, 0xB5, 0x00, 0x00, //     #@  @+
+    0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, //   =@@@@@@@@
+    0x00, 0x13, 0xC7, 0x33, 0xF3, 0x30, 0x00, //   .-@#--@--
+    0x00, 0x00, 0xD4, 0x02, 0xE0, 0x00, 0x00, //     @= :@
+    0x00, 0x00, 0xF2, 0x04, 0xC0, 0x00, 0x00, //     @: =@
+    0x00, 0x01, 0xF0, 0x06, 0xB0, 0x00, 0x00, //    .@  *@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @560 '$' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x7B, 0x00, 0x00, 0x00, //       #@
+    0x00, 0x00, 0x00, 0x7B, 0x00, 0x00, 0x00, //       #@
+    0x00, 0x00, 0x01, 0x9C, 0x30, 0x00, 0x00, //      .@@-
+    0x00, 0x00, 0x9F, 0xFF, 0xFC, 0x30, 0x00, //     @@@@@@-
+    0x00, 0x06, 0xF7, 0x10, 0x4B, 0x80, 0x00, //    *@#. =@%
+    0x00, 0x0A, 0xE0, 0x00, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x08, 0xF6, 0x00, 0x00, 0x00, 0x00, //    %@*
+    0x00, 0x01, 0xAF, 0xD7, 0x10, 0x00, 0x00, //    .@@@#.
+    0x00, 0x00, 0x04, 0xBF, 0xE8, 0x00, 0x00, //      =@@@%
+    0x00, 0x00, 0x00, 0x02, 0x9F, 0xB0, 0x00, //        :@@@
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xF2, 0x00, //          %@:
+    0x00, 0x05, 0x10, 0x00, 0x08, 0xF2, 0x00, //    +.    %@:
+    0x00, 0x1E, 0xE8, 0x54, 0x7F, 0xA0, 0x00, //   .@@%+=#@@
+    0x00, 0x02, 0x9E, 0xFF, 0xD8, 0x10, 0x00, //    :@@@@@%.
+    0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, //       %@
+    0x00, 0x00, 0x00, 0x7B, 0x00, 0x00, 0x00, //       #@
+    0x00, 0x00, 0x00, 0x7B, 0x00, 0x00, 0x00, //       #@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @700 '%' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x5D, 0xEB, 0x20, 0x00, 0x04, 0x00, //   +@@@:    =
+    0x02, 0xE5, 0x19, 0xC0, 0x00, 0x7E, 0x20, //  :@+.@@   #@:
+    0x06, 0xD0, 0x02, 0xF1, 0x06, 0xE3, 0x00, //  *@  :@. *@-
+    0x05, 0xD0, 0x02, 0xF1, 0x5D, 0x20, 0x00, //  +@  :@.+@:
+    0x02, 0xE5, 0x19, 0xB0, 0x62, 0x00, 0x00, //  :@+.@@ *:
+    0x00, 0x4D, 0xEB, 0x20, 0x00, 0x00, 0x00, //   =@@@:
+    0x00, 0x00, 0x00, 0x01, 0xAE, 0xC4, 0x00, //        .@@@=
+    0x00, 0x00, 0x38, 0x0A, 0xB1, 0x6E, 0x10, //     -% @@.*@.
+    0x00, 0x02, 0xE4, 0x0F, 0x40, 0x0D, 0x50, //    :@= @=  @+
+    0x00, 0x1D, 0x80, 0x1F, 0x20, 0x0C, 0x60, //   .@% .@:  @*
+    0x01, 0xCB, 0x00, 0x0E, 0x40, 0x0D, 0x50, //  .@@   @=  @+
+    0x02, 0xC2, 0x00, 0x09, 0xB1, 0x6E, 0x10, //  :@:   @@.*@.
+    0x00, 0x00, 0x00, 0x01, 0xAE, 0xC3, 0x00, //        .@@@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @840 '&' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x5D, 0xEB, 0x10, 0x00, 0x00, //     +@@@.
+    0x00, 0x03, 0xF8, 0x4D, 0x90, 0x00, 0x00, //    -@%=@@
+    0x00, 0x07, 0xE0, 0x08, 0xC0, 0x00, 0x00, //    #@  %@
+    0x00, 0x07, 0xE0, 0x0C, 0x90, 0x00, 0x00, //    #@  @@
+    0x00, 0x04, 0xF3, 0xAD, 0x10, 0x00, 0x00, //    =@-@@.
+    0x00, 0x00, 0xDF, 0xC2, 0x00, 0x00, 0x00, //     @@@:
+    0x00, 0x06, 0xFF, 0x50, 0x00, 0x4F, 0x30, //    *@@+   =@-
+    0x00, 0x6F, 0x7A, 0xE2, 0x00, 0xAD, 0x00, //   *@#@@:  @@
+    0x00, 0xEA, 0x01, 0xDD, 0x22, 0xF6, 0x00, //   @@ .@@::@*
+    0x02, 0xF7, 0x00, 0x2D, 0xDB, 0xC0, 0x00, //  :@#  :@@@@
+    0x01, 0xFC, 0x00, 0x02, 0xEF, 0x90, 0x00, //  .@@   :@@@
+    0x00, 0x7F, 0xB6, 0x6C, 0xFB, 0xFC, 0x30, //   #@@**@@@@@-
+    0x00, 0x06, 0xCE, 0xEA, 0x30, 0x4C, 0x40, //    *@@@@- =@=
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @980 ''' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x01, 0xBB, 0x10, 0x00, 0x00, //      .@@.
+    0x00, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x00, //      .@@.
+    0x00, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x00, //      .@@.
+    0x00, 0x00, 0x00, 0xEE, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @1120 '(' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x10, 0x00, //          #.
+    0x00, 0x00, 0x00, 0x00, 0x9E, 0x30, 0x00, //         @@-
+    0x00, 0x00, 0x00, 0x07, 0xE3, 0x00, 0x00, //        #@-
+    0x00, 0x00, 0x00, 0x3F, 0x60, 0x00, 0x00, //       -@*
+    0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x03, 0xF6, 0x00, 0x00, 0x00, //      -@*
+    0x00, 0x00, 0x07, 0xF1, 0x00, 0x00, 0x00, //      #@.
+    0x00, 0x00, 0x0A, 0xC0, 0x00, 0x00, 0x00, //      @@
+    0x00, 0x00, 0x0C, 0xB0, 0x00, 0x00, 0x00, //      @@
+    0x00, 0x00, 0x0C, 0xA0, 0x00, 0x00, 0x00, //      @@
+    0x00, 0x00, 0x0C, 0xB0, 0x00, 0x00, 0x00, //      @@
+    0x00, 0x00, 0x0A, 0xD0, 0x00, 0x00, 0x00, //      @@
+    0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x00, //      #@:
+    0x00, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x00, //      :@*
+    0x00, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x2E, 0x80, 0x00, 0x00, //       :@%
+    0x00, 0x00, 0x00, 0x05, 0xF5, 0x00, 0x00, //        +@+
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0x40, 0x00, //         *@=
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, //          =
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @1260 ')' (14 pixels wide)
+    0x00, 0x01, 0x70, 0x00, 0x00, 0x00, 0x00, //    .#
+    0x00, 0x03, 0xE9, 0x00, 0x00, 0x00, 0x00, //    -@@
+    0x00, 0x00, 0x3E, 0x70, 0x00, 0x00, 0x00, //     -@#
+    0x00, 0x00, 0x06, 0xF3, 0x00, 0x00, 0x00, //      *@-
+    0x00, 0x00, 0x00, 0xCB, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x00, //       *@-
+    0x00, 0x00, 0x00, 0x1F, 0x70, 0x00, 0x00, //       .@#
+    0x00, 0x00, 0x00, 0x0C, 0xA0, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0A, 0xC0, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0D, 0xA0, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x2F, 0x70, 0x00, 0x00, //       :@#
+    0x00, 0x00, 0x00, 0x7F, 0x20, 0x00, 0x00, //       #@:
+    0x00, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x08, 0xE2, 0x00, 0x00, 0x00, //      %@:
+    0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, //     +@+
+    0x00, 0x04, 0xF6, 0x00, 0x00, 0x00, 0x00, //    =@*
+    0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, //     =
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @1400 '*' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, //       %%
+    0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, //       %%
+    0x00, 0x02, 0x00, 0x99, 0x00, 0x20, 0x00, //    :  @@  :
+    0x00, 0x2E, 0xC7, 0xBB, 0x7C, 0xE2, 0x00, //   :@@#@@#@@:
+    0x00, 0x01, 0x6C, 0xFF, 0xC6, 0x10, 0x00, //    .*@@@@*.
+    0x00, 0x00, 0x06, 0xFF, 0x60, 0x00, 0x00, //      *@@*
+    0x00, 0x00, 0x2E, 0x67, 0xE1, 0x00, 0x00, //     :@*#@.
+    0x00, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0x00, //     @@  @@
+    0x00, 0x01, 0xB1, 0x00, 0x1B, 0x10, 0x00, //    .@.  .@.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @1540 '+' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, //       ..
+    0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, //   =@@@@@@@@=
+    0x00, 0x13, 0x33, 0xBB, 0x33, 0x31, 0x00, //   .---@@---.
+    0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @1680 ',' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x02, 0xDE, 0x40, 0x00, 0x00, //      :@@=
+    0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, //      #@@@
+    0x00, 0x00, 0x02, 0xDF, 0xD0, 0x00, 0x00, //      :@@@
+    0x00, 0x00, 0x00, 0x0A, 0xC0, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x1E, 0x80, 0x00, 0x00, //       .@%
+    0x00, 0x00, 0x01, 0xBD, 0x10, 0x00, 0x00, //      .@@.
+    0x00, 0x00, 0x0D, 0xC2, 0x00, 0x00, 0x00, //      @@:
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, //      :
+    // @1820 '-' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, //   =@@@@@@@@=
+    0x00, 0x13, 0x33, 0x33, 0x33, 0x31, 0x00, //   .--------.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @1960 '.' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, //       ==
+    0x00, 0x00, 0x06, 0xFF, 0x60, 0x00, 0x00, //      *@@*
+    0x00, 0x00, 0x09, 0xFF, 0x90, 0x00, 0x00, //      @@@@
+    0x00, 0x00, 0x03, 0xDD, 0x30, 0x00, 0x00, //      -@@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @2100 '/' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0xC0, 0x00, //          @@
+    0x00, 0x00, 0x00, 0x00, 0x1E, 0x70, 0x00, //         .@#
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0x10, 0x00, //         *@.
+    0x00, 0x00, 0x00, 0x00, 0xCB, 0x00, 0x00, //         @@
+    0x00, 0x00, 0x00, 0x02, 0xF5, 0x00, 0x00, //        :@+
+    0x00, 0x00, 0x00, 0x08, 0xE0, 0x00, 0x00, //        %@
+    0x00, 0x00, 0x00, 0x0D, 0x90, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x4F, 0x30, 0x00, 0x00, //       =@-
+    0x00, 0x00, 0x00, 0xAC, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x01, 0xE7, 0x00, 0x00, 0x00, //      .@#
+    0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, //      *@.
+    0x00, 0x00, 0x0C, 0xB0, 0x00, 0x00, 0x00, //      @@
+    0x00, 0x00, 0x2F, 0x50, 0x00, 0x00, 0x00, //     :@+
+    0x00, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x00, //     %@
+    0x00, 0x00, 0xD9, 0x00, 0x00, 0x00, 0x00, //     @@
+    0x00, 0x04, 0xF3, 0x00, 0x00, 0x00, 0x00, //    =@-
+    0x00, 0x0A, 0xC0, 0x00, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x07, 0x40, 0x00, 0x00, 0x00, 0x00, //    #=
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @2240 '0' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x3B, 0xEE, 0xB3, 0x00, 0x00, //     -@@@@-
+    0x00, 0x03, 0xFC, 0x66, 0xCF, 0x30, 0x00, //    -@@**@@-
+    0x00, 0x0C, 0xD1, 0x00, 0x1D, 0xC0, 0x00, //    @@.  .@@
+    0x00, 0x3F, 0x60, 0x00, 0x06, 0xF3, 0x00, //   -@*    *@-
+    0x00, 0x6F, 0x20, 0x00, 0x02, 0xF6, 0x00, //   *@:    :@*
+    0x00, 0x8F, 0x01, 0xCC, 0x10, 0xF8, 0x00, //   %@ .@@. @%
+    0x00, 0x9E, 0x03, 0xFF, 0x30, 0xF8, 0x00, //   @@ -@@- @%
+    0x00, 0x8F, 0x00, 0x88, 0x00, 0xF8, 0x00, //   %@  %%  @%
+    0x00, 0x6F, 0x20, 0x00, 0x02, 0xF6, 0x00, //   *@:    :@*
+    0x00, 0x3F, 0x60, 0x00, 0x06, 0xF3, 0x00, //   -@*    *@-
+    0x00, 0x0C, 0xD1, 0x00, 0x1D, 0xC0, 0x00, //    @@.  .@@
+    0x00, 0x03, 0xEC, 0x66, 0xCE, 0x30, 0x00, //    -@@**@@-
+    0x00, 0x00, 0x3B, 0xEE, 0xB3, 0x00, 0x00, //     -@@@@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @2380 '1' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x36, 0xCF, 0x30, 0x00, 0x00, //     -*@@-
+    0x00, 0x02, 0xFF, 0xFF, 0x30, 0x00, 0x00, //    :@@@@-
+    0x00, 0x00, 0x00, 0x7F, 0x30, 0x00, 0x00, //       #@-
+    0x00, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x00, //       *@-
+    0x00, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x00, //       *@-
+    0x00, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x00, //       *@-
+    0x00, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x00, //       *@-
+    0x00, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x00, //       *@-
+    0x00, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x00, //       *@-
+    0x00, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x00, //       *@-
+    0x00, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x00, //       *@-
+    0x00, 0x05, 0x55, 0x9F, 0x75, 0x53, 0x00, //    +++@@#++-
+    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, //   .@@@@@@@@%
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @2520 '2' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x01, 0x8D, 0xFE, 0x91, 0x00, 0x00, //    .%@@@@.
+    0x00, 0x3E, 0xD7, 0x68, 0xEE, 0x10, 0x00, //   -@@#*%@@.
+    0x00, 0x2A, 0x10, 0x00, 0x4F, 0x80, 0x00, //   :@.   =@%
+    0x00, 0x00, 0x00, 0x00, 0x0E, 0xB0, 0x00, //          @@
+    0x00, 0x00, 0x00, 0x00, 0x0E, 0x90, 0x00, //          @@
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0x40, 0x00, //         +@=
+    0x00, 0x00, 0x00, 0x01, 0xDB, 0x00, 0x00, //        .@@
+    0x00, 0x00, 0x00, 0x0B, 0xE2, 0x00, 0x00, //        @@:
+    0x00, 0x00, 0x00, 0xBE, 0x30, 0x00, 0x00, //       @@-
+    0x00, 0x00, 0x1B, 0xE3, 0x00, 0x00, 0x00, //     .@@-
+    0x00, 0x01, 0xCE, 0x30, 0x00, 0x00, 0x00, //    .@@-
+    0x00, 0x2D, 0xF7, 0x55, 0x55, 0x52, 0x00, //   :@@#+++++:
+    0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, //   %@@@@@@@@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @2660 '3' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x01, 0x8D, 0xFD, 0xA3, 0x00, 0x00, //    .%@@@@-
+    0x00, 0x2D, 0xE8, 0x67, 0xDF, 0x40, 0x00, //   :@@%*#@@=
+    0x00, 0x07, 0x10, 0x00, 0x2E, 0xC0, 0x00, //    #.   :@@
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0xD0, 0x00, //          @@
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xA0, 0x00, //         .@@
+    0x00, 0x00, 0x01, 0x26, 0xDC, 0x10, 0x00, //      .:*@@.
+    0x00, 0x00, 0x0E, 0xFF, 0xA1, 0x00, 0x00, //      @@@@.
+    0x00, 0x00, 0x03, 0x57, 0xCE, 0x40, 0x00, //      -+#@@=
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0xE1, 0x00, //          @@.
+    0x00, 0x00, 0x00, 0x00, 0x05, 0xF5, 0x00, //          +@+
+    0x00, 0x48, 0x00, 0x00, 0x0A, 0xF3, 0x00, //   =%     @@-
+    0x00, 0x7F, 0xD7, 0x67, 0xCF, 0x90, 0x00, //   #@@#*#@@@
+    0x00, 0x03, 0xAD, 0xFE, 0xB5, 0x00, 0x00, //    -@@@@@+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @2800 '4' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x04, 0xFE, 0x00, 0x00, //        =@@
+    0x00, 0x00, 0x00, 0x2E, 0xEE, 0x00, 0x00, //       :@@@
+    0x00, 0x00, 0x00, 0xCC, 0x9E, 0x00, 0x00, //       @@@@
+    0x00, 0x00, 0x09, 0xE2, 0x9E, 0x00, 0x00, //      @@:@@
+    0x00, 0x00, 0x5F, 0x50, 0xAE, 0x00, 0x00, //     +@+ @@
+    0x00, 0x03, 0xE8, 0x00, 0xAE, 0x00, 0x00, //    -@%  @@
+    0x00, 0x1D, 0xB0, 0x00, 0xAE, 0x00, 0x00, //   .@@   @@
+    0x00, 0xBD, 0x21, 0x11, 0xAE, 0x11, 0x00, //   @@:...@@..
+    0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, //  -@@@@@@@@@@
+    0x01, 0x44, 0x44, 0x44, 0xBE, 0x43, 0x00, //  .======@@=-
+    0x00, 0x00, 0x00, 0x00, 0xAE, 0x00, 0x00, //         @@
+    0x00, 0x00, 0x00, 0x00, 0xAE, 0x00, 0x00, //         @@
+    0x00, 0x00, 0x00, 0x00, 0xAE, 0x00, 0x00, //         @@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @2940 '5' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, //    #@@@@@@@
+    0x00, 0x08, 0xF7, 0x66, 0x66, 0x50, 0x00, //    %@#****+
+    0x00, 0x09, 0xE0, 0x00, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x0A, 0xD0, 0x00, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x0B, 0xC0, 0x00, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x0C, 0xDC, 0xFF, 0xC6, 0x00, 0x00, //    @@@@@@*
+    0x00, 0x08, 0xB6, 0x45, 0xBF, 0xA0, 0x00, //    %@*=+@@@
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0xF3, 0x00, //          @@-
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xF6, 0x00, //          =@*
+    0x00, 0x00, 0x00, 0x00, 0x05, 0xF5, 0x00, //          +@+
+    0x00, 0x45, 0x00, 0x00, 0x1C, 0xF1, 0x00, //   =+    .@@.
+    0x00, 0x8F, 0xC7, 0x68, 0xDF, 0x60, 0x00, //   %@@#*%@@*
+    0x00, 0x04, 0xAD, 0xFE, 0xA3, 0x00, 0x00, //    =@@@@@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @3080 '6' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x06, 0xCE, 0xEB, 0x40, 0x00, //      *@@@@=
+    0x00, 0x00, 0xAF, 0xA7, 0x7C, 0xF2, 0x00, //     @@@##@@:
+    0x00, 0x07, 0xF6, 0x00, 0x00, 0x30, 0x00, //    #@*    -
+    0x00, 0x0D, 0xB0, 0x00, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x3F, 0x50, 0x00, 0x00, 0x00, 0x00, //   -@+
+    0x00, 0x5F, 0x36, 0xCF, 0xEA, 0x20, 0x00, //   +@-*@@@@:
+    0x00, 0x6F, 0xCC, 0x64, 0x6E, 0xE1, 0x00, //   *@@@*=*@@.
+    0x00, 0x6F, 0x90, 0x00, 0x03, 0xF7, 0x00, //   *@@    -@#
+    0x00, 0x5F, 0x40, 0x00, 0x00, 0xEA, 0x00, //   +@=     @@
+    0x00, 0x2F, 0x80, 0x00, 0x00, 0xF9, 0x00, //   :@%     @@
+    0x00, 0x0B, 0xE2, 0x00, 0x06, 0xF5, 0x00, //    @@:   *@+
+    0x00, 0x02, 0xEE, 0x75, 0x8F, 0xA0, 0x00, //    :@@#+%@@
+    0x00, 0x00, 0x29, 0xEF, 0xD6, 0x00, 0x00, //     :@@@@*
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @3220 '7' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, //   @@@@@@@@@@
+    0x00, 0x46, 0x66, 0x66, 0x6A, 0xF4, 0x00, //   =******@@=
+    0x00, 0x00, 0x00, 0x00, 0x2E, 0x70, 0x00, //         :@#
+    0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, //         @@
+    0x00, 0x00, 0x00, 0x05, 0xF3, 0x00, 0x00, //        +@-
+    0x00, 0x00, 0x00, 0x0D, 0xA0, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, //       =@=
+    0x00, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, //      .@%
+    0x00, 0x00, 0x04, 0xF6, 0x00, 0x00, 0x00, //      =@*
+    0x00, 0x00, 0x06, 0xF5, 0x00, 0x00, 0x00, //      *@+
+    0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, //      #@=
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @3360 '8' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x3B, 0xEE, 0xC5, 0x00, 0x00, //     -@@@@+
+    0x00, 0x04, 0xFB, 0x54, 0x9F, 0x60, 0x00, //    =@@+=@@*
+    0x00, 0x0B, 0xD0, 0x00, 0x0A, 0xE0, 0x00, //    @@    @@
+    0x00, 0x0C, 0xA0, 0x00, 0x06, 0xF0, 0x00, //    @@    *@
+    0x00, 0x08, 0xE3, 0x00, 0x09, 0xB0, 0x00, //    %@-   @@
+    0x00, 0x00, 0xAE, 0x82, 0x5D, 0x20, 0x00, //     @@%:+@:
+    0x00, 0x00, 0x7E, 0xDF, 0xF7, 0x00, 0x00, //     #@@@@#
+    0x00, 0x0B, 0xC1, 0x03, 0x9F, 0xA0, 0x00, //    @@. -@@@
+    0x00, 0x6F, 0x20, 0x00, 0x06, 0xF5, 0x00, //   *@:    *@+
+    0x00, 0x9E, 0x00, 0x00, 0x00, 0xF9, 0x00, //   @@      @@
+    0x00, 0x7F, 0x30, 0x00, 0x04, 0xF7, 0x00, //   #@-    =@#
+    0x00, 0x1D, 0xE8, 0x44, 0x7E, 0xD1, 0x00, //   .@@%==#@@.
+    0x00, 0x01, 0x7C, 0xEE, 0xC8, 0x10, 0x00, //    .#@@@@%.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @3500 '9' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x6D, 0xFD, 0x92, 0x00, 0x00, //     *@@@@:
+    0x00, 0x09, 0xF9, 0x57, 0xED, 0x20, 0x00, //    @@@+#@@:
+    0x00, 0x4F, 0x70, 0x00, 0x2E, 0xB0, 0x00, //   =@#   :@@
+    0x00, 0x9F, 0x10, 0x00, 0x08, 0xF2, 0x00, //   @@.    %@:
+    0x00, 0x9E, 0x00, 0x00, 0x04, 0xF5, 0x00, //   @@     =@+
+    0x00, 0x7F, 0x30, 0x00, 0x07, 0xF7, 0x00, //   #@-    #@#
+    0x00, 0x1E, 0xC4, 0x13, 0x9D, 0xF7, 0x00, //   .@@=.-@@@#
+    0x00, 0x03, 0xCF, 0xFE, 0x93, 0xF6, 0x00, //    -@@@@@-@*
+    0x00, 0x00, 0x01, 0x31, 0x05, 0xF3, 0x00, //      .-. +@-
+    0x00, 0x00, 0x00, 0x00, 0x0A, 0xD0, 0x00, //          @@
+    0x00, 0x03, 0x00, 0x00, 0x5F, 0x70, 0x00, //    -    +@#
+    0x00, 0x2F, 0xB6, 0x7A, 0xFA, 0x00, 0x00, //   :@@*#@@@
+    0x00, 0x04, 0xBE, 0xFC, 0x60, 0x00, 0x00, //    =@@@@*
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @3640 ':' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x03, 0xDD, 0x30, 0x00, 0x00, //      -@@-
+    0x00, 0x00, 0x09, 0xFF, 0x90, 0x00, 0x00, //      @@@@
+    0x00, 0x00, 0x06, 0xFF, 0x60, 0x00, 0x00, //      *@@*
+    0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, //       ==
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, //       ==
+    0x00, 0x00, 0x06, 0xFF, 0x60, 0x00, 0x00, //      *@@*
+    0x00, 0x00, 0x09, 0xFF, 0x90, 0x00, 0x00, //      @@@@
+    0x00, 0x00, 0x03, 0xDD, 0x30, 0x00, 0x00, //      -@@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @3780 ';' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x03, 0xDD, 0x30, 0x00, 0x00, //      -@@-
+    0x00, 0x00, 0x09, 0xFF, 0x90, 0x00, 0x00, //      @@@@
+    0x00, 0x00, 0x06, 0xFF, 0x60, 0x00, 0x00, //      *@@*
+    0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, //       ==
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x02, 0xDE, 0x40, 0x00, 0x00, //      :@@=
+    0x00, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x00, //      #@@@
+    0x00, 0x00, 0x02, 0xDF, 0xD0, 0x00, 0x00, //      :@@@
+    0x00, 0x00, 0x00, 0x0A, 0xC0, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x1E, 0x80, 0x00, 0x00, //       .@%
+    0x00, 0x00, 0x01, 0xBD, 0x10, 0x00, 0x00, //      .@@.
+    0x00, 0x00, 0x0D, 0xC2, 0x00, 0x00, 0x00, //      @@:
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, //      :
+    // @3920 '<' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, //           :
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, //          #@
+    0x00, 0x00, 0x00, 0x02, 0xBF, 0x60, 0x00, //        :@@*
+    0x00, 0x00, 0x00, 0x6E, 0xC2, 0x00, 0x00, //       *@@:
+    0x00, 0x00, 0x2B, 0xF7, 0x00, 0x00, 0x00, //     :@@#
+    0x00, 0x04, 0xEC, 0x30, 0x00, 0x00, 0x00, //    =@@-
+    0x00, 0x09, 0xF3, 0x00, 0x00, 0x00, 0x00, //    @@-
+    0x00, 0x01, 0xAF, 0x80, 0x00, 0x00, 0x00, //    .@@%
+    0x00, 0x00, 0x06, 0xEC, 0x30, 0x00, 0x00, //      *@@-
+    0x00, 0x00, 0x00, 0x2B, 0xF7, 0x00, 0x00, //       :@@#
+    0x00, 0x00, 0x00, 0x00, 0x6E, 0xB0, 0x00, //         *@@
+    0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, //          :@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @4060 '=' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, //   =@@@@@@@@=
+    0x00, 0x14, 0x44, 0x44, 0x44, 0x41, 0x00, //   .========.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, //   =@@@@@@@@=
+    0x00, 0x13, 0x33, 0x33, 0x33, 0x31, 0x00, //   .--------.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @4200 '>' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, //    :
+    0x00, 0x0C, 0x70, 0x00, 0x00, 0x00, 0x00, //    @#
+    0x00, 0x06, 0xFB, 0x20, 0x00, 0x00, 0x00, //    *@@:
+    0x00, 0x00, 0x2C, 0xE6, 0x00, 0x00, 0x00, //     :@@*
+    0x00, 0x00, 0x00, 0x7F, 0xB2, 0x00, 0x00, //       #@@:
+    0x00, 0x00, 0x00, 0x03, 0xCE, 0x40, 0x00, //        -@@=
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x00, //         -@@
+    0x00, 0x00, 0x00, 0x08, 0xFA, 0x10, 0x00, //        %@@.
+    0x00, 0x00, 0x03, 0xCE, 0x60, 0x00, 0x00, //      -@@*
+    0x00, 0x00, 0x7F, 0xB2, 0x00, 0x00, 0x00, //     #@@:
+    0x00, 0x0B, 0xE6, 0x00, 0x00, 0x00, 0x00, //    @@*
+    0x00, 0x0A, 0x20, 0x00, 0x00, 0x00, 0x00, //    @:
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @4340 '?' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x5C, 0xEE, 0xB3, 0x00, 0x00, //     +@@@@-
+    0x00, 0x07, 0xF9, 0x67, 0xDE, 0x30, 0x00, //    #@@*#@@-
+    0x00, 0x01, 0x30, 0x00, 0x3F, 0x80, 0x00, //    .-   -@%
+    0x00, 0x00, 0x00, 0x00, 0x2F, 0x70, 0x00, //         :@#
+    0x00, 0x00, 0x00, 0x00, 0xBD, 0x10, 0x00, //         @@.
+    0x00, 0x00, 0x00, 0x1C, 0xC1, 0x00, 0x00, //       .@@.
+    0x00, 0x00, 0x00, 0xBD, 0x10, 0x00, 0x00, //       @@.
+    0x00, 0x00, 0x02, 0xF5, 0x00, 0x00, 0x00, //      :@+
+    0x00, 0x00, 0x01, 0x41, 0x00, 0x00, 0x00, //      .=.
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, //       .
+    0x00, 0x00, 0x06, 0xFC, 0x00, 0x00, 0x00, //      *@@
+    0x00, 0x00, 0x0A, 0xFF, 0x20, 0x00, 0x00, //      @@@:
+    0x00, 0x00, 0x05, 0xEB, 0x00, 0x00, 0x00, //      +@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @4480 '@' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x06, 0xCE, 0xEA, 0x20, 0x00, //      *@@@@:
+    0x00, 0x01, 0xBD, 0x62, 0x3B, 0xD1, 0x00, //    .@@*:-@@.
+    0x00, 0x0A, 0xD1, 0x00, 0x00, 0xC7, 0x00, //    @@.    @#
+    0x00, 0x3F, 0x40, 0x00, 0x00, 0x6B, 0x00, //   -@=     *@
+    0x00, 0x8C, 0x00, 0x00, 0x00, 0x4D, 0x00, //   %@      =@
+    0x00, 0xC8, 0x00, 0x03, 0x8C, 0xEE, 0x00, //   @%   -%@@@
+    0x00, 0xE5, 0x00, 0x9E, 0x95, 0x7E, 0x00, //   @+  @@@+#@
+    0x00, 0xF4, 0x05, 0xF3, 0x00, 0x5E, 0x00, //   @= +@-  +@
+    0x00, 0xF4, 0x07, 0xD0, 0x00, 0x6E, 0x00, //   @= #@   *@
+    0x00, 0xE5, 0x05, 0xF4, 0x05, 0xDE, 0x00, //   @+ +@= +@@
+    0x00, 0xB7, 0x00, 0x9F, 0xFB, 0x4D, 0x00, //   @#  @@@@=@
+    0x00, 0x8B, 0x00, 0x01, 0x20, 0x00, 0x00, //   %@   .:
+    0x00, 0x2F, 0x30, 0x00, 0x00, 0x00, 0x00, //   :@-
+    0x00, 0x09, 0xC0, 0x00, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x01, 0xCC, 0x30, 0x14, 0xB1, 0x00, //    .@@- .=@.
+    0x00, 0x00, 0x18, 0xEF, 0xFD, 0x70, 0x00, //     .%@@@@#
+    0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, //        :.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @4620 'A' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x02, 0xFF, 0x20, 0x00, 0x00, //      :@@:
+    0x00, 0x00, 0x07, 0xEE, 0x70, 0x00, 0x00, //      #@@#
+    0x00, 0x00, 0x0C, 0x9A, 0xC0, 0x00, 0x00, //      @@@@
+    0x00, 0x00, 0x2F, 0x56, 0xF2, 0x00, 0x00, //     :@+*@:
+    0x00, 0x00, 0x7F, 0x11, 0xF7, 0x00, 0x00, //     #@..@#
+    0x00, 0x00, 0xCB, 0x00, 0xCC, 0x00, 0x00, //     @@  @@
+    0x00, 0x02, 0xF7, 0x00, 0x8F, 0x20, 0x00, //    :@#  %@:
+    0x00, 0x07, 0xF3, 0x11, 0x4F, 0x70, 0x00, //    #@-..=@#
+    0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, //    @@@@@@@@
+    0x00, 0x3F, 0x94, 0x44, 0x4A, 0xF2, 0x00, //   -@@====@@:
+    0x00, 0x8F, 0x30, 0x00, 0x04, 0xF8, 0x00, //   %@-    =@%
+    0x00, 0xDD, 0x00, 0x00, 0x00, 0xDD, 0x00, //   @@      @@
+    0x03, 0xF8, 0x00, 0x00, 0x00, 0x9F, 0x30, //  -@%      @@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @4760 'B' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x0E, 0xFF, 0xFE, 0xC7, 0x10, 0x00, //    @@@@@@#.
+    0x00, 0x0E, 0xC5, 0x56, 0xAF, 0xB0, 0x00, //    @@++*@@@
+    0x00, 0x0E, 0xB0, 0x00, 0x0A, 0xF2, 0x00, //    @@    @@:
+    0x00, 0x0E, 0xB0, 0x00, 0x09, 0xF1, 0x00, //    @@    @@.
+    0x00, 0x0E, 0xB0, 0x12, 0x6F, 0x70, 0x00, //    @@ .:*@#
+    0x00, 0x0E, 0xFF, 0xFF, 0xF7, 0x00, 0x00, //    @@@@@@#
+    0x00, 0x0E, 0xC3, 0x35, 0x7E, 0xC1, 0x00, //    @@--+#@@.
+    0x00, 0x0E, 0xB0, 0x00, 0x02, 0xF9, 0x00, //    @@    :@@
+    0x00, 0x0E, 0xB0, 0x00, 0x00, 0xCD, 0x00, //    @@     @@
+    0x00, 0x0E, 0xB0, 0x00, 0x00, 0xDD, 0x00, //    @@     @@
+    0x00, 0x0E, 0xB0, 0x00, 0x04, 0xF9, 0x00, //    @@    =@@
+    0x00, 0x0E, 0xC5, 0x56, 0xAF, 0xD1, 0x00, //    @@++*@@@.
+    0x00, 0x0E, 0xFF, 0xFE, 0xC7, 0x10, 0x00, //    @@@@@@#.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @4900 'C' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x06, 0xBE, 0xEC, 0x60, 0x00, //      *@@@@*
+    0x00, 0x01, 0xBF, 0xC8, 0x8B, 0xF7, 0x00, //    .@@@%%@@#
+    0x00, 0x09, 0xF7, 0x00, 0x00, 0x51, 0x00, //    @@#    +.
+    0x00, 0x2F, 0xB0, 0x00, 0x00, 0x00, 0x00, //   :@@
+    0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x00, //   #@+
+    0x00, 0x9F, 0x20, 0x00, 0x00, 0x00, 0x00, //   @@:
+    0x00, 0xAF, 0x10, 0x00, 0x00, 0x00, 0x00, //   @@.
+    0x00, 0x9F, 0x20, 0x00, 0x00, 0x00, 0x00, //   @@:
+    0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x00, //   #@+
+    0x00, 0x2F, 0xB0, 0x00, 0x00, 0x00, 0x00, //   :@@
+    0x00, 0x09, 0xF8, 0x00, 0x00, 0x57, 0x00, //    @@%    +#
+    0x00, 0x01, 0xBF, 0xC8, 0x7B, 0xFA, 0x00, //    .@@@%#@@@
+    0x00, 0x00, 0x06, 0xCE, 0xEC, 0x60, 0x00, //      *@@@@*
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @5040 'D' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x4F, 0xFF, 0xED, 0x82, 0x00, 0x00, //   =@@@@@%:
+    0x00, 0x4F, 0x96, 0x7A, 0xFE, 0x40, 0x00, //   =@@*#@@@=
+    0x00, 0x4F, 0x50, 0x00, 0x3E, 0xE1, 0x00, //   =@+   -@@.
+    0x00, 0x4F, 0x50, 0x00, 0x05, 0xF7, 0x00, //   =@+    +@#
+    0x00, 0x4F, 0x50, 0x00, 0x00, 0xEC, 0x00, //   =@+     @@
+    0x00, 0x4F, 0x50, 0x00, 0x00, 0xCE, 0x00, //   =@+     @@
+    0x00, 0x4F, 0x50, 0x00, 0x00, 0xBF, 0x00, //   =@+     @@
+    0x00, 0x4F, 0x50, 0x00, 0x00, 0xCE, 0x00, //   =@+     @@
+    0x00, 0x4F, 0x50, 0x00, 0x00, 0xFB, 0x00, //   =@+     @@
+    0x00, 0x4F, 0x50, 0x00, 0x06, 0xF7, 0x00, //   =@+    *@#
+    0x00, 0x4F, 0x50, 0x00, 0x3E, 0xE1, 0x00, //   =@+   -@@.
+    0x00, 0x4F, 0x95, 0x69, 0xFE, 0x30, 0x00, //   =@@+*@@@-
+    0x00, 0x4F, 0xFF, 0xED, 0x82, 0x00, 0x00, //   =@@@@@%:
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @5180 'E' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, //    @@@@@@@@*
+    0x00, 0x0B, 0xF6, 0x66, 0x66, 0x62, 0x00, //    @@******:
+    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x0B, 0xF2, 0x22, 0x22, 0x10, 0x00, //    @@:::::.
+    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0x60, 0x00, //    @@@@@@@*
+    0x00, 0x0B, 0xF5, 0x55, 0x55, 0x20, 0x00, //    @@+++++:
+    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x0B, 0xF6, 0x66, 0x66, 0x64, 0x00, //    @@******=
+    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, //    @@@@@@@@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @5320 'F' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, //    =@@@@@@@@
+    0x00, 0x04, 0xF9, 0x66, 0x66, 0x64, 0x00, //    =@@*****=
+    0x00, 0x04, 0xF5, 0x00, 0x00, 0x00, 0x00, //    =@+
+    0x00, 0x04, 0xF5, 0x00, 0x00, 0x00, 0x00, //    =@+
+    0x00, 0x04, 0xF5, 0x00, 0x00, 0x00, 0x00, //    =@+
+    0x00, 0x04, 0xF6, 0x22, 0x22, 0x10, 0x00, //    =@*::::.
+    0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, //    =@@@@@@@
+    0x00, 0x04, 0xF8, 0x44, 0x44, 0x30, 0x00, //    =@%====-
+    0x00, 0x04, 0xF5, 0x00, 0x00, 0x00, 0x00, //    =@+
+    0x00, 0x04, 0xF5, 0x00, 0x00, 0x00, 0x00, //    =@+
+    0x00, 0x04, 0xF5, 0x00, 0x00, 0x00, 0x00, //    =@+
+    0x00, 0x04, 0xF5, 0x00, 0x00, 0x00, 0x00, //    =@+
+    0x00, 0x04, 0xF5, 0x00, 0x00, 0x00, 0x00, //    =@+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @5460 'G' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x18, 0xCE, 0xEA, 0x30, 0x00, //     .%@@@@-
+    0x00, 0x02, 0xDF, 0xB8, 0x8C, 0xF3, 0x00, //    :@@@%%@@-
+    0x00, 0x0D, 0xF4, 0x00, 0x00, 0x50, 0x00, //    @@=    +
+    0x00, 0x6F, 0x70, 0x00, 0x00, 0x00, 0x00, //   *@#
+    0x00, 0xAF, 0x10, 0x00, 0x00, 0x00, 0x00, //   @@.
+    0x00, 0xDD, 0x00, 0x01, 0x11, 0x11, 0x00, //   @@   .....
+    0x00, 0xEC, 0x00, 0x08, 0xFF, 0xFA, 0x00, //   @@   %@@@@
+    0x00, 0xDD, 0x00, 0x02, 0x44, 0xEA, 0x00, //   @@   :==@@
+    0x00, 0xBF, 0x10, 0x00, 0x00, 0xDA, 0x00, //   @@.     @@
+    0x00, 0x6F, 0x70, 0x00, 0x00, 0xDA, 0x00, //   *@#     @@
+    0x00, 0x0D, 0xE4, 0x00, 0x00, 0xEA, 0x00, //    @@=    @@
+    0x00, 0x03, 0xEF, 0xA7, 0x8D, 0xF7, 0x00, //    -@@@#%@@#
+    0x00, 0x00, 0x18, 0xDF, 0xEB, 0x50, 0x00, //     .%@@@@+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @5600 'H' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x6F, 0x40, 0x00, 0x04, 0xF6, 0x00, //   *@=    =@*
+    0x00, 0x6F, 0x40, 0x00, 0x04, 0xF6, 0x00, //   *@=    =@*
+    0x00, 0x6F, 0x40, 0x00, 0x04, 0xF6, 0x00, //   *@=    =@*
+    0x00, 0x6F, 0x40, 0x00, 0x04, 0xF6, 0x00, //   *@=    =@*
+    0x00, 0x6F, 0x52, 0x22, 0x25, 0xF6, 0x00, //   *@+::::+@*
+    0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, //   *@@@@@@@@*
+    0x00, 0x6F, 0x75, 0x55, 0x57, 0xF6, 0x00, //   *@#++++#@*
+    0x00, 0x6F, 0x40, 0x00, 0x04, 0xF6, 0x00, //   *@=    =@*
+    0x00, 0x6F, 0x40, 0x00, 0x04, 0xF6, 0x00, //   *@=    =@*
+    0x00, 0x6F, 0x40, 0x00, 0x04, 0xF6, 0x00, //   *@=    =@*
+    0x00, 0x6F, 0x40, 0x00, 0x04, 0xF6, 0x00, //   *@=    =@*
+    0x00, 0x6F, 0x40, 0x00, 0x04, 0xF6, 0x00, //   *@=    =@*
+    0x00, 0x6F, 0x40, 0x00, 0x04, 0xF6, 0x00, //   *@=    =@*
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @5740 'I' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, //   .@@@@@@@@.
+    0x00, 0x16, 0x66, 0xEE, 0x66, 0x61, 0x00, //   .***@@***.
+    0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x16, 0x66, 0xEE, 0x66, 0x61, 0x00, //   .***@@***.
+    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, //   .@@@@@@@@.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @5880 'J' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, //    =@@@@@@@
+    0x00, 0x02, 0x66, 0x66, 0x6D, 0xD0, 0x00, //    :*****@@
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0xD0, 0x00, //          @@
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0xD0, 0x00, //          @@
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0xD0, 0x00, //          @@
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0xD0, 0x00, //          @@
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0xD0, 0x00, //          @@
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0xD0, 0x00, //          @@
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0xD0, 0x00, //          @@
+    0x00, 0x00, 0x00, 0x00, 0x0E, 0xB0, 0x00, //          @@
+    0x00, 0x2D, 0x40, 0x00, 0x4F, 0x90, 0x00, //   :@=   =@@
+    0x00, 0x1C, 0xFA, 0x79, 0xFE, 0x20, 0x00, //   .@@@#@@@:
+    0x00, 0x01, 0x8D, 0xFE, 0xA2, 0x00, 0x00, //    .%@@@@:
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @6020 'K' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x1F, 0xA0, 0x00, 0x03, 0xFA, 0x00, //   .@@    -@@
+    0x00, 0x1F, 0xA0, 0x00, 0x2E, 0xC1, 0x00, //   .@@   :@@.
+    0x00, 0x1F, 0xA0, 0x01, 0xDD, 0x20, 0x00, //   .@@  .@@:
+    0x00, 0x1F, 0xA0, 0x0B, 0xE3, 0x00, 0x00, //   .@@  @@-
+    0x00, 0x1F, 0xA0, 0x9F, 0x50, 0x00, 0x00, //   .@@ @@+
+    0x00, 0x1F, 0xA7, 0xFF, 0x40, 0x00, 0x00, //   .@@#@@=
+    0x00, 0x1F, 0xDF, 0xBD, 0xC0, 0x00, 0x00, //   .@@@@@@
+    0x00, 0x1F, 0xFC, 0x16, 0xF6, 0x00, 0x00, //   .@@@.*@*
+    0x00, 0x1F, 0xD1, 0x00, 0xCE, 0x10, 0x00, //   .@@.  @@.
+    0x00, 0x1F, 0xA0, 0x00, 0x4F, 0x80, 0x00, //   .@@   =@%
+    0x00, 0x1F, 0xA0, 0x00, 0x0A, 0xF2, 0x00, //   .@@    @@:
+    0x00, 0x1F, 0xA0, 0x00, 0x02, 0xFB, 0x00, //   .@@    :@@
+    0x00, 0x1F, 0xA0, 0x00, 0x00, 0x8F, 0x40, //   .@@     %@=
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @6160 'L' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x05, 0xF5, 0x00, 0x00, 0x00, 0x00, //    +@+
+    0x00, 0x05, 0xF5, 0x00, 0x00, 0x00, 0x00, //    +@+
+    0x00, 0x05, 0xF5, 0x00, 0x00, 0x00, 0x00, //    +@+
+    0x00, 0x05, 0xF5, 0x00, 0x00, 0x00, 0x00, //    +@+
+    0x00, 0x05, 0xF5, 0x00, 0x00, 0x00, 0x00, //    +@+
+    0x00, 0x05, 0xF5, 0x00, 0x00, 0x00, 0x00, //    +@+
+    0x00, 0x05, 0xF5, 0x00, 0x00, 0x00, 0x00, //    +@+
+    0x00, 0x05, 0xF5, 0x00, 0x00, 0x00, 0x00, //    +@+
+    0x00, 0x05, 0xF5, 0x00, 0x00, 0x00, 0x00, //    +@+
+    0x00, 0x05, 0xF5, 0x00, 0x00, 0x00, 0x00, //    +@+
+    0x00, 0x05, 0xF5, 0x00, 0x00, 0x00, 0x00, //    +@+
+    0x00, 0x05, 0xF9, 0x66, 0x66, 0x65, 0x00, //    +@@*****+
+    0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, //    +@@@@@@@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @6300 'M' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x6F, 0x90, 0x00, 0x09, 0xF6, 0x00, //   *@@    @@*
+    0x00, 0x6F, 0xE0, 0x00, 0x0E, 0xF6, 0x00, //   *@@    @@*
+    0x00, 0x6D, 0xD4, 0x00, 0x4D, 0xE6, 0x00, //   *@@=  =@@*
+    0x00, 0x6E, 0x99, 0x00, 0x98, 0xE6, 0x00, //   *@@@  @%@*
+    0x00, 0x6F, 0x4E, 0x00, 0xE3, 0xF6, 0x00, //   *@=@  @-@*
+    0x00, 0x6F, 0x0D, 0x44, 0xD1, 0xF6, 0x00, //   *@ @==@.@*
+    0x00, 0x6F, 0x08, 0x99, 0x81, 0xF6, 0x00, //   *@ %@@%.@*
+    0x00, 0x6F, 0x03, 0xEE, 0x21, 0xF6, 0x00, //   *@ -@@:.@*
+    0x00, 0x6F, 0x00, 0xCC, 0x01, 0xF6, 0x00, //   *@  @@ .@*
+    0x00, 0x6F, 0x00, 0x44, 0x01, 0xF6, 0x00, //   *@  == .@*
+    0x00, 0x6F, 0x00, 0x00, 0x01, 0xF6, 0x00, //   *@     .@*
+    0x00, 0x6F, 0x00, 0x00, 0x01, 0xF6, 0x00, //   *@     .@*
+    0x00, 0x6F, 0x00, 0x00, 0x01, 0xF6, 0x00, //   *@     .@*
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @6440 'N' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x5F, 0x90, 0x00, 0x04, 0xF5, 0x00, //   +@@    =@+
+    0x00, 0x5F, 0xF2, 0x00, 0x04, 0xF5, 0x00, //   +@@:   =@+
+    0x00, 0x5F, 0xCA, 0x00, 0x04, 0xF5, 0x00, //   +@@@   =@+
+    0x00, 0x5F, 0x6F, 0x30, 0x04, 0xF5, 0x00, //   +@*@-  =@+
+    0x00, 0x5F, 0x2C, 0xA0, 0x04, 0xF5, 0x00, //   +@:@@  =@+
+    0x00, 0x5F, 0x34, 0xF3, 0x04, 0xF5, 0x00, //   +@-=@- =@+
+    0x00, 0x5F, 0x30, 0xBB, 0x03, 0xF5, 0x00, //   +@- @@ -@+
+    0x00, 0x5F, 0x40, 0x3F, 0x43, 0xF5, 0x00, //   +@= -@=-@+
+    0x00, 0x5F, 0x40, 0x0B, 0xC3, 0xF5, 0x00, //   +@=  @@-@+
+    0x00, 0x5F, 0x40, 0x03, 0xF6, 0xF5, 0x00, //   +@=  -@*@+
+    0x00, 0x5F, 0x40, 0x00, 0xAC, 0xF5, 0x00, //   +@=   @@@+
+    0x00, 0x5F, 0x40, 0x00, 0x2F, 0xF5, 0x00, //   +@=   :@@+
+    0x00, 0x5F, 0x40, 0x00, 0x09, 0xF5, 0x00, //   +@=    @@+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @6580 'O' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x4B, 0xEE, 0xB4, 0x00, 0x00, //     =@@@@=
+    0x00, 0x06, 0xFD, 0x88, 0xDF, 0x60, 0x00, //    *@@%%@@*
+    0x00, 0x2F, 0xC1, 0x00, 0x1C, 0xF2, 0x00, //   :@@.  .@@:
+    0x00, 0x9F, 0x40, 0x00, 0x04, 0xF8, 0x00, //   @@=    =@%
+    0x00, 0xDE, 0x00, 0x00, 0x00, 0xED, 0x00, //   @@      @@
+    0x00, 0xFC, 0x00, 0x00, 0x00, 0xCF, 0x00, //   @@      @@
+    0x00, 0xFB, 0x00, 0x00, 0x00, 0xBF, 0x00, //   @@      @@
+    0x00, 0xFC, 0x00, 0x00, 0x00, 0xCF, 0x00, //   @@      @@
+    0x00, 0xCE, 0x00, 0x00, 0x00, 0xEC, 0x00, //   @@      @@
+    0x00, 0x8F, 0x40, 0x00, 0x04, 0xF8, 0x00, //   %@=    =@%
+    0x00, 0x2E, 0xC1, 0x00, 0x1C, 0xE2, 0x00, //   :@@.  .@@:
+    0x00, 0x05, 0xFD, 0x88, 0xDF, 0x50, 0x00, //    +@@%%@@+
+    0x00, 0x00, 0x4B, 0xEE, 0xB4, 0x00, 0x00, //     =@@@@=
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @6720 'P' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x0E, 0xFF, 0xFE, 0xDA, 0x30, 0x00, //    @@@@@@@-
+    0x00, 0x0E, 0xC5, 0x56, 0x8E, 0xF4, 0x00, //    @@++*%@@=
+    0x00, 0x0E, 0xB0, 0x00, 0x02, 0xEB, 0x00, //    @@    :@@
+    0x00, 0x0E, 0xB0, 0x00, 0x00, 0xCD, 0x00, //    @@     @@
+    0x00, 0x0E, 0xB0, 0x00, 0x01, 0xEC, 0x00, //    @@    .@@
+    0x00, 0x0E, 0xB1, 0x12, 0x5C, 0xF5, 0x00, //    @@..:+@@+
+    0x00, 0x0E, 0xFF, 0xFF, 0xFD, 0x50, 0x00, //    @@@@@@@+
+    0x00, 0x0E, 0xC4, 0x43, 0x20, 0x00, 0x00, //    @@==-:
+    0x00, 0x0E, 0xB0, 0x00, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x0E, 0xB0, 0x00, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x0E, 0xB0, 0x00, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x0E, 0xB0, 0x00, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x0E, 0xB0, 0x00, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @6860 'Q' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x4B, 0xEE, 0xB3, 0x00, 0x00, //     =@@@@-
+    0x00, 0x06, 0xFD, 0x88, 0xDF, 0x50, 0x00, //    *@@%%@@+
+    0x00, 0x2E, 0xC1, 0x00, 0x1D, 0xE1, 0x00, //   :@@.  .@@.
+    0x00, 0x8F, 0x40, 0x00, 0x05, 0xF7, 0x00, //   %@=    +@#
+    0x00, 0xCE, 0x00, 0x00, 0x00, 0xFB, 0x00, //   @@      @@
+    0x00, 0xEC, 0x00, 0x00, 0x00, 0xDD, 0x00, //   @@      @@
+    0x00, 0xFB, 0x00, 0x00, 0x00, 0xBE, 0x00, //   @@      @@
+    0x00, 0xFC, 0x00, 0x00, 0x00, 0xCE, 0x00, //   @@      @@
+    0x00, 0xDD, 0x00, 0x00, 0x00, 0xEC, 0x00, //   @@      @@
+    0x00, 0x9F, 0x20, 0x00, 0x03, 0xF8, 0x00, //   @@:    -@%
+    0x00, 0x3F, 0x90, 0x00, 0x0A, 0xF2, 0x00, //   -@@    @@:
+    0x00, 0x09, 0xF9, 0x22, 0x9F, 0x80, 0x00, //    @@@::@@%
+    0x00, 0x00, 0x9F, 0xFF, 0xF8, 0x00, 0x00, //     @@@@@%
+    0x00, 0x00, 0x01, 0xBF, 0x30, 0x00, 0x00, //      .@@-
+    0x00, 0x00, 0x00, 0x3E, 0xD5, 0x22, 0x00, //       -@@+::
+    0x00, 0x00, 0x00, 0x03, 0xCF, 0xFE, 0x00, //        -@@@@
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x43, 0x00, //          :=-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @7000 'R' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x0F, 0xFF, 0xFE, 0xD9, 0x20, 0x00, //    @@@@@@@:
+    0x00, 0x0F, 0xC5, 0x56, 0x9E, 0xE2, 0x00, //    @@++*@@@:
+    0x00, 0x0F, 0xA0, 0x00, 0x04, 0xF8, 0x00, //    @@    =@%
+    0x00, 0x0F, 0xA0, 0x00, 0x01, 0xF9, 0x00, //    @@    .@@
+    0x00, 0x0F, 0xA0, 0x00, 0x04, 0xF8, 0x00, //    @@    =@%
+    0x00, 0x0F, 0xA1, 0x12, 0x6D, 0xE2, 0x00, //    @@..:*@@:
+    0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x30, 0x00, //    @@@@@@@-
+    0x00, 0x0F, 0xB4, 0x4D, 0xE1, 0x00, 0x00, //    @@==@@.
+    0x00, 0x0F, 0xA0, 0x05, 0xF8, 0x00, 0x00, //    @@  +@%
+    0x00, 0x0F, 0xA0, 0x00, 0xCE, 0x20, 0x00, //    @@   @@:
+    0x00, 0x0F, 0xA0, 0x00, 0x3F, 0xA0, 0x00, //    @@   -@@
+    0x00, 0x0F, 0xA0, 0x00, 0x0A, 0xF3, 0x00, //    @@    @@-
+    0x00, 0x0F, 0xA0, 0x00, 0x02, 0xFC, 0x00, //    @@    :@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @7140 'S' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x3A, 0xDF, 0xD8, 0x10, 0x00, //     -@@@@%.
+    0x00, 0x05, 0xFD, 0x87, 0xAE, 0xE1, 0x00, //    +@@%#@@@.
+    0x00, 0x0E, 0xD1, 0x00, 0x01, 0x60, 0x00, //    @@.   .*
+    0x00, 0x0F, 0xB0, 0x00, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x0B, 0xF5, 0x00, 0x00, 0x00, 0x00, //    @@+
+    0x00, 0x02, 0xCF, 0xD6, 0x10, 0x00, 0x00, //    :@@@*.
+    0x00, 0x00, 0x06, 0xCF, 0xE9, 0x10, 0x00, //      *@@@@.
+    0x00, 0x00, 0x00, 0x03, 0xAF, 0xD1, 0x00, //        -@@@.
+    0x00, 0x00, 0x00, 0x00, 0x05, 0xF8, 0x00, //          +@%
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, //           @@
+    0x00, 0x3C, 0x30, 0x00, 0x05, 0xF8, 0x00, //   -@-    +@%
+    0x00, 0x4E, 0xFB, 0x87, 0xAF, 0xD1, 0x00, //   =@@@%#@@@.
+    0x00, 0x01, 0x7C, 0xEF, 0xD8, 0x10, 0x00, //    .#@@@@%.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @7280 'T' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, //  :@@@@@@@@@@:
+    0x01, 0x66, 0x66, 0xEE, 0x66, 0x66, 0x10, //  .****@@****.
+    0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @7420 'U' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x6F, 0x40, 0x00, 0x03, 0xF6, 0x00, //   *@=    -@*
+    0x00, 0x6F, 0x40, 0x00, 0x03, 0xF6, 0x00, //   *@=    -@*
+    0x00, 0x6F, 0x40, 0x00, 0x03, 0xF6, 0x00, //   *@=    -@*
+    0x00, 0x6F, 0x40, 0x00, 0x03, 0xF6, 0x00, //   *@=    -@*
+    0x00, 0x6F, 0x40, 0x00, 0x03, 0xF6, 0x00, //   *@=    -@*
+    0x00, 0x6F, 0x40, 0x00, 0x03, 0xF6, 0x00, //   *@=    -@*
+    0x00, 0x6F, 0x40, 0x00, 0x03, 0xF6, 0x00, //   *@=    -@*
+    0x00, 0x6F, 0x40, 0x00, 0x03, 0xF6, 0x00, //   *@=    -@*
+    0x00, 0x6F, 0x40, 0x00, 0x04, 0xF6, 0x00, //   *@=    =@*
+    0x00, 0x4F, 0x70, 0x00, 0x06, 0xF4, 0x00, //   =@#    *@=
+    0x00, 0x1E, 0xD1, 0x00, 0x1C, 0xE1, 0x00, //   .@@.  .@@.
+    0x00, 0x06, 0xFD, 0x88, 0xDF, 0x60, 0x00, //    *@@%%@@*
+    0x00, 0x00, 0x5C, 0xEF, 0xC5, 0x00, 0x00, //     +@@@@+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @7560 'V' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0xEC, 0x00, 0x00, 0x00, 0xBE, 0x00, //   @@      @@
+    0x00, 0xAF, 0x10, 0x00, 0x01, 0xFA, 0x00, //   @@.    .@@
+    0x00, 0x5F, 0x60, 0x00, 0x05, 0xF5, 0x00, //   +@*    +@+
+    0x00, 0x1F, 0xA0, 0x00, 0x09, 0xF1, 0x00, //   .@@    @@.
+    0x00, 0x0A, 0xE0, 0x00, 0x0E, 0xB0, 0x00, //    @@    @@
+    0x00, 0x06, 0xF4, 0x00, 0x3F, 0x60, 0x00, //    *@=  -@*
+    0x00, 0x01, 0xF9, 0x00, 0x8F, 0x10, 0x00, //    .@@  %@.
+    0x00, 0x00, 0xBD, 0x00, 0xCB, 0x00, 0x00, //     @@  @@
+    0x00, 0x00, 0x6F, 0x21, 0xF6, 0x00, 0x00, //     *@:.@*
+    0x00, 0x00, 0x1F, 0x76, 0xF2, 0x00, 0x00, //     .@#*@:
+    0x00, 0x00, 0x0B, 0xBA, 0xC0, 0x00, 0x00, //      @@@@
+    0x00, 0x00, 0x07, 0xFE, 0x70, 0x00, 0x00, //      #@@#
+    0x00, 0x00, 0x02, 0xFF, 0x20, 0x00, 0x00, //      :@@:
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @7700 'W' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x0B, 0xE0, 0x00, 0x00, 0x00, 0x0D, 0xB0, //  @@        @@
+    0x09, 0xF1, 0x00, 0x00, 0x00, 0x0E, 0x90, //  @@.       @@
+    0x06, 0xF3, 0x00, 0x00, 0x00, 0x1F, 0x60, //  *@-      .@*
+    0x04, 0xF5, 0x00, 0xAC, 0x00, 0x3F, 0x40, //  =@+  @@  -@=
+    0x02, 0xF7, 0x00, 0xEF, 0x10, 0x5F, 0x20, //  :@#  @@. +@:
+    0x00, 0xE9, 0x03, 0xDD, 0x50, 0x7F, 0x00, //   @@ -@@+ #@
+    0x00, 0xCB, 0x07, 0xAA, 0xA0, 0x9C, 0x00, //   @@ #@@@ @@
+    0x00, 0xAD, 0x0C, 0x67, 0xE0, 0xBA, 0x00, //   @@ @*#@ @@
+    0x00, 0x7E, 0x1F, 0x23, 0xF2, 0xC8, 0x00, //   #@.@:-@:@%
+    0x00, 0x5F, 0x5E, 0x00, 0xE6, 0xE6, 0x00, //   +@+@  @*@*
+    0x00, 0x3F, 0xAA, 0x00, 0xAA, 0xF3, 0x00, //   -@@@  @@@-
+    0x00, 0x0F, 0xF6, 0x00, 0x6E, 0xF1, 0x00, //    @@*  *@@.
+    0x00, 0x0D, 0xF2, 0x00, 0x2F, 0xE0, 0x00, //    @@:  :@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @7840 'X' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x6F, 0x70, 0x00, 0x06, 0xF5, 0x00, //   *@#    *@+
+    0x00, 0x0C, 0xE1, 0x00, 0x0D, 0xC0, 0x00, //    @@.   @@
+    0x00, 0x03, 0xF8, 0x00, 0x7F, 0x30, 0x00, //    -@%  #@-
+    0x00, 0x00, 0x9F, 0x21, 0xEA, 0x00, 0x00, //     @@:.@@
+    0x00, 0x00, 0x1E, 0xA7, 0xE2, 0x00, 0x00, //     .@@#@:
+    0x00, 0x00, 0x07, 0xFE, 0x70, 0x00, 0x00, //      #@@#
+    0x00, 0x00, 0x03, 0xFF, 0x20, 0x00, 0x00, //      -@@:
+    0x00, 0x00, 0x0B, 0xDE, 0xA0, 0x00, 0x00, //      @@@@
+    0x00, 0x00, 0x4F, 0x57, 0xF4, 0x00, 0x00, //     =@+#@=
+    0x00, 0x00, 0xDC, 0x00, 0xDD, 0x00, 0x00, //     @@  @@
+    0x00, 0x07, 0xF3, 0x00, 0x5F, 0x70, 0x00, //    #@-  +@#
+    0x00, 0x1E, 0xA0, 0x00, 0x0C, 0xE1, 0x00, //   .@@    @@.
+    0x00, 0x9F, 0x20, 0x00, 0x03, 0xF9, 0x00, //   @@:    -@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @7980 'Y' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x01, 0xEC, 0x00, 0x00, 0x00, 0xBE, 0x10, //  .@@      @@.
+    0x00, 0x7F, 0x40, 0x00, 0x03, 0xF7, 0x00, //   #@=    -@#
+    0x00, 0x0D, 0xC0, 0x00, 0x0B, 0xD0, 0x00, //    @@    @@
+    0x00, 0x06, 0xF5, 0x00, 0x3F, 0x60, 0x00, //    *@+  -@*
+    0x00, 0x00, 0xDC, 0x00, 0xBD, 0x00, 0x00, //     @@  @@
+    0x00, 0x00, 0x5F, 0x53, 0xF5, 0x00, 0x00, //     +@+-@+
+    0x00, 0x00, 0x0C, 0xCB, 0xC0, 0x00, 0x00, //      @@@@
+    0x00, 0x00, 0x04, 0xFF, 0x40, 0x00, 0x00, //      =@@=
+    0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @8120 'Z' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, //   .@@@@@@@@@
+    0x00, 0x06, 0x66, 0x66, 0x6B, 0xF5, 0x00, //    ******@@+
+    0x00, 0x00, 0x00, 0x00, 0x2E, 0xA0, 0x00, //         :@@
+    0x00, 0x00, 0x00, 0x00, 0xCD, 0x10, 0x00, //         @@.
+    0x00, 0x00, 0x00, 0x08, 0xF4, 0x00, 0x00, //        %@=
+    0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, //       -@%
+    0x00, 0x00, 0x01, 0xDC, 0x00, 0x00, 0x00, //      .@@
+    0x00, 0x00, 0x09, 0xF3, 0x00, 0x00, 0x00, //      @@-
+    0x00, 0x00, 0x4F, 0x70, 0x00, 0x00, 0x00, //     =@#
+    0x00, 0x01, 0xDB, 0x00, 0x00, 0x00, 0x00, //    .@@
+    0x00, 0x0A, 0xE2, 0x00, 0x00, 0x00, 0x00, //    @@:
+    0x00, 0x5F, 0xB6, 0x66, 0x66, 0x65, 0x00, //   +@@******+
+    0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, //   @@@@@@@@@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @8260 '[' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF1, 0x00, //      #@@@@@.
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, //      #@
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, //      #@
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, //      #@
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, //      #@
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, //      #@
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, //      #@
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, //      #@
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, //      #@
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, //      #@
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, //      #@
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, //      #@
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, //      #@
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, //      #@
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, //      #@
+    0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, //      #@
+    0x00, 0x00, 0x07, 0xEE, 0xEE, 0xE1, 0x00, //      #@@@@@.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @8400 '\' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x0C, 0xA0, 0x00, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x07, 0xE1, 0x00, 0x00, 0x00, 0x00, //    #@.
+    0x00, 0x01, 0xF6, 0x00, 0x00, 0x00, 0x00, //    .@*
+    0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, 0x00, //     @@
+    0x00, 0x00, 0x5F, 0x20, 0x00, 0x00, 0x00, //     +@:
+    0x00, 0x00, 0x0E, 0x80, 0x00, 0x00, 0x00, //      @%
+    0x00, 0x00, 0x09, 0xD0, 0x00, 0x00, 0x00, //      @@
+    0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 0x00, //      -@=
+    0x00, 0x00, 0x00, 0xCA, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x7E, 0x10, 0x00, 0x00, //       #@.
+    0x00, 0x00, 0x00, 0x1F, 0x60, 0x00, 0x00, //       .@*
+    0x00, 0x00, 0x00, 0x0B, 0xB0, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x05, 0xF2, 0x00, 0x00, //        +@:
+    0x00, 0x00, 0x00, 0x00, 0xE8, 0x00, 0x00, //         @%
+    0x00, 0x00, 0x00, 0x00, 0x9D, 0x00, 0x00, //         @@
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0x00, //         -@=
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0xA0, 0x00, //          @@
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x70, 0x00, //          =#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @8540 ']' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x00, //    @@@@@%
+    0x00, 0x00, 0x00, 0x0C, 0x80, 0x00, 0x00, //        @%
+    0x00, 0x00, 0x00, 0x0C, 0x80, 0x00, 0x00, //        @%
+    0x00, 0x00, 0x00, 0x0C, 0x80, 0x00, 0x00, //        @%
+    0x00, 0x00, 0x00, 0x0C, 0x80, 0x00, 0x00, //        @%
+    0x00, 0x00, 0x00, 0x0C, 0x80, 0x00, 0x00, //        @%
+    0x00, 0x00, 0x00, 0x0C, 0x80, 0x00, 0x00, //        @%
+    0x00, 0x00, 0x00, 0x0C, 0x80, 0x00, 0x00, //        @%
+    0x00, 0x00, 0x00, 0x0C, 0x80, 0x00, 0x00, //        @%
+    0x00, 0x00, 0x00, 0x0C, 0x80, 0x00, 0x00, //        @%
+    0x00, 0x00, 0x00, 0x0C, 0x80, 0x00, 0x00, //        @%
+    0x00, 0x00, 0x00, 0x0C, 0x80, 0x00, 0x00, //        @%
+    0x00, 0x00, 0x00, 0x0C, 0x80, 0x00, 0x00, //        @%
+    0x00, 0x00, 0x00, 0x0C, 0x80, 0x00, 0x00, //        @%
+    0x00, 0x00, 0x00, 0x0C, 0x80, 0x00, 0x00, //        @%
+    0x00, 0x00, 0x00, 0x0C, 0x80, 0x00, 0x00, //        @%
+    0x00, 0x0E, 0xEE, 0xEE, 0x70, 0x00, 0x00, //    @@@@@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @8680 '^' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0xDD, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x04, 0xEE, 0x40, 0x00, 0x00, //      =@@=
+    0x00, 0x00, 0x0A, 0xAA, 0xA0, 0x00, 0x00, //      @@@@
+    0x00, 0x00, 0x1F, 0x44, 0xF1, 0x00, 0x00, //     .@==@.
+    0x00, 0x00, 0x7E, 0x00, 0xE7, 0x00, 0x00, //     #@  @#
+    0x00, 0x00, 0xC8, 0x00, 0x8C, 0x00, 0x00, //     @%  %@
+    0x00, 0x03, 0xF3, 0x00, 0x3F, 0x30, 0x00, //    -@-  -@-
+    0x00, 0x09, 0xD0, 0x00, 0x0D, 0x90, 0x00, //    @@    @@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @8820 '_' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x12, 0x22, 0x22, 0x22, 0x21, 0x00, //   .::::::::.
+    0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, //   @@@@@@@@@@
+    0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, //   ==========
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @8960 '`' (14 pixels wide)
+    0x00, 0x00, 0x1D, 0xC0, 0x00, 0x00, 0x00, //     .@@
+    0x00, 0x00, 0x03, 0xE6, 0x00, 0x00, 0x00, //      -@*
+    0x00, 0x00, 0x00, 0x5E, 0x10, 0x00, 0x00, //       +@.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @9100 'a' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x5B, 0xEF, 0xD8, 0x00, 0x00, //     +@@@@%
+    0x00, 0x0B, 0xFA, 0x66, 0xBF, 0x80, 0x00, //    @@@**@@%
+    0x00, 0x03, 0x20, 0x00, 0x0B, 0xF1, 0x00, //    -:    @@.
+    0x00, 0x00, 0x00, 0x00, 0x28, 0xF3, 0x00, //         :%@-
+    0x00, 0x00, 0x39, 0xCF, 0xED, 0xF4, 0x00, //     -@@@@@@=
+    0x00, 0x09, 0xF9, 0x41, 0x05, 0xF4, 0x00, //    @@@=. +@=
+    0x00, 0x3F, 0x70, 0x00, 0x05, 0xF4, 0x00, //   -@#    +@=
+    0x00, 0x5F, 0x50, 0x00, 0x1A, 0xF4, 0x00, //   +@+   .@@=
+    0x00, 0x1E, 0xD7, 0x58, 0xDB, 0xF4, 0x00, //   .@@#+%@@@=
+    0x00, 0x03, 0xBE, 0xEA, 0x31, 0xF4, 0x00, //    -@@@@-.@=
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @9240 'b' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, //   :@%
+    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, //   :@%
+    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, //   :@%
+    0x00, 0x2F, 0x70, 0x00, 0x00, 0x00, 0x00, //   :@#
+    0x00, 0x2F, 0x75, 0xCE, 0xE9, 0x10, 0x00, //   :@#+@@@@.
+    0x00, 0x2F, 0xDE, 0x86, 0xAF, 0xC0, 0x00, //   :@@@%*@@@
+    0x00, 0x2F, 0xC1, 0x00, 0x08, 0xF6, 0x00, //   :@@.   %@*
+    0x00, 0x2F, 0x80, 0x00, 0x01, 0xFA, 0x00, //   :@%    .@@
+    0x00, 0x2F, 0x80, 0x00, 0x00, 0xEC, 0x00, //   :@%     @@
+    0x00, 0x2F, 0x80, 0x00, 0x00, 0xFB, 0x00, //   :@%     @@
+    0x00, 0x2F, 0x80, 0x00, 0x03, 0xF9, 0x00, //   :@%    -@@
+    0x00, 0x2F, 0xA0, 0x00, 0x0B, 0xF3, 0x00, //   :@@    @@-
+    0x00, 0x2F, 0xEC, 0x86, 0xCF, 0x80, 0x00, //   :@@@%*@@%
+    0x00, 0x2F, 0x47, 0xDF, 0xC6, 0x00, 0x00, //   :@=#@@@*
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @9380 'c' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x17, 0xCE, 0xEC, 0x50, 0x00, //     .#@@@@+
+    0x00, 0x02, 0xDF, 0xA6, 0x6B, 0xF5, 0x00, //    :@@@**@@+
+    0x00, 0x0B, 0xF5, 0x00, 0x00, 0x40, 0x00, //    @@+    =
+    0x00, 0x3F, 0xA0, 0x00, 0x00, 0x00, 0x00, //   -@@
+    0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x00, //   +@+
+    0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x00, //   +@+
+    0x00, 0x3F, 0x90, 0x00, 0x00, 0x00, 0x00, //   -@@
+    0x00, 0x0C, 0xF4, 0x00, 0x00, 0x32, 0x00, //    @@=    -:
+    0x00, 0x02, 0xDF, 0xA6, 0x6A, 0xF8, 0x00, //    :@@@**@@%
+    0x00, 0x00, 0x18, 0xDF, 0xEB, 0x50, 0x00, //     .%@@@@+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @9520 'd' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xF2, 0x00, //          %@:
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xF2, 0x00, //          %@:
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xF2, 0x00, //          %@:
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x00, //          #@:
+    0x00, 0x00, 0x6C, 0xFD, 0x77, 0xF2, 0x00, //     *@@@##@:
+    0x00, 0x08, 0xFC, 0x77, 0xCE, 0xF2, 0x00, //    %@@##@@@:
+    0x00, 0x3F, 0xB0, 0x00, 0x0A, 0xF2, 0x00, //   -@@    @@:
+    0x00, 0x9F, 0x30, 0x00, 0x08, 0xF2, 0x00, //   @@-    %@:
+    0x00, 0xBF, 0x00, 0x00, 0x08, 0xF2, 0x00, //   @@     %@:
+    0x00, 0xCE, 0x00, 0x00, 0x08, 0xF2, 0x00, //   @@     %@:
+    0x00, 0xAF, 0x20, 0x00, 0x08, 0xF2, 0x00, //   @@:    %@:
+    0x00, 0x5F, 0x90, 0x00, 0x1C, 0xF2, 0x00, //   +@@   .@@:
+    0x00, 0x0B, 0xFB, 0x78, 0xDC, 0xF2, 0x00, //    @@@#%@@@:
+    0x00, 0x01, 0x8D, 0xFC, 0x44, 0xF2, 0x00, //    .%@@@==@:
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @9660 'e' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x2A, 0xEF, 0xD8, 0x10, 0x00, //     :@@@@%.
+    0x00, 0x04, 0xED, 0x75, 0x8E, 0xC0, 0x00, //    =@@#+%@@
+    0x00, 0x1E, 0xB0, 0x00, 0x03, 0xF6, 0x00, //   .@@    -@*
+    0x00, 0x6F, 0x30, 0x00, 0x00, 0xDA, 0x00, //   *@-     @@
+    0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, //   @@@@@@@@@@
+    0x00, 0x9F, 0x43, 0x33, 0x33, 0x32, 0x00, //   @@=------:
+    0x00, 0x6F, 0x60, 0x00, 0x00, 0x00, 0x00, //   *@*
+    0x00, 0x1E, 0xE2, 0x00, 0x00, 0x10, 0x00, //   .@@:    .
+    0x00, 0x04, 0xEE, 0x86, 0x6A, 0xF2, 0x00, //    =@@%**@@:
+    0x00, 0x00, 0x29, 0xDF, 0xEB, 0x40, 0x00, //     :@@@@@=
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @9800 'f' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x18, 0xDF, 0xEB, 0x40, //       .%@@@@=
+    0x00, 0x00, 0x00, 0x9F, 0x96, 0x69, 0x40, //       @@@**@=
+    0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x02, 0xF7, 0x00, 0x00, 0x00, //      :@#
+    0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, //    @@@@@@@@%
+    0x00, 0x05, 0x57, 0xFA, 0x55, 0x53, 0x00, //    ++#@@+++-
+    0x00, 0x00, 0x02, 0xF7, 0x00, 0x00, 0x00, //      :@#
+    0x00, 0x00, 0x02, 0xF7, 0x00, 0x00, 0x00, //      :@#
+    0x00, 0x00, 0x02, 0xF7, 0x00, 0x00, 0x00, //      :@#
+    0x00, 0x00, 0x02, 0xF7, 0x00, 0x00, 0x00, //      :@#
+    0x00, 0x00, 0x02, 0xF7, 0x00, 0x00, 0x00, //      :@#
+    0x00, 0x00, 0x02, 0xF7, 0x00, 0x00, 0x00, //      :@#
+    0x00, 0x00, 0x02, 0xF7, 0x00, 0x00, 0x00, //      :@#
+    0x00, 0x00, 0x02, 0xF7, 0x00, 0x00, 0x00, //      :@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @9940 'g' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x5C, 0xEF, 0xFF, 0xFF, 0x40, //     +@@@@@@@=
+    0x00, 0x06, 0xF9, 0x45, 0xCE, 0x54, 0x10, //    *@@=+@@+=.
+    0x00, 0x0E, 0xB0, 0x00, 0x2F, 0x70, 0x00, //    @@   :@#
+    0x00, 0x0E, 0xA0, 0x00, 0x1F, 0x80, 0x00, //    @@   .@%
+    0x00, 0x08, 0xF5, 0x01, 0x9F, 0x30, 0x00, //    %@+ .@@-
+    0x00, 0x02, 0xEE, 0xFF, 0xC4, 0x00, 0x00, //    :@@@@@=
+    0x00, 0x0A, 0xA0, 0x11, 0x00, 0x00, 0x00, //    @@ ..
+    0x00, 0x0E, 0x70, 0x00, 0x00, 0x00, 0x00, //    @#
+    0x00, 0x0A, 0xE8, 0x65, 0x54, 0x20, 0x00, //    @@%*++=:
+    0x00, 0x04, 0xFE, 0xFF, 0xFF, 0xFB, 0x00, //    =@@@@@@@@
+    0x00, 0x3E, 0x40, 0x00, 0x01, 0x9F, 0x40, //   -@=    .@@=
+    0x00, 0x8E, 0x00, 0x00, 0x00, 0x7F, 0x20, //   %@      #@:
+    0x00, 0x4F, 0xB5, 0x33, 0x5A, 0xF8, 0x00, //   =@@+--+@@%
+    0x00, 0x04, 0xAD, 0xEF, 0xD9, 0x30, 0x00, //    =@@@@@@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @10080 'h' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, //   :@%
+    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, //   :@%
+    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, //   :@%
+    0x00, 0x2F, 0x70, 0x00, 0x00, 0x00, 0x00, //   :@#
+    0x00, 0x2F, 0x72, 0xAE, 0xEB, 0x20, 0x00, //   :@#:@@@@:
+    0x00, 0x2F, 0xAE, 0xA7, 0x9F, 0xD0, 0x00, //   :@@@@#@@@
+    0x00, 0x2F, 0xE4, 0x00, 0x08, 0xF4, 0x00, //   :@@=   %@=
+    0x00, 0x2F, 0x80, 0x00, 0x04, 0xF6, 0x00, //   :@%    =@*
+    0x00, 0x2F, 0x80, 0x00, 0x03, 0xF7, 0x00, //   :@%    -@#
+    0x00, 0x2F, 0x80, 0x00, 0x03, 0xF7, 0x00, //   :@%    -@#
+    0x00, 0x2F, 0x80, 0x00, 0x03, 0xF7, 0x00, //   :@%    -@#
+    0x00, 0x2F, 0x80, 0x00, 0x03, 0xF7, 0x00, //   :@%    -@#
+    0x00, 0x2F, 0x80, 0x00, 0x03, 0xF7, 0x00, //   :@%    -@#
+    0x00, 0x2F, 0x80, 0x00, 0x03, 0xF7, 0x00, //   :@%    -@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @10220 'i' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x2D, 0xD1, 0x00, 0x00, //       :@@.
+    0x00, 0x00, 0x00, 0x4F, 0xF3, 0x00, 0x00, //       =@@-
+    0x00, 0x00, 0x00, 0x07, 0x60, 0x00, 0x00, //        #*
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, //   -@@@@@@
+    0x00, 0x15, 0x55, 0x5C, 0xE0, 0x00, 0x00, //   .++++@@
+    0x00, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @10360 'j' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x2D, 0xD1, 0x00, 0x00, //       :@@.
+    0x00, 0x00, 0x00, 0x4F, 0xF3, 0x00, 0x00, //       =@@-
+    0x00, 0x00, 0x00, 0x07, 0x60, 0x00, 0x00, //        #*
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, //   -@@@@@@
+    0x00, 0x15, 0x55, 0x5C, 0xE0, 0x00, 0x00, //   .++++@@
+    0x00, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x1E, 0xB0, 0x00, 0x00, //       .@@
+    0x00, 0x78, 0x67, 0xCF, 0x50, 0x00, 0x00, //   #%*#@@+
+    0x00, 0x6C, 0xEE, 0xC5, 0x00, 0x00, 0x00, //   *@@@@+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @10500 'k' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x0D, 0xC0, 0x00, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x0D, 0xC0, 0x00, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x0D, 0xC0, 0x00, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x0D, 0xC0, 0x00, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x0D, 0xC0, 0x00, 0x06, 0xF7, 0x00, //    @@    *@#
+    0x00, 0x0D, 0xC0, 0x00, 0x6F, 0x70, 0x00, //    @@   *@#
+    0x00, 0x0D, 0xC0, 0x06, 0xF8, 0x00, 0x00, //    @@  *@%
+    0x00, 0x0D, 0xC0, 0x6F, 0x80, 0x00, 0x00, //    @@ *@%
+    0x00, 0x0D, 0xC6, 0xFF, 0x70, 0x00, 0x00, //    @@*@@#
+    0x00, 0x0D, 0xEF, 0x89, 0xF3, 0x00, 0x00, //    @@@%@@-
+    0x00, 0x0D, 0xF8, 0x00, 0xCD, 0x10, 0x00, //    @@%  @@.
+    0x00, 0x0D, 0xC0, 0x00, 0x3F, 0xA0, 0x00, //    @@   -@@
+    0x00, 0x0D, 0xC0, 0x00, 0x07, 0xF6, 0x00, //    @@    #@*
+    0x00, 0x0D, 0xC0, 0x00, 0x00, 0xBE, 0x20, //    @@     @@:
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @10640 'l' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x6F, 0xFF, 0xF9, 0x00, 0x00, 0x00, //   *@@@@@
+    0x00, 0x25, 0x56, 0xF9, 0x00, 0x00, 0x00, //   :++*@@
+    0x00, 0x00, 0x01, 0xF9, 0x00, 0x00, 0x00, //      .@@
+    0x00, 0x00, 0x01, 0xF9, 0x00, 0x00, 0x00, //      .@@
+    0x00, 0x00, 0x01, 0xF9, 0x00, 0x00, 0x00, //      .@@
+    0x00, 0x00, 0x01, 0xF9, 0x00, 0x00, 0x00, //      .@@
+    0x00, 0x00, 0x01, 0xF9, 0x00, 0x00, 0x00, //      .@@
+    0x00, 0x00, 0x01, 0xF9, 0x00, 0x00, 0x00, //      .@@
+    0x00, 0x00, 0x01, 0xF9, 0x00, 0x00, 0x00, //      .@@
+    0x00, 0x00, 0x01, 0xF9, 0x00, 0x00, 0x00, //      .@@
+    0x00, 0x00, 0x01, 0xF9, 0x00, 0x00, 0x00, //      .@@
+    0x00, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x9F, 0x96, 0x85, 0x00, //       @@@*%+
+    0x00, 0x00, 0x00, 0x19, 0xEE, 0xC6, 0x00, //       .@@@@*
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @10780 'm' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0xC8, 0x7E, 0xD2, 0x5E, 0xD4, 0x00, //   @%#@@:+@@=
+    0x00, 0xCD, 0xC7, 0xEC, 0xC7, 0xED, 0x00, //   @@@#@@@#@@
+    0x00, 0xCE, 0x10, 0x9E, 0x20, 0x8F, 0x10, //   @@. @@: %@.
+    0x00, 0xCC, 0x00, 0x8C, 0x00, 0x7F, 0x20, //   @@  %@  #@:
+    0x00, 0xCC, 0x00, 0x8C, 0x00, 0x7F, 0x20, //   @@  %@  #@:
+    0x00, 0xCC, 0x00, 0x8C, 0x00, 0x7F, 0x20, //   @@  %@  #@:
+    0x00, 0xCC, 0x00, 0x8C, 0x00, 0x7F, 0x20, //   @@  %@  #@:
+    0x00, 0xCC, 0x00, 0x8C, 0x00, 0x7F, 0x20, //   @@  %@  #@:
+    0x00, 0xCC, 0x00, 0x8C, 0x00, 0x7F, 0x20, //   @@  %@  #@:
+    0x00, 0xCC, 0x00, 0x8C, 0x00, 0x7F, 0x20, //   @@  %@  #@:
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @10920 'n' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x2F, 0x42, 0xAE, 0xEB, 0x20, 0x00, //   :@=:@@@@:
+    0x00, 0x2F, 0x8E, 0xA7, 0x9F, 0xD0, 0x00, //   :@%@@#@@@
+    0x00, 0x2F, 0xE4, 0x00, 0x08, 0xF4, 0x00, //   :@@=   %@=
+    0x00, 0x2F, 0x80, 0x00, 0x04, 0xF6, 0x00, //   :@%    =@*
+    0x00, 0x2F, 0x80, 0x00, 0x03, 0xF7, 0x00, //   :@%    -@#
+    0x00, 0x2F, 0x80, 0x00, 0x03, 0xF7, 0x00, //   :@%    -@#
+    0x00, 0x2F, 0x80, 0x00, 0x03, 0xF7, 0x00, //   :@%    -@#
+    0x00, 0x2F, 0x80, 0x00, 0x03, 0xF7, 0x00, //   :@%    -@#
+    0x00, 0x2F, 0x80, 0x00, 0x03, 0xF7, 0x00, //   :@%    -@#
+    0x00, 0x2F, 0x80, 0x00, 0x03, 0xF7, 0x00, //   :@%    -@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @11060 'o' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x5B, 0xEE, 0xB5, 0x00, 0x00, //     +@@@@+
+    0x00, 0x07, 0xFC, 0x66, 0xCF, 0x70, 0x00, //    #@@**@@#
+    0x00, 0x3F, 0xB0, 0x00, 0x0B, 0xF3, 0x00, //   -@@    @@-
+    0x00, 0x9F, 0x30, 0x00, 0x03, 0xF9, 0x00, //   @@-    -@@
+    0x00, 0xBF, 0x00, 0x00, 0x00, 0xFB, 0x00, //   @@      @@
+    0x00, 0xBF, 0x00, 0x00, 0x00, 0xFB, 0x00, //   @@      @@
+    0x00, 0x9F, 0x30, 0x00, 0x03, 0xF9, 0x00, //   @@-    -@@
+    0x00, 0x3F, 0xB0, 0x00, 0x0B, 0xF3, 0x00, //   -@@    @@-
+    0x00, 0x08, 0xFC, 0x66, 0xCF, 0x80, 0x00, //    %@@**@@%
+    0x00, 0x00, 0x5B, 0xEE, 0xB5, 0x00, 0x00, //     +@@@@+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @11200 'p' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x2F, 0x44, 0xBE, 0xE9, 0x10, 0x00, //   :@==@@@@.
+    0x00, 0x2F, 0xCE, 0x86, 0xAF, 0xC0, 0x00, //   :@@@%*@@@
+    0x00, 0x2F, 0xC1, 0x00, 0x08, 0xF6, 0x00, //   :@@.   %@*
+    0x00, 0x2F, 0x80, 0x00, 0x01, 0xFA, 0x00, //   :@%    .@@
+    0x00, 0x2F, 0x80, 0x00, 0x00, 0xEC, 0x00, //   :@%     @@
+    0x00, 0x2F, 0x80, 0x00, 0x00, 0xFB, 0x00, //   :@%     @@
+    0x00, 0x2F, 0x80, 0x00, 0x03, 0xF9, 0x00, //   :@%    -@@
+    0x00, 0x2F, 0xA0, 0x00, 0x0B, 0xF3, 0x00, //   :@@    @@-
+    0x00, 0x2F, 0xEC, 0x77, 0xCF, 0x80, 0x00, //   :@@@##@@%
+    0x00, 0x2F, 0x77, 0xDF, 0xC6, 0x00, 0x00, //   :@##@@@*
+    0x00, 0x2F, 0x70, 0x00, 0x00, 0x00, 0x00, //   :@#
+    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, //   :@%
+    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, //   :@%
+    0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, //   :@%
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @11340 'q' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x6C, 0xFD, 0x84, 0xF2, 0x00, //     *@@@%=@:
+    0x00, 0x08, 0xFC, 0x77, 0xCE, 0xF2, 0x00, //    %@@##@@@:
+    0x00, 0x3F, 0xB0, 0x00, 0x0A, 0xF2, 0x00, //   -@@    @@:
+    0x00, 0x9F, 0x30, 0x00, 0x08, 0xF2, 0x00, //   @@-    %@:
+    0x00, 0xBF, 0x00, 0x00, 0x08, 0xF2, 0x00, //   @@     %@:
+    0x00, 0xCE, 0x00, 0x00, 0x08, 0xF2, 0x00, //   @@     %@:
+    0x00, 0xAF, 0x20, 0x00, 0x08, 0xF2, 0x00, //   @@:    %@:
+    0x00, 0x5F, 0x90, 0x00, 0x1C, 0xF2, 0x00, //   +@@   .@@:
+    0x00, 0x0B, 0xFB, 0x78, 0xDD, 0xF2, 0x00, //    @@@#%@@@:
+    0x00, 0x01, 0x8D, 0xFC, 0x57, 0xF2, 0x00, //    .%@@@+#@:
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xF2, 0x00, //          #@:
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xF2, 0x00, //          %@:
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xF2, 0x00, //          %@:
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xF2, 0x00, //          %@:
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @11480 'r' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x01, 0xF5, 0x05, 0xCE, 0xE8, 0x00, //    .@+ +@@@%
+    0x00, 0x01, 0xF6, 0x9F, 0xA8, 0x95, 0x00, //    .@*@@@%@+
+    0x00, 0x01, 0xFD, 0xD2, 0x00, 0x00, 0x00, //    .@@@:
+    0x00, 0x01, 0xFE, 0x20, 0x00, 0x00, 0x00, //    .@@:
+    0x00, 0x01, 0xF9, 0x00, 0x00, 0x00, 0x00, //    .@@
+    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, //    .@%
+    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, //    .@%
+    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, //    .@%
+    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, //    .@%
+    0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, //    .@%
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @11620 's' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x7C, 0xEE, 0xC8, 0x10, 0x00, //     #@@@@%.
+    0x00, 0x09, 0xF9, 0x55, 0x8E, 0xB0, 0x00, //    @@@++%@@
+    0x00, 0x0E, 0xB0, 0x00, 0x00, 0x10, 0x00, //    @@     .
+    0x00, 0x0B, 0xF6, 0x10, 0x00, 0x00, 0x00, //    @@*.
+    0x00, 0x01, 0x9F, 0xEB, 0x61, 0x00, 0x00, //    .@@@@*.
+    0x00, 0x00, 0x01, 0x59, 0xEF, 0x80, 0x00, //      .+@@@%
+    0x00, 0x00, 0x00, 0x00, 0x09, 0xF5, 0x00, //          @@+
+    0x00, 0x06, 0x00, 0x00, 0x04, 0xF7, 0x00, //    *     =@#
+    0x00, 0x4F, 0xD8, 0x55, 0x7D, 0xE2, 0x00, //   =@@%++#@@:
+    0x00, 0x02, 0x8C, 0xEE, 0xD9, 0x20, 0x00, //    :%@@@@@:
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @11760 't' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x05, 0x60, 0x00, 0x00, 0x00, //      +*
+    0x00, 0x00, 0x0A, 0xC0, 0x00, 0x00, 0x00, //      @@
+    0x00, 0x00, 0x0C, 0xC0, 0x00, 0x00, 0x00, //      @@
+    0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, //   @@@@@@@@@%
+    0x00, 0x34, 0x4E, 0xC4, 0x44, 0x42, 0x00, //   -==@@====:
+    0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00, 0x00, //      @@
+    0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00, 0x00, //      @@
+    0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00, 0x00, //      @@
+    0x00, 0x00, 0x0D, 0xC0, 0x00, 0x00, 0x00, //      @@
+    0x00, 0x00, 0x0C, 0xC0, 0x00, 0x00, 0x00, //      @@
+    0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, //      @@.
+    0x00, 0x00, 0x04, 0xFD, 0x76, 0x77, 0x00, //      =@@#*##
+    0x00, 0x00, 0x00, 0x6C, 0xFE, 0xC7, 0x00, //       *@@@@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @11900 'u' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x7F, 0x30, 0x00, 0x08, 0xF1, 0x00, //   #@-    %@.
+    0x00, 0x7F, 0x30, 0x00, 0x08, 0xF1, 0x00, //   #@-    %@.
+    0x00, 0x7F, 0x30, 0x00, 0x08, 0xF1, 0x00, //   #@-    %@.
+    0x00, 0x7F, 0x30, 0x00, 0x08, 0xF1, 0x00, //   #@-    %@.
+    0x00, 0x7F, 0x30, 0x00, 0x08, 0xF1, 0x00, //   #@-    %@.
+    0x00, 0x7F, 0x30, 0x00, 0x08, 0xF1, 0x00, //   #@-    %@.
+    0x00, 0x6F, 0x40, 0x00, 0x09, 0xF1, 0x00, //   *@=    @@.
+    0x00, 0x4F, 0x80, 0x00, 0x4F, 0xF1, 0x00, //   =@%   =@@.
+    0x00, 0x0D, 0xF9, 0x7A, 0xE8, 0xF1, 0x00, //    @@@#@@%@.
+    0x00, 0x02, 0xBE, 0xEA, 0x24, 0xF1, 0x00, //    :@@@@:=@.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @12040 'v' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0xCD, 0x00, 0x00, 0x00, 0xCC, 0x00, //   @@      @@
+    0x00, 0x6F, 0x40, 0x00, 0x03, 0xF6, 0x00, //   *@=    -@*
+    0x00, 0x0E, 0xA0, 0x00, 0x09, 0xE1, 0x00, //    @@    @@.
+    0x00, 0x08, 0xF1, 0x00, 0x1E, 0x90, 0x00, //    %@.  .@@
+    0x00, 0x02, 0xF7, 0x00, 0x6F, 0x30, 0x00, //    :@#  *@-
+    0x00, 0x00, 0xBD, 0x00, 0xCB, 0x00, 0x00, //     @@  @@
+    0x00, 0x00, 0x5F, 0x32, 0xF5, 0x00, 0x00, //     +@-:@+
+    0x00, 0x00, 0x0D, 0x98, 0xE0, 0x00, 0x00, //      @@%@
+    0x00, 0x00, 0x07, 0xED, 0x80, 0x00, 0x00, //      #@@%
+    0x00, 0x00, 0x01, 0xFF, 0x20, 0x00, 0x00, //      .@@:
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @12180 'w' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x0B, 0xE0, 0x00, 0x45, 0x00, 0x0C, 0xB0, //  @@   =+   @@
+    0x08, 0xF2, 0x00, 0xDE, 0x00, 0x1F, 0x80, //  %@:  @@  .@%
+    0x05, 0xF5, 0x01, 0xDD, 0x30, 0x4F, 0x50, //  +@+ .@@- =@+
+    0x01, 0xF8, 0x05, 0xAA, 0x60, 0x7F, 0x10, //  .@% +@@* #@.
+    0x00, 0xDB, 0x08, 0x88, 0xA0, 0xAD, 0x00, //   @@ %%%@ @@
+    0x00, 0xAE, 0x0C, 0x44, 0xD0, 0xDA, 0x00, //   @@ @==@ @@
+    0x00, 0x6F, 0x3F, 0x11, 0xF2, 0xF7, 0x00, //   *@-@..@:@#
+    0x00, 0x3F, 0x8D, 0x00, 0xD7, 0xF4, 0x00, //   -@%@  @#@=
+    0x00, 0x0F, 0xE9, 0x00, 0x9D, 0xF1, 0x00, //    @@@  @@@.
+    0x00, 0x0C, 0xF6, 0x00, 0x6F, 0xC0, 0x00, //    @@*  *@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @12320 'x' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x2E, 0xB0, 0x00, 0x0A, 0xE2, 0x00, //   :@@    @@:
+    0x00, 0x06, 0xF6, 0x00, 0x5F, 0x60, 0x00, //    *@*  +@*
+    0x00, 0x00, 0xAE, 0x21, 0xEA, 0x00, 0x00, //     @@:.@@
+    0x00, 0x00, 0x1D, 0xC9, 0xE1, 0x00, 0x00, //     .@@@@.
+    0x00, 0x00, 0x04, 0xFF, 0x50, 0x00, 0x00, //      =@@+
+    0x00, 0x00, 0x08, 0xFF, 0x60, 0x00, 0x00, //      %@@*
+    0x00, 0x00, 0x3F, 0x6A, 0xE2, 0x00, 0x00, //     -@*@@:
+    0x00, 0x01, 0xDB, 0x01, 0xDC, 0x00, 0x00, //    .@@ .@@
+    0x00, 0x0A, 0xE2, 0x00, 0x3F, 0x90, 0x00, //    @@:  -@@
+    0x00, 0x5F, 0x60, 0x00, 0x07, 0xF5, 0x00, //   +@*    #@+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @12460 'y' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0xCD, 0x00, 0x00, 0x00, 0xBC, 0x00, //   @@      @@
+    0x00, 0x5F, 0x40, 0x00, 0x02, 0xF6, 0x00, //   +@=    :@*
+    0x00, 0x0D, 0xB0, 0x00, 0x08, 0xE1, 0x00, //    @@    %@.
+    0x00, 0x06, 0xF3, 0x00, 0x0D, 0x90, 0x00, //    *@-   @@
+    0x00, 0x00, 0xE9, 0x00, 0x4F, 0x30, 0x00, //     @@  =@-
+    0x00, 0x00, 0x7F, 0x10, 0xAC, 0x00, 0x00, //     #@. @@
+    0x00, 0x00, 0x1E, 0x71, 0xF6, 0x00, 0x00, //     .@#.@*
+    0x00, 0x00, 0x08, 0xD7, 0xE1, 0x00, 0x00, //      %@#@.
+    0x00, 0x00, 0x02, 0xFE, 0x90, 0x00, 0x00, //      :@@@
+    0x00, 0x00, 0x00, 0xAF, 0x30, 0x00, 0x00, //       @@-
+    0x00, 0x00, 0x00, 0xCB, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x05, 0xF5, 0x00, 0x00, 0x00, //      +@+
+    0x00, 0x36, 0x9F, 0xA0, 0x00, 0x00, 0x00, //   -*@@@
+    0x00, 0x7E, 0xD7, 0x00, 0x00, 0x00, 0x00, //   #@@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @12600 'z' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, //    @@@@@@@@*
+    0x00, 0x04, 0x55, 0x55, 0x7F, 0xD1, 0x00, //    =++++#@@.
+    0x00, 0x00, 0x00, 0x01, 0xDE, 0x20, 0x00, //        .@@:
+    0x00, 0x00, 0x00, 0x0B, 0xF3, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x9F, 0x50, 0x00, 0x00, //       @@+
+    0x00, 0x00, 0x07, 0xF7, 0x00, 0x00, 0x00, //      #@#
+    0x00, 0x00, 0x5F, 0x90, 0x00, 0x00, 0x00, //     +@@
+    0x00, 0x03, 0xFB, 0x00, 0x00, 0x00, 0x00, //    -@@
+    0x00, 0x2E, 0xF6, 0x55, 0x55, 0x53, 0x00, //   :@@*+++++-
+    0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, //   @@@@@@@@@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @12740 '{' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x19, 0xDE, 0xF1, 0x00, //       .@@@@.
+    0x00, 0x00, 0x00, 0xAD, 0x30, 0x00, 0x00, //       @@-
+    0x00, 0x00, 0x00, 0xD8, 0x00, 0x00, 0x00, //       @%
+    0x00, 0x00, 0x00, 0xD8, 0x00, 0x00, 0x00, //       @%
+    0x00, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x05, 0xF6, 0x00, 0x00, 0x00, //      +@*
+    0x00, 0x08, 0xFF, 0x70, 0x00, 0x00, 0x00, //    %@@#
+    0x00, 0x01, 0x38, 0xF5, 0x00, 0x00, 0x00, //    .-%@+
+    0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xB9, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xC9, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xD8, 0x00, 0x00, 0x00, //       @%
+    0x00, 0x00, 0x00, 0xD8, 0x00, 0x00, 0x00, //       @%
+    0x00, 0x00, 0x00, 0xAD, 0x30, 0x00, 0x00, //       @@-
+    0x00, 0x00, 0x00, 0x19, 0xDE, 0xE1, 0x00, //       .@@@@.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @12880 '|' (14 pixels wide)
+    0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0x00, //       @@
+    // @13020 '}' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x0F, 0xED, 0x91, 0x00, 0x00, 0x00, //    @@@@.
+    0x00, 0x00, 0x03, 0xDA, 0x00, 0x00, 0x00, //      -@@
+    0x00, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x00, //       %@
+    0x00, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x00, //       %@
+    0x00, 0x00, 0x00, 0x8C, 0x00, 0x00, 0x00, //       %@
+    0x00, 0x00, 0x00, 0x9B, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x9B, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x6E, 0x50, 0x00, 0x00, //       *@+
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0x80, 0x00, //        #@@%
+    0x00, 0x00, 0x00, 0x5F, 0x83, 0x10, 0x00, //       +@%-.
+    0x00, 0x00, 0x00, 0x9B, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x9B, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x9C, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x00, //       %@
+    0x00, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x00, //       %@
+    0x00, 0x00, 0x03, 0xDA, 0x00, 0x00, 0x00, //      -@@
+    0x00, 0x0E, 0xED, 0x91, 0x00, 0x00, 0x00, //    @@@@.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @13160 '~' (14 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x03, 0xCE, 0x80, 0x00, 0xB4, 0x00, //    -@@%   @=
+    0x00, 0x0D, 0x84, 0xDB, 0x26, 0xE1, 0x00, //    @%=@@:*@.
+    0x00, 0x4D, 0x00, 0x1B, 0xFE, 0x50, 0x00, //   =@  .@@@+
+    0x00, 0x01, 0x00, 0x00, 0x21, 0x00, 0x00, //    .    :.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+};
+
+sFONT_AA Font20Aa = {14, /* Width */
+                     20, /* Height */
+                     Font20Aa_Table};
+
+static const uint8_t Font24Aa_Table[] = {
+    // @0 ' ' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @216 '!' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x0B, 0xF2, 0x00, 0x00, 0x00, 0x00, //        @@:
+    0x00, 0x00, 0x00, 0x0B, 0xF2, 0x00, 0x00, 0x00, 0x00, //        @@:
+    0x00, 0x00, 0x00, 0x0B, 0xF1, 0x00, 0x00, 0x00, 0x00, //        @@.
+    0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0x00, //        @@.
+    0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0x00, //        @@.
+    0x00, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x08, 0xE0, 0x00, 0x00, 0x00, 0x00, //        %@
+    0x00, 0x00, 0x00, 0x08, 0xE0, 0x00, 0x00, 0x00, 0x00, //        %@
+    0x00, 0x00, 0x00, 0x08, 0xE0, 0x00, 0x00, 0x00, 0x00, //        %@
+    0x00, 0x00, 0x00, 0x04, 0x70, 0x00, 0x00, 0x00, 0x00, //        =#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x08, 0xA3, 0x00, 0x00, 0x00, 0x00, //        %@-
+    0x00, 0x00, 0x00, 0x6F, 0xFC, 0x00, 0x00, 0x00, 0x00, //       *@@@
+    0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, //       #@@@
+    0x00, 0x00, 0x00, 0x1C, 0xE5, 0x00, 0x00, 0x00, 0x00, //       .@@+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @432 '"' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x11, 0x10, 0x00, 0x11, 0x00, 0x00, 0x00, //     ...   ..
+    0x00, 0x00, 0xDF, 0xC0, 0x05, 0xFF, 0x40, 0x00, 0x00, //     @@@  +@@=
+    0x00, 0x00, 0xDF, 0xB0, 0x05, 0xFF, 0x40, 0x00, 0x00, //     @@@  +@@=
+    0x00, 0x00, 0xCF, 0xB0, 0x05, 0xFF, 0x30, 0x00, 0x00, //     @@@  +@@-
+    0x00, 0x00, 0xBF, 0xA0, 0x03, 0xFF, 0x20, 0x00, 0x00, //     @@@  -@@:
+    0x00, 0x00, 0x9F, 0x80, 0x02, 0xFF, 0x00, 0x00, 0x00, //     @@%  :@@
+    0x00, 0x00, 0x7F, 0x60, 0x00, 0xFE, 0x00, 0x00, 0x00, //     #@*   @@
+    0x00, 0x00, 0x6F, 0x50, 0x00, 0xDC, 0x00, 0x00, 0x00, //     *@+   @@
+    0x00, 0x00, 0x4F, 0x30, 0x00, 0xCA, 0x00, 0x00, 0x00, //     =@-   @@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @648 '#' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0xB8, 0x00, 0x4F, 0x00, 0x00, 0x00, //       @%  =@
+    0x00, 0x00, 0x00, 0xD6, 0x00, 0x6D, 0x00, 0x00, 0x00, //       @*  *@
+    0x00, 0x00, 0x01, 0xF4, 0x00, 0x9B, 0x00, 0x00, 0x00, //      .@=  @@
+    0x00, 0x00, 0x03, 0xF2, 0x00, 0xB9, 0x00, 0x00, 0x00, //      -@:  @@
+    0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, //    #@@@@@@@@@#
+    0x00, 0x03, 0x6A, 0xE6, 0x66, 0xF9, 0x63, 0x00, 0x00, //    -*@@***@@*-
+    0x00, 0x00, 0x08, 0xC0, 0x01, 0xF4, 0x00, 0x00, 0x00, //      %@  .@=
+    0x00, 0x00, 0x09, 0xA0, 0x02, 0xF2, 0x00, 0x00, 0x00, //      @@  :@:
+    0x00, 0x00, 0x0B, 0x90, 0x04, 0xF1, 0x00, 0x00, 0x00, //      @@  =@.
+    0x00, 0x01, 0x1C, 0x81, 0x16, 0xE1, 0x10, 0x00, 0x00, //    ..@%..*@..
+    0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, //    @@@@@@@@@@
+    0x00, 0x04, 0x5F, 0x74, 0x4A, 0xC4, 0x40, 0x00, 0x00, //    =+@#==@@==
+    0x00, 0x00, 0x3F, 0x20, 0x0A, 0x90, 0x00, 0x00, 0x00, //     -@:  @@
+    0x00, 0x00, 0x4F, 0x00, 0x0C, 0x70, 0x00, 0x00, 0x00, //     =@   @#
+    0x00, 0x00, 0x6D, 0x00, 0x0E, 0x50, 0x00, 0x00, 0x00, //     *@   @+
+    0x00, 0x00, 0x8B, 0x00, 0x1F, 0x30, 0x00, 0x00, 0x00, //     %@  .@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @864 '$' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x04, 0xC1, 0x00, 0x00, 0x00, 0x00, //        =@.
+    0x00, 0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x00, //        *@.
+    0x00, 0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x00, //        *@.
+    0x00, 0x00, 0x00, 0x5A, 0xF8, 0x40, 0x00, 0x00, 0x00, //       +@@%=
+    0x00, 0x00, 0x3D, 0xFF, 0xFF, 0xFC, 0x20, 0x00, 0x00, //     -@@@@@@@:
+    0x00, 0x00, 0xDF, 0x82, 0x02, 0x8F, 0x80, 0x00, 0x00, //     @@%: :%@%
+    0x00, 0x03, 0xFC, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, //    -@@     :
+    0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    -@@
+    0x00, 0x00, 0xDF, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@@:
+    0x00, 0x00, 0x2D, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0x00, //     :@@@@+
+    0x00, 0x00, 0x00, 0x6D, 0xFF, 0xC4, 0x00, 0x00, 0x00, //       *@@@@=
+    0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0x70, 0x00, 0x00, //         =@@@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF1, 0x00, 0x00, //           +@@.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF4, 0x00, 0x00, //            @@=
+    0x00, 0x03, 0x70, 0x00, 0x00, 0x0D, 0xF2, 0x00, 0x00, //    -#      @@:
+    0x00, 0x0B, 0xFD, 0x73, 0x24, 0xAF, 0xB0, 0x00, 0x00, //    @@@#-:=@@@
+    0x00, 0x01, 0x8E, 0xFF, 0xFF, 0xFA, 0x10, 0x00, 0x00, //    .%@@@@@@@.
+    0x00, 0x00, 0x01, 0x4A, 0xF6, 0x20, 0x00, 0x00, 0x00, //      .=@@*:
+    0x00, 0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x00, //        *@.
+    0x00, 0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x00, //        *@.
+    0x00, 0x00, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x00, //        *@.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @1080 '%' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x19, 0xEE, 0xA1, 0x00, 0x00, 0x02, 0x00, 0x00, //   .@@@@.     :
+    0x00, 0xAE, 0x55, 0xDA, 0x00, 0x00, 0x3E, 0x60, 0x00, //   @@++@@    -@*
+    0x02, 0xF6, 0x00, 0x6F, 0x20, 0x01, 0xDE, 0x20, 0x00, //  :@*  *@:  .@@:
+    0x04, 0xF3, 0x00, 0x3F, 0x40, 0x0A, 0xE3, 0x00, 0x00, //  =@-  -@=  @@-
+    0x04, 0xF3, 0x00, 0x3F, 0x40, 0x7E, 0x30, 0x00, 0x00, //  =@-  -@= #@-
+    0x01, 0xF5, 0x00, 0x5F, 0x23, 0xF4, 0x00, 0x00, 0x00, //  .@+  +@:-@=
+    0x00, 0x9D, 0x22, 0xDA, 0x00, 0x30, 0x00, 0x00, 0x00, //   @@::@@  -
+    0x00, 0x19, 0xEE, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, //   .@@@@.
+    0x00, 0x00, 0x00, 0x00, 0x05, 0xDF, 0xC4, 0x00, 0x00, //          +@@@=
+    0x00, 0x00, 0x03, 0x50, 0x4F, 0x84, 0xAE, 0x20, 0x00, //      -+ =@%=@@:
+    0x00, 0x00, 0x3E, 0x70, 0xBC, 0x00, 0x0E, 0x80, 0x00, //     -@# @@   @%
+    0x00, 0x03, 0xE9, 0x00, 0xD9, 0x00, 0x0C, 0xA0, 0x00, //    -@@  @@   @@
+    0x00, 0x2E, 0xC0, 0x00, 0xD9, 0x00, 0x0C, 0xA0, 0x00, //   :@@   @@   @@
+    0x01, 0xDD, 0x20, 0x00, 0xAC, 0x00, 0x1E, 0x80, 0x00, //  .@@:   @@  .@%
+    0x00, 0x93, 0x00, 0x00, 0x3F, 0x94, 0xBE, 0x10, 0x00, //   @-    -@@=@@.
+    0x00, 0x00, 0x00, 0x00, 0x05, 0xDF, 0xC4, 0x00, 0x00, //          +@@@=
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @1296 '&' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x06, 0xDE, 0xC3, 0x00, 0x00, 0x00, 0x00, //      *@@@-
+    0x00, 0x00, 0x6F, 0xB7, 0xDE, 0x10, 0x00, 0x00, 0x00, //     *@@#@@.
+    0x00, 0x00, 0xDD, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, //     @@  +@+
+    0x00, 0x01, 0xFA, 0x00, 0x4F, 0x50, 0x00, 0x00, 0x00, //    .@@  =@+
+    0x00, 0x00, 0xFB, 0x00, 0xAE, 0x10, 0x00, 0x00, 0x00, //     @@  @@.
+    0x00, 0x00, 0xCE, 0x19, 0xF5, 0x00, 0x00, 0x00, 0x00, //     @@.@@+
+    0x00, 0x00, 0x6F, 0xEF, 0x60, 0x00, 0x00, 0x00, 0x00, //     *@@@*
+    0x00, 0x00, 0x6F, 0xF5, 0x00, 0x00, 0x29, 0x50, 0x00, //     *@@+    :@+
+    0x00, 0x07, 0xFD, 0xFB, 0x00, 0x00, 0x8F, 0x40, 0x00, //    #@@@@    %@=
+    0x00, 0x4F, 0xC1, 0x9F, 0x70, 0x00, 0xDE, 0x00, 0x00, //   =@@.@@#   @@
+    0x00, 0xBF, 0x30, 0x1D, 0xF7, 0x05, 0xF7, 0x00, 0x00, //   @@- .@@# +@#
+    0x00, 0xEE, 0x00, 0x02, 0xDF, 0x7D, 0xD1, 0x00, 0x00, //   @@   :@@#@@.
+    0x00, 0xDF, 0x20, 0x00, 0x2D, 0xFF, 0x60, 0x00, 0x00, //   @@:   :@@@*
+    0x00, 0x9F, 0xB1, 0x00, 0x1B, 0xFF, 0xD4, 0x00, 0x00, //   @@@.  .@@@@=
+    0x00, 0x1D, 0xFE, 0xAA, 0xEF, 0x98, 0xFF, 0x90, 0x00, //   .@@@@@@@@%@@@
+    0x00, 0x01, 0x8D, 0xFE, 0xB4, 0x00, 0x3A, 0x70, 0x00, //    .%@@@@=  -@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @1512 ''' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, //        ..
+    0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, //       :@@%
+    0x00, 0x00, 0x00, 0x1F, 0xF7, 0x00, 0x00, 0x00, 0x00, //       .@@#
+    0x00, 0x00, 0x00, 0x1F, 0xF7, 0x00, 0x00, 0x00, 0x00, //       .@@#
+    0x00, 0x00, 0x00, 0x0F, 0xF6, 0x00, 0x00, 0x00, 0x00, //        @@*
+    0x00, 0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x00, //        @@=
+    0x00, 0x00, 0x00, 0x0B, 0xF2, 0x00, 0x00, 0x00, 0x00, //        @@:
+    0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0x00, //        @@.
+    0x00, 0x00, 0x00, 0x08, 0xE0, 0x00, 0x00, 0x00, 0x00, //        %@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @1728 '(' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, //           .*
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0x30, 0x00, 0x00, //          .@@-
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0xF5, 0x00, 0x00, 0x00, //          @@+
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, //         @@*
+    0x00, 0x00, 0x00, 0x03, 0xFA, 0x00, 0x00, 0x00, 0x00, //        -@@
+    0x00, 0x00, 0x00, 0x0B, 0xF2, 0x00, 0x00, 0x00, 0x00, //        @@:
+    0x00, 0x00, 0x00, 0x3F, 0xA0, 0x00, 0x00, 0x00, 0x00, //       -@@
+    0x00, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x00, 0x00, //       %@=
+    0x00, 0x00, 0x00, 0xBF, 0x10, 0x00, 0x00, 0x00, 0x00, //       @@.
+    0x00, 0x00, 0x00, 0xED, 0x00, 0x00, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xAF, 0x20, 0x00, 0x00, 0x00, 0x00, //       @@:
+    0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00, 0x00, 0x00, //       *@*
+    0x00, 0x00, 0x00, 0x1E, 0xC0, 0x00, 0x00, 0x00, 0x00, //       .@@
+    0x00, 0x00, 0x00, 0x09, 0xF4, 0x00, 0x00, 0x00, 0x00, //        @@=
+    0x00, 0x00, 0x00, 0x01, 0xED, 0x10, 0x00, 0x00, 0x00, //        .@@.
+    0x00, 0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, //         =@@
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xFA, 0x00, 0x00, 0x00, //          #@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x30, 0x00, 0x00, //           #@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, //            .
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @1944 ')' (17 pixels wide)
+    0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //     -=
+    0x00, 0x00, 0xCF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@+
+    0x00, 0x00, 0x1C, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, //     .@@=
+    0x00, 0x00, 0x02, 0xED, 0x10, 0x00, 0x00, 0x00, 0x00, //      :@@.
+    0x00, 0x00, 0x00, 0x4F, 0x90, 0x00, 0x00, 0x00, 0x00, //       =@@
+    0x00, 0x00, 0x00, 0x0A, 0xF2, 0x00, 0x00, 0x00, 0x00, //        @@:
+    0x00, 0x00, 0x00, 0x04, 0xF9, 0x00, 0x00, 0x00, 0x00, //        =@@
+    0x00, 0x00, 0x00, 0x00, 0xED, 0x00, 0x00, 0x00, 0x00, //         @@
+    0x00, 0x00, 0x00, 0x00, 0xAF, 0x20, 0x00, 0x00, 0x00, //         @@:
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x00, //         #@=
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0x50, 0x00, 0x00, 0x00, //         *@+
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00, 0x00, //         *@*
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, //         #@+
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0x30, 0x00, 0x00, 0x00, //         %@-
+    0x00, 0x00, 0x00, 0x00, 0xBF, 0x10, 0x00, 0x00, 0x00, //         @@.
+    0x00, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, //        .@@
+    0x00, 0x00, 0x00, 0x06, 0xF6, 0x00, 0x00, 0x00, 0x00, //        *@*
+    0x00, 0x00, 0x00, 0x0D, 0xE1, 0x00, 0x00, 0x00, 0x00, //        @@.
+    0x00, 0x00, 0x00, 0x8F, 0x60, 0x00, 0x00, 0x00, 0x00, //       %@*
+    0x00, 0x00, 0x05, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, //      +@@
+    0x00, 0x00, 0x5F, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, //     +@@.
+    0x00, 0x00, 0xBC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @2160 '*' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x00, 0x00, //        *@
+    0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, //        #@
+    0x00, 0x00, 0x00, 0x07, 0xD0, 0x00, 0x00, 0x00, 0x00, //        #@
+    0x00, 0x08, 0x61, 0x08, 0xE0, 0x04, 0x92, 0x00, 0x00, //    %*. %@  =@:
+    0x00, 0x08, 0xEF, 0xBC, 0xF9, 0xEF, 0xB2, 0x00, 0x00, //    %@@@@@@@@@:
+    0x00, 0x00, 0x16, 0xDF, 0xFE, 0x92, 0x00, 0x00, 0x00, //     .*@@@@@:
+    0x00, 0x00, 0x00, 0x6F, 0xFC, 0x00, 0x00, 0x00, 0x00, //       *@@@
+    0x00, 0x00, 0x02, 0xEB, 0x5F, 0x70, 0x00, 0x00, 0x00, //      :@@+@#
+    0x00, 0x00, 0x0B, 0xE1, 0x09, 0xF2, 0x00, 0x00, 0x00, //      @@. @@:
+    0x00, 0x00, 0x5F, 0x40, 0x00, 0xCB, 0x00, 0x00, 0x00, //     +@=   @@
+    0x00, 0x00, 0x36, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, //     -*    :*
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @2376 '+' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x08, 0xD0, 0x00, 0x00, 0x00, 0x00, //        %@
+    0x00, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x00, 0x00, //        @@
+    0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, //    @@@@@@@@@@+
+    0x00, 0x07, 0x88, 0x8C, 0xF8, 0x88, 0x83, 0x00, 0x00, //    #%%%@@%%%%-
+    0x00, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x09, 0xF0, 0x00, 0x00, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @2592 ',' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x06, 0x93, 0x00, 0x00, 0x00, 0x00, //        *@-
+    0x00, 0x00, 0x00, 0x6F, 0xFF, 0x20, 0x00, 0x00, 0x00, //       *@@@:
+    0x00, 0x00, 0x00, 0x8F, 0xFF, 0x60, 0x00, 0x00, 0x00, //       %@@@*
+    0x00, 0x00, 0x00, 0x2C, 0xFF, 0x70, 0x00, 0x00, 0x00, //       :@@@#
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0x60, 0x00, 0x00, 0x00, //         +@*
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x20, 0x00, 0x00, 0x00, //         @@:
+    0x00, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x00, 0x00, 0x00, //        =@@
+    0x00, 0x00, 0x00, 0x7F, 0xC1, 0x00, 0x00, 0x00, 0x00, //       #@@.
+    0x00, 0x00, 0x01, 0xE9, 0x10, 0x00, 0x00, 0x00, 0x00, //      .@@.
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, //       .
+    // @2808 '-' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x07, 0x88, 0x88, 0x88, 0x88, 0x83, 0x00, 0x00, //    #%%%%%%%%%-
+    0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, //    @@@@@@@@@@+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @3024 '.' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x3D, 0xF7, 0x00, 0x00, 0x00, 0x00, //       -@@#
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0x10, 0x00, 0x00, 0x00, //       @@@@.
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0x10, 0x00, 0x00, 0x00, //       @@@@.
+    0x00, 0x00, 0x00, 0x2C, 0xE7, 0x00, 0x00, 0x00, 0x00, //       :@@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @3240 '/' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xD0, 0x00, 0x00, //            @@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x70, 0x00, 0x00, //           +@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x20, 0x00, 0x00, //           @@:
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x00, 0x00, //          .@@
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xF5, 0x00, 0x00, 0x00, //          #@+
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0xE0, 0x00, 0x00, 0x00, //          @@
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x00, //         -@@
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x30, 0x00, 0x00, 0x00, //         @@-
+    0x00, 0x00, 0x00, 0x00, 0xED, 0x00, 0x00, 0x00, 0x00, //         @@
+    0x00, 0x00, 0x00, 0x05, 0xF7, 0x00, 0x00, 0x00, 0x00, //        +@#
+    0x00, 0x00, 0x00, 0x0A, 0xF2, 0x00, 0x00, 0x00, 0x00, //        @@:
+    0x00, 0x00, 0x00, 0x1F, 0xB0, 0x00, 0x00, 0x00, 0x00, //       .@@
+    0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x00, //       #@+
+    0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, //      -@@
+    0x00, 0x00, 0x09, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, //      @@-
+    0x00, 0x00, 0x0E, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, //      @@
+    0x00, 0x00, 0x5F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, //     +@#
+    0x00, 0x00, 0xAF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@:
+    0x00, 0x01, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    .@@
+    0x00, 0x07, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    #@+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @3456 '0' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x03, 0xBE, 0xEC, 0x70, 0x00, 0x00, 0x00, //      -@@@@#
+    0x00, 0x00, 0x6F, 0xFA, 0x9D, 0xFB, 0x00, 0x00, 0x00, //     *@@@@@@@
+    0x00, 0x02, 0xFE, 0x30, 0x00, 0xAF, 0x70, 0x00, 0x00, //    :@@-   @@#
+    0x00, 0x09, 0xF6, 0x00, 0x00, 0x1E, 0xE1, 0x00, 0x00, //    @@*    .@@.
+    0x00, 0x0E, 0xE0, 0x00, 0x00, 0x09, 0xF5, 0x00, 0x00, //    @@      @@+
+    0x00, 0x2F, 0xB0, 0x00, 0x00, 0x05, 0xF8, 0x00, 0x00, //   :@@      +@%
+    0x00, 0x3F, 0x90, 0x1B, 0xE4, 0x03, 0xF9, 0x00, 0x00, //   -@@ .@@= -@@
+    0x00, 0x4F, 0x80, 0x4F, 0xFA, 0x03, 0xFA, 0x00, 0x00, //   =@% =@@@ -@@
+    0x00, 0x4F, 0x90, 0x1E, 0xF6, 0x03, 0xFA, 0x00, 0x00, //   =@@ .@@* -@@
+    0x00, 0x3F, 0x90, 0x01, 0x20, 0x04, 0xF9, 0x00, 0x00, //   -@@  .:  =@@
+    0x00, 0x1F, 0xB0, 0x00, 0x00, 0x06, 0xF7, 0x00, 0x00, //   .@@      *@#
+    0x00, 0x0D, 0xE0, 0x00, 0x00, 0x09, 0xF4, 0x00, 0x00, //    @@      @@=
+    0x00, 0x08, 0xF6, 0x00, 0x00, 0x1E, 0xE0, 0x00, 0x00, //    %@*    .@@
+    0x00, 0x02, 0xEE, 0x30, 0x01, 0xBF, 0x70, 0x00, 0x00, //    :@@-  .@@#
+    0x00, 0x00, 0x5F, 0xFB, 0xAD, 0xFA, 0x00, 0x00, 0x00, //     +@@@@@@@
+    0x00, 0x00, 0x03, 0xAE, 0xFC, 0x60, 0x00, 0x00, 0x00, //      -@@@@*
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @3672 '1' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x01, 0x5B, 0xFA, 0x00, 0x00, 0x00, 0x00, //      .+@@@
+    0x00, 0x00, 0x7F, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, //     #@@@@@
+    0x00, 0x00, 0x48, 0x8A, 0xFA, 0x00, 0x00, 0x00, 0x00, //     =%%@@@
+    0x00, 0x00, 0x00, 0x04, 0xFA, 0x00, 0x00, 0x00, 0x00, //        =@@
+    0x00, 0x00, 0x00, 0x04, 0xFA, 0x00, 0x00, 0x00, 0x00, //        =@@
+    0x00, 0x00, 0x00, 0x04, 0xFA, 0x00, 0x00, 0x00, 0x00, //        =@@
+    0x00, 0x00, 0x00, 0x04, 0xFA, 0x00, 0x00, 0x00, 0x00, //        =@@
+    0x00, 0x00, 0x00, 0x04, 0xFA, 0x00, 0x00, 0x00, 0x00, //        =@@
+    0x00, 0x00, 0x00, 0x04, 0xFA, 0x00, 0x00, 0x00, 0x00, //        =@@
+    0x00, 0x00, 0x00, 0x04, 0xFA, 0x00, 0x00, 0x00, 0x00, //        =@@
+    0x00, 0x00, 0x00, 0x04, 0xFA, 0x00, 0x00, 0x00, 0x00, //        =@@
+    0x00, 0x00, 0x00, 0x04, 0xFA, 0x00, 0x00, 0x00, 0x00, //        =@@
+    0x00, 0x00, 0x00, 0x04, 0xFA, 0x00, 0x00, 0x00, 0x00, //        =@@
+    0x00, 0x00, 0x00, 0x04, 0xFA, 0x00, 0x00, 0x00, 0x00, //        =@@
+    0x00, 0x06, 0xAA, 0xAB, 0xFD, 0xAA, 0xA6, 0x00, 0x00, //    *@@@@@@@@@*
+    0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, //    @@@@@@@@@@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @3888 '2' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x29, 0xDF, 0xEB, 0x50, 0x00, 0x00, 0x00, //     :@@@@@+
+    0x00, 0x06, 0xFF, 0xBA, 0xCF, 0xF8, 0x00, 0x00, 0x00, //    *@@@@@@@%
+    0x00, 0x2E, 0xD3, 0x00, 0x03, 0xEF, 0x30, 0x00, 0x00, //   :@@-   -@@-
+    0x00, 0x03, 0x10, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, //    -.     #@%
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, //           =@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x90, 0x00, 0x00, //           +@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x40, 0x00, 0x00, //           @@=
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x00, //          -@@
+    0x00, 0x00, 0x00, 0x00, 0x1D, 0xF3, 0x00, 0x00, 0x00, //         .@@-
+    0x00, 0x00, 0x00, 0x00, 0xBF, 0x60, 0x00, 0x00, 0x00, //         @@*
+    0x00, 0x00, 0x00, 0x0A, 0xF8, 0x00, 0x00, 0x00, 0x00, //        @@%
+    0x00, 0x00, 0x00, 0xAF, 0x90, 0x00, 0x00, 0x00, 0x00, //       @@@
+    0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, //     .@@@
+    0x00, 0x01, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, //    .@@%
+    0x00, 0x1C, 0xFE, 0xAA, 0xAA, 0xAA, 0xA5, 0x00, 0x00, //   .@@@@@@@@@@+
+    0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, //   =@@@@@@@@@@%
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @4104 '3' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x29, 0xDE, 0xEC, 0x61, 0x00, 0x00, 0x00, //     :@@@@@*.
+    0x00, 0x07, 0xFF, 0xCA, 0xBE, 0xFD, 0x10, 0x00, 0x00, //    #@@@@@@@@.
+    0x00, 0x09, 0xC3, 0x00, 0x01, 0xBF, 0x90, 0x00, 0x00, //    @@-   .@@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, //           -@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, //           -@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x70, 0x00, 0x00, //           @@#
+    0x00, 0x00, 0x00, 0x02, 0x5B, 0xFA, 0x00, 0x00, 0x00, //        :+@@@
+    0x00, 0x00, 0x02, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, //      :@@@@=
+    0x00, 0x00, 0x01, 0x89, 0xBF, 0xE7, 0x00, 0x00, 0x00, //      .%@@@@#
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x9F, 0x90, 0x00, 0x00, //          .@@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, //            @@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF6, 0x00, 0x00, //            @@*
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x0C, 0xF5, 0x00, 0x00, //    -       @@+
+    0x00, 0x5F, 0x91, 0x00, 0x01, 0x9F, 0xD1, 0x00, 0x00, //   +@@.   .@@@.
+    0x00, 0x1B, 0xFF, 0xCA, 0xBE, 0xFE, 0x30, 0x00, 0x00, //   .@@@@@@@@@-
+    0x00, 0x00, 0x4A, 0xDF, 0xEC, 0x81, 0x00, 0x00, 0x00, //     =@@@@@%.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @4320 '4' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x0B, 0xFB, 0x00, 0x00, 0x00, //          @@@
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0xFB, 0x00, 0x00, 0x00, //         %@@@
+    0x00, 0x00, 0x00, 0x04, 0xFA, 0xFB, 0x00, 0x00, 0x00, //        =@@@@
+    0x00, 0x00, 0x00, 0x1E, 0xD3, 0xFB, 0x00, 0x00, 0x00, //       .@@-@@
+    0x00, 0x00, 0x00, 0xBF, 0x42, 0xFB, 0x00, 0x00, 0x00, //       @@=:@@
+    0x00, 0x00, 0x08, 0xF8, 0x03, 0xFB, 0x00, 0x00, 0x00, //      %@% -@@
+    0x00, 0x00, 0x4F, 0xB0, 0x03, 0xFB, 0x00, 0x00, 0x00, //     =@@  -@@
+    0x00, 0x01, 0xEE, 0x10, 0x03, 0xFB, 0x00, 0x00, 0x00, //    .@@.  -@@
+    0x00, 0x0B, 0xF4, 0x00, 0x03, 0xFB, 0x00, 0x00, 0x00, //    @@=   -@@
+    0x00, 0x7F, 0x80, 0x00, 0x03, 0xFB, 0x00, 0x00, 0x00, //   #@%    -@@
+    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, //  .@@@@@@@@@@@@.
+    0x01, 0x99, 0x99, 0x99, 0x9A, 0xFD, 0x99, 0x10, 0x00, //  .@@@@@@@@@@@@.
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xFB, 0x00, 0x00, 0x00, //          -@@
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xFB, 0x00, 0x00, 0x00, //          -@@
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xFB, 0x00, 0x00, 0x00, //          -@@
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xFB, 0x00, 0x00, 0x00, //          -@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @4536 '5' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, //     @@@@@@@@@
+    0x00, 0x00, 0xFE, 0xBB, 0xBB, 0xBB, 0x80, 0x00, 0x00, //     @@@@@@@@%
+    0x00, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    .@@
+    0x00, 0x02, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    :@@
+    0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    -@@
+    0x00, 0x04, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    =@%
+    0x00, 0x05, 0xFB, 0xBE, 0xFD, 0x93, 0x00, 0x00, 0x00, //    +@@@@@@@-
+    0x00, 0x05, 0xFE, 0xA8, 0x9D, 0xFF, 0x50, 0x00, 0x00, //    +@@@%@@@@+
+    0x00, 0x00, 0x41, 0x00, 0x00, 0x7F, 0xE1, 0x00, 0x00, //     =.    #@@.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF6, 0x00, 0x00, //            @@*
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, //            %@%
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF7, 0x00, 0x00, //            %@#
+    0x00, 0x02, 0x00, 0x00, 0x00, 0x1D, 0xF4, 0x00, 0x00, //    :      .@@=
+    0x00, 0x5F, 0x81, 0x00, 0x02, 0xBF, 0xB0, 0x00, 0x00, //   +@%.   :@@@
+    0x00, 0x2C, 0xFF, 0xBA, 0xCF, 0xFC, 0x10, 0x00, 0x00, //   :@@@@@@@@@.
+    0x00, 0x00, 0x5A, 0xDE, 0xEC, 0x60, 0x00, 0x00, 0x00, //     +@@@@@*
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @4752 '6' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x5B, 0xEF, 0xD9, 0x20, 0x00, 0x00, //       +@@@@@:
+    0x00, 0x00, 0x0A, 0xFF, 0xBA, 0xCF, 0xF4, 0x00, 0x00, //      @@@@@@@@=
+    0x00, 0x00, 0x9F, 0xA1, 0x00, 0x04, 0x90, 0x00, 0x00, //     @@@.   =@
+    0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    :@@
+    0x00, 0x08, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    %@=
+    0x00, 0x0C, 0xE0, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, //    @@   .:
+    0x00, 0x0F, 0xC0, 0x7D, 0xFF, 0xE8, 0x10, 0x00, 0x00, //    @@ #@@@@%.
+    0x00, 0x1F, 0xCC, 0xE8, 0x67, 0xCF, 0xC0, 0x00, 0x00, //   .@@@@%*#@@@
+    0x00, 0x2F, 0xFB, 0x10, 0x00, 0x0B, 0xF6, 0x00, 0x00, //   :@@@.    @@*
+    0x00, 0x2F, 0xD1, 0x00, 0x00, 0x04, 0xFA, 0x00, 0x00, //   :@@.     =@@
+    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x02, 0xFC, 0x00, 0x00, //    @@      :@@
+    0x00, 0x0C, 0xF2, 0x00, 0x00, 0x03, 0xFB, 0x00, 0x00, //    @@:     -@@
+    0x00, 0x07, 0xF9, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, //    #@@     #@%
+    0x00, 0x01, 0xDF, 0x50, 0x00, 0x3E, 0xE2, 0x00, 0x00, //    .@@+   -@@:
+    0x00, 0x00, 0x3E, 0xFC, 0x9B, 0xFF, 0x50, 0x00, 0x00, //     -@@@@@@@+
+    0x00, 0x00, 0x01, 0x8D, 0xFE, 0xA3, 0x00, 0x00, 0x00, //      .%@@@@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @4968 '7' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, //   +@@@@@@@@@@@
+    0x00, 0x3B, 0xBB, 0xBB, 0xBB, 0xBD, 0xF8, 0x00, 0x00, //   -@@@@@@@@@@%
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xB0, 0x00, 0x00, //           :@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0x20, 0x00, 0x00, //           @@:
+    0x00, 0x00, 0x00, 0x00, 0x06, 0xF6, 0x00, 0x00, 0x00, //          *@*
+    0x00, 0x00, 0x00, 0x00, 0x1E, 0xD0, 0x00, 0x00, 0x00, //         .@@
+    0x00, 0x00, 0x00, 0x00, 0x8F, 0x50, 0x00, 0x00, 0x00, //         %@+
+    0x00, 0x00, 0x00, 0x00, 0xEE, 0x00, 0x00, 0x00, 0x00, //         @@
+    0x00, 0x00, 0x00, 0x05, 0xF9, 0x00, 0x00, 0x00, 0x00, //        +@@
+    0x00, 0x00, 0x00, 0x0A, 0xF4, 0x00, 0x00, 0x00, 0x00, //        @@=
+    0x00, 0x00, 0x00, 0x0D, 0xF1, 0x00, 0x00, 0x00, 0x00, //        @@.
+    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, //       .@@
+    0x00, 0x00, 0x00, 0x4F, 0xB0, 0x00, 0x00, 0x00, 0x00, //       =@@
+    0x00, 0x00, 0x00, 0x6F, 0xA0, 0x00, 0x00, 0x00, 0x00, //       *@@
+    0x00, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x00, 0x00, //       #@@
+    0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, //       %@%
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @5184 '8' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x03, 0xAE, 0xFD, 0x92, 0x00, 0x00, 0x00, //      -@@@@@:
+    0x00, 0x00, 0x7F, 0xE9, 0x8A, 0xFE, 0x30, 0x00, 0x00, //     #@@@%@@@-
+    0x00, 0x02, 0xFD, 0x10, 0x00, 0x4F, 0xB0, 0x00, 0x00, //    :@@.   =@@
+    0x00, 0x05, 0xF7, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, //    +@#     @@
+    0x00, 0x05, 0xF7, 0x00, 0x00, 0x0A, 0xF0, 0x00, 0x00, //    +@#     @@
+    0x00, 0x01, 0xEE, 0x20, 0x00, 0x1E, 0xB0, 0x00, 0x00, //    .@@:   .@@
+    0x00, 0x00, 0x5F, 0xE7, 0x10, 0xAE, 0x20, 0x00, 0x00, //     +@@#. @@:
+    0x00, 0x00, 0x06, 0xFF, 0xFD, 0xE3, 0x00, 0x00, 0x00, //      *@@@@@-
+    0x00, 0x00, 0x7F, 0x85, 0xAF, 0xFA, 0x10, 0x00, 0x00, //     #@%+@@@@.
+    0x00, 0x08, 0xF5, 0x00, 0x02, 0x9F, 0xD1, 0x00, 0x00, //    %@+   :@@@.
+    0x00, 0x2F, 0xA0, 0x00, 0x00, 0x08, 0xF7, 0x00, 0x00, //   :@@      %@#
+    0x00, 0x5F, 0x70, 0x00, 0x00, 0x03, 0xFA, 0x00, 0x00, //   +@#      -@@
+    0x00, 0x4F, 0x90, 0x00, 0x00, 0x04, 0xFA, 0x00, 0x00, //   =@@      =@@
+    0x00, 0x0D, 0xF5, 0x00, 0x00, 0x1C, 0xF5, 0x00, 0x00, //    @@+    .@@+
+    0x00, 0x03, 0xEF, 0xC9, 0x8A, 0xEF, 0x90, 0x00, 0x00, //    -@@@@%@@@@
+    0x00, 0x00, 0x18, 0xCE, 0xFE, 0xA4, 0x00, 0x00, 0x00, //     .%@@@@@=
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @5400 '9' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x18, 0xDF, 0xEB, 0x40, 0x00, 0x00, 0x00, //     .%@@@@=
+    0x00, 0x02, 0xDF, 0xC9, 0xAE, 0xF8, 0x00, 0x00, 0x00, //    :@@@@@@@%
+    0x00, 0x0C, 0xF7, 0x00, 0x01, 0xBF, 0x50, 0x00, 0x00, //    @@#   .@@+
+    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x1E, 0xD0, 0x00, 0x00, //   -@@     .@@
+    0x00, 0x5F, 0x80, 0x00, 0x00, 0x0A, 0xF3, 0x00, 0x00, //   +@%      @@-
+    0x00, 0x5F, 0x90, 0x00, 0x00, 0x06, 0xF6, 0x00, 0x00, //   +@@      *@*
+    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x1C, 0xF8, 0x00, 0x00, //   :@@     .@@%
+    0x00, 0x0B, 0xFB, 0x31, 0x26, 0xED, 0xF8, 0x00, 0x00, //    @@@-.:*@@@%
+    0x00, 0x01, 0xBF, 0xFF, 0xFE, 0x76, 0xF8, 0x00, 0x00, //    .@@@@@@#*@%
+    0x00, 0x00, 0x03, 0x67, 0x51, 0x07, 0xF6, 0x00, 0x00, //      -*#+. #@*
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xF3, 0x00, 0x00, //            @@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xE0, 0x00, 0x00, //           .@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, //           %@%
+    0x00, 0x05, 0x81, 0x00, 0x07, 0xFD, 0x10, 0x00, 0x00, //    +%.   #@@.
+    0x00, 0x0C, 0xFE, 0xAA, 0xDF, 0xE3, 0x00, 0x00, 0x00, //    @@@@@@@@-
+    0x00, 0x00, 0x6C, 0xEF, 0xD8, 0x10, 0x00, 0x00, 0x00, //     *@@@@%.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @5616 ':' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x2C, 0xE6, 0x00, 0x00, 0x00, 0x00, //       :@@*
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0x10, 0x00, 0x00, 0x00, //       @@@@.
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0x10, 0x00, 0x00, 0x00, //       @@@@.
+    0x00, 0x00, 0x00, 0x3D, 0xF7, 0x00, 0x00, 0x00, 0x00, //       -@@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x3D, 0xF7, 0x00, 0x00, 0x00, 0x00, //       -@@#
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0x10, 0x00, 0x00, 0x00, //       @@@@.
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0x10, 0x00, 0x00, 0x00, //       @@@@.
+    0x00, 0x00, 0x00, 0x2C, 0xE7, 0x00, 0x00, 0x00, 0x00, //       :@@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @5832 ';' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x2C, 0xE6, 0x00, 0x00, 0x00, 0x00, //       :@@*
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0x10, 0x00, 0x00, 0x00, //       @@@@.
+    0x00, 0x00, 0x00, 0xAF, 0xFF, 0x10, 0x00, 0x00, 0x00, //       @@@@.
+    0x00, 0x00, 0x00, 0x3D, 0xF7, 0x00, 0x00, 0x00, 0x00, //       -@@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x06, 0x93, 0x00, 0x00, 0x00, 0x00, //        *@-
+    0x00, 0x00, 0x00, 0x6F, 0xFF, 0x20, 0x00, 0x00, 0x00, //       *@@@:
+    0x00, 0x00, 0x00, 0x8F, 0xFF, 0x60, 0x00, 0x00, 0x00, //       %@@@*
+    0x00, 0x00, 0x00, 0x2C, 0xFF, 0x70, 0x00, 0x00, 0x00, //       :@@@#
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0x60, 0x00, 0x00, 0x00, //         +@*
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x20, 0x00, 0x00, 0x00, //         @@:
+    0x00, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x00, 0x00, 0x00, //        =@@
+    0x00, 0x00, 0x00, 0x7F, 0xC1, 0x00, 0x00, 0x00, 0x00, //       #@@.
+    0x00, 0x00, 0x01, 0xE9, 0x10, 0x00, 0x00, 0x00, 0x00, //      .@@.
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, //       .
+    // @6048 '<' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x70, 0x00, 0x00, //            .#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xC0, 0x00, 0x00, //           =@@
+    0x00, 0x00, 0x00, 0x00, 0x19, 0xFD, 0x40, 0x00, 0x00, //         .@@@=
+    0x00, 0x00, 0x00, 0x03, 0xDF, 0xA1, 0x00, 0x00, 0x00, //        -@@@.
+    0x00, 0x00, 0x00, 0x8F, 0xE5, 0x00, 0x00, 0x00, 0x00, //       %@@+
+    0x00, 0x00, 0x3C, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x00, //     -@@@.
+    0x00, 0x01, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, //    .@@+
+    0x00, 0x01, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, //    .@@+
+    0x00, 0x00, 0x3C, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x00, //     -@@@.
+    0x00, 0x00, 0x00, 0x8F, 0xE5, 0x00, 0x00, 0x00, 0x00, //       %@@+
+    0x00, 0x00, 0x00, 0x03, 0xDF, 0xA1, 0x00, 0x00, 0x00, //        -@@@.
+    0x00, 0x00, 0x00, 0x00, 0x19, 0xFD, 0x40, 0x00, 0x00, //         .@@@=
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xC0, 0x00, 0x00, //           =@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x70, 0x00, 0x00, //            .#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @6264 '=' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, //    @@@@@@@@@@+
+    0x00, 0x07, 0x88, 0x88, 0x88, 0x88, 0x83, 0x00, 0x00, //    #%%%%%%%%%-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x21, 0x00, 0x00, //    ::::::::::.
+    0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, //    @@@@@@@@@@+
+    0x00, 0x05, 0x55, 0x55, 0x55, 0x55, 0x52, 0x00, 0x00, //    ++++++++++:
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @6480 '>' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x05, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    +-
+    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    #@%
+    0x00, 0x01, 0xAF, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, //    .@@@-
+    0x00, 0x00, 0x06, 0xEF, 0x70, 0x00, 0x00, 0x00, 0x00, //      *@@#
+    0x00, 0x00, 0x00, 0x2B, 0xFC, 0x20, 0x00, 0x00, 0x00, //       :@@@:
+    0x00, 0x00, 0x00, 0x00, 0x6E, 0xE7, 0x00, 0x00, 0x00, //         *@@#
+    0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0x70, 0x00, 0x00, //          :@@#
+    0x00, 0x00, 0x00, 0x00, 0x02, 0xBF, 0x70, 0x00, 0x00, //          :@@#
+    0x00, 0x00, 0x00, 0x00, 0x6E, 0xF7, 0x00, 0x00, 0x00, //         *@@#
+    0x00, 0x00, 0x00, 0x2B, 0xFC, 0x20, 0x00, 0x00, 0x00, //       :@@@:
+    0x00, 0x00, 0x06, 0xEF, 0x70, 0x00, 0x00, 0x00, 0x00, //      *@@#
+    0x00, 0x01, 0xAF, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, //    .@@@-
+    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    #@%
+    0x00, 0x05, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    +-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @6696 '?' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x06, 0xCE, 0xEC, 0x60, 0x00, 0x00, 0x00, //      *@@@@*
+    0x00, 0x01, 0xCF, 0xEA, 0xBE, 0xFB, 0x00, 0x00, 0x00, //    .@@@@@@@@
+    0x00, 0x01, 0xA6, 0x00, 0x01, 0xDF, 0x50, 0x00, 0x00, //    .@*   .@@+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x70, 0x00, 0x00, //           %@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x50, 0x00, 0x00, //           @@+
+    0x00, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x00, 0x00, //          =@@
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0xB1, 0x00, 0x00, 0x00, //         +@@.
+    0x00, 0x00, 0x00, 0x05, 0xFB, 0x00, 0x00, 0x00, 0x00, //        +@@
+    0x00, 0x00, 0x00, 0x1E, 0xE1, 0x00, 0x00, 0x00, 0x00, //       .@@.
+    0x00, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x00, 0x00, //       -@@
+    0x00, 0x00, 0x00, 0x14, 0x20, 0x00, 0x00, 0x00, 0x00, //       .=:
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x2A, 0x81, 0x00, 0x00, 0x00, 0x00, //       :@%.
+    0x00, 0x00, 0x00, 0xBF, 0xF7, 0x00, 0x00, 0x00, 0x00, //       @@@#
+    0x00, 0x00, 0x00, 0xCF, 0xF8, 0x00, 0x00, 0x00, 0x00, //       @@@%
+    0x00, 0x00, 0x00, 0x5E, 0xC2, 0x00, 0x00, 0x00, 0x00, //       +@@:
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @6912 '@' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x01, 0x7C, 0xFF, 0xE9, 0x10, 0x00, 0x00, //      .#@@@@@.
+    0x00, 0x00, 0x2D, 0xF9, 0x54, 0x7E, 0xC1, 0x00, 0x00, //     :@@@+=#@@.
+    0x00, 0x01, 0xED, 0x20, 0x00, 0x02, 0xF8, 0x00, 0x00, //    .@@:    :@%
+    0x00, 0x09, 0xF3, 0x00, 0x00, 0x00, 0x9D, 0x00, 0x00, //    @@-      @@
+    0x00, 0x1F, 0x90, 0x00, 0x00, 0x00, 0x6F, 0x10, 0x00, //   .@@       *@.
+    0x00, 0x6F, 0x30, 0x00, 0x00, 0x25, 0x9F, 0x20, 0x00, //   *@-     :+@@:
+    0x00, 0x9E, 0x00, 0x01, 0x8D, 0xFD, 0xDF, 0x20, 0x00, //   @@   .%@@@@@:
+    0x00, 0xBC, 0x00, 0x1D, 0xD6, 0x10, 0x7F, 0x20, 0x00, //   @@  .@@*. #@:
+    0x00, 0xCB, 0x00, 0x7F, 0x20, 0x00, 0x7F, 0x20, 0x00, //   @@  #@:   #@:
+    0x00, 0xCB, 0x00, 0x9F, 0x00, 0x00, 0x9F, 0x20, 0x00, //   @@  @@    @@:
+    0x00, 0xBC, 0x00, 0x5F, 0x92, 0x3A, 0xDF, 0x20, 0x00, //   @@  +@@:-@@@:
+    0x00, 0x9E, 0x00, 0x09, 0xFF, 0xF9, 0x3F, 0x20, 0x00, //   @@   @@@@@-@:
+    0x00, 0x6F, 0x20, 0x00, 0x24, 0x10, 0x00, 0x00, 0x00, //   *@:   :=.
+    0x00, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //   .@%
+    0x00, 0x09, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    @@:
+    0x00, 0x01, 0xEC, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, //    .@@.     .
+    0x00, 0x00, 0x3E, 0xE6, 0x22, 0x39, 0xE1, 0x00, 0x00, //     -@@*::-@@.
+    0x00, 0x00, 0x01, 0x9E, 0xFF, 0xFD, 0x60, 0x00, 0x00, //      .@@@@@@*
+    0x00, 0x00, 0x00, 0x01, 0x33, 0x20, 0x00, 0x00, 0x00, //        .--:
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @7128 'A' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x1F, 0xF7, 0x00, 0x00, 0x00, 0x00, //       .@@#
+    0x00, 0x00, 0x00, 0x6F, 0xEC, 0x00, 0x00, 0x00, 0x00, //       *@@@
+    0x00, 0x00, 0x00, 0xBD, 0x8F, 0x20, 0x00, 0x00, 0x00, //       @@%@:
+    0x00, 0x00, 0x01, 0xF9, 0x4F, 0x70, 0x00, 0x00, 0x00, //      .@@=@#
+    0x00, 0x00, 0x06, 0xF5, 0x0E, 0xC0, 0x00, 0x00, 0x00, //      *@+ @@
+    0x00, 0x00, 0x0B, 0xE1, 0x0A, 0xF2, 0x00, 0x00, 0x00, //      @@. @@:
+    0x00, 0x00, 0x1F, 0xB0, 0x05, 0xF7, 0x00, 0x00, 0x00, //     .@@  +@#
+    0x00, 0x00, 0x6F, 0x60, 0x01, 0xFC, 0x00, 0x00, 0x00, //     *@*  .@@
+    0x00, 0x00, 0xBF, 0x10, 0x00, 0xBF, 0x20, 0x00, 0x00, //     @@.   @@:
+    0x00, 0x01, 0xFE, 0x99, 0x99, 0xCF, 0x70, 0x00, 0x00, //    .@@@@@@@@#
+    0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, //    *@@@@@@@@@
+    0x00, 0x0B, 0xF2, 0x00, 0x00, 0x0C, 0xF2, 0x00, 0x00, //    @@:     @@:
+    0x00, 0x1F, 0xD0, 0x00, 0x00, 0x08, 0xF7, 0x00, 0x00, //   .@@      %@#
+    0x00, 0x6F, 0x80, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, //   *@%      -@@
+    0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xEF, 0x20, 0x00, //   @@=       @@:
+    0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x70, 0x00, //  .@@        @@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @7344 'B' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x08, 0xFF, 0xFF, 0xEC, 0x93, 0x00, 0x00, 0x00, //    %@@@@@@@-
+    0x00, 0x08, 0xFC, 0x99, 0xAD, 0xFF, 0x50, 0x00, 0x00, //    %@@@@@@@@+
+    0x00, 0x08, 0xF7, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, //    %@#    #@@
+    0x00, 0x08, 0xF7, 0x00, 0x00, 0x0E, 0xF2, 0x00, 0x00, //    %@#     @@:
+    0x00, 0x08, 0xF7, 0x00, 0x00, 0x0D, 0xF2, 0x00, 0x00, //    %@#     @@:
+    0x00, 0x08, 0xF7, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, //    %@#    :@@
+    0x00, 0x08, 0xF7, 0x00, 0x14, 0xDE, 0x40, 0x00, 0x00, //    %@#  .=@@=
+    0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xD3, 0x00, 0x00, 0x00, //    %@@@@@@@-
+    0x00, 0x08, 0xFB, 0x88, 0x8A, 0xEF, 0x80, 0x00, 0x00, //    %@@%%%@@@%
+    0x00, 0x08, 0xF7, 0x00, 0x00, 0x09, 0xF8, 0x00, 0x00, //    %@#     @@%
+    0x00, 0x08, 0xF7, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, //    %@#     .@@
+    0x00, 0x08, 0xF7, 0x00, 0x00, 0x00, 0xEF, 0x10, 0x00, //    %@#      @@.
+    0x00, 0x08, 0xF7, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, //    %@#     :@@
+    0x00, 0x08, 0xF7, 0x00, 0x00, 0x2C, 0xF8, 0x00, 0x00, //    %@#    :@@%
+    0x00, 0x08, 0xFC, 0x99, 0xAC, 0xFF, 0xB1, 0x00, 0x00, //    %@@@@@@@@@.
+    0x00, 0x08, 0xFF, 0xFF, 0xFE, 0xB5, 0x00, 0x00, 0x00, //    %@@@@@@@+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @7560 'C' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x4A, 0xDF, 0xEA, 0x30, 0x00, 0x00, //       =@@@@@-
+    0x00, 0x00, 0x1A, 0xFF, 0xDC, 0xDF, 0xF7, 0x00, 0x00, //     .@@@@@@@@#
+    0x00, 0x00, 0xBF, 0xD4, 0x00, 0x03, 0xD6, 0x00, 0x00, //     @@@=   -@*
+    0x00, 0x06, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, //    *@@.
+    0x00, 0x0C, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    @@+
+    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //   :@@
+    0x00, 0x5F, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //   +@@
+    0x00, 0x6F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //   *@@
+    0x00, 0x6F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //   *@@
+    0x00, 0x5F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //   +@@
+    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //   :@@
+    0x00, 0x0C, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    @@*
+    0x00, 0x05, 0xFE, 0x10, 0x00, 0x00, 0x12, 0x00, 0x00, //    +@@.     .:
+    0x00, 0x00, 0xBF, 0xD4, 0x00, 0x03, 0xDE, 0x10, 0x00, //     @@@=   -@@.
+    0x00, 0x00, 0x1B, 0xFF, 0xEC, 0xDF, 0xF7, 0x00, 0x00, //     .@@@@@@@@#
+    0x00, 0x00, 0x00, 0x5A, 0xEF, 0xDA, 0x30, 0x00, 0x00, //       +@@@@@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @7776 'D' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x0E, 0xFF, 0xFE, 0xD9, 0x40, 0x00, 0x00, 0x00, //    @@@@@@@=
+    0x00, 0x0E, 0xFA, 0xAB, 0xDF, 0xFA, 0x00, 0x00, 0x00, //    @@@@@@@@@
+    0x00, 0x0E, 0xF0, 0x00, 0x04, 0xDF, 0xA0, 0x00, 0x00, //    @@    =@@@
+    0x00, 0x0E, 0xF0, 0x00, 0x00, 0x2E, 0xF4, 0x00, 0x00, //    @@     :@@=
+    0x00, 0x0E, 0xF0, 0x00, 0x00, 0x08, 0xFA, 0x00, 0x00, //    @@      %@@
+    0x00, 0x0E, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, //    @@      -@@
+    0x00, 0x0E, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x10, 0x00, //    @@       @@.
+    0x00, 0x0E, 0xF0, 0x00, 0x00, 0x00, 0xEF, 0x20, 0x00, //    @@       @@:
+    0x00, 0x0E, 0xF0, 0x00, 0x00, 0x00, 0xEF, 0x20, 0x00, //    @@       @@:
+    0x00, 0x0E, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x10, 0x00, //    @@       @@.
+    0x00, 0x0E, 0xF0, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, //    @@      -@@
+    0x00, 0x0E, 0xF0, 0x00, 0x00, 0x08, 0xF9, 0x00, 0x00, //    @@      %@@
+    0x00, 0x0E, 0xF0, 0x00, 0x00, 0x2F, 0xF3, 0x00, 0x00, //    @@     :@@-
+    0x00, 0x0E, 0xF0, 0x00, 0x04, 0xEF, 0x90, 0x00, 0x00, //    @@    =@@@
+    0x00, 0x0E, 0xFA, 0xAB, 0xDF, 0xF9, 0x00, 0x00, 0x00, //    @@@@@@@@@
+    0x00, 0x0E, 0xFF, 0xFE, 0xD9, 0x30, 0x00, 0x00, 0x00, //    @@@@@@@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @7992 'E' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, //    =@@@@@@@@@#
+    0x00, 0x04, 0xFE, 0xAA, 0xAA, 0xAA, 0xA5, 0x00, 0x00, //    =@@@@@@@@@+
+    0x00, 0x04, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    =@@
+    0x00, 0x04, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    =@@
+    0x00, 0x04, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    =@@
+    0x00, 0x04, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    =@@
+    0x00, 0x04, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    =@@
+    0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, //    =@@@@@@@@=
+    0x00, 0x04, 0xFE, 0xBB, 0xBB, 0xBB, 0x30, 0x00, 0x00, //    =@@@@@@@@-
+    0x00, 0x04, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    =@@
+    0x00, 0x04, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    =@@
+    0x00, 0x04, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    =@@
+    0x00, 0x04, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    =@@
+    0x00, 0x04, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    =@@
+    0x00, 0x04, 0xFE, 0xBB, 0xBB, 0xBB, 0xB8, 0x00, 0x00, //    =@@@@@@@@@%
+    0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, //    =@@@@@@@@@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @8208 'F' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, //     @@@@@@@@@@
+    0x00, 0x00, 0xCF, 0xBA, 0xAA, 0xAA, 0xA9, 0x00, 0x00, //     @@@@@@@@@@
+    0x00, 0x00, 0xCF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@=
+    0x00, 0x00, 0xCF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@=
+    0x00, 0x00, 0xCF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@=
+    0x00, 0x00, 0xCF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@=
+    0x00, 0x00, 0xCF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@=
+    0x00, 0x00, 0xCF, 0xBA, 0xAA, 0xAA, 0x70, 0x00, 0x00, //     @@@@@@@@#
+    0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, //     @@@@@@@@@
+    0x00, 0x00, 0xCF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@=
+    0x00, 0x00, 0xCF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@=
+    0x00, 0x00, 0xCF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@=
+    0x00, 0x00, 0xCF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@=
+    0x00, 0x00, 0xCF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@=
+    0x00, 0x00, 0xCF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@=
+    0x00, 0x00, 0xCF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@=
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @8424 'G' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x01, 0x7C, 0xEE, 0xD8, 0x10, 0x00, 0x00, //      .#@@@@%.
+    0x00, 0x00, 0x3D, 0xFF, 0xDC, 0xEF, 0xE3, 0x00, 0x00, //     -@@@@@@@@-
+    0x00, 0x02, 0xEF, 0xA2, 0x00, 0x06, 0xD2, 0x00, 0x00, //    :@@@:   *@:
+    0x00, 0x0A, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    @@@
+    0x00, 0x2F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //   :@@.
+    0x00, 0x6F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //   *@@
+    0x00, 0x9F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //   @@#
+    0x00, 0xBF, 0x60, 0x00, 0x2A, 0xAA, 0xA8, 0x00, 0x00, //   @@*   :@@@@%
+    0x00, 0xBF, 0x60, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, //   @@*   -@@@@@
+    0x00, 0x9F, 0x70, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, //   @@#      .@@
+    0x00, 0x7F, 0xA0, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, //   #@@      .@@
+    0x00, 0x2F, 0xF1, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, //   :@@.     .@@
+    0x00, 0x0B, 0xFA, 0x00, 0x00, 0x01, 0xFC, 0x00, 0x00, //    @@@     .@@
+    0x00, 0x02, 0xEF, 0xA1, 0x00, 0x06, 0xFC, 0x00, 0x00, //    :@@@.   *@@
+    0x00, 0x00, 0x3E, 0xFF, 0xDC, 0xEF, 0xF6, 0x00, 0x00, //     -@@@@@@@@*
+    0x00, 0x00, 0x01, 0x8C, 0xEE, 0xD9, 0x20, 0x00, 0x00, //      .%@@@@@:
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @8640 'H' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, //   :@@      %@%
+    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, //   :@@      %@%
+    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, //   :@@      %@%
+    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, //   :@@      %@%
+    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, //   :@@      %@%
+    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, //   :@@      %@%
+    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, //   :@@      %@%
+    0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, //   :@@@@@@@@@@%
+    0x00, 0x2F, 0xFB, 0xBB, 0xBB, 0xBD, 0xF8, 0x00, 0x00, //   :@@@@@@@@@@%
+    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, //   :@@      %@%
+    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, //   :@@      %@%
+    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, //   :@@      %@%
+    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, //   :@@      %@%
+    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, //   :@@      %@%
+    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, //   :@@      %@%
+    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, //   :@@      %@%
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @8856 'I' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, //    @@@@@@@@@@:
+    0x00, 0x07, 0xAA, 0xAE, 0xFB, 0xAA, 0xA1, 0x00, 0x00, //    #@@@@@@@@@.
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x08, 0xBB, 0xBE, 0xFB, 0xBB, 0xB1, 0x00, 0x00, //    %@@@@@@@@@.
+    0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, //    @@@@@@@@@@:
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @9072 'J' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, //     @@@@@@@@@
+    0x00, 0x00, 0x8A, 0xAA, 0xAA, 0xBF, 0xC0, 0x00, 0x00, //     %@@@@@@@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, //           :@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, //           :@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, //           :@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, //           :@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, //           :@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, //           :@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, //           :@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, //           :@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, //           :@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xC0, 0x00, 0x00, //           =@@
+    0x00, 0x03, 0x70, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, //    -#     #@@
+    0x00, 0x0C, 0xF8, 0x10, 0x04, 0xEF, 0x40, 0x00, 0x00, //    @@%.  =@@=
+    0x00, 0x03, 0xEF, 0xEC, 0xEF, 0xF9, 0x00, 0x00, 0x00, //    -@@@@@@@@
+    0x00, 0x00, 0x18, 0xDF, 0xEB, 0x50, 0x00, 0x00, 0x00, //     .%@@@@+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @9288 'K' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x0A, 0xF6, 0x00, 0x00, 0x05, 0xFD, 0x10, 0x00, //    @@*     +@@.
+    0x00, 0x0A, 0xF6, 0x00, 0x00, 0x3F, 0xE2, 0x00, 0x00, //    @@*    -@@:
+    0x00, 0x0A, 0xF6, 0x00, 0x02, 0xDF, 0x40, 0x00, 0x00, //    @@*   :@@=
+    0x00, 0x0A, 0xF6, 0x00, 0x0C, 0xF7, 0x00, 0x00, 0x00, //    @@*   @@#
+    0x00, 0x0A, 0xF6, 0x00, 0xAF, 0xA0, 0x00, 0x00, 0x00, //    @@*  @@@
+    0x00, 0x0A, 0xF6, 0x07, 0xFC, 0x10, 0x00, 0x00, 0x00, //    @@* #@@.
+    0x00, 0x0A, 0xF6, 0x5F, 0xF9, 0x00, 0x00, 0x00, 0x00, //    @@*+@@@
+    0x00, 0x0A, 0xF8, 0xEF, 0xEF, 0x20, 0x00, 0x00, 0x00, //    @@%@@@@:
+    0x00, 0x0A, 0xFF, 0xF6, 0x7F, 0xB0, 0x00, 0x00, 0x00, //    @@@@*#@@
+    0x00, 0x0A, 0xFF, 0x90, 0x0D, 0xF4, 0x00, 0x00, 0x00, //    @@@@  @@=
+    0x00, 0x0A, 0xFB, 0x00, 0x05, 0xFC, 0x00, 0x00, 0x00, //    @@@   +@@
+    0x00, 0x0A, 0xF6, 0x00, 0x00, 0xCF, 0x60, 0x00, 0x00, //    @@*    @@*
+    0x00, 0x0A, 0xF6, 0x00, 0x00, 0x4F, 0xD1, 0x00, 0x00, //    @@*    =@@.
+    0x00, 0x0A, 0xF6, 0x00, 0x00, 0x0B, 0xF7, 0x00, 0x00, //    @@*     @@#
+    0x00, 0x0A, 0xF6, 0x00, 0x00, 0x03, 0xFE, 0x10, 0x00, //    @@*     -@@.
+    0x00, 0x0A, 0xF6, 0x00, 0x00, 0x00, 0x9F, 0x90, 0x00, //    @@*      @@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @9504 'L' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0xCF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@-
+    0x00, 0x00, 0xCF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@-
+    0x00, 0x00, 0xCF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@-
+    0x00, 0x00, 0xCF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@-
+    0x00, 0x00, 0xCF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@-
+    0x00, 0x00, 0xCF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@-
+    0x00, 0x00, 0xCF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@-
+    0x00, 0x00, 0xCF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@-
+    0x00, 0x00, 0xCF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@-
+    0x00, 0x00, 0xCF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@-
+    0x00, 0x00, 0xCF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@-
+    0x00, 0x00, 0xCF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@-
+    0x00, 0x00, 0xCF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@-
+    0x00, 0x00, 0xCF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@-
+    0x00, 0x00, 0xCF, 0xBB, 0xBB, 0xBB, 0xBA, 0x00, 0x00, //     @@@@@@@@@@
+    0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, //     @@@@@@@@@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @9720 'M' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x1F, 0xF5, 0x00, 0x00, 0x0E, 0xF7, 0x00, 0x00, //   .@@+     @@#
+    0x00, 0x1F, 0xFA, 0x00, 0x00, 0x4F, 0xF7, 0x00, 0x00, //   .@@@    =@@#
+    0x00, 0x1F, 0xCE, 0x00, 0x00, 0x8D, 0xF7, 0x00, 0x00, //   .@@@    %@@#
+    0x00, 0x1F, 0x9F, 0x50, 0x00, 0xD9, 0xF7, 0x00, 0x00, //   .@@@+   @@@#
+    0x00, 0x1F, 0x8C, 0x90, 0x03, 0xF5, 0xF7, 0x00, 0x00, //   .@%@@  -@+@#
+    0x00, 0x1F, 0x98, 0xE0, 0x08, 0xD3, 0xF7, 0x00, 0x00, //   .@@%@  %@-@#
+    0x00, 0x1F, 0x92, 0xF4, 0x0D, 0x84, 0xF7, 0x00, 0x00, //   .@@:@= @%=@#
+    0x00, 0x1F, 0x90, 0xC9, 0x2F, 0x34, 0xF7, 0x00, 0x00, //   .@@ @@:@-=@#
+    0x00, 0x1F, 0x90, 0x7D, 0x7D, 0x04, 0xF7, 0x00, 0x00, //   .@@ #@#@ =@#
+    0x00, 0x1F, 0x90, 0x2F, 0xE7, 0x04, 0xF7, 0x00, 0x00, //   .@@ :@@# =@#
+    0x00, 0x1F, 0x90, 0x0C, 0xF2, 0x04, 0xF7, 0x00, 0x00, //   .@@  @@: =@#
+    0x00, 0x1F, 0x90, 0x05, 0x90, 0x04, 0xF7, 0x00, 0x00, //   .@@  +@  =@#
+    0x00, 0x1F, 0x90, 0x00, 0x00, 0x04, 0xF7, 0x00, 0x00, //   .@@      =@#
+    0x00, 0x1F, 0x90, 0x00, 0x00, 0x04, 0xF7, 0x00, 0x00, //   .@@      =@#
+    0x00, 0x1F, 0x90, 0x00, 0x00, 0x04, 0xF7, 0x00, 0x00, //   .@@      =@#
+    0x00, 0x1F, 0x90, 0x00, 0x00, 0x04, 0xF7, 0x00, 0x00, //   .@@      =@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @9936 'N' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x0F, 0xF4, 0x00, 0x00, 0x07, 0xF6, 0x00, 0x00, //    @@=     #@*
+    0x00, 0x0F, 0xFC, 0x00, 0x00, 0x07, 0xF6, 0x00, 0x00, //    @@@     #@*
+    0x00, 0x0F, 0xEF, 0x40, 0x00, 0x07, 0xF6, 0x00, 0x00, //    @@@=    #@*
+    0x00, 0x0F, 0xBD, 0xC0, 0x00, 0x07, 0xF6, 0x00, 0x00, //    @@@@    #@*
+    0x00, 0x0F, 0xB6, 0xF5, 0x00, 0x07, 0xF6, 0x00, 0x00, //    @@*@+   #@*
+    0x00, 0x0F, 0xC1, 0xEC, 0x00, 0x07, 0xF6, 0x00, 0x00, //    @@.@@   #@*
+    0x00, 0x0F, 0xD0, 0x7F, 0x50, 0x07, 0xF6, 0x00, 0x00, //    @@ #@+  #@*
+    0x00, 0x0F, 0xD0, 0x1E, 0xC0, 0x07, 0xF6, 0x00, 0x00, //    @@ .@@  #@*
+    0x00, 0x0F, 0xD0, 0x07, 0xF5, 0x07, 0xF6, 0x00, 0x00, //    @@  #@+ #@*
+    0x00, 0x0F, 0xD0, 0x00, 0xDC, 0x07, 0xF6, 0x00, 0x00, //    @@   @@ #@*
+    0x00, 0x0F, 0xD0, 0x00, 0x6F, 0x56, 0xF6, 0x00, 0x00, //    @@   *@+*@*
+    0x00, 0x0F, 0xD0, 0x00, 0x0D, 0xC5, 0xF6, 0x00, 0x00, //    @@    @@+@*
+    0x00, 0x0F, 0xD0, 0x00, 0x06, 0xF9, 0xF6, 0x00, 0x00, //    @@    *@@@*
+    0x00, 0x0F, 0xD0, 0x00, 0x00, 0xDE, 0xF6, 0x00, 0x00, //    @@     @@@*
+    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x6F, 0xF6, 0x00, 0x00, //    @@     *@@*
+    0x00, 0x0F, 0xD0, 0x00, 0x00, 0x0D, 0xF6, 0x00, 0x00, //    @@      @@*
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @10152 'O' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x04, 0xBE, 0xEC, 0x70, 0x00, 0x00, 0x00, //      =@@@@#
+    0x00, 0x00, 0x8F, 0xFD, 0xCF, 0xFD, 0x10, 0x00, 0x00, //     %@@@@@@@.
+    0x00, 0x06, 0xFE, 0x40, 0x01, 0xBF, 0xC0, 0x00, 0x00, //    *@@=  .@@@
+    0x00, 0x0E, 0xF4, 0x00, 0x00, 0x1D, 0xF5, 0x00, 0x00, //    @@=    .@@+
+    0x00, 0x5F, 0xC0, 0x00, 0x00, 0x06, 0xFB, 0x00, 0x00, //   +@@      *@@
+    0x00, 0x9F, 0x70, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, //   @@#      .@@
+    0x00, 0xBF, 0x50, 0x00, 0x00, 0x00, 0xEF, 0x20, 0x00, //   @@+       @@:
+    0x00, 0xCF, 0x40, 0x00, 0x00, 0x00, 0xDF, 0x30, 0x00, //   @@=       @@-
+    0x00, 0xCF, 0x40, 0x00, 0x00, 0x00, 0xDF, 0x30, 0x00, //   @@=       @@-
+    0x00, 0xBF, 0x50, 0x00, 0x00, 0x00, 0xEF, 0x20, 0x00, //   @@+       @@:
+    0x00, 0x9F, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, //   @@%      :@@
+    0x00, 0x5F, 0xC0, 0x00, 0x00, 0x06, 0xFB, 0x00, 0x00, //   +@@      *@@
+    0x00, 0x0D, 0xF5, 0x00, 0x00, 0x1D, 0xF5, 0x00, 0x00, //    @@+    .@@+
+    0x00, 0x05, 0xFE, 0x40, 0x01, 0xBF, 0xB0, 0x00, 0x00, //    +@@=  .@@@
+    0x00, 0x00, 0x7F, 0xFD, 0xCF, 0xFC, 0x10, 0x00, 0x00, //     #@@@@@@@.
+    0x00, 0x00, 0x04, 0xBE, 0xEC, 0x70, 0x00, 0x00, 0x00, //      =@@@@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @10368 'P' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x08, 0xFF, 0xFF, 0xFD, 0xB7, 0x10, 0x00, 0x00, //    %@@@@@@@#.
+    0x00, 0x08, 0xFC, 0x99, 0xAB, 0xFF, 0xD1, 0x00, 0x00, //    %@@@@@@@@@.
+    0x00, 0x08, 0xF7, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, //    %@#    .@@@
+    0x00, 0x08, 0xF7, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, //    %@#     :@@
+    0x00, 0x08, 0xF7, 0x00, 0x00, 0x00, 0xEF, 0x10, 0x00, //    %@#      @@.
+    0x00, 0x08, 0xF7, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, //    %@#     .@@
+    0x00, 0x08, 0xF7, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x00, //    %@#     *@@
+    0x00, 0x08, 0xF7, 0x00, 0x02, 0x7E, 0xF4, 0x00, 0x00, //    %@#   :#@@=
+    0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFE, 0x50, 0x00, 0x00, //    %@@@@@@@@+
+    0x00, 0x08, 0xFC, 0xAA, 0x98, 0x51, 0x00, 0x00, 0x00, //    %@@@@@%+.
+    0x00, 0x08, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    %@#
+    0x00, 0x08, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    %@#
+    0x00, 0x08, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    %@#
+    0x00, 0x08, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    %@#
+    0x00, 0x08, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    %@#
+    0x00, 0x08, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    %@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @10584 'Q' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x04, 0xBE, 0xEC, 0x60, 0x00, 0x00, 0x00, //      =@@@@*
+    0x00, 0x00, 0x8F, 0xFD, 0xCF, 0xFC, 0x10, 0x00, 0x00, //     %@@@@@@@.
+    0x00, 0x05, 0xFE, 0x40, 0x01, 0xBF, 0xA0, 0x00, 0x00, //    +@@=  .@@@
+    0x00, 0x0D, 0xF4, 0x00, 0x00, 0x1E, 0xF4, 0x00, 0x00, //    @@=    .@@=
+    0x00, 0x4F, 0xC0, 0x00, 0x00, 0x07, 0xF9, 0x00, 0x00, //   =@@      #@@
+    0x00, 0x8F, 0x70, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, //   %@#      -@@
+    0x00, 0xBF, 0x50, 0x00, 0x00, 0x00, 0xFF, 0x10, 0x00, //   @@+       @@.
+    0x00, 0xCF, 0x40, 0x00, 0x00, 0x00, 0xEF, 0x20, 0x00, //   @@=       @@:
+    0x00, 0xCF, 0x40, 0x00, 0x00, 0x00, 0xEF, 0x20, 0x00, //   @@=       @@:
+    0x00, 0xBF, 0x40, 0x00, 0x00, 0x00, 0xFF, 0x10, 0x00, //   @@=       @@.
+    0x00, 0x9F, 0x70, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, //   @@#      :@@
+    0x00, 0x6F, 0xA0, 0x00, 0x00, 0x06, 0xFB, 0x00, 0x00, //   *@@      *@@
+    0x00, 0x1F, 0xF2, 0x00, 0x00, 0x0C, 0xF5, 0x00, 0x00, //   .@@:     @@+
+    0x00, 0x08, 0xFB, 0x10, 0x00, 0x7F, 0xD0, 0x00, 0x00, //    %@@.   #@@
+    0x00, 0x01, 0xCF, 0xD7, 0x6B, 0xFE, 0x30, 0x00, 0x00, //    .@@@#*@@@-
+    0x00, 0x00, 0x1A, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x00, //     .@@@@@@-
+    0x00, 0x00, 0x00, 0x1B, 0xF9, 0x00, 0x00, 0x00, 0x00, //       .@@@
+    0x00, 0x00, 0x00, 0x03, 0xFF, 0x50, 0x00, 0x00, 0x00, //        -@@+
+    0x00, 0x00, 0x00, 0x00, 0x5F, 0xFD, 0xBC, 0x00, 0x00, //         +@@@@@
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xAE, 0xFD, 0x20, 0x00, //          -@@@@:
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @10800 'R' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x09, 0xFF, 0xFF, 0xFD, 0xB5, 0x00, 0x00, 0x00, //    @@@@@@@@+
+    0x00, 0x09, 0xFC, 0x99, 0xAC, 0xFF, 0xA0, 0x00, 0x00, //    @@@@@@@@@@
+    0x00, 0x09, 0xF6, 0x00, 0x00, 0x3D, 0xF5, 0x00, 0x00, //    @@*    -@@+
+    0x00, 0x09, 0xF6, 0x00, 0x00, 0x06, 0xFA, 0x00, 0x00, //    @@*     *@@
+    0x00, 0x09, 0xF6, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x00, //    @@*     -@@
+    0x00, 0x09, 0xF6, 0x00, 0x00, 0x05, 0xFA, 0x00, 0x00, //    @@*     +@@
+    0x00, 0x09, 0xF6, 0x00, 0x00, 0x0A, 0xF7, 0x00, 0x00, //    @@*     @@#
+    0x00, 0x09, 0xF6, 0x00, 0x13, 0xAF, 0xE1, 0x00, 0x00, //    @@*  .-@@@.
+    0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFD, 0x30, 0x00, 0x00, //    @@@@@@@@@-
+    0x00, 0x09, 0xFC, 0xAA, 0xDF, 0x80, 0x00, 0x00, 0x00, //    @@@@@@@%
+    0x00, 0x09, 0xF6, 0x00, 0x4F, 0xD1, 0x00, 0x00, 0x00, //    @@*  =@@.
+    0x00, 0x09, 0xF6, 0x00, 0x0A, 0xF8, 0x00, 0x00, 0x00, //    @@*   @@%
+    0x00, 0x09, 0xF6, 0x00, 0x02, 0xFF, 0x20, 0x00, 0x00, //    @@*   :@@:
+    0x00, 0x09, 0xF6, 0x00, 0x00, 0x8F, 0xB0, 0x00, 0x00, //    @@*    %@@
+    0x00, 0x09, 0xF6, 0x00, 0x00, 0x1D, 0xF5, 0x00, 0x00, //    @@*    .@@+
+    0x00, 0x09, 0xF6, 0x00, 0x00, 0x05, 0xFE, 0x10, 0x00, //    @@*     +@@.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @11016 'S' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x04, 0xAE, 0xFE, 0xA5, 0x00, 0x00, 0x00, //      =@@@@@+
+    0x00, 0x00, 0x8F, 0xFD, 0xCD, 0xFF, 0xB1, 0x00, 0x00, //     %@@@@@@@@.
+    0x00, 0x04, 0xFE, 0x40, 0x00, 0x29, 0xC1, 0x00, 0x00, //    =@@=   :@@.
+    0x00, 0x09, 0xF8, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, //    @@%      .
+    0x00, 0x09, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    @@%
+    0x00, 0x05, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, //    +@@=
+    0x00, 0x00, 0xAF, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x00, //     @@@@=
+    0x00, 0x00, 0x06, 0xDF, 0xFD, 0x71, 0x00, 0x00, 0x00, //      *@@@@#.
+    0x00, 0x00, 0x00, 0x05, 0xCF, 0xFE, 0x40, 0x00, 0x00, //        +@@@@=
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xF3, 0x00, 0x00, //          -@@@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFB, 0x00, 0x00, //            @@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFD, 0x00, 0x00, //            -@@
+    0x00, 0x05, 0x30, 0x00, 0x00, 0x05, 0xFB, 0x00, 0x00, //    +-      +@@
+    0x00, 0x2F, 0xE8, 0x10, 0x00, 0x4E, 0xF6, 0x00, 0x00, //   :@@%.   =@@*
+    0x00, 0x06, 0xEF, 0xFD, 0xCE, 0xFF, 0x90, 0x00, 0x00, //    *@@@@@@@@@
+    0x00, 0x00, 0x17, 0xCE, 0xFE, 0xA4, 0x00, 0x00, 0x00, //     .#@@@@@=
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @11232 'T' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, //   @@@@@@@@@@@@*
+    0x00, 0xAA, 0xAA, 0xAE, 0xFB, 0xAA, 0xAA, 0x40, 0x00, //   @@@@@@@@@@@@=
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @11448 'U' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, //   :@@      #@%
+    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, //   :@@      #@%
+    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, //   :@@      #@%
+    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, //   :@@      #@%
+    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, //   :@@      #@%
+    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, //   :@@      #@%
+    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, //   :@@      #@%
+    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, //   :@@      #@%
+    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, //   :@@      #@%
+    0x00, 0x2F, 0xE0, 0x00, 0x00, 0x07, 0xF7, 0x00, 0x00, //   :@@      #@#
+    0x00, 0x1F, 0xE0, 0x00, 0x00, 0x07, 0xF7, 0x00, 0x00, //   .@@      #@#
+    0x00, 0x0E, 0xF1, 0x00, 0x00, 0x09, 0xF5, 0x00, 0x00, //    @@.     @@+
+    0x00, 0x0B, 0xF6, 0x00, 0x00, 0x1E, 0xF2, 0x00, 0x00, //    @@*    .@@:
+    0x00, 0x05, 0xFE, 0x40, 0x01, 0xBF, 0xB0, 0x00, 0x00, //    +@@=  .@@@
+    0x00, 0x00, 0x9F, 0xFD, 0xCF, 0xFD, 0x20, 0x00, 0x00, //     @@@@@@@@:
+    0x00, 0x00, 0x05, 0xBE, 0xFD, 0x91, 0x00, 0x00, 0x00, //      +@@@@@.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @11664 'V' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0xCF, 0x40, 0x00, 0x00, 0x00, 0xCF, 0x30, 0x00, //   @@=       @@-
+    0x00, 0x8F, 0x90, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, //   %@@      :@@
+    0x00, 0x3F, 0xD0, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, //   -@@      *@@
+    0x00, 0x0D, 0xF3, 0x00, 0x00, 0x0A, 0xF4, 0x00, 0x00, //    @@-     @@=
+    0x00, 0x08, 0xF7, 0x00, 0x00, 0x0E, 0xE0, 0x00, 0x00, //    %@#     @@
+    0x00, 0x04, 0xFB, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, //    =@@    =@@
+    0x00, 0x00, 0xEF, 0x10, 0x00, 0x9F, 0x50, 0x00, 0x00, //     @@.   @@+
+    0x00, 0x00, 0x9F, 0x50, 0x00, 0xDF, 0x10, 0x00, 0x00, //     @@+   @@.
+    0x00, 0x00, 0x5F, 0xA0, 0x02, 0xFB, 0x00, 0x00, 0x00, //     +@@  :@@
+    0x00, 0x00, 0x0E, 0xE0, 0x07, 0xF6, 0x00, 0x00, 0x00, //      @@  #@*
+    0x00, 0x00, 0x0A, 0xF3, 0x0B, 0xF1, 0x00, 0x00, 0x00, //      @@- @@.
+    0x00, 0x00, 0x06, 0xF7, 0x0E, 0xC0, 0x00, 0x00, 0x00, //      *@# @@
+    0x00, 0x00, 0x01, 0xFC, 0x4F, 0x70, 0x00, 0x00, 0x00, //      .@@=@#
+    0x00, 0x00, 0x00, 0xBF, 0xAF, 0x20, 0x00, 0x00, 0x00, //       @@@@:
+    0x00, 0x00, 0x00, 0x6F, 0xFD, 0x00, 0x00, 0x00, 0x00, //       *@@@
+    0x00, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, //       :@@%
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @11880 'W' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x0A, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF1, 0x00, //  @@=         @@.
+    0x08, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xE0, 0x00, //  %@*         @@
+    0x06, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x00, //  *@%        .@@
+    0x04, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xA0, 0x00, //  =@@        :@@
+    0x01, 0xFC, 0x00, 0x08, 0xF2, 0x00, 0x4F, 0x70, 0x00, //  .@@   %@:  =@#
+    0x00, 0xEE, 0x00, 0x0D, 0xF6, 0x00, 0x6F, 0x50, 0x00, //   @@   @@*  *@+
+    0x00, 0xCF, 0x10, 0x2F, 0xDA, 0x00, 0x8F, 0x30, 0x00, //   @@. :@@@  %@-
+    0x00, 0xAF, 0x30, 0x6E, 0x8E, 0x00, 0xAF, 0x10, 0x00, //   @@- *@%@  @@.
+    0x00, 0x7F, 0x50, 0xAB, 0x5F, 0x40, 0xBE, 0x00, 0x00, //   #@+ @@+@= @@
+    0x00, 0x5F, 0x70, 0xE7, 0x1F, 0x80, 0xDC, 0x00, 0x00, //   +@# @#.@% @@
+    0x00, 0x3F, 0x83, 0xF3, 0x0D, 0xC0, 0xF9, 0x00, 0x00, //   -@%-@- @@ @@
+    0x00, 0x0F, 0x97, 0xE0, 0x09, 0xF1, 0xF7, 0x00, 0x00, //    @@#@  @@.@#
+    0x00, 0x0D, 0xBB, 0xB0, 0x05, 0xF6, 0xF5, 0x00, 0x00, //    @@@@  +@*@+
+    0x00, 0x0B, 0xCE, 0x70, 0x01, 0xFB, 0xF3, 0x00, 0x00, //    @@@#  .@@@-
+    0x00, 0x09, 0xFF, 0x30, 0x00, 0xCF, 0xF1, 0x00, 0x00, //    @@@-   @@@.
+    0x00, 0x06, 0xFE, 0x00, 0x00, 0x8F, 0xE0, 0x00, 0x00, //    *@@    %@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @12096 'X' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x2F, 0xF2, 0x00, 0x00, 0x09, 0xF8, 0x00, 0x00, //   :@@:     @@%
+    0x00, 0x08, 0xF9, 0x00, 0x00, 0x2F, 0xE1, 0x00, 0x00, //    %@@    :@@.
+    0x00, 0x01, 0xEF, 0x30, 0x00, 0xAF, 0x60, 0x00, 0x00, //    .@@-   @@*
+    0x00, 0x00, 0x6F, 0xB0, 0x03, 0xFC, 0x00, 0x00, 0x00, //     *@@  -@@
+    0x00, 0x00, 0x0C, 0xF4, 0x0A, 0xF4, 0x00, 0x00, 0x00, //      @@= @@=
+    0x00, 0x00, 0x04, 0xFC, 0x3F, 0xB0, 0x00, 0x00, 0x00, //      =@@-@@
+    0x00, 0x00, 0x00, 0xBF, 0xDF, 0x20, 0x00, 0x00, 0x00, //       @@@@:
+    0x00, 0x00, 0x00, 0x3F, 0xF9, 0x00, 0x00, 0x00, 0x00, //       -@@@
+    0x00, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, //       #@@@
+    0x00, 0x00, 0x01, 0xED, 0xAF, 0x50, 0x00, 0x00, 0x00, //      .@@@@+
+    0x00, 0x00, 0x09, 0xF6, 0x2F, 0xD1, 0x00, 0x00, 0x00, //      @@*:@@.
+    0x00, 0x00, 0x2F, 0xD0, 0x09, 0xF8, 0x00, 0x00, 0x00, //     :@@  @@%
+    0x00, 0x00, 0xBF, 0x50, 0x01, 0xEF, 0x20, 0x00, 0x00, //     @@+  .@@:
+    0x00, 0x04, 0xFC, 0x00, 0x00, 0x7F, 0xA0, 0x00, 0x00, //    =@@    #@@
+    0x00, 0x0D, 0xF3, 0x00, 0x00, 0x1D, 0xF4, 0x00, 0x00, //    @@-    .@@=
+    0x00, 0x6F, 0xA0, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x00, //   *@@      *@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @12312 'Y' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0xCF, 0x40, 0x00, 0x00, 0x00, 0xCF, 0x30, 0x00, //   @@=       @@-
+    0x00, 0x5F, 0xC0, 0x00, 0x00, 0x05, 0xFB, 0x00, 0x00, //   +@@      +@@
+    0x00, 0x0C, 0xF4, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, //    @@=     @@-
+    0x00, 0x05, 0xFC, 0x00, 0x00, 0x4F, 0xA0, 0x00, 0x00, //    +@@    =@@
+    0x00, 0x00, 0xCF, 0x40, 0x00, 0xBF, 0x30, 0x00, 0x00, //     @@=   @@-
+    0x00, 0x00, 0x4F, 0xB0, 0x04, 0xFA, 0x00, 0x00, 0x00, //     =@@  =@@
+    0x00, 0x00, 0x0B, 0xF4, 0x0B, 0xF2, 0x00, 0x00, 0x00, //      @@= @@:
+    0x00, 0x00, 0x04, 0xFB, 0x3F, 0xA0, 0x00, 0x00, 0x00, //      =@@-@@
+    0x00, 0x00, 0x00, 0xBF, 0xDF, 0x20, 0x00, 0x00, 0x00, //       @@@@:
+    0x00, 0x00, 0x00, 0x3F, 0xF9, 0x00, 0x00, 0x00, 0x00, //       -@@@
+    0x00, 0x00, 0x00, 0x0D, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, //        @@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @12528 'Z' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, //    @@@@@@@@@@@
+    0x00, 0x07, 0xAA, 0xAA, 0xAA, 0xAE, 0xF9, 0x00, 0x00, //    #@@@@@@@@@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD1, 0x00, 0x00, //           -@@.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x40, 0x00, 0x00, //           @@=
+    0x00, 0x00, 0x00, 0x00, 0x08, 0xF9, 0x00, 0x00, 0x00, //          %@@
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0xD1, 0x00, 0x00, 0x00, //         -@@.
+    0x00, 0x00, 0x00, 0x00, 0xCF, 0x40, 0x00, 0x00, 0x00, //         @@=
+    0x00, 0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, //        %@%
+    0x00, 0x00, 0x00, 0x3F, 0xD1, 0x00, 0x00, 0x00, 0x00, //       -@@.
+    0x00, 0x00, 0x00, 0xDF, 0x30, 0x00, 0x00, 0x00, 0x00, //       @@-
+    0x00, 0x00, 0x08, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, //      %@%
+    0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, //     -@@
+    0x00, 0x01, 0xDF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, //    .@@-
+    0x00, 0x09, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    @@%
+    0x00, 0x3F, 0xFB, 0xBB, 0xBB, 0xBB, 0xBA, 0x00, 0x00, //   -@@@@@@@@@@@
+    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, //   #@@@@@@@@@@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @12744 '[' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xF1, 0x00, 0x00, //       @@@@@@@.
+    0x00, 0x00, 0x00, 0x9F, 0x22, 0x22, 0x20, 0x00, 0x00, //       @@:::::
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xF1, 0x00, 0x00, //       @@@@@@@.
+    0x00, 0x00, 0x00, 0x13, 0x33, 0x33, 0x30, 0x00, 0x00, //       .------
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @12960 '\' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x07, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    #@+
+    0x00, 0x01, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    .@@
+    0x00, 0x00, 0xAF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, //     @@:
+    0x00, 0x00, 0x5F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, //     +@#
+    0x00, 0x00, 0x0E, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, //      @@
+    0x00, 0x00, 0x09, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, //      @@-
+    0x00, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, //      -@@
+    0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 0x00, //       #@+
+    0x00, 0x00, 0x00, 0x1F, 0xB0, 0x00, 0x00, 0x00, 0x00, //       .@@
+    0x00, 0x00, 0x00, 0x0A, 0xF2, 0x00, 0x00, 0x00, 0x00, //        @@:
+    0x00, 0x00, 0x00, 0x05, 0xF7, 0x00, 0x00, 0x00, 0x00, //        +@#
+    0x00, 0x00, 0x00, 0x00, 0xED, 0x00, 0x00, 0x00, 0x00, //         @@
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x30, 0x00, 0x00, 0x00, //         @@-
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00, 0x00, //         -@@
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0xE0, 0x00, 0x00, 0x00, //          @@
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xF5, 0x00, 0x00, 0x00, //          #@+
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x00, 0x00, //          .@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x20, 0x00, 0x00, //           @@:
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x70, 0x00, 0x00, //           +@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xD0, 0x00, 0x00, //            @@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @13176 ']' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x09, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, //    @@@@@@@
+    0x00, 0x01, 0x22, 0x22, 0xAF, 0x00, 0x00, 0x00, 0x00, //    .::::@@
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, //         @@
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, //         @@
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, //         @@
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, //         @@
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, //         @@
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, //         @@
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, //         @@
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, //         @@
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, //         @@
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, //         @@
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, //         @@
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, //         @@
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, //         @@
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, //         @@
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, //         @@
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, //         @@
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, //         @@
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x00, 0x00, 0x00, 0x00, //         @@
+    0x00, 0x09, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, //    @@@@@@@
+    0x00, 0x02, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, //    :------
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @13392 '^' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x06, 0x81, 0x00, 0x00, 0x00, 0x00, //        *%.
+    0x00, 0x00, 0x00, 0x1F, 0xF7, 0x00, 0x00, 0x00, 0x00, //       .@@#
+    0x00, 0x00, 0x00, 0x7F, 0xCD, 0x00, 0x00, 0x00, 0x00, //       #@@@
+    0x00, 0x00, 0x00, 0xCB, 0x5F, 0x30, 0x00, 0x00, 0x00, //       @@+@-
+    0x00, 0x00, 0x03, 0xF6, 0x1E, 0x90, 0x00, 0x00, 0x00, //      -@*.@@
+    0x00, 0x00, 0x09, 0xF1, 0x0A, 0xE1, 0x00, 0x00, 0x00, //      @@. @@.
+    0x00, 0x00, 0x1E, 0xA0, 0x04, 0xF6, 0x00, 0x00, 0x00, //     .@@  =@*
+    0x00, 0x00, 0x6F, 0x50, 0x00, 0xDC, 0x00, 0x00, 0x00, //     *@+   @@
+    0x00, 0x00, 0xBE, 0x00, 0x00, 0x8F, 0x20, 0x00, 0x00, //     @@    %@:
+    0x00, 0x02, 0xF9, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, //    :@@    -@%
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @13608 '_' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x6B, 0xBB, 0xBB, 0xBB, 0xBB, 0xBA, 0x00, 0x00, //   *@@@@@@@@@@@
+    0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, //   %@@@@@@@@@@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @13824 '`' (17 pixels wide)
+    0x00, 0x00, 0x03, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, //      -%*
+    0x00, 0x00, 0x00, 0xBF, 0x30, 0x00, 0x00, 0x00, 0x00, //       @@-
+    0x00, 0x00, 0x00, 0x1D, 0xC0, 0x00, 0x00, 0x00, 0x00, //       .@@
+    0x00, 0x00, 0x00, 0x03, 0xE7, 0x00, 0x00, 0x00, 0x00, //        -@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @14040 'a' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x05, 0xAD, 0xFE, 0xB4, 0x00, 0x00, 0x00, //      +@@@@@=
+    0x00, 0x03, 0xDF, 0xEB, 0xAC, 0xFF, 0x50, 0x00, 0x00, //    -@@@@@@@@+
+    0x00, 0x02, 0xC5, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, //    :@+    #@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, //            @@-
+    0x00, 0x00, 0x00, 0x00, 0x25, 0x6C, 0xF5, 0x00, 0x00, //         :+*@@+
+    0x00, 0x00, 0x06, 0xBE, 0xFE, 0xDE, 0xF5, 0x00, 0x00, //      *@@@@@@@+
+    0x00, 0x02, 0xDF, 0xA5, 0x20, 0x09, 0xF5, 0x00, 0x00, //    :@@@+:  @@+
+    0x00, 0x0C, 0xF5, 0x00, 0x00, 0x09, 0xF5, 0x00, 0x00, //    @@+     @@+
+    0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0A, 0xF5, 0x00, 0x00, //    @@      @@+
+    0x00, 0x0E, 0xF3, 0x00, 0x02, 0xAF, 0xF5, 0x00, 0x00, //    @@-   :@@@+
+    0x00, 0x07, 0xFF, 0xB9, 0xBF, 0xB8, 0xF5, 0x00, 0x00, //    #@@@@@@@%@+
+    0x00, 0x00, 0x5C, 0xEE, 0xB5, 0x04, 0xF5, 0x00, 0x00, //     +@@@@+ =@+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @14256 'b' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    @@-
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    @@-
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    @@-
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    @@-
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    @@-
+    0x00, 0x0C, 0xF3, 0x3A, 0xEE, 0xC6, 0x00, 0x00, 0x00, //    @@--@@@@*
+    0x00, 0x0C, 0xFA, 0xFD, 0xAC, 0xFF, 0x90, 0x00, 0x00, //    @@@@@@@@@@
+    0x00, 0x0C, 0xFE, 0x50, 0x00, 0x4E, 0xF4, 0x00, 0x00, //    @@@+   =@@=
+    0x00, 0x0C, 0xF4, 0x00, 0x00, 0x08, 0xFA, 0x00, 0x00, //    @@=     %@@
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x04, 0xFD, 0x00, 0x00, //    @@-     =@@
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, //    @@-     :@@
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x02, 0xFD, 0x00, 0x00, //    @@-     :@@
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x00, //    @@-     =@@
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x0B, 0xF7, 0x00, 0x00, //    @@-     @@#
+    0x00, 0x0C, 0xFB, 0x20, 0x00, 0x8F, 0xE1, 0x00, 0x00, //    @@@:   %@@.
+    0x00, 0x0C, 0xFB, 0xFC, 0xBD, 0xFE, 0x40, 0x00, 0x00, //    @@@@@@@@@=
+    0x00, 0x0C, 0xD0, 0x6C, 0xFE, 0xA2, 0x00, 0x00, 0x00, //    @@ *@@@@:
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @14472 'c' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x6B, 0xEF, 0xD9, 0x30, 0x00, 0x00, //       *@@@@@-
+    0x00, 0x00, 0x2D, 0xFF, 0xBA, 0xCF, 0xF5, 0x00, 0x00, //     :@@@@@@@@+
+    0x00, 0x01, 0xDF, 0xA1, 0x00, 0x03, 0xB2, 0x00, 0x00, //    .@@@.   -@:
+    0x00, 0x08, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    %@@
+    0x00, 0x0D, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    @@-
+    0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    @@
+    0x00, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //   .@@
+    0x00, 0x0E, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    @@-
+    0x00, 0x09, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    @@@
+    0x00, 0x02, 0xEF, 0xA1, 0x00, 0x02, 0xB7, 0x00, 0x00, //    :@@@.   :@#
+    0x00, 0x00, 0x3E, 0xFE, 0xBA, 0xCF, 0xF7, 0x00, 0x00, //     -@@@@@@@@#
+    0x00, 0x00, 0x01, 0x7C, 0xEF, 0xD9, 0x30, 0x00, 0x00, //      .#@@@@@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @14688 'd' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, //            @@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, //            @@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, //            @@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, //            @@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, //            @@-
+    0x00, 0x00, 0x06, 0xCF, 0xE9, 0x2C, 0xF3, 0x00, 0x00, //      *@@@@:@@-
+    0x00, 0x00, 0xBF, 0xFB, 0xAE, 0xED, 0xF3, 0x00, 0x00, //     @@@@@@@@@-
+    0x00, 0x09, 0xFD, 0x20, 0x00, 0x7F, 0xF3, 0x00, 0x00, //    @@@:   #@@-
+    0x00, 0x2F, 0xF3, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, //   :@@-     @@-
+    0x00, 0x6F, 0xB0, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, //   *@@      @@-
+    0x00, 0x8F, 0x80, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, //   %@%      @@-
+    0x00, 0x8F, 0x80, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, //   %@%      @@-
+    0x00, 0x6F, 0xA0, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, //   *@@      @@-
+    0x00, 0x3F, 0xE1, 0x00, 0x00, 0x0D, 0xF3, 0x00, 0x00, //   -@@.     @@-
+    0x00, 0x0C, 0xFA, 0x10, 0x02, 0xBF, 0xF3, 0x00, 0x00, //    @@@.  :@@@-
+    0x00, 0x02, 0xEF, 0xEB, 0xBF, 0xCB, 0xF3, 0x00, 0x00, //    :@@@@@@@@@-
+    0x00, 0x00, 0x29, 0xDF, 0xD7, 0x08, 0xF3, 0x00, 0x00, //     :@@@@# %@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @14904 'e' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x02, 0x9D, 0xFE, 0xB4, 0x00, 0x00, 0x00, //      :@@@@@=
+    0x00, 0x00, 0x6F, 0xFB, 0x9B, 0xEF, 0x70, 0x00, 0x00, //     *@@@@@@@#
+    0x00, 0x04, 0xFD, 0x30, 0x00, 0x2C, 0xF4, 0x00, 0x00, //    =@@-   :@@=
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x03, 0xFA, 0x00, 0x00, //    @@-     -@@
+    0x00, 0x2F, 0xD2, 0x22, 0x22, 0x22, 0xFC, 0x00, 0x00, //   :@@:::::::@@
+    0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, //   =@@@@@@@@@@@
+    0x00, 0x5F, 0xC4, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, //   +@@=========
+    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //   :@@
+    0x00, 0x0D, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    @@*
+    0x00, 0x04, 0xFF, 0x60, 0x00, 0x02, 0x70, 0x00, 0x00, //    =@@*    :#
+    0x00, 0x00, 0x6F, 0xFD, 0xA9, 0xBF, 0xF3, 0x00, 0x00, //     *@@@@@@@@-
+    0x00, 0x00, 0x02, 0x9D, 0xFE, 0xD8, 0x20, 0x00, 0x00, //      :@@@@@%:
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @15120 'f' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x4B, 0xEF, 0xEB, 0x60, 0x00, //         =@@@@@*
+    0x00, 0x00, 0x00, 0x05, 0xFF, 0xCA, 0xAD, 0x90, 0x00, //        +@@@@@@@
+    0x00, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x10, 0x00, //        @@+    .
+    0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x00, //       :@@
+    0x00, 0x00, 0x00, 0x3F, 0xB0, 0x00, 0x00, 0x00, 0x00, //       -@@
+    0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, //    %@@@@@@@@@@
+    0x00, 0x05, 0x99, 0xAF, 0xE9, 0x99, 0x96, 0x00, 0x00, //    +@@@@@@@@@*
+    0x00, 0x00, 0x00, 0x3F, 0xB0, 0x00, 0x00, 0x00, 0x00, //       -@@
+    0x00, 0x00, 0x00, 0x3F, 0xB0, 0x00, 0x00, 0x00, 0x00, //       -@@
+    0x00, 0x00, 0x00, 0x3F, 0xB0, 0x00, 0x00, 0x00, 0x00, //       -@@
+    0x00, 0x00, 0x00, 0x3F, 0xB0, 0x00, 0x00, 0x00, 0x00, //       -@@
+    0x00, 0x00, 0x00, 0x3F, 0xB0, 0x00, 0x00, 0x00, 0x00, //       -@@
+    0x00, 0x00, 0x00, 0x3F, 0xB0, 0x00, 0x00, 0x00, 0x00, //       -@@
+    0x00, 0x00, 0x00, 0x3F, 0xB0, 0x00, 0x00, 0x00, 0x00, //       -@@
+    0x00, 0x00, 0x00, 0x3F, 0xB0, 0x00, 0x00, 0x00, 0x00, //       -@@
+    0x00, 0x00, 0x00, 0x3F, 0xB0, 0x00, 0x00, 0x00, 0x00, //       -@@
+    0x00, 0x00, 0x00, 0x3F, 0xB0, 0x00, 0x00, 0x00, 0x00, //       -@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @15336 'g' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x04, 0xBE, 0xFF, 0xFF, 0xFF, 0x80, 0x00, //      =@@@@@@@@%
+    0x00, 0x00, 0x7F, 0xD8, 0x8E, 0xFC, 0x88, 0x40, 0x00, //     #@@%%@@@%%=
+    0x00, 0x03, 0xFD, 0x10, 0x01, 0xDE, 0x20, 0x00, 0x00, //    -@@.  .@@:
+    0x00, 0x08, 0xF6, 0x00, 0x00, 0x7F, 0x60, 0x00, 0x00, //    %@*    #@*
+    0x00, 0x08, 0xF5, 0x00, 0x00, 0x6F, 0x70, 0x00, 0x00, //    %@+    *@#
+    0x00, 0x05, 0xFA, 0x00, 0x00, 0xAF, 0x40, 0x00, 0x00, //    +@@    @@=
+    0x00, 0x00, 0xCF, 0x82, 0x28, 0xFB, 0x00, 0x00, 0x00, //     @@%::%@@
+    0x00, 0x00, 0x7F, 0xEF, 0xFF, 0x81, 0x00, 0x00, 0x00, //     #@@@@@%.
+    0x00, 0x04, 0xF6, 0x03, 0x31, 0x00, 0x00, 0x00, 0x00, //    =@* --.
+    0x00, 0x08, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    %@=
+    0x00, 0x03, 0xEF, 0xBA, 0xAA, 0x98, 0x61, 0x00, 0x00, //    -@@@@@@@%*.
+    0x00, 0x00, 0xAE, 0xEF, 0xFF, 0xFF, 0xFE, 0x20, 0x00, //     @@@@@@@@@@:
+    0x00, 0x0B, 0xD2, 0x00, 0x00, 0x02, 0xBF, 0x80, 0x00, //    @@:     :@@%
+    0x00, 0x3F, 0x70, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, //   -@#       *@%
+    0x00, 0x2F, 0xC1, 0x00, 0x00, 0x02, 0xDE, 0x20, 0x00, //   :@@.     :@@:
+    0x00, 0x0A, 0xFD, 0x86, 0x67, 0xBF, 0xE4, 0x00, 0x00, //    @@@%**#@@@=
+    0x00, 0x00, 0x5B, 0xDF, 0xFE, 0xB6, 0x10, 0x00, 0x00, //     +@@@@@@*.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @15552 'h' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    @@-
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    @@-
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    @@-
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    @@-
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    @@-
+    0x00, 0x0C, 0xF3, 0x18, 0xDF, 0xD9, 0x10, 0x00, 0x00, //    @@-.%@@@@.
+    0x00, 0x0C, 0xF4, 0xDF, 0xCC, 0xFF, 0xB0, 0x00, 0x00, //    @@=@@@@@@@
+    0x00, 0x0C, 0xFE, 0xA1, 0x00, 0x3F, 0xF3, 0x00, 0x00, //    @@@@.  -@@-
+    0x00, 0x0C, 0xF8, 0x00, 0x00, 0x0A, 0xF7, 0x00, 0x00, //    @@%     @@#
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, //    @@-     #@%
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, //    @@-     *@%
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, //    @@-     *@%
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, //    @@-     *@%
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, //    @@-     *@%
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, //    @@-     *@%
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, //    @@-     *@%
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, //    @@-     *@%
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @15768 'i' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0xBE, 0x70, 0x00, 0x00, 0x00, //         @@#
+    0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, //        -@@@
+    0x00, 0x00, 0x00, 0x00, 0xCF, 0x80, 0x00, 0x00, 0x00, //         @@%
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, //    @@@@@@@%
+    0x00, 0x08, 0x99, 0x99, 0xCF, 0x80, 0x00, 0x00, 0x00, //    %@@@@@@%
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, //         *@%
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, //         *@%
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, //         *@%
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, //         *@%
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, //         *@%
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, //         *@%
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, //         *@%
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, //         *@%
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, //         *@%
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, //         *@%
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @15984 'j' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0xBE, 0x70, 0x00, 0x00, 0x00, //         @@#
+    0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x00, 0x00, 0x00, //        -@@@
+    0x00, 0x00, 0x00, 0x00, 0xCF, 0x80, 0x00, 0x00, 0x00, //         @@%
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, //    @@@@@@@%
+    0x00, 0x08, 0x99, 0x99, 0xCF, 0x80, 0x00, 0x00, 0x00, //    %@@@@@@%
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, //         *@%
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, //         *@%
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, //         *@%
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, //         *@%
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, //         *@%
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, //         *@%
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, //         *@%
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, //         *@%
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, //         *@%
+    0x00, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x00, 0x00, //         *@%
+    0x00, 0x00, 0x00, 0x00, 0x7F, 0x70, 0x00, 0x00, 0x00, //         #@#
+    0x00, 0x00, 0x00, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, //         @@*
+    0x00, 0x01, 0x00, 0x02, 0xEF, 0x20, 0x00, 0x00, 0x00, //    .   :@@:
+    0x00, 0x6F, 0xCA, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, //   *@@@@@@%
+    0x00, 0x39, 0xDF, 0xEC, 0x60, 0x00, 0x00, 0x00, 0x00, //   -@@@@@*
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @16200 'k' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    #@%
+    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    #@%
+    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    #@%
+    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    #@%
+    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    #@%
+    0x00, 0x07, 0xF8, 0x00, 0x00, 0x09, 0xFA, 0x00, 0x00, //    #@%     @@@
+    0x00, 0x07, 0xF8, 0x00, 0x00, 0x9F, 0xA0, 0x00, 0x00, //    #@%    @@@
+    0x00, 0x07, 0xF8, 0x00, 0x09, 0xFA, 0x00, 0x00, 0x00, //    #@%   @@@
+    0x00, 0x07, 0xF8, 0x00, 0x9F, 0xB0, 0x00, 0x00, 0x00, //    #@%  @@@
+    0x00, 0x07, 0xF8, 0x09, 0xFC, 0x00, 0x00, 0x00, 0x00, //    #@% @@@
+    0x00, 0x07, 0xF8, 0x8F, 0xFE, 0x20, 0x00, 0x00, 0x00, //    #@%%@@@:
+    0x00, 0x07, 0xFE, 0xFB, 0x6F, 0xB0, 0x00, 0x00, 0x00, //    #@@@@*@@
+    0x00, 0x07, 0xFF, 0xB0, 0x0A, 0xF7, 0x00, 0x00, 0x00, //    #@@@  @@#
+    0x00, 0x07, 0xFB, 0x00, 0x01, 0xDF, 0x40, 0x00, 0x00, //    #@@   .@@=
+    0x00, 0x07, 0xF8, 0x00, 0x00, 0x4F, 0xD1, 0x00, 0x00, //    #@%    =@@.
+    0x00, 0x07, 0xF8, 0x00, 0x00, 0x08, 0xFA, 0x00, 0x00, //    #@%     %@@
+    0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0xCF, 0x60, 0x00, //    #@%      @@*
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @16416 'l' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x1F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, //   .@@@@@@
+    0x00, 0x19, 0x99, 0xAF, 0xD0, 0x00, 0x00, 0x00, 0x00, //   .@@@@@@
+    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, //       .@@
+    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, //       .@@
+    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, //       .@@
+    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, //       .@@
+    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, //       .@@
+    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, //       .@@
+    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, //       .@@
+    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, //       .@@
+    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, //       .@@
+    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, //       .@@
+    0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x00, 0x00, //       .@@
+    0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x01, 0x00, 0x00, //        @@+   .
+    0x00, 0x00, 0x00, 0x06, 0xFF, 0xBA, 0xD9, 0x00, 0x00, //        *@@@@@@
+    0x00, 0x00, 0x00, 0x00, 0x6D, 0xFE, 0xB6, 0x00, 0x00, //         *@@@@*
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @16632 'm' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x8F, 0x19, 0xED, 0x40, 0x9E, 0xD4, 0x00, 0x00, //   %@.@@@= @@@=
+    0x00, 0x8F, 0xAE, 0xCF, 0xD9, 0xDC, 0xFE, 0x00, 0x00, //   %@@@@@@@@@@@
+    0x00, 0x8F, 0xD1, 0x0A, 0xFC, 0x10, 0xCF, 0x30, 0x00, //   %@@. @@@. @@-
+    0x00, 0x8F, 0x60, 0x07, 0xF4, 0x00, 0x9F, 0x50, 0x00, //   %@*  #@=  @@+
+    0x00, 0x8F, 0x50, 0x06, 0xF3, 0x00, 0x8F, 0x50, 0x00, //   %@+  *@-  %@+
+    0x00, 0x8F, 0x50, 0x06, 0xF3, 0x00, 0x8F, 0x50, 0x00, //   %@+  *@-  %@+
+    0x00, 0x8F, 0x50, 0x06, 0xF3, 0x00, 0x8F, 0x50, 0x00, //   %@+  *@-  %@+
+    0x00, 0x8F, 0x50, 0x06, 0xF3, 0x00, 0x8F, 0x50, 0x00, //   %@+  *@-  %@+
+    0x00, 0x8F, 0x50, 0x06, 0xF3, 0x00, 0x8F, 0x50, 0x00, //   %@+  *@-  %@+
+    0x00, 0x8F, 0x50, 0x06, 0xF3, 0x00, 0x8F, 0x50, 0x00, //   %@+  *@-  %@+
+    0x00, 0x8F, 0x50, 0x06, 0xF3, 0x00, 0x8F, 0x50, 0x00, //   %@+  *@-  %@+
+    0x00, 0x8F, 0x50, 0x06, 0xF3, 0x00, 0x8F, 0x50, 0x00, //   %@+  *@-  %@+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @16848 'n' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x0C, 0xD0, 0x18, 0xDF, 0xD9, 0x10, 0x00, 0x00, //    @@ .%@@@@.
+    0x00, 0x0C, 0xF2, 0xDF, 0xCC, 0xFF, 0xB0, 0x00, 0x00, //    @@:@@@@@@@
+    0x00, 0x0C, 0xFE, 0xA1, 0x00, 0x3F, 0xF3, 0x00, 0x00, //    @@@@.  -@@-
+    0x00, 0x0C, 0xF8, 0x00, 0x00, 0x0A, 0xF7, 0x00, 0x00, //    @@%     @@#
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x07, 0xF8, 0x00, 0x00, //    @@-     #@%
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, //    @@-     *@%
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, //    @@-     *@%
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, //    @@-     *@%
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, //    @@-     *@%
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, //    @@-     *@%
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, //    @@-     *@%
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, //    @@-     *@%
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @17064 'o' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x05, 0xBE, 0xFD, 0x81, 0x00, 0x00, 0x00, //      +@@@@%.
+    0x00, 0x00, 0xAF, 0xFB, 0xAD, 0xFE, 0x30, 0x00, 0x00, //     @@@@@@@@-
+    0x00, 0x08, 0xFC, 0x20, 0x00, 0x8F, 0xD1, 0x00, 0x00, //    %@@:   %@@.
+    0x00, 0x1F, 0xF2, 0x00, 0x00, 0x0B, 0xF7, 0x00, 0x00, //   .@@:     @@#
+    0x00, 0x6F, 0xB0, 0x00, 0x00, 0x04, 0xFC, 0x00, 0x00, //   *@@      =@@
+    0x00, 0x8F, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, //   %@%      :@@
+    0x00, 0x8F, 0x80, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, //   %@%      :@@
+    0x00, 0x6F, 0xA0, 0x00, 0x00, 0x04, 0xFC, 0x00, 0x00, //   *@@      =@@
+    0x00, 0x2F, 0xF2, 0x00, 0x00, 0x0B, 0xF7, 0x00, 0x00, //   :@@:     @@#
+    0x00, 0x08, 0xFC, 0x20, 0x00, 0x8F, 0xE1, 0x00, 0x00, //    %@@:   %@@.
+    0x00, 0x00, 0xAF, 0xFB, 0xAD, 0xFE, 0x30, 0x00, 0x00, //     @@@@@@@@-
+    0x00, 0x00, 0x05, 0xBE, 0xFD, 0x81, 0x00, 0x00, 0x00, //      +@@@@%.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @17280 'p' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x0C, 0xE0, 0x3A, 0xEE, 0xC6, 0x00, 0x00, 0x00, //    @@ -@@@@*
+    0x00, 0x0C, 0xF8, 0xFD, 0xAC, 0xFF, 0x90, 0x00, 0x00, //    @@%@@@@@@@
+    0x00, 0x0C, 0xFE, 0x50, 0x00, 0x4E, 0xF4, 0x00, 0x00, //    @@@+   =@@=
+    0x00, 0x0C, 0xF4, 0x00, 0x00, 0x08, 0xFA, 0x00, 0x00, //    @@=     %@@
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x04, 0xFD, 0x00, 0x00, //    @@-     =@@
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, //    @@-     :@@
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, //    @@-     :@@
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x00, //    @@-     =@@
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x0A, 0xF7, 0x00, 0x00, //    @@-     @@#
+    0x00, 0x0C, 0xFB, 0x20, 0x00, 0x7F, 0xE1, 0x00, 0x00, //    @@@:   #@@.
+    0x00, 0x0C, 0xFC, 0xFC, 0xBD, 0xFE, 0x40, 0x00, 0x00, //    @@@@@@@@@=
+    0x00, 0x0C, 0xF3, 0x6C, 0xFE, 0xA2, 0x00, 0x00, 0x00, //    @@-*@@@@:
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    @@-
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    @@-
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    @@-
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    @@-
+    0x00, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    @@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @17496 'q' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x06, 0xCF, 0xE9, 0x27, 0xF3, 0x00, 0x00, //      *@@@@:#@-
+    0x00, 0x00, 0xBF, 0xFB, 0xAE, 0xEC, 0xF3, 0x00, 0x00, //     @@@@@@@@@-
+    0x00, 0x09, 0xFD, 0x20, 0x00, 0x7F, 0xF3, 0x00, 0x00, //    @@@:   #@@-
+    0x00, 0x2F, 0xF3, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, //   :@@-     @@-
+    0x00, 0x6F, 0xB0, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, //   *@@      @@-
+    0x00, 0x8F, 0x80, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, //   %@%      @@-
+    0x00, 0x8F, 0x80, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, //   %@%      @@-
+    0x00, 0x6F, 0xA0, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, //   *@@      @@-
+    0x00, 0x3F, 0xE1, 0x00, 0x00, 0x0D, 0xF3, 0x00, 0x00, //   -@@.     @@-
+    0x00, 0x0C, 0xFA, 0x10, 0x02, 0xBF, 0xF3, 0x00, 0x00, //    @@@.  :@@@-
+    0x00, 0x02, 0xEF, 0xEB, 0xBF, 0xCC, 0xF3, 0x00, 0x00, //    :@@@@@@@@@-
+    0x00, 0x00, 0x29, 0xDF, 0xD7, 0x0B, 0xF3, 0x00, 0x00, //     :@@@@# @@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, //            @@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, //            @@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, //            @@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, //            @@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xF3, 0x00, 0x00, //            @@-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @17712 'r' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x8F, 0x20, 0x28, 0xDF, 0xEA, 0x00, 0x00, //     %@: :%@@@@
+    0x00, 0x00, 0x8F, 0x34, 0xEF, 0xEC, 0xE9, 0x00, 0x00, //     %@-=@@@@@@
+    0x00, 0x00, 0x8F, 0x7F, 0xB3, 0x00, 0x01, 0x00, 0x00, //     %@#@@-   .
+    0x00, 0x00, 0x8F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, //     %@@@
+    0x00, 0x00, 0x8F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, //     %@@
+    0x00, 0x00, 0x8F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, //     %@#
+    0x00, 0x00, 0x8F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, //     %@#
+    0x00, 0x00, 0x8F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, //     %@#
+    0x00, 0x00, 0x8F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, //     %@#
+    0x00, 0x00, 0x8F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, //     %@#
+    0x00, 0x00, 0x8F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, //     %@#
+    0x00, 0x00, 0x8F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, //     %@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @17928 's' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x18, 0xCE, 0xFD, 0xA4, 0x00, 0x00, 0x00, //     .%@@@@@=
+    0x00, 0x01, 0xDF, 0xD9, 0x9A, 0xEF, 0xA0, 0x00, 0x00, //    .@@@@@@@@@
+    0x00, 0x07, 0xFA, 0x00, 0x00, 0x17, 0x30, 0x00, 0x00, //    #@@    .#-
+    0x00, 0x08, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //    %@@
+    0x00, 0x02, 0xEF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, //    :@@@=
+    0x00, 0x00, 0x2A, 0xFF, 0xEA, 0x51, 0x00, 0x00, 0x00, //     :@@@@@+.
+    0x00, 0x00, 0x00, 0x16, 0xAE, 0xFE, 0x60, 0x00, 0x00, //       .*@@@@*
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xF5, 0x00, 0x00, //           +@@+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF9, 0x00, 0x00, //            #@@
+    0x00, 0x0B, 0x92, 0x00, 0x00, 0x0B, 0xF7, 0x00, 0x00, //    @@:     @@#
+    0x00, 0x19, 0xFF, 0xC9, 0x8A, 0xEF, 0xB0, 0x00, 0x00, //   .@@@@@%@@@@
+    0x00, 0x00, 0x28, 0xCE, 0xFE, 0xB6, 0x00, 0x00, 0x00, //     :%@@@@@*
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @18144 't' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, //       *#
+    0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, //   +@@@@@@@@@@@
+    0x00, 0x38, 0x89, 0xFE, 0x88, 0x88, 0x85, 0x00, 0x00, //   -%%@@@%%%%%+
+    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, //      .@@
+    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, //      .@@
+    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, //      .@@
+    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, //      .@@
+    0x00, 0x00, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, //      .@@
+    0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, //       @@
+    0x00, 0x00, 0x00, 0xEF, 0x10, 0x00, 0x00, 0x00, 0x00, //       @@.
+    0x00, 0x00, 0x00, 0xAF, 0x90, 0x00, 0x01, 0x00, 0x00, //       @@@    .
+    0x00, 0x00, 0x00, 0x3E, 0xFD, 0xAA, 0xCD, 0x00, 0x00, //       -@@@@@@@
+    0x00, 0x00, 0x00, 0x03, 0xAE, 0xFD, 0xB7, 0x00, 0x00, //        -@@@@@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @18360 'u' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0D, 0xF2, 0x00, 0x00, //   :@@      @@:
+    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0D, 0xF2, 0x00, 0x00, //   :@@      @@:
+    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0D, 0xF2, 0x00, 0x00, //   :@@      @@:
+    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0D, 0xF2, 0x00, 0x00, //   :@@      @@:
+    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0D, 0xF2, 0x00, 0x00, //   :@@      @@:
+    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0D, 0xF2, 0x00, 0x00, //   :@@      @@:
+    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0D, 0xF2, 0x00, 0x00, //   :@@      @@:
+    0x00, 0x2F, 0xD0, 0x00, 0x00, 0x0D, 0xF2, 0x00, 0x00, //   :@@      @@:
+    0x00, 0x1F, 0xF1, 0x00, 0x00, 0x4F, 0xF2, 0x00, 0x00, //   .@@.    =@@:
+    0x00, 0x0D, 0xF9, 0x00, 0x06, 0xEE, 0xF2, 0x00, 0x00, //    @@@   *@@@:
+    0x00, 0x06, 0xFF, 0xDB, 0xDF, 0x69, 0xF2, 0x00, 0x00, //    *@@@@@@*@@:
+    0x00, 0x00, 0x6C, 0xFE, 0xA3, 0x08, 0xF2, 0x00, 0x00, //     *@@@@- %@:
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @18576 'v' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, 0xEE, 0x10, 0x00, //   @@*       @@.
+    0x00, 0x3F, 0xC0, 0x00, 0x00, 0x05, 0xF9, 0x00, 0x00, //   -@@      +@@
+    0x00, 0x0B, 0xF3, 0x00, 0x00, 0x0B, 0xF3, 0x00, 0x00, //    @@-     @@-
+    0x00, 0x05, 0xF9, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, //    +@@    :@@
+    0x00, 0x00, 0xEE, 0x10, 0x00, 0x7F, 0x50, 0x00, 0x00, //     @@.   #@+
+    0x00, 0x00, 0x8F, 0x60, 0x00, 0xDE, 0x00, 0x00, 0x00, //     %@*   @@
+    0x00, 0x00, 0x2F, 0xC0, 0x04, 0xF8, 0x00, 0x00, 0x00, //     :@@  =@%
+    0x00, 0x00, 0x0B, 0xF2, 0x0A, 0xF2, 0x00, 0x00, 0x00, //      @@: @@:
+    0x00, 0x00, 0x04, 0xF8, 0x1F, 0xB0, 0x00, 0x00, 0x00, //      =@%.@@
+    0x00, 0x00, 0x00, 0xDD, 0x6F, 0x50, 0x00, 0x00, 0x00, //       @@*@+
+    0x00, 0x00, 0x00, 0x7F, 0xEE, 0x00, 0x00, 0x00, 0x00, //       #@@@
+    0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, //       .@@%
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @18792 'w' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x0B, 0xF5, 0x00, 0x03, 0x41, 0x00, 0x0B, 0xF1, 0x00, //  @@+   -=.   @@.
+    0x07, 0xF8, 0x00, 0x0C, 0xF4, 0x00, 0x0E, 0xD0, 0x00, //  #@%   @@=   @@
+    0x04, 0xFB, 0x00, 0x0F, 0xD8, 0x00, 0x3F, 0xA0, 0x00, //  =@@   @@%  -@@
+    0x01, 0xFE, 0x00, 0x4E, 0x8B, 0x00, 0x6F, 0x70, 0x00, //  .@@  =@%@  *@#
+    0x00, 0xDF, 0x20, 0x7C, 0x6E, 0x00, 0x9F, 0x40, 0x00, //   @@: #@*@  @@=
+    0x00, 0x9F, 0x50, 0xA9, 0x3F, 0x30, 0xCF, 0x10, 0x00, //   @@+ @@-@- @@.
+    0x00, 0x6F, 0x80, 0xE6, 0x0E, 0x60, 0xFC, 0x00, 0x00, //   *@% @* @* @@
+    0x00, 0x3F, 0xB2, 0xF2, 0x0B, 0xA3, 0xF9, 0x00, 0x00, //   -@@:@: @@-@@
+    0x00, 0x0E, 0xE5, 0xE0, 0x08, 0xD5, 0xF6, 0x00, 0x00, //    @@+@  %@+@*
+    0x00, 0x0B, 0xF9, 0xB0, 0x04, 0xF9, 0xF3, 0x00, 0x00, //    @@@@  =@@@-
+    0x00, 0x08, 0xFE, 0x70, 0x01, 0xFE, 0xE0, 0x00, 0x00, //    %@@#  .@@@
+    0x00, 0x04, 0xFF, 0x40, 0x00, 0xDF, 0xB0, 0x00, 0x00, //    =@@=   @@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @19008 'x' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x0B, 0xF6, 0x00, 0x00, 0x1D, 0xF3, 0x00, 0x00, //    @@*    .@@-
+    0x00, 0x02, 0xEE, 0x20, 0x00, 0x9F, 0x70, 0x00, 0x00, //    :@@:   @@#
+    0x00, 0x00, 0x5F, 0xC0, 0x04, 0xFC, 0x00, 0x00, 0x00, //     +@@  =@@
+    0x00, 0x00, 0x0A, 0xF7, 0x0D, 0xE2, 0x00, 0x00, 0x00, //      @@# @@:
+    0x00, 0x00, 0x01, 0xDF, 0xAF, 0x60, 0x00, 0x00, 0x00, //      .@@@@*
+    0x00, 0x00, 0x00, 0x4F, 0xFA, 0x00, 0x00, 0x00, 0x00, //       =@@@
+    0x00, 0x00, 0x00, 0x8F, 0xFB, 0x00, 0x00, 0x00, 0x00, //       %@@@
+    0x00, 0x00, 0x04, 0xFB, 0x9F, 0x80, 0x00, 0x00, 0x00, //      =@@@@%
+    0x00, 0x00, 0x1E, 0xE2, 0x1D, 0xF4, 0x00, 0x00, 0x00, //     .@@:.@@=
+    0x00, 0x00, 0xAF, 0x60, 0x03, 0xFE, 0x10, 0x00, 0x00, //     @@*  -@@.
+    0x00, 0x06, 0xFA, 0x00, 0x00, 0x6F, 0xB0, 0x00, 0x00, //    *@@    *@@
+    0x00, 0x2E, 0xE1, 0x00, 0x00, 0x0A, 0xF7, 0x00, 0x00, //   :@@.     @@#
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @19224 'y' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, 0xDE, 0x10, 0x00, //   @@*       @@.
+    0x00, 0x2F, 0xC0, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x00, //   :@@      -@@
+    0x00, 0x0A, 0xF4, 0x00, 0x00, 0x09, 0xF3, 0x00, 0x00, //    @@=     @@-
+    0x00, 0x03, 0xFA, 0x00, 0x00, 0x1E, 0xC0, 0x00, 0x00, //    -@@    .@@
+    0x00, 0x00, 0xCF, 0x20, 0x00, 0x6F, 0x60, 0x00, 0x00, //     @@:   *@*
+    0x00, 0x00, 0x5F, 0x80, 0x00, 0xCE, 0x10, 0x00, 0x00, //     +@%   @@.
+    0x00, 0x00, 0x0D, 0xE1, 0x02, 0xF9, 0x00, 0x00, 0x00, //      @@. :@@
+    0x00, 0x00, 0x06, 0xF6, 0x08, 0xF3, 0x00, 0x00, 0x00, //      *@* %@-
+    0x00, 0x00, 0x00, 0xEC, 0x0D, 0xD0, 0x00, 0x00, 0x00, //       @@ @@
+    0x00, 0x00, 0x00, 0x7F, 0x7F, 0x70, 0x00, 0x00, 0x00, //       #@#@#
+    0x00, 0x00, 0x00, 0x1E, 0xFF, 0x10, 0x00, 0x00, 0x00, //       .@@@.
+    0x00, 0x00, 0x00, 0x09, 0xFA, 0x00, 0x00, 0x00, 0x00, //        @@@
+    0x00, 0x00, 0x00, 0x09, 0xF4, 0x00, 0x00, 0x00, 0x00, //        @@=
+    0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, //       :@@
+    0x00, 0x00, 0x01, 0xCF, 0x40, 0x00, 0x00, 0x00, 0x00, //      .@@=
+    0x00, 0x1B, 0xBE, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, //   .@@@@%
+    0x00, 0x4E, 0xFC, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, //   =@@@+
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @19440 'z' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, //    *@@@@@@@@@%
+    0x00, 0x04, 0x99, 0x99, 0x99, 0xCF, 0xE3, 0x00, 0x00, //    =@@@@@@@@@-
+    0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0x50, 0x00, 0x00, //          :@@+
+    0x00, 0x00, 0x00, 0x00, 0x1D, 0xF7, 0x00, 0x00, 0x00, //         .@@#
+    0x00, 0x00, 0x00, 0x00, 0xBF, 0x90, 0x00, 0x00, 0x00, //         @@@
+    0x00, 0x00, 0x00, 0x09, 0xFB, 0x00, 0x00, 0x00, 0x00, //        @@@
+    0x00, 0x00, 0x00, 0x7F, 0xC1, 0x00, 0x00, 0x00, 0x00, //       #@@.
+    0x00, 0x00, 0x05, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, //      +@@:
+    0x00, 0x00, 0x4F, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, //     =@@-
+    0x00, 0x02, 0xEF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, //    :@@=
+    0x00, 0x1D, 0xFD, 0x99, 0x99, 0x99, 0x97, 0x00, 0x00, //   .@@@@@@@@@@#
+    0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, //   =@@@@@@@@@@@
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @19656 '{' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x6C, 0xEF, 0xF1, 0x00, 0x00, //         *@@@@.
+    0x00, 0x00, 0x00, 0x07, 0xFA, 0x43, 0x20, 0x00, 0x00, //        #@@=-:
+    0x00, 0x00, 0x00, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0C, 0xD0, 0x00, 0x00, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0B, 0xE0, 0x00, 0x00, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x13, 0x9F, 0x80, 0x00, 0x00, 0x00, 0x00, //     .-@@%
+    0x00, 0x02, 0xFF, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, //    :@@@#
+    0x00, 0x00, 0x46, 0xBF, 0x60, 0x00, 0x00, 0x00, 0x00, //     =*@@*
+    0x00, 0x00, 0x00, 0x0C, 0xD0, 0x00, 0x00, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0A, 0xE0, 0x00, 0x00, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0B, 0xD0, 0x00, 0x00, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0C, 0xD0, 0x00, 0x00, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0x00, //        @@
+    0x00, 0x00, 0x00, 0x08, 0xF8, 0x10, 0x00, 0x00, 0x00, //        %@%.
+    0x00, 0x00, 0x00, 0x01, 0x9E, 0xFF, 0xF1, 0x00, 0x00, //        .@@@@@.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x30, 0x00, 0x00, //           ::-
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @19872 '|' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0x00, //        @@.
+    0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0x00, //        @@.
+    0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0x00, //        @@.
+    0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0x00, //        @@.
+    0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0x00, //        @@.
+    0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0x00, //        @@.
+    0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0x00, //        @@.
+    0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0x00, //        @@.
+    0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0x00, //        @@.
+    0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0x00, //        @@.
+    0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0x00, //        @@.
+    0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0x00, //        @@.
+    0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0x00, //        @@.
+    0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0x00, //        @@.
+    0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0x00, //        @@.
+    0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0x00, //        @@.
+    0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0x00, //        @@.
+    0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0x00, //        @@.
+    0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0x00, //        @@.
+    0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0x00, //        @@.
+    0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0x00, //        @@.
+    0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0x00, //        @@.
+    0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0x00, //        @@.
+    0x00, 0x00, 0x00, 0x0A, 0xF1, 0x00, 0x00, 0x00, 0x00, //        @@.
+    // @20088 '}' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x09, 0xFF, 0xD9, 0x20, 0x00, 0x00, 0x00, 0x00, //    @@@@@:
+    0x00, 0x01, 0x23, 0x6E, 0xD0, 0x00, 0x00, 0x00, 0x00, //    .:-*@@
+    0x00, 0x00, 0x00, 0x08, 0xF3, 0x00, 0x00, 0x00, 0x00, //        %@-
+    0x00, 0x00, 0x00, 0x06, 0xF3, 0x00, 0x00, 0x00, 0x00, //        *@-
+    0x00, 0x00, 0x00, 0x07, 0xF3, 0x00, 0x00, 0x00, 0x00, //        #@-
+    0x00, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x00, 0x00, //        #@:
+    0x00, 0x00, 0x00, 0x08, 0xF2, 0x00, 0x00, 0x00, 0x00, //        %@:
+    0x00, 0x00, 0x00, 0x08, 0xF1, 0x00, 0x00, 0x00, 0x00, //        %@.
+    0x00, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x00, 0x00, //        #@:
+    0x00, 0x00, 0x00, 0x03, 0xFC, 0x41, 0x00, 0x00, 0x00, //        -@@=.
+    0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0x80, 0x00, 0x00, //         -@@@%
+    0x00, 0x00, 0x00, 0x02, 0xDE, 0x74, 0x20, 0x00, 0x00, //        :@@#=:
+    0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 0x00, //        #@=
+    0x00, 0x00, 0x00, 0x08, 0xF1, 0x00, 0x00, 0x00, 0x00, //        %@.
+    0x00, 0x00, 0x00, 0x08, 0xF1, 0x00, 0x00, 0x00, 0x00, //        %@.
+    0x00, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x00, 0x00, //        #@:
+    0x00, 0x00, 0x00, 0x07, 0xF3, 0x00, 0x00, 0x00, 0x00, //        #@-
+    0x00, 0x00, 0x00, 0x06, 0xF4, 0x00, 0x00, 0x00, 0x00, //        *@=
+    0x00, 0x00, 0x00, 0x07, 0xF3, 0x00, 0x00, 0x00, 0x00, //        #@-
+    0x00, 0x00, 0x00, 0x3E, 0xE0, 0x00, 0x00, 0x00, 0x00, //       -@@
+    0x00, 0x09, 0xFF, 0xFC, 0x30, 0x00, 0x00, 0x00, 0x00, //    @@@@@-
+    0x00, 0x02, 0x32, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, //    :-:.
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    // @20304 '~' (17 pixels wide)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, //      ..     .
+    0x00, 0x00, 0x9F, 0xFC, 0x40, 0x02, 0xE5, 0x00, 0x00, //     @@@@=  :@+
+    0x00, 0x09, 0xE7, 0x6D, 0xFB, 0x8D, 0xD1, 0x00, 0x00, //    @@#*@@@%@@.
+    0x00, 0x0C, 0x60, 0x00, 0x7D, 0xEB, 0x20, 0x00, 0x00, //    @*   #@@@:
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, //
+};
+
+sFONT_AA Font24Aa = {17, /* Width */
+                     24, /* Height */
+                     Font24Aa_Table};
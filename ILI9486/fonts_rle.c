@@ -0,0 +1,990 @@
+/*
+ * fonts_rle.c
+ *
+ * Generated by Tools/font_rle from font8.c ... font24.c, do not edit.
+ * Run-length encoded glyphs, see sFONT_RLE in fonts.h.
+ */
+
+#include "fonts.h"
+
+static const uint8_t Font8_Runs[567] = {
+    0x04, 0x11, 0x01, 0x12, 0x11, 0x21, 0x11, 0x11, 0x11, 0x15, 0x11, 0x11,
+    0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x24, 0x22, 0x23, 0x21, 0x11, 0x31,
+    0x44, 0x41, 0x31, 0x13, 0x11, 0x22, 0x21, 0x11, 0x14, 0x03, 0x12, 0x11,
+    0x11, 0x11, 0x11, 0x21, 0x01, 0x21, 0x11, 0x11, 0x11, 0x12, 0x11, 0x13,
+    0x11, 0x11, 0x11, 0x21, 0x41, 0x25, 0x21, 0x41, 0x12, 0x11, 0x03, 0x01,
+    0x31, 0x21, 0x31, 0x31, 0x21, 0x31, 0x21, 0x11, 0x11, 0x12, 0x12, 0x12,
+    0x11, 0x11, 0x12, 0x41, 0x41, 0x41, 0x41, 0x25, 0x11, 0x11, 0x11, 0x11,
+    0x21, 0x11, 0x23, 0x11, 0x11, 0x11, 0x21, 0x11, 0x33, 0x21, 0x22, 0x11,
+    0x11, 0x14, 0x21, 0x23, 0x04, 0x22, 0x32, 0x11, 0x11, 0x13, 0x22, 0x11,
+    0x12, 0x13, 0x04, 0x11, 0x21, 0x11, 0x21, 0x21, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x12, 0x11, 0x11, 0x13, 0x12, 0x11, 0x12, 0x23, 0x01, 0x21, 0x11,
+    0x32, 0x31, 0x21, 0x12, 0x41, 0x41, 0x03, 0x33, 0x01, 0x41, 0x42, 0x11,
+    0x21, 0x11, 0x11, 0x11, 0x21, 0x11, 0x51, 0x12, 0x11, 0x22, 0x22, 0x13,
+    0x22, 0x43, 0x12, 0x41, 0x31, 0x11, 0x23, 0x11, 0x33, 0x12, 0x04, 0x21,
+    0x21, 0x13, 0x21, 0x21, 0x11, 0x25, 0x04, 0x12, 0x21, 0x21, 0x32, 0x04,
+    0x21, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x25, 0x05, 0x11, 0x21, 0x12,
+    0x31, 0x41, 0x26, 0x05, 0x11, 0x21, 0x12, 0x31, 0x41, 0x33, 0x03, 0x11,
+    0x31, 0x31, 0x13, 0x11, 0x22, 0x03, 0x11, 0x11, 0x21, 0x14, 0x11, 0x21,
+    0x11, 0x24, 0x11, 0x03, 0x11, 0x21, 0x21, 0x21, 0x13, 0x13, 0x21, 0x31,
+    0x11, 0x11, 0x11, 0x11, 0x21, 0x02, 0x12, 0x11, 0x11, 0x22, 0x33, 0x21,
+    0x11, 0x12, 0x12, 0x03, 0x31, 0x41, 0x41, 0x41, 0x26, 0x02, 0x14, 0x14,
+    0x13, 0x11, 0x12, 0x33, 0x12, 0x02, 0x12, 0x12, 0x11, 0x12, 0x11, 0x11,
+    0x12, 0x11, 0x15, 0x11, 0x12, 0x11, 0x22, 0x22, 0x22, 0x21, 0x12, 0x04,
+    0x21, 0x21, 0x11, 0x21, 0x13, 0x21, 0x33, 0x12, 0x11, 0x22, 0x22, 0x22,
+    0x21, 0x12, 0x32, 0x04, 0x21, 0x21, 0x11, 0x21, 0x13, 0x21, 0x24, 0x11,
+    0x04, 0x11, 0x11, 0x32, 0x14, 0x06, 0x11, 0x11, 0x21, 0x41, 0x41, 0x33,
+    0x02, 0x12, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x22, 0x02,
+    0x13, 0x31, 0x11, 0x21, 0x11, 0x11, 0x21, 0x11, 0x32, 0x02, 0x13, 0x32,
+    0x11, 0x12, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x02, 0x12, 0x11, 0x11,
+    0x31, 0x41, 0x31, 0x11, 0x12, 0x12, 0x02, 0x13, 0x31, 0x11, 0x11, 0x31,
+    0x41, 0x33, 0x05, 0x21, 0x21, 0x21, 0x21, 0x25, 0x03, 0x11, 0x11, 0x11,
+    0x11, 0x12, 0x01, 0x41, 0x31, 0x41, 0x31, 0x31, 0x41, 0x02, 0x11, 0x11,
+    0x11, 0x11, 0x13, 0x11, 0x21, 0x11, 0x11, 0x05, 0x01, 0x21, 0x12, 0x31,
+    0x13, 0x14, 0x02, 0x41, 0x43, 0x21, 0x21, 0x11, 0x25, 0x04, 0x21, 0x23,
+    0x22, 0x31, 0x14, 0x22, 0x21, 0x13, 0x07, 0x32, 0x21, 0x11, 0x13, 0x11,
+    0x21, 0x13, 0x14, 0x22, 0x21, 0x13, 0x31, 0x12, 0x02, 0x41, 0x43, 0x21,
+    0x21, 0x11, 0x24, 0x11, 0x11, 0x42, 0x21, 0x21, 0x13, 0x11, 0x43, 0x21,
+    0x21, 0x21, 0x24, 0x02, 0x41, 0x41, 0x12, 0x13, 0x21, 0x11, 0x12, 0x12,
+    0x02, 0x21, 0x21, 0x21, 0x21, 0x13, 0x02, 0x11, 0x11, 0x11, 0x12, 0x11,
+    0x12, 0x11, 0x11, 0x04, 0x21, 0x21, 0x11, 0x23, 0x21, 0x12, 0x11, 0x22,
+    0x21, 0x12, 0x04, 0x21, 0x21, 0x11, 0x21, 0x13, 0x21, 0x33, 0x14, 0x22,
+    0x21, 0x13, 0x31, 0x22, 0x04, 0x11, 0x31, 0x23, 0x12, 0x11, 0x33, 0x11,
+    0x34, 0x21, 0x41, 0x21, 0x22, 0x02, 0x12, 0x11, 0x21, 0x11, 0x21, 0x23,
+    0x02, 0x21, 0x11, 0x21, 0x22, 0x32, 0x02, 0x13, 0x11, 0x12, 0x11, 0x11,
+    0x11, 0x11, 0x01, 0x21, 0x12, 0x22, 0x11, 0x21, 0x02, 0x12, 0x11, 0x11,
+    0x21, 0x11, 0x31, 0x41, 0x32, 0x05, 0x11, 0x21, 0x15, 0x21, 0x11, 0x21,
+    0x12, 0x21, 0x21, 0x31, 0x07, 0x01, 0x31, 0x21, 0x22, 0x11, 0x21, 0x11,
+    0x11, 0x12, 0x11,
+};
+
+static const sGLYPH_RLE Font8_Glyphs[FONT_RLE_GLYPHS + 1] = {
+    {0, 0, 0, 0, 0}, // ' '
+    {0, 2, 0, 1, 6}, // '!'
+    {2, 1, 0, 3, 2}, // '"'
+    {5, 0, 0, 5, 7}, // '#'
+    {17, 1, 0, 3, 7}, // '$'
+    {22, 1, 0, 4, 6}, // '%'
+    {27, 1, 1, 4, 5}, // '&'
+    {33, 2, 0, 1, 3}, // '\''
+    {34, 2, 0, 2, 7}, // '('
+    {40, 1, 0, 2, 7}, // ')'
+    {46, 1, 0, 3, 4}, // '*'
+    {51, 0, 1, 5, 5}, // '+'
+    {56, 2, 4, 2, 3}, // ','
+    {58, 1, 3, 3, 1}, // '-'
+    {59, 2, 5, 1, 1}, // '.'
+    {60, 0, 0, 4, 7}, // '/'
+    {67, 1, 0, 3, 6}, // '0'
+    {74, 0, 0, 5, 6}, // '1'
+    {80, 1, 0, 3, 6}, // '2'
+    {87, 1, 0, 3, 6}, // '3'
+    {93, 1, 0, 4, 6}, // '4'
+    {100, 1, 0, 3, 6}, // '5'
+    {105, 1, 0, 3, 6}, // '6'
+    {110, 1, 0, 3, 6}, // '7'
+    {116, 1, 0, 3, 6}, // '8'
+    {124, 1, 0, 3, 6}, // '9'
+    {129, 2, 2, 1, 4}, // ':'
+    {131, 2, 2, 2, 4}, // ';'
+    {133, 0, 1, 4, 5}, // '<'
+    {138, 1, 1, 3, 3}, // '='
+    {140, 1, 1, 4, 5}, // '>'
+    {145, 1, 0, 3, 6}, // '?'
+    {151, 1, 0, 4, 7}, // '@'
+    {158, 0, 0, 5, 6}, // 'A'
+    {166, 0, 0, 5, 6}, // 'B'
+    {174, 1, 0, 3, 6}, // 'C'
+    {179, 0, 0, 5, 6}, // 'D'
+    {188, 0, 0, 5, 6}, // 'E'
+    {195, 0, 0, 5, 6}, // 'F'
+    {202, 1, 0, 4, 6}, // 'G'
+    {209, 0, 0, 5, 6}, // 'H'
+    {219, 1, 0, 3, 6}, // 'I'
+    {225, 1, 0, 4, 6}, // 'J'
+    {233, 0, 0, 5, 6}, // 'K'
+    {243, 0, 0, 5, 6}, // 'L'
+    {249, 0, 0, 5, 6}, // 'M'
+    {257, 0, 0, 5, 6}, // 'N'
+    {268, 1, 0, 4, 6}, // 'O'
+    {275, 0, 0, 5, 6}, // 'P'
+    {283, 1, 0, 4, 7}, // 'Q'
+    {291, 0, 0, 5, 6}, // 'R'
+    {300, 1, 0, 3, 6}, // 'S'
+    {305, 0, 0, 5, 6}, // 'T'
+    {312, 0, 0, 5, 6}, // 'U'
+    {323, 0, 0, 5, 6}, // 'V'
+    {333, 0, 0, 5, 6}, // 'W'
+    {344, 0, 0, 5, 6}, // 'X'
+    {354, 0, 0, 5, 6}, // 'Y'
+    {362, 1, 0, 4, 6}, // 'Z'
+    {368, 2, 0, 2, 7}, // '['
+    {374, 0, 0, 4, 7}, // '\\'
+    {381, 1, 0, 2, 7}, // ']'
+    {387, 1, 0, 3, 3}, // '^'
+    {391, 0, 7, 5, 1}, // '_'
+    {392, 2, 0, 2, 2}, // '`'
+    {394, 1, 2, 4, 4}, // 'a'
+    {398, 0, 0, 5, 6}, // 'b'
+    {405, 1, 2, 3, 4}, // 'c'
+    {408, 1, 0, 4, 6}, // 'd'
+    {414, 1, 2, 3, 4}, // 'e'
+    {416, 1, 0, 3, 6}, // 'f'
+    {422, 1, 2, 4, 6}, // 'g'
+    {428, 0, 0, 5, 6}, // 'h'
+    {436, 1, 0, 3, 6}, // 'i'
+    {441, 1, 0, 3, 8}, // 'j'
+    {447, 0, 0, 5, 6}, // 'k'
+    {456, 1, 0, 3, 6}, // 'l'
+    {462, 0, 2, 5, 4}, // 'm'
+    {471, 0, 2, 5, 4}, // 'n'
+    {477, 1, 2, 4, 4}, // 'o'
+    {482, 0, 2, 5, 6}, // 'p'
+    {490, 1, 2, 4, 6}, // 'q'
+    {496, 1, 2, 4, 4}, // 'r'
+    {500, 1, 2, 3, 4}, // 's'
+    {503, 0, 1, 5, 5}, // 't'
+    {509, 0, 2, 5, 4}, // 'u'
+    {516, 0, 2, 5, 4}, // 'v'
+    {522, 0, 2, 5, 4}, // 'w'
+    {530, 1, 2, 4, 4}, // 'x'
+    {536, 0, 2, 5, 6}, // 'y'
+    {545, 1, 2, 4, 4}, // 'z'
+    {549, 1, 0, 3, 7}, // '{'
+    {556, 2, 0, 1, 7}, // '|'
+    {557, 1, 0, 3, 7}, // '}'
+    {564, 1, 3, 4, 2}, // '~'
+    {567, 0, 0, 0, 0}, // end
+};
+
+sFONT_RLE Font8Rle = {5, 8, Font8_Glyphs, Font8_Runs};
+
+static const uint8_t Font12_Runs[868] = {
+    0x05, 0x21, 0x02, 0x13, 0x21, 0x11, 0x21, 0x21, 0x11, 0x21, 0x11, 0x11,
+    0x11, 0x15, 0x11, 0x11, 0x15, 0x11, 0x11, 0x11, 0x11, 0x21, 0x11, 0x21,
+    0x24, 0x31, 0x44, 0x24, 0x31, 0x31, 0x11, 0x31, 0x11, 0x31, 0x65, 0x51,
+    0x31, 0x11, 0x31, 0x22, 0x21, 0x41, 0x31, 0x11, 0x12, 0x21, 0x22, 0x11,
+    0x04, 0x11, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x21, 0x11, 0x01, 0x11,
+    0x21, 0x11, 0x11, 0x11, 0x11, 0x12, 0x11, 0x21, 0x25, 0x21, 0x31, 0x11,
+    0x21, 0x11, 0x31, 0x61, 0x61, 0x37, 0x31, 0x61, 0x61, 0x12, 0x11, 0x12,
+    0x11, 0x05, 0x04, 0x41, 0x41, 0x31, 0x41, 0x31, 0x41, 0x31, 0x41, 0x31,
+    0x13, 0x11, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31, 0x13, 0x12, 0x41, 0x41,
+    0x41, 0x41, 0x41, 0x41, 0x25, 0x13, 0x11, 0x31, 0x41, 0x31, 0x31, 0x31,
+    0x31, 0x36, 0x13, 0x11, 0x31, 0x41, 0x22, 0x51, 0x42, 0x31, 0x13, 0x32,
+    0x31, 0x11, 0x31, 0x11, 0x21, 0x21, 0x11, 0x31, 0x16, 0x41, 0x43, 0x14,
+    0x11, 0x41, 0x43, 0x51, 0x42, 0x31, 0x13, 0x23, 0x11, 0x31, 0x44, 0x11,
+    0x32, 0x32, 0x31, 0x13, 0x06, 0x31, 0x41, 0x31, 0x41, 0x41, 0x31, 0x41,
+    0x13, 0x11, 0x32, 0x31, 0x13, 0x11, 0x32, 0x32, 0x31, 0x13, 0x13, 0x11,
+    0x32, 0x32, 0x31, 0x14, 0x41, 0x31, 0x13, 0x04, 0x44, 0x12, 0x12, 0x74,
+    0x11, 0x42, 0x31, 0x32, 0x31, 0x62, 0x61, 0x62, 0x05, 0x55, 0x02, 0x61,
+    0x62, 0x61, 0x32, 0x31, 0x32, 0x12, 0x11, 0x21, 0x31, 0x21, 0x21, 0x62,
+    0x13, 0x11, 0x32, 0x32, 0x23, 0x11, 0x12, 0x11, 0x12, 0x23, 0x41, 0x31,
+    0x13, 0x22, 0x61, 0x51, 0x11, 0x41, 0x11, 0x41, 0x11, 0x35, 0x21, 0x31,
+    0x13, 0x13, 0x05, 0x21, 0x31, 0x11, 0x31, 0x14, 0x21, 0x31, 0x11, 0x31,
+    0x11, 0x36, 0x15, 0x32, 0x41, 0x41, 0x41, 0x41, 0x31, 0x13, 0x04, 0x31,
+    0x21, 0x21, 0x31, 0x11, 0x31, 0x11, 0x31, 0x11, 0x31, 0x11, 0x21, 0x14,
+    0x06, 0x11, 0x31, 0x11, 0x11, 0x33, 0x31, 0x11, 0x31, 0x51, 0x37, 0x06,
+    0x11, 0x31, 0x11, 0x11, 0x33, 0x31, 0x11, 0x31, 0x51, 0x43, 0x14, 0x11,
+    0x31, 0x11, 0x51, 0x51, 0x24, 0x31, 0x11, 0x31, 0x23, 0x03, 0x13, 0x11,
+    0x31, 0x21, 0x31, 0x25, 0x21, 0x31, 0x21, 0x31, 0x21, 0x31, 0x13, 0x13,
+    0x05, 0x21, 0x41, 0x41, 0x41, 0x41, 0x41, 0x25, 0x14, 0x31, 0x41, 0x41,
+    0x11, 0x21, 0x11, 0x21, 0x11, 0x21, 0x22, 0x03, 0x13, 0x11, 0x31, 0x21,
+    0x21, 0x31, 0x11, 0x43, 0x41, 0x21, 0x31, 0x31, 0x13, 0x22, 0x03, 0x31,
+    0x41, 0x41, 0x41, 0x41, 0x21, 0x11, 0x26, 0x03, 0x13, 0x12, 0x12, 0x22,
+    0x12, 0x21, 0x11, 0x11, 0x21, 0x11, 0x11, 0x21, 0x31, 0x21, 0x31, 0x13,
+    0x13, 0x03, 0x13, 0x12, 0x21, 0x22, 0x21, 0x21, 0x11, 0x11, 0x21, 0x11,
+    0x11, 0x21, 0x11, 0x11, 0x21, 0x22, 0x13, 0x12, 0x13, 0x11, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x31, 0x13, 0x04, 0x21, 0x21, 0x11, 0x21, 0x11, 0x21,
+    0x13, 0x21, 0x41, 0x33, 0x13, 0x11, 0x32, 0x32, 0x32, 0x32, 0x32, 0x31,
+    0x13, 0x33, 0x05, 0x31, 0x31, 0x21, 0x31, 0x21, 0x31, 0x24, 0x31, 0x21,
+    0x31, 0x31, 0x13, 0x31, 0x12, 0x12, 0x23, 0x53, 0x51, 0x43, 0x22, 0x12,
+    0x08, 0x21, 0x21, 0x31, 0x61, 0x61, 0x61, 0x61, 0x53, 0x03, 0x13, 0x11,
+    0x31, 0x21, 0x31, 0x21, 0x31, 0x21, 0x31, 0x21, 0x31, 0x21, 0x31, 0x33,
+    0x03, 0x13, 0x11, 0x31, 0x21, 0x31, 0x31, 0x11, 0x41, 0x11, 0x41, 0x11,
+    0x51, 0x61, 0x03, 0x13, 0x11, 0x31, 0x21, 0x31, 0x21, 0x11, 0x11, 0x21,
+    0x11, 0x11, 0x21, 0x11, 0x11, 0x21, 0x11, 0x11, 0x31, 0x11, 0x02, 0x32,
+    0x11, 0x31, 0x31, 0x11, 0x51, 0x61, 0x51, 0x11, 0x31, 0x31, 0x12, 0x32,
+    0x03, 0x13, 0x11, 0x31, 0x31, 0x11, 0x41, 0x11, 0x51, 0x61, 0x61, 0x53,
+    0x06, 0x31, 0x31, 0x31, 0x41, 0x31, 0x31, 0x36, 0x04, 0x21, 0x21, 0x21,
+    0x21, 0x21, 0x21, 0x21, 0x23, 0x01, 0x41, 0x31, 0x31, 0x41, 0x31, 0x41,
+    0x31, 0x31, 0x03, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x24, 0x21,
+    0x41, 0x31, 0x11, 0x11, 0x31, 0x07, 0x01, 0x21, 0x13, 0x21, 0x31, 0x24,
+    0x11, 0x31, 0x11, 0x31, 0x25, 0x02, 0x51, 0x51, 0x12, 0x22, 0x21, 0x11,
+    0x31, 0x11, 0x31, 0x11, 0x36, 0x15, 0x32, 0x41, 0x41, 0x31, 0x13, 0x32,
+    0x51, 0x22, 0x11, 0x11, 0x22, 0x11, 0x31, 0x11, 0x31, 0x11, 0x31, 0x25,
+    0x13, 0x11, 0x37, 0x41, 0x54, 0x23, 0x11, 0x35, 0x11, 0x41, 0x41, 0x41,
+    0x35, 0x12, 0x13, 0x22, 0x11, 0x31, 0x11, 0x31, 0x11, 0x31, 0x24, 0x51,
+    0x23, 0x02, 0x61, 0x61, 0x12, 0x32, 0x21, 0x21, 0x31, 0x21, 0x31, 0x21,
+    0x31, 0x13, 0x13, 0x21, 0x73, 0x41, 0x41, 0x41, 0x41, 0x25, 0x21, 0x54,
+    0x31, 0x31, 0x31, 0x31, 0x31, 0x34, 0x02, 0x51, 0x51, 0x13, 0x11, 0x21,
+    0x23, 0x31, 0x11, 0x31, 0x21, 0x12, 0x13, 0x12, 0x41, 0x41, 0x41, 0x41,
+    0x41, 0x41, 0x25, 0x03, 0x11, 0x31, 0x11, 0x11, 0x21, 0x11, 0x11, 0x21,
+    0x11, 0x11, 0x21, 0x11, 0x11, 0x17, 0x02, 0x12, 0x32, 0x21, 0x21, 0x31,
+    0x21, 0x31, 0x21, 0x31, 0x13, 0x13, 0x13, 0x11, 0x32, 0x32, 0x32, 0x31,
+    0x13, 0x02, 0x12, 0x22, 0x21, 0x11, 0x31, 0x11, 0x31, 0x11, 0x31, 0x14,
+    0x21, 0x43, 0x12, 0x13, 0x22, 0x11, 0x31, 0x11, 0x31, 0x11, 0x31, 0x24,
+    0x51, 0x43, 0x02, 0x12, 0x12, 0x31, 0x41, 0x41, 0x35, 0x15, 0x31, 0x13,
+    0x52, 0x35, 0x11, 0x45, 0x21, 0x51, 0x51, 0x51, 0x31, 0x23, 0x02, 0x22,
+    0x21, 0x31, 0x21, 0x31, 0x21, 0x31, 0x21, 0x22, 0x32, 0x12, 0x03, 0x13,
+    0x11, 0x31, 0x21, 0x31, 0x31, 0x11, 0x41, 0x11, 0x51, 0x03, 0x13, 0x11,
+    0x31, 0x21, 0x11, 0x11, 0x21, 0x11, 0x11, 0x21, 0x11, 0x11, 0x31, 0x11,
+    0x02, 0x22, 0x11, 0x21, 0x32, 0x42, 0x31, 0x21, 0x12, 0x22, 0x03, 0x13,
+    0x11, 0x31, 0x31, 0x21, 0x31, 0x11, 0x52, 0x51, 0x61, 0x44, 0x06, 0x21,
+    0x31, 0x31, 0x31, 0x36, 0x21, 0x11, 0x21, 0x21, 0x21, 0x11, 0x31, 0x21,
+    0x21, 0x31, 0x09, 0x01, 0x31, 0x21, 0x21, 0x21, 0x31, 0x11, 0x21, 0x21,
+    0x11, 0x11, 0x22, 0x12,
+};
+
+static const sGLYPH_RLE Font12_Glyphs[FONT_RLE_GLYPHS + 1] = {
+    {0, 0, 0, 0, 0}, // ' '
+    {0, 3, 1, 1, 8}, // '!'
+    {2, 1, 1, 5, 3}, // '"'
+    {7, 1, 1, 5, 9}, // '#'
+    {23, 1, 1, 4, 9}, // '$'
+    {30, 1, 1, 5, 8}, // '%'
+    {39, 1, 3, 5, 6}, // '&'
+    {48, 3, 1, 1, 4}, // '\''
+    {49, 3, 1, 2, 10}, // '('
+    {58, 2, 1, 2, 10}, // ')'
+    {67, 1, 1, 5, 5}, // '*'
+    {74, 0, 2, 7, 7}, // '+'
+    {81, 2, 7, 3, 4}, // ','
+    {85, 1, 5, 5, 1}, // '-'
+    {86, 2, 7, 2, 2}, // '.'
+    {87, 1, 1, 5, 9}, // '/'
+    {96, 1, 1, 5, 8}, // '0'
+    {105, 1, 1, 5, 8}, // '1'
+    {113, 1, 1, 5, 8}, // '2'
+    {122, 1, 1, 5, 8}, // '3'
+    {131, 1, 1, 6, 8}, // '4'
+    {143, 1, 1, 5, 8}, // '5'
+    {151, 1, 1, 5, 8}, // '6'
+    {160, 1, 1, 5, 8}, // '7'
+    {168, 1, 1, 5, 8}, // '8'
+    {178, 1, 1, 5, 8}, // '9'
+    {187, 2, 3, 2, 6}, // ':'
+    {189, 2, 3, 3, 7}, // ';'
+    {193, 0, 2, 6, 7}, // '<'
+    {200, 1, 4, 5, 3}, // '='
+    {202, 0, 2, 6, 7}, // '>'
+    {209, 2, 2, 4, 7}, // '?'
+    {216, 1, 0, 5, 10}, // '@'
+    {229, 0, 1, 7, 8}, // 'A'
+    {242, 0, 1, 6, 8}, // 'B'
+    {254, 1, 1, 5, 8}, // 'C'
+    {262, 0, 1, 6, 8}, // 'D'
+    {276, 0, 1, 6, 8}, // 'E'
+    {287, 1, 1, 6, 8}, // 'F'
+    {298, 1, 1, 6, 8}, // 'G'
+    {309, 0, 1, 7, 8}, // 'H'
+    {324, 1, 1, 5, 8}, // 'I'
+    {332, 1, 1, 5, 8}, // 'J'
+    {343, 0, 1, 7, 8}, // 'K'
+    {358, 1, 1, 5, 8}, // 'L'
+    {367, 0, 1, 7, 8}, // 'M'
+    {385, 0, 1, 7, 8}, // 'N'
+    {404, 1, 1, 5, 8}, // 'O'
+    {413, 1, 1, 5, 8}, // 'P'
+    {424, 1, 1, 5, 9}, // 'Q'
+    {434, 0, 1, 7, 8}, // 'R'
+    {448, 1, 1, 5, 8}, // 'S'
+    {456, 0, 1, 7, 8}, // 'T'
+    {465, 0, 1, 7, 8}, // 'U'
+    {480, 0, 1, 7, 8}, // 'V'
+    {494, 0, 1, 7, 8}, // 'W'
+    {514, 0, 1, 7, 8}, // 'X'
+    {528, 0, 1, 7, 8}, // 'Y'
+    {540, 1, 1, 5, 8}, // 'Z'
+    {548, 2, 1, 3, 10}, // '['
+    {557, 1, 1, 4, 9}, // '\\'
+    {566, 2, 1, 3, 10}, // ']'
+    {575, 1, 1, 5, 4}, // '^'
+    {581, 0, 11, 7, 1}, // '_'
+    {582, 3, 1, 2, 2}, // '`'
+    {584, 1, 3, 6, 6}, // 'a'
+    {593, 0, 1, 6, 8}, // 'b'
+    {605, 1, 3, 5, 6}, // 'c'
+    {611, 1, 1, 6, 8}, // 'd'
+    {624, 1, 3, 5, 6}, // 'e'
+    {629, 1, 1, 5, 8}, // 'f'
+    {637, 1, 3, 6, 8}, // 'g'
+    {649, 0, 1, 7, 8}, // 'h'
+    {663, 1, 1, 5, 8}, // 'i'
+    {670, 1, 1, 4, 10}, // 'j'
+    {678, 0, 1, 6, 8}, // 'k'
+    {691, 1, 1, 5, 8}, // 'l'
+    {699, 0, 3, 7, 6}, // 'm'
+    {714, 0, 3, 7, 6}, // 'n'
+    {726, 1, 3, 5, 6}, // 'o'
+    {733, 0, 3, 6, 8}, // 'p'
+    {746, 1, 3, 6, 8}, // 'q'
+    {758, 1, 3, 5, 6}, // 'r'
+    {765, 1, 3, 5, 6}, // 's'
+    {770, 1, 2, 6, 7}, // 't'
+    {778, 0, 3, 7, 6}, // 'u'
+    {790, 0, 3, 7, 6}, // 'v'
+    {801, 0, 3, 7, 6}, // 'w'
+    {816, 0, 3, 6, 6}, // 'x'
+    {826, 0, 3, 7, 8}, // 'y'
+    {838, 1, 3, 5, 6}, // 'z'
+    {844, 2, 1, 3, 10}, // '{'
+    {854, 3, 1, 1, 9}, // '|'
+    {855, 2, 1, 3, 10}, // '}'
+    {865, 1, 5, 5, 2}, // '~'
+    {868, 0, 0, 0, 0}, // end
+};
+
+sFONT_RLE Font12Rle = {7, 12, Font12_Glyphs, Font12_Runs};
+
+static const uint8_t Font16_Runs[1082] = {
+    0x0F, 0x01, 0x22, 0x03, 0x16, 0x13, 0x11, 0x31, 0x21, 0x31, 0x21, 0x31,
+    0x22, 0x12, 0x32, 0x12, 0x32, 0x12, 0x32, 0x12, 0x18, 0x12, 0x12, 0x28,
+    0x12, 0x12, 0x32, 0x12, 0x32, 0x12, 0x32, 0x12, 0x31, 0x48, 0x34, 0x35,
+    0x54, 0x44, 0x55, 0x34, 0x38, 0x41, 0x61, 0x12, 0x51, 0x21, 0x41, 0x21,
+    0x52, 0x32, 0x34, 0x24, 0x32, 0x32, 0x51, 0x21, 0x41, 0x21, 0x52, 0x24,
+    0x22, 0x52, 0x52, 0x62, 0x43, 0x14, 0x13, 0x12, 0x22, 0x23, 0x12, 0x06,
+    0x11, 0x21, 0x21, 0x22, 0x22, 0x12, 0x13, 0x12, 0x22, 0x22, 0x22, 0x23,
+    0x22, 0x32, 0x22, 0x02, 0x22, 0x32, 0x32, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x12, 0x13, 0x12, 0x32, 0x62, 0x3F, 0x01, 0x24, 0x36, 0x22, 0x22, 0x31,
+    0x61, 0x61, 0x37, 0x31, 0x61, 0x61, 0x12, 0x11, 0x12, 0x11, 0x21, 0x07,
+    0x04, 0x62, 0x62, 0x52, 0x62, 0x52, 0x62, 0x52, 0x52, 0x62, 0x52, 0x62,
+    0x52, 0x62, 0x23, 0x32, 0x12, 0x12, 0x34, 0x34, 0x34, 0x34, 0x34, 0x32,
+    0x12, 0x12, 0x33, 0x32, 0x35, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+    0x38, 0x24, 0x22, 0x24, 0x34, 0x32, 0x42, 0x42, 0x42, 0x42, 0x42, 0x57,
+    0x16, 0x12, 0x42, 0x62, 0x52, 0x35, 0x63, 0x62, 0x64, 0x42, 0x16, 0x33,
+    0x43, 0x34, 0x31, 0x12, 0x22, 0x12, 0x21, 0x22, 0x12, 0x22, 0x17, 0x42,
+    0x35, 0x16, 0x12, 0x52, 0x52, 0x55, 0x21, 0x32, 0x52, 0x53, 0x42, 0x15,
+    0x34, 0x13, 0x42, 0x42, 0x52, 0x13, 0x13, 0x24, 0x34, 0x32, 0x12, 0x22,
+    0x24, 0x08, 0x42, 0x52, 0x42, 0x52, 0x52, 0x52, 0x42, 0x52, 0x52, 0x15,
+    0x12, 0x34, 0x34, 0x32, 0x15, 0x12, 0x34, 0x34, 0x34, 0x32, 0x15, 0x14,
+    0x22, 0x22, 0x12, 0x34, 0x34, 0x23, 0x13, 0x12, 0x52, 0x42, 0x43, 0x14,
+    0x04, 0x64, 0x22, 0x22, 0xD2, 0x21, 0x21, 0x31, 0x72, 0x52, 0x61, 0x62,
+    0x52, 0x92, 0x91, 0x92, 0x92, 0x09, 0x99, 0x02, 0x92, 0x91, 0x92, 0x92,
+    0x52, 0x61, 0x62, 0x52, 0x15, 0x12, 0x34, 0x32, 0x52, 0x33, 0x32, 0x52,
+    0xC2, 0x23, 0x21, 0x32, 0x42, 0x42, 0x24, 0x11, 0x22, 0x11, 0x22, 0x24,
+    0x61, 0x31, 0x23, 0x16, 0x64, 0x61, 0x21, 0x52, 0x22, 0x42, 0x22, 0x46,
+    0x32, 0x42, 0x22, 0x42, 0x14, 0x24, 0x07, 0x22, 0x32, 0x12, 0x32, 0x12,
+    0x32, 0x16, 0x22, 0x32, 0x12, 0x32, 0x12, 0x39, 0x25, 0x11, 0x12, 0x44,
+    0x63, 0x72, 0x72, 0x72, 0x61, 0x12, 0x41, 0x35, 0x07, 0x32, 0x32, 0x22,
+    0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x32, 0x17,
+    0x08, 0x12, 0x41, 0x12, 0x41, 0x12, 0x21, 0x35, 0x32, 0x21, 0x32, 0x41,
+    0x12, 0x49, 0x09, 0x12, 0x51, 0x12, 0x51, 0x12, 0x21, 0x45, 0x42, 0x21,
+    0x42, 0x72, 0x65, 0x24, 0x11, 0x22, 0x32, 0x12, 0x51, 0x12, 0x72, 0x72,
+    0x27, 0x42, 0x22, 0x32, 0x35, 0x04, 0x14, 0x12, 0x32, 0x22, 0x32, 0x22,
+    0x32, 0x27, 0x22, 0x32, 0x22, 0x32, 0x22, 0x32, 0x14, 0x14, 0x08, 0x32,
+    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x38, 0x27, 0x52, 0x72, 0x72, 0x72,
+    0x22, 0x32, 0x22, 0x32, 0x22, 0x32, 0x35, 0x04, 0x14, 0x12, 0x32, 0x22,
+    0x22, 0x32, 0x12, 0x44, 0x55, 0x42, 0x22, 0x32, 0x32, 0x14, 0x23, 0x06,
+    0x52, 0x72, 0x72, 0x72, 0x72, 0x41, 0x22, 0x41, 0x22, 0x4A, 0x03, 0x53,
+    0x12, 0x52, 0x23, 0x33, 0x24, 0x14, 0x22, 0x11, 0x11, 0x12, 0x22, 0x13,
+    0x12, 0x22, 0x21, 0x22, 0x22, 0x52, 0x15, 0x15, 0x03, 0x24, 0x12, 0x32,
+    0x23, 0x22, 0x24, 0x12, 0x22, 0x11, 0x12, 0x22, 0x14, 0x22, 0x23, 0x22,
+    0x32, 0x14, 0x22, 0x25, 0x32, 0x32, 0x12, 0x54, 0x54, 0x54, 0x54, 0x52,
+    0x12, 0x32, 0x35, 0x07, 0x22, 0x32, 0x12, 0x32, 0x12, 0x32, 0x12, 0x32,
+    0x16, 0x22, 0x62, 0x56, 0x25, 0x32, 0x32, 0x12, 0x54, 0x54, 0x54, 0x54,
+    0x52, 0x12, 0x32, 0x35, 0x52, 0x22, 0x26, 0x07, 0x42, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x35, 0x52, 0x22, 0x42, 0x32, 0x32, 0x32, 0x25, 0x23, 0x18,
+    0x34, 0x35, 0x55, 0x55, 0x34, 0x38, 0x09, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x21, 0x32, 0x62, 0x62, 0x62, 0x46, 0x04, 0x14, 0x12, 0x32, 0x22, 0x32,
+    0x22, 0x32, 0x22, 0x32, 0x22, 0x32, 0x22, 0x32, 0x22, 0x32, 0x35, 0x04,
+    0x14, 0x12, 0x32, 0x22, 0x32, 0x32, 0x12, 0x42, 0x12, 0x42, 0x12, 0x51,
+    0x11, 0x63, 0x63, 0x05, 0x15, 0x12, 0x52, 0x22, 0x21, 0x22, 0x22, 0x13,
+    0x12, 0x22, 0x13, 0x12, 0x31, 0x11, 0x11, 0x11, 0x43, 0x13, 0x43, 0x13,
+    0x42, 0x32, 0x04, 0x14, 0x12, 0x32, 0x32, 0x12, 0x53, 0x63, 0x63, 0x52,
+    0x12, 0x32, 0x32, 0x14, 0x14, 0x04, 0x24, 0x12, 0x42, 0x32, 0x22, 0x54,
+    0x72, 0x82, 0x82, 0x82, 0x66, 0x08, 0x43, 0x32, 0x42, 0x51, 0x52, 0x42,
+    0x33, 0x48, 0x06, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x24, 0x02, 0x62, 0x72, 0x62, 0x72, 0x62, 0x72, 0x72, 0x62, 0x72, 0x62,
+    0x72, 0x62, 0x04, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x26, 0x31, 0x51, 0x11, 0x41, 0x11, 0x31, 0x31, 0x11, 0x52, 0x51, 0x0B,
+    0x01, 0x31, 0x31, 0x15, 0x72, 0x62, 0x26, 0x12, 0x32, 0x12, 0x23, 0x23,
+    0x13, 0x03, 0x72, 0x72, 0x72, 0x13, 0x33, 0x22, 0x22, 0x42, 0x12, 0x42,
+    0x12, 0x42, 0x13, 0x22, 0x13, 0x13, 0x24, 0x11, 0x12, 0x34, 0x53, 0x62,
+    0x51, 0x12, 0x32, 0x25, 0x53, 0x72, 0x72, 0x33, 0x12, 0x22, 0x23, 0x12,
+    0x42, 0x12, 0x42, 0x12, 0x42, 0x22, 0x23, 0x33, 0x13, 0x25, 0x32, 0x32,
+    0x12, 0x5D, 0x82, 0x42, 0x26, 0x36, 0x22, 0x72, 0x57, 0x42, 0x72, 0x72,
+    0x72, 0x72, 0x57, 0x23, 0x13, 0x12, 0x23, 0x12, 0x42, 0x12, 0x42, 0x12,
+    0x42, 0x22, 0x23, 0x33, 0x12, 0x72, 0x72, 0x35, 0x03, 0x72, 0x72, 0x72,
+    0x13, 0x33, 0x22, 0x22, 0x32, 0x22, 0x32, 0x22, 0x32, 0x22, 0x32, 0x14,
+    0x14, 0x32, 0x62, 0xC4, 0x62, 0x62, 0x62, 0x62, 0x62, 0x38, 0x32, 0x42,
+    0x76, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x47, 0x03, 0x72, 0x72,
+    0x72, 0x14, 0x22, 0x12, 0x44, 0x54, 0x52, 0x12, 0x42, 0x22, 0x23, 0x15,
+    0x14, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x38, 0x08, 0x32,
+    0x12, 0x12, 0x22, 0x12, 0x12, 0x22, 0x12, 0x12, 0x22, 0x12, 0x12, 0x22,
+    0x12, 0x12, 0x13, 0x12, 0x13, 0x03, 0x13, 0x33, 0x22, 0x22, 0x32, 0x22,
+    0x32, 0x22, 0x32, 0x22, 0x32, 0x14, 0x14, 0x25, 0x32, 0x32, 0x12, 0x54,
+    0x54, 0x52, 0x12, 0x32, 0x35, 0x03, 0x13, 0x33, 0x22, 0x22, 0x42, 0x12,
+    0x42, 0x12, 0x42, 0x13, 0x22, 0x22, 0x13, 0x32, 0x72, 0x65, 0x23, 0x13,
+    0x12, 0x23, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42, 0x22, 0x23, 0x33, 0x12,
+    0x72, 0x72, 0x55, 0x04, 0x13, 0x33, 0x22, 0x22, 0x72, 0x72, 0x72, 0x57,
+    0x18, 0x36, 0x45, 0x55, 0x38, 0x22, 0x62, 0x62, 0x47, 0x32, 0x62, 0x62,
+    0x62, 0x62, 0x31, 0x34, 0x03, 0x23, 0x22, 0x32, 0x22, 0x32, 0x22, 0x32,
+    0x22, 0x32, 0x22, 0x23, 0x33, 0x13, 0x04, 0x14, 0x12, 0x32, 0x22, 0x32,
+    0x32, 0x12, 0x42, 0x12, 0x53, 0x63, 0x04, 0x34, 0x12, 0x52, 0x22, 0x21,
+    0x22, 0x22, 0x13, 0x12, 0x33, 0x13, 0x43, 0x13, 0x42, 0x32, 0x04, 0x14,
+    0x22, 0x12, 0x53, 0x63, 0x63, 0x52, 0x12, 0x24, 0x14, 0x04, 0x24, 0x12,
+    0x42, 0x32, 0x22, 0x42, 0x22, 0x51, 0x12, 0x64, 0x72, 0x82, 0x72, 0x65,
+    0x08, 0x42, 0x42, 0x33, 0x32, 0x42, 0x48, 0x22, 0x12, 0x22, 0x22, 0x22,
+    0x22, 0x12, 0x32, 0x22, 0x22, 0x22, 0x32, 0x0F, 0x09, 0x02, 0x32, 0x22,
+    0x22, 0x22, 0x22, 0x32, 0x12, 0x22, 0x22, 0x22, 0x12, 0x12, 0x41, 0x21,
+    0x21, 0x42,
+};
+
+static const sGLYPH_RLE Font16_Glyphs[FONT_RLE_GLYPHS + 1] = {
+    {0, 0, 0, 0, 0}, // ' '
+    {0, 4, 1, 2, 10}, // '!'
+    {3, 3, 2, 7, 5}, // '"'
+    {12, 2, 1, 8, 11}, // '#'
+    {32, 2, 0, 7, 13}, // '$'
+    {43, 2, 1, 8, 10}, // '%'
+    {59, 2, 2, 7, 9}, // '&'
+    {71, 5, 2, 3, 5}, // '\''
+    {75, 4, 1, 4, 12}, // '('
+    {87, 3, 1, 4, 12}, // ')'
+    {99, 2, 1, 8, 7}, // '*'
+    {107, 2, 3, 7, 7}, // '+'
+    {114, 4, 9, 3, 5}, // ','
+    {119, 2, 6, 7, 1}, // '-'
+    {120, 4, 9, 2, 2}, // '.'
+    {121, 2, 0, 8, 13}, // '/'
+    {134, 2, 1, 7, 10}, // '0'
+    {147, 2, 1, 8, 10}, // '1'
+    {157, 2, 1, 7, 10}, // '2'
+    {168, 1, 1, 8, 10}, // '3'
+    {179, 2, 1, 7, 10}, // '4'
+    {193, 2, 1, 7, 10}, // '5'
+    {204, 2, 1, 7, 10}, // '6'
+    {217, 1, 1, 7, 10}, // '7'
+    {227, 2, 1, 7, 10}, // '8'
+    {239, 2, 1, 7, 10}, // '9'
+    {252, 4, 4, 2, 7}, // ':'
+    {254, 4, 4, 4, 9}, // ';'
+    {260, 1, 2, 9, 9}, // '<'
+    {269, 1, 5, 9, 3}, // '='
+    {271, 1, 2, 9, 9}, // '>'
+    {280, 2, 2, 7, 9}, // '?'
+    {289, 2, 1, 6, 11}, // '@'
+    {303, 1, 2, 10, 9}, // 'A'
+    {318, 1, 2, 8, 9}, // 'B'
+    {332, 1, 2, 9, 9}, // 'C'
+    {344, 1, 2, 9, 9}, // 'D'
+    {360, 1, 2, 8, 9}, // 'E'
+    {374, 1, 2, 9, 9}, // 'F'
+    {387, 1, 2, 9, 9}, // 'G'
+    {401, 1, 2, 9, 9}, // 'H'
+    {418, 2, 2, 8, 9}, // 'I'
+    {427, 1, 2, 9, 9}, // 'J'
+    {439, 1, 2, 9, 9}, // 'K'
+    {455, 1, 2, 9, 9}, // 'L'
+    {466, 0, 2, 11, 9}, // 'M'
+    {488, 1, 2, 9, 9}, // 'N'
+    {507, 1, 2, 9, 9}, // 'O'
+    {519, 1, 2, 8, 9}, // 'P'
+    {532, 1, 2, 9, 11}, // 'Q'
+    {547, 1, 2, 10, 9}, // 'R'
+    {563, 2, 2, 7, 9}, // 'S'
+    {570, 1, 2, 8, 9}, // 'T'
+    {582, 1, 2, 9, 9}, // 'U'
+    {599, 1, 2, 9, 9}, // 'V'
+    {615, 0, 2, 11, 9}, // 'W'
+    {638, 1, 2, 9, 9}, // 'X'
+    {653, 1, 2, 10, 9}, // 'Y'
+    {665, 2, 2, 7, 9}, // 'Z'
+    {674, 5, 1, 4, 12}, // '['
+    {685, 2, 0, 8, 13}, // '\\'
+    {698, 3, 1, 4, 12}, // ']'
+    {709, 2, 0, 7, 6}, // '^'
+    {719, 0, 15, 11, 1}, // '_'
+    {720, 4, 0, 3, 3}, // '`'
+    {723, 2, 4, 8, 7}, // 'a'
+    {733, 1, 1, 9, 10}, // 'b'
+    {750, 1, 4, 8, 7}, // 'c'
+    {760, 1, 1, 9, 10}, // 'd'
+    {777, 1, 4, 9, 7}, // 'e'
+    {785, 2, 1, 9, 10}, // 'f'
+    {795, 1, 4, 9, 10}, // 'g'
+    {812, 1, 1, 9, 10}, // 'h'
+    {829, 2, 1, 8, 10}, // 'i'
+    {838, 2, 1, 6, 13}, // 'j'
+    {849, 1, 1, 9, 10}, // 'k'
+    {864, 2, 1, 8, 10}, // 'l'
+    {874, 1, 4, 10, 7}, // 'm'
+    {893, 1, 4, 9, 7}, // 'n'
+    {907, 1, 4, 9, 7}, // 'o'
+    {917, 1, 4, 9, 10}, // 'p'
+    {934, 1, 4, 9, 10}, // 'q'
+    {951, 1, 4, 9, 7}, // 'r'
+    {960, 2, 4, 7, 7}, // 's'
+    {965, 1, 1, 8, 10}, // 't'
+    {976, 1, 4, 9, 7}, // 'u'
+    {990, 1, 4, 9, 7}, // 'v'
+    {1002, 0, 4, 11, 7}, // 'w'
+    {1018, 1, 4, 9, 7}, // 'x'
+    {1029, 1, 4, 10, 10}, // 'y'
+    {1044, 2, 4, 7, 7}, // 'z'
+    {1051, 3, 1, 4, 12}, // '{'
+    {1063, 5, 1, 2, 12}, // '|'
+    {1065, 4, 1, 4, 12}, // '}'
+    {1077, 2, 5, 7, 3}, // '~'
+    {1082, 0, 0, 0, 0}, // end
+};
+
+sFONT_RLE Font16Rle = {11, 16, Font16_Glyphs, Font16_Runs};
+
+static const uint8_t Font20_Runs[1355] = {
+    0x0F, 0x06, 0x11, 0x21, 0x76, 0x03, 0x26, 0x26, 0x23, 0x11, 0x41, 0x21,
+    0x41, 0x21, 0x41, 0x22, 0x22, 0x42, 0x22, 0x42, 0x22, 0x42, 0x22, 0x42,
+    0x22, 0x2F, 0x05, 0x22, 0x22, 0x42, 0x22, 0x2F, 0x05, 0x22, 0x22, 0x42,
+    0x22, 0x42, 0x22, 0x42, 0x22, 0x42, 0x22, 0x32, 0x62, 0x56, 0x19, 0x44,
+    0x65, 0x46, 0x65, 0x44, 0x49, 0x16, 0x52, 0x62, 0x62, 0x13, 0x51, 0x31,
+    0x41, 0x31, 0x41, 0x31, 0x53, 0x32, 0x54, 0x25, 0x24, 0x52, 0x33, 0x51,
+    0x31, 0x41, 0x31, 0x41, 0x31, 0x53, 0x35, 0x27, 0x22, 0x72, 0x82, 0x64,
+    0x2D, 0x24, 0x12, 0x32, 0x29, 0x24, 0x12, 0x09, 0x11, 0x21, 0x21, 0x22,
+    0x22, 0x12, 0x22, 0x22, 0x12, 0x22, 0x22, 0x22, 0x22, 0x22, 0x32, 0x22,
+    0x22, 0x32, 0x22, 0x02, 0x22, 0x32, 0x22, 0x22, 0x32, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x12, 0x22, 0x22, 0x12, 0x22, 0x32, 0x62, 0x62, 0x32, 0x12,
+    0x1A, 0x24, 0x44, 0x36, 0x22, 0x22, 0x42, 0x82, 0x82, 0x82, 0x4F, 0x05,
+    0x42, 0x82, 0x82, 0x82, 0x13, 0x12, 0x22, 0x12, 0x22, 0x21, 0x0F, 0x03,
+    0x09, 0x62, 0x62, 0x52, 0x62, 0x62, 0x52, 0x62, 0x52, 0x62, 0x52, 0x62,
+    0x52, 0x62, 0x62, 0x52, 0x62, 0x25, 0x37, 0x22, 0x32, 0x12, 0x54, 0x54,
+    0x54, 0x54, 0x54, 0x54, 0x52, 0x12, 0x32, 0x27, 0x35, 0x32, 0x35, 0x35,
+    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x3F, 0x01, 0x25, 0x37,
+    0x13, 0x35, 0x52, 0x72, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x6F, 0x03,
+    0x35, 0x38, 0x22, 0x43, 0x82, 0x73, 0x45, 0x55, 0x83, 0x82, 0x84, 0x5C,
+    0x27, 0x53, 0x54, 0x54, 0x42, 0x12, 0x32, 0x22, 0x32, 0x22, 0x22, 0x32,
+    0x12, 0x42, 0x1F, 0x03, 0x62, 0x55, 0x45, 0x17, 0x27, 0x22, 0x72, 0x76,
+    0x37, 0x22, 0x33, 0x72, 0x72, 0x74, 0x4B, 0x26, 0x45, 0x27, 0x14, 0x52,
+    0x63, 0x62, 0x14, 0x28, 0x13, 0x35, 0x54, 0x52, 0x12, 0x33, 0x17, 0x44,
+    0x0F, 0x05, 0x52, 0x72, 0x62, 0x72, 0x72, 0x62, 0x72, 0x72, 0x62, 0x72,
+    0x72, 0x25, 0x37, 0x13, 0x35, 0x55, 0x33, 0x17, 0x27, 0x13, 0x35, 0x54,
+    0x55, 0x33, 0x17, 0x35, 0x24, 0x47, 0x13, 0x32, 0x12, 0x54, 0x55, 0x33,
+    0x18, 0x24, 0x12, 0x63, 0x62, 0x54, 0x17, 0x25, 0x09, 0x99, 0x23, 0x23,
+    0x23, 0xF0, 0x13, 0x22, 0x22, 0x32, 0x31, 0x92, 0x74, 0x54, 0x63, 0x63,
+    0x64, 0x93, 0xA3, 0x94, 0x94, 0x92, 0x0F, 0x07, 0xF0, 0x7F, 0x07, 0x02,
+    0x94, 0x94, 0x93, 0xA3, 0x94, 0x63, 0x63, 0x64, 0x54, 0x72, 0x15, 0x27,
+    0x12, 0x44, 0x42, 0x62, 0x43, 0x43, 0x52, 0xF0, 0x63, 0x53, 0x33, 0x22,
+    0x21, 0x21, 0x42, 0x52, 0x52, 0x34, 0x21, 0x22, 0x21, 0x22, 0x21, 0x22,
+    0x34, 0x71, 0x61, 0x41, 0x24, 0x26, 0x66, 0x93, 0x82, 0x12, 0x72, 0x12,
+    0x62, 0x22, 0x62, 0x32, 0x48, 0x48, 0x32, 0x62, 0x14, 0x48, 0x44, 0x07,
+    0x38, 0x32, 0x42, 0x22, 0x42, 0x22, 0x33, 0x27, 0x38, 0x22, 0x43, 0x12,
+    0x52, 0x12, 0x5F, 0x06, 0x34, 0x12, 0x28, 0x13, 0x36, 0x54, 0x82, 0x82,
+    0x82, 0x83, 0x52, 0x13, 0x33, 0x27, 0x45, 0x08, 0x39, 0x32, 0x43, 0x22,
+    0x53, 0x12, 0x62, 0x12, 0x62, 0x12, 0x62, 0x12, 0x62, 0x12, 0x53, 0x12,
+    0x43, 0x19, 0x28, 0x0F, 0x05, 0x12, 0x52, 0x12, 0x52, 0x12, 0x22, 0x46,
+    0x46, 0x42, 0x22, 0x42, 0x52, 0x12, 0x5F, 0x07, 0x0F, 0x05, 0x12, 0x52,
+    0x12, 0x52, 0x12, 0x22, 0x46, 0x46, 0x42, 0x22, 0x42, 0x82, 0x76, 0x46,
+    0x34, 0x12, 0x29, 0x22, 0x43, 0x12, 0x62, 0x12, 0x92, 0x92, 0x38, 0x38,
+    0x62, 0x22, 0x52, 0x29, 0x45, 0x04, 0x28, 0x24, 0x12, 0x42, 0x22, 0x42,
+    0x22, 0x42, 0x28, 0x28, 0x22, 0x42, 0x22, 0x42, 0x22, 0x42, 0x14, 0x28,
+    0x24, 0x0F, 0x01, 0x32, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x3F,
+    0x01, 0x47, 0x47, 0x72, 0x92, 0x92, 0x92, 0x22, 0x52, 0x22, 0x52, 0x22,
+    0x52, 0x22, 0x43, 0x28, 0x55, 0x05, 0x1A, 0x15, 0x12, 0x33, 0x32, 0x22,
+    0x52, 0x12, 0x65, 0x63, 0x12, 0x52, 0x32, 0x42, 0x32, 0x42, 0x42, 0x25,
+    0x29, 0x33, 0x06, 0x46, 0x62, 0x82, 0x82, 0x82, 0x82, 0x82, 0x42, 0x22,
+    0x42, 0x22, 0x4F, 0x07, 0x04, 0x48, 0x44, 0x13, 0x43, 0x24, 0x24, 0x22,
+    0x11, 0x21, 0x12, 0x22, 0x14, 0x12, 0x22, 0x14, 0x12, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x62, 0x15, 0x2A, 0x25, 0x03, 0x29, 0x15, 0x13,
+    0x32, 0x24, 0x22, 0x24, 0x22, 0x22, 0x12, 0x12, 0x22, 0x12, 0x12, 0x22,
+    0x24, 0x22, 0x24, 0x22, 0x33, 0x15, 0x13, 0x15, 0x22, 0x34, 0x56, 0x33,
+    0x23, 0x13, 0x45, 0x64, 0x64, 0x64, 0x65, 0x43, 0x13, 0x23, 0x36, 0x54,
+    0x08, 0x29, 0x22, 0x43, 0x12, 0x52, 0x12, 0x52, 0x12, 0x43, 0x18, 0x27,
+    0x32, 0x82, 0x76, 0x46, 0x34, 0x56, 0x33, 0x23, 0x13, 0x45, 0x64, 0x64,
+    0x64, 0x65, 0x43, 0x13, 0x23, 0x36, 0x54, 0x64, 0x12, 0x28, 0x22, 0x23,
+    0x08, 0x39, 0x32, 0x43, 0x22, 0x52, 0x22, 0x43, 0x28, 0x37, 0x42, 0x33,
+    0x32, 0x42, 0x32, 0x43, 0x15, 0x38, 0x42, 0x25, 0x12, 0x1C, 0x45, 0x65,
+    0x86, 0x66, 0x85, 0x65, 0x4C, 0x12, 0x15, 0x0F, 0x07, 0x22, 0x24, 0x22,
+    0x24, 0x22, 0x22, 0x42, 0x82, 0x82, 0x82, 0x82, 0x66, 0x46, 0x04, 0x28,
+    0x24, 0x12, 0x42, 0x22, 0x42, 0x22, 0x42, 0x22, 0x42, 0x22, 0x42, 0x22,
+    0x42, 0x22, 0x42, 0x23, 0x23, 0x36, 0x54, 0x04, 0x38, 0x34, 0x12, 0x52,
+    0x22, 0x52, 0x32, 0x32, 0x42, 0x32, 0x52, 0x12, 0x62, 0x12, 0x62, 0x12,
+    0x73, 0x83, 0x83, 0x05, 0x3A, 0x35, 0x12, 0x72, 0x22, 0x23, 0x22, 0x22,
+    0x23, 0x22, 0x22, 0x23, 0x22, 0x22, 0x12, 0x12, 0x12, 0x31, 0x12, 0x12,
+    0x11, 0x43, 0x33, 0x43, 0x33, 0x43, 0x33, 0x42, 0x52, 0x04, 0x38, 0x34,
+    0x12, 0x52, 0x32, 0x32, 0x52, 0x12, 0x73, 0x83, 0x72, 0x12, 0x52, 0x32,
+    0x32, 0x52, 0x14, 0x38, 0x34, 0x04, 0x28, 0x24, 0x12, 0x42, 0x32, 0x22,
+    0x54, 0x64, 0x72, 0x82, 0x82, 0x82, 0x66, 0x46, 0x0F, 0x03, 0x44, 0x32,
+    0x52, 0x52, 0x62, 0x52, 0x52, 0x34, 0x4F, 0x03, 0x0A, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x28, 0x02, 0x62, 0x72,
+    0x62, 0x62, 0x72, 0x62, 0x72, 0x62, 0x72, 0x62, 0x72, 0x62, 0x62, 0x72,
+    0x62, 0x08, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x2A, 0x41, 0x73, 0x52, 0x12, 0x32, 0x32, 0x12, 0x53, 0x71, 0x0F,
+    0x0D, 0x01, 0x42, 0x41, 0x26, 0x38, 0x82, 0x37, 0x28, 0x13, 0x42, 0x12,
+    0x43, 0x1A, 0x15, 0x13, 0x03, 0x83, 0x92, 0x92, 0x92, 0x14, 0x49, 0x23,
+    0x42, 0x22, 0x62, 0x12, 0x62, 0x12, 0x62, 0x13, 0x42, 0x1A, 0x13, 0x14,
+    0x34, 0x12, 0x19, 0x12, 0x54, 0x64, 0x82, 0x83, 0x52, 0x19, 0x26, 0x73,
+    0x83, 0x92, 0x92, 0x44, 0x12, 0x29, 0x22, 0x43, 0x12, 0x62, 0x12, 0x62,
+    0x12, 0x62, 0x13, 0x43, 0x2A, 0x34, 0x13, 0x34, 0x48, 0x22, 0x42, 0x1F,
+    0x07, 0x92, 0x52, 0x19, 0x35, 0x36, 0x27, 0x22, 0x72, 0x58, 0x18, 0x32,
+    0x72, 0x72, 0x72, 0x72, 0x58, 0x18, 0x34, 0x13, 0x1A, 0x12, 0x43, 0x12,
+    0x62, 0x12, 0x62, 0x12, 0x62, 0x22, 0x43, 0x29, 0x44, 0x12, 0x92, 0x83,
+    0x37, 0x46, 0x03, 0x73, 0x82, 0x82, 0x82, 0x14, 0x38, 0x23, 0x32, 0x22,
+    0x42, 0x22, 0x42, 0x22, 0x42, 0x22, 0x42, 0x14, 0x28, 0x24, 0x32, 0x62,
+    0xF0, 0x45, 0x35, 0x62, 0x62, 0x62, 0x62, 0x62, 0x3F, 0x01, 0x42, 0x62,
+    0xF0, 0x47, 0x17, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x5A,
+    0x16, 0x03, 0x73, 0x82, 0x82, 0x82, 0x15, 0x22, 0x15, 0x22, 0x12, 0x54,
+    0x64, 0x62, 0x12, 0x52, 0x22, 0x33, 0x28, 0x25, 0x05, 0x35, 0x62, 0x62,
+    0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x3F, 0x01, 0x06, 0x13, 0x2B,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x14, 0x13, 0x17, 0x13, 0x13, 0x03, 0x14, 0x29, 0x23,
+    0x32, 0x22, 0x42, 0x22, 0x42, 0x22, 0x42, 0x22, 0x42, 0x14, 0x28, 0x24,
+    0x34, 0x48, 0x22, 0x42, 0x12, 0x64, 0x64, 0x62, 0x12, 0x42, 0x28, 0x44,
+    0x03, 0x14, 0x3A, 0x23, 0x42, 0x22, 0x62, 0x12, 0x62, 0x12, 0x62, 0x13,
+    0x42, 0x29, 0x22, 0x14, 0x42, 0x92, 0x85, 0x65, 0x34, 0x13, 0x1A, 0x12,
+    0x43, 0x12, 0x62, 0x12, 0x62, 0x12, 0x62, 0x22, 0x43, 0x29, 0x44, 0x12,
+    0x92, 0x92, 0x75, 0x65, 0x04, 0x23, 0x14, 0x15, 0x24, 0x22, 0x23, 0x72,
+    0x82, 0x82, 0x68, 0x28, 0x2F, 0x01, 0x46, 0x56, 0x56, 0x4F, 0x01, 0x22,
+    0x82, 0x82, 0x69, 0x19, 0x32, 0x82, 0x82, 0x82, 0x82, 0x42, 0x28, 0x35,
+    0x03, 0x33, 0x13, 0x33, 0x22, 0x42, 0x22, 0x42, 0x22, 0x42, 0x22, 0x42,
+    0x22, 0x33, 0x29, 0x24, 0x13, 0x04, 0x38, 0x34, 0x12, 0x52, 0x32, 0x32,
+    0x42, 0x32, 0x52, 0x12, 0x62, 0x12, 0x73, 0x83, 0x04, 0x38, 0x34, 0x12,
+    0x21, 0x22, 0x22, 0x21, 0x22, 0x22, 0x16, 0x33, 0x13, 0x43, 0x13, 0x42,
+    0x32, 0x42, 0x32, 0x04, 0x28, 0x24, 0x22, 0x22, 0x54, 0x72, 0x74, 0x52,
+    0x22, 0x24, 0x28, 0x24, 0x04, 0x38, 0x34, 0x12, 0x52, 0x32, 0x32, 0x42,
+    0x32, 0x52, 0x12, 0x65, 0x73, 0x82, 0x92, 0x82, 0x67, 0x47, 0x0F, 0x03,
+    0x32, 0x52, 0x52, 0x52, 0x52, 0x3F, 0x03, 0x33, 0x24, 0x22, 0x42, 0x42,
+    0x42, 0x42, 0x33, 0x23, 0x43, 0x42, 0x42, 0x42, 0x42, 0x44, 0x33, 0x0F,
+    0x0F, 0x02, 0x03, 0x34, 0x42, 0x42, 0x42, 0x42, 0x42, 0x43, 0x43, 0x23,
+    0x32, 0x42, 0x42, 0x42, 0x24, 0x23, 0x23, 0x56, 0x24, 0x26, 0x54,
+};
+
+static const sGLYPH_RLE Font20_Glyphs[FONT_RLE_GLYPHS + 1] = {
+    {0, 0, 0, 0, 0}, // ' '
+    {0, 5, 1, 3, 13}, // '!'
+    {5, 3, 2, 8, 6}, // '"'
+    {15, 2, 0, 10, 16}, // '#'
+    {43, 3, 0, 8, 16}, // '$'
+    {57, 2, 1, 9, 13}, // '%'
+    {78, 3, 3, 9, 11}, // '&'
+    {91, 6, 2, 3, 6}, // '\''
+    {95, 6, 1, 4, 16}, // '('
+    {111, 4, 1, 4, 16}, // ')'
+    {127, 3, 1, 8, 9}, // '*'
+    {138, 2, 3, 10, 10}, // '+'
+    {148, 5, 11, 4, 6}, // ','
+    {154, 2, 7, 9, 2}, // '-'
+    {156, 6, 11, 3, 3}, // '.'
+    {157, 3, 0, 8, 16}, // '/'
+    {173, 2, 1, 9, 13}, // '0'
+    {189, 3, 1, 8, 13}, // '1'
+    {202, 2, 1, 9, 13}, // '2'
+    {216, 1, 1, 10, 13}, // '3'
+    {229, 2, 1, 9, 13}, // '4'
+    {247, 2, 1, 9, 13}, // '5'
+    {260, 2, 1, 9, 13}, // '6'
+    {276, 2, 1, 9, 13}, // '7'
+    {289, 2, 1, 9, 13}, // '8'
+    {304, 2, 1, 9, 13}, // '9'
+    {320, 6, 5, 3, 9}, // ':'
+    {322, 5, 5, 5, 11}, // ';'
+    {331, 1, 3, 11, 11}, // '<'
+    {342, 1, 5, 11, 6}, // '='
+    {347, 2, 3, 11, 11}, // '>'
+    {358, 3, 2, 8, 12}, // '?'
+    {370, 3, 1, 7, 14}, // '@'
+    {389, 1, 2, 12, 12}, // 'A'
+    {407, 2, 2, 10, 12}, // 'B'
+    {424, 2, 2, 10, 12}, // 'C'
+    {439, 1, 2, 11, 12}, // 'D'
+    {459, 2, 2, 10, 12}, // 'E'
+    {476, 2, 2, 10, 12}, // 'F'
+    {492, 2, 2, 11, 12}, // 'G'
+    {509, 2, 2, 10, 12}, // 'H'
+    {529, 3, 2, 8, 12}, // 'I'
+    {541, 2, 2, 11, 12}, // 'J'
+    {557, 2, 2, 11, 12}, // 'K'
+    {578, 2, 2, 10, 12}, // 'L'
+    {592, 1, 2, 12, 12}, // 'M'
+    {620, 2, 2, 10, 12}, // 'N'
+    {645, 2, 2, 10, 12}, // 'O'
+    {660, 2, 2, 10, 12}, // 'P'
+    {676, 2, 2, 10, 15}, // 'Q'
+    {696, 2, 2, 11, 12}, // 'R'
+    {715, 2, 2, 10, 12}, // 'S'
+    {727, 2, 2, 10, 12}, // 'T'
+    {742, 2, 2, 10, 12}, // 'U'
+    {763, 1, 2, 11, 12}, // 'V'
+    {783, 1, 2, 13, 12}, // 'W'
+    {813, 1, 2, 11, 12}, // 'X'
+    {833, 2, 2, 10, 12}, // 'Y'
+    {848, 3, 2, 8, 12}, // 'Z'
+    {860, 6, 1, 4, 16}, // '['
+    {873, 3, 0, 8, 16}, // '\\'
+    {889, 4, 1, 4, 16}, // ']'
+    {902, 2, 1, 9, 6}, // '^'
+    {911, 0, 18, 14, 2}, // '_'
+    {913, 5, 1, 4, 3}, // '`'
+    {916, 2, 5, 10, 9}, // 'a'
+    {928, 1, 1, 11, 13}, // 'b'
+    {948, 2, 5, 10, 9}, // 'c'
+    {959, 2, 1, 11, 13}, // 'd'
+    {979, 2, 5, 10, 9}, // 'e'
+    {989, 3, 1, 9, 13}, // 'f'
+    {1002, 2, 5, 11, 13}, // 'g'
+    {1022, 2, 1, 10, 13}, // 'h'
+    {1042, 3, 1, 8, 13}, // 'i'
+    {1054, 2, 1, 8, 17}, // 'j'
+    {1069, 2, 1, 10, 13}, // 'k'
+    {1088, 3, 1, 8, 13}, // 'l'
+    {1101, 1, 5, 12, 9}, // 'm'
+    {1124, 2, 5, 10, 9}, // 'n'
+    {1140, 2, 5, 10, 9}, // 'o'
+    {1152, 1, 5, 11, 13}, // 'p'
+    {1172, 2, 5, 11, 13}, // 'q'
+    {1192, 2, 5, 10, 9}, // 'r'
+    {1204, 3, 5, 8, 9}, // 's'
+    {1211, 2, 2, 10, 12}, // 't'
+    {1224, 2, 5, 10, 9}, // 'u'
+    {1241, 1, 5, 11, 9}, // 'v'
+    {1256, 1, 5, 11, 9}, // 'w'
+    {1275, 2, 5, 10, 9}, // 'x'
+    {1288, 1, 5, 11, 13}, // 'y'
+    {1306, 3, 5, 8, 9}, // 'z'
+    {1315, 4, 1, 6, 16}, // '{'
+    {1331, 6, 1, 2, 16}, // '|'
+    {1334, 3, 1, 6, 16}, // '}'
+    {1350, 2, 6, 10, 4}, // '~'
+    {1355, 0, 0, 0, 0}, // end
+};
+
+sFONT_RLE Font20Rle = {14, 20, Font20_Glyphs, Font20_Runs};
+
+static const uint8_t Font24_Runs[1643] = {
+    0x0F, 0x0C, 0x11, 0x21, 0x76, 0x03, 0x26, 0x26, 0x23, 0x11, 0x41, 0x21,
+    0x41, 0x21, 0x41, 0x21, 0x41, 0x32, 0x22, 0x52, 0x22, 0x52, 0x22, 0x52,
+    0x22, 0x52, 0x22, 0x2F, 0x07, 0x32, 0x22, 0x42, 0x22, 0x3F, 0x07, 0x22,
+    0x22, 0x52, 0x22, 0x52, 0x22, 0x52, 0x22, 0x52, 0x22, 0x42, 0x72, 0x54,
+    0x12, 0x1A, 0x45, 0x46, 0x75, 0x56, 0x66, 0x55, 0x45, 0x3B, 0x12, 0x14,
+    0x62, 0x72, 0x72, 0x72, 0x24, 0x56, 0x33, 0x23, 0x22, 0x42, 0x22, 0x42,
+    0x23, 0x23, 0x39, 0x26, 0x29, 0x33, 0x23, 0x22, 0x42, 0x22, 0x42, 0x23,
+    0x23, 0x36, 0x54, 0x36, 0x47, 0x32, 0x32, 0x42, 0x92, 0xA2, 0x93, 0x75,
+    0x26, 0x19, 0x34, 0x22, 0x43, 0x3A, 0x25, 0x13, 0x09, 0x11, 0x21, 0x21,
+    0x21, 0x42, 0x33, 0x23, 0x24, 0x23, 0x33, 0x23, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x43, 0x33, 0x43, 0x33, 0x43, 0x42, 0x02, 0x43, 0x43, 0x33, 0x43,
+    0x33, 0x43, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x33, 0x24, 0x23, 0x23,
+    0x32, 0x42, 0x82, 0x82, 0x43, 0x12, 0x1D, 0x26, 0x54, 0x64, 0x52, 0x22,
+    0x42, 0x22, 0x52, 0xA2, 0xA2, 0xA2, 0xA2, 0x5F, 0x09, 0x52, 0xA2, 0xA2,
+    0xA2, 0xA2, 0x23, 0x22, 0x23, 0x22, 0x32, 0x22, 0x32, 0x0F, 0x05, 0x0C,
+    0x82, 0x82, 0x73, 0x72, 0x73, 0x72, 0x82, 0x72, 0x82, 0x72, 0x82, 0x72,
+    0x82, 0x72, 0x82, 0x73, 0x72, 0x73, 0x72, 0x82, 0x34, 0x56, 0x32, 0x42,
+    0x22, 0x42, 0x12, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x12, 0x42,
+    0x22, 0x42, 0x36, 0x54, 0x51, 0x64, 0x46, 0x43, 0x12, 0x82, 0x82, 0x82,
+    0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x4F, 0x05, 0x35, 0x49, 0x13, 0x52,
+    0x12, 0x74, 0x72, 0x92, 0x82, 0x82, 0x73, 0x73, 0x72, 0x82, 0x82, 0x8F,
+    0x07, 0x34, 0x47, 0x32, 0x33, 0x82, 0x82, 0x72, 0x54, 0x65, 0x83, 0x92,
+    0x82, 0x84, 0x5C, 0x26, 0x63, 0x74, 0x74, 0x62, 0x12, 0x52, 0x22, 0x52,
+    0x22, 0x42, 0x32, 0x42, 0x32, 0x32, 0x42, 0x22, 0x52, 0x2F, 0x07, 0x72,
+    0x67, 0x47, 0x19, 0x29, 0x22, 0x92, 0x92, 0x92, 0x14, 0x49, 0x23, 0x42,
+    0xA2, 0x92, 0x92, 0x94, 0x62, 0x1A, 0x36, 0x55, 0x37, 0x23, 0x63, 0x72,
+    0x72, 0x82, 0x14, 0x39, 0x13, 0x42, 0x12, 0x64, 0x64, 0x62, 0x12, 0x43,
+    0x18, 0x45, 0x0F, 0x07, 0x64, 0x53, 0x72, 0x82, 0x73, 0x72, 0x82, 0x73,
+    0x72, 0x82, 0x73, 0x72, 0x82, 0x26, 0x38, 0x13, 0x45, 0x64, 0x62, 0x12,
+    0x42, 0x36, 0x46, 0x32, 0x42, 0x12, 0x64, 0x64, 0x65, 0x43, 0x18, 0x36,
+    0x25, 0x48, 0x13, 0x42, 0x12, 0x64, 0x64, 0x62, 0x12, 0x43, 0x19, 0x34,
+    0x12, 0x82, 0x72, 0x73, 0x63, 0x27, 0x35, 0x0C, 0xF0, 0x5C, 0x24, 0x24,
+    0x24, 0xF0, 0xB3, 0x23, 0x32, 0x42, 0x32, 0x41, 0xB3, 0xA4, 0x84, 0x84,
+    0x84, 0x84, 0x84, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0xB3, 0x0F, 0x0B, 0xF0,
+    0xBF, 0x0B, 0x03, 0xB4, 0xC4, 0xC4, 0xC4, 0xC4, 0xC4, 0x84, 0x84, 0x84,
+    0x84, 0x84, 0xA3, 0x25, 0x37, 0x12, 0x45, 0x54, 0x52, 0x63, 0x53, 0x44,
+    0x53, 0x62, 0xF0, 0x93, 0x63, 0x35, 0x47, 0x23, 0x33, 0x12, 0x54, 0x46,
+    0x37, 0x23, 0x14, 0x22, 0x24, 0x22, 0x24, 0x22, 0x24, 0x37, 0x46, 0x92,
+    0x83, 0x42, 0x28, 0x35, 0x36, 0xA7, 0xD3, 0xC2, 0x12, 0xB2, 0x12, 0xA2,
+    0x32, 0x92, 0x32, 0x82, 0x42, 0x89, 0x6A, 0x62, 0x72, 0x42, 0x82, 0x26,
+    0x3D, 0x37, 0x0A, 0x3B, 0x42, 0x53, 0x32, 0x62, 0x32, 0x62, 0x32, 0x53,
+    0x39, 0x4A, 0x32, 0x63, 0x22, 0x72, 0x22, 0x72, 0x22, 0x7E, 0x1B, 0x45,
+    0x12, 0x2A, 0x13, 0x53, 0x12, 0x74, 0x84, 0xA2, 0xA2, 0xA2, 0xA2, 0xB2,
+    0x72, 0x13, 0x53, 0x29, 0x56, 0x09, 0x4B, 0x42, 0x53, 0x32, 0x62, 0x32,
+    0x72, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x22,
+    0x62, 0x32, 0x53, 0x1B, 0x2A, 0x0F, 0x09, 0x22, 0x62, 0x22, 0x62, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x66, 0x66, 0x62, 0x22, 0x62, 0x22, 0x22, 0x22,
+    0x62, 0x22, 0x6F, 0x0B, 0x0F, 0x09, 0x22, 0x62, 0x22, 0x62, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x66, 0x66, 0x62, 0x22, 0x62, 0x22, 0x62, 0xA2, 0x88,
+    0x48, 0x45, 0x12, 0x3A, 0x23, 0x53, 0x22, 0x72, 0x12, 0x82, 0x12, 0xB2,
+    0xB2, 0x49, 0x49, 0x82, 0x13, 0x72, 0x23, 0x53, 0x3A, 0x56, 0x06, 0x2C,
+    0x26, 0x22, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x4A, 0x4A, 0x42,
+    0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x26, 0x2C, 0x26, 0x0F, 0x05,
+    0x42, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x4F, 0x05,
+    0x3A, 0x3A, 0x82, 0xB2, 0xB2, 0xB2, 0xB2, 0x32, 0x62, 0x32, 0x62, 0x32,
+    0x62, 0x32, 0x62, 0x32, 0x52, 0x49, 0x65, 0x07, 0x25, 0x17, 0x25, 0x32,
+    0x52, 0x62, 0x42, 0x72, 0x32, 0x82, 0x22, 0x92, 0x13, 0x97, 0x83, 0x23,
+    0x72, 0x43, 0x62, 0x52, 0x62, 0x53, 0x37, 0x3C, 0x35, 0x08, 0x58, 0x82,
+    0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0xB2, 0x62, 0x32, 0x62, 0x32, 0x62, 0x32,
+    0x6F, 0x0D, 0x04, 0x89, 0x65, 0x23, 0x63, 0x44, 0x44, 0x44, 0x44, 0x42,
+    0x12, 0x22, 0x12, 0x42, 0x12, 0x22, 0x12, 0x42, 0x24, 0x22, 0x42, 0x24,
+    0x22, 0x42, 0x32, 0x32, 0x42, 0x82, 0x42, 0x82, 0x27, 0x2E, 0x27, 0x04,
+    0x3B, 0x37, 0x23, 0x52, 0x44, 0x42, 0x45, 0x32, 0x42, 0x12, 0x32, 0x42,
+    0x13, 0x22, 0x42, 0x23, 0x12, 0x42, 0x32, 0x12, 0x42, 0x35, 0x42, 0x44,
+    0x42, 0x53, 0x27, 0x32, 0x27, 0x32, 0x44, 0x68, 0x33, 0x43, 0x22, 0x62,
+    0x13, 0x65, 0x84, 0x84, 0x84, 0x85, 0x63, 0x12, 0x62, 0x23, 0x43, 0x38,
+    0x64, 0x0A, 0x2B, 0x32, 0x53, 0x22, 0x62, 0x22, 0x62, 0x22, 0x62, 0x22,
+    0x52, 0x39, 0x37, 0x52, 0xA2, 0xA2, 0x88, 0x48, 0x44, 0x68, 0x33, 0x43,
+    0x22, 0x62, 0x13, 0x65, 0x84, 0x84, 0x84, 0x85, 0x63, 0x12, 0x62, 0x23,
+    0x43, 0x38, 0x55, 0x75, 0x22, 0x2A, 0x22, 0x43, 0x0A, 0x4B, 0x52, 0x53,
+    0x42, 0x62, 0x42, 0x62, 0x42, 0x53, 0x49, 0x57, 0x72, 0x33, 0x62, 0x43,
+    0x52, 0x52, 0x52, 0x53, 0x27, 0x3B, 0x43, 0x25, 0x12, 0x1C, 0x45, 0x64,
+    0x66, 0x76, 0x66, 0x76, 0x64, 0x65, 0x4C, 0x12, 0x15, 0x0F, 0x0B, 0x32,
+    0x34, 0x32, 0x34, 0x32, 0x34, 0x32, 0x32, 0x52, 0xA2, 0xA2, 0xA2, 0xA2,
+    0xA2, 0x78, 0x48, 0x06, 0x2C, 0x26, 0x22, 0x62, 0x42, 0x62, 0x42, 0x62,
+    0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62,
+    0x52, 0x42, 0x68, 0x84, 0x07, 0x1E, 0x17, 0x22, 0x72, 0x52, 0x52, 0x62,
+    0x52, 0x62, 0x52, 0x72, 0x32, 0x82, 0x32, 0x92, 0x12, 0xA2, 0x12, 0xA2,
+    0x12, 0xB3, 0xC3, 0xD1, 0x07, 0x3E, 0x37, 0x22, 0x92, 0x42, 0x92, 0x42,
+    0x41, 0x42, 0x52, 0x23, 0x22, 0x62, 0x23, 0x22, 0x62, 0x12, 0x12, 0x12,
+    0x62, 0x12, 0x12, 0x12, 0x64, 0x25, 0x73, 0x33, 0x83, 0x33, 0x82, 0x52,
+    0x82, 0x52, 0x06, 0x2C, 0x26, 0x22, 0x62, 0x52, 0x42, 0x72, 0x22, 0x94,
+    0xB2, 0xC2, 0xB4, 0x92, 0x22, 0x72, 0x42, 0x52, 0x62, 0x26, 0x2C, 0x26,
+    0x05, 0x3B, 0x36, 0x22, 0x62, 0x52, 0x42, 0x72, 0x22, 0x82, 0x22, 0x94,
+    0xB2, 0xC2, 0xC2, 0xC2, 0xC2, 0x98, 0x68, 0x1A, 0x1A, 0x12, 0x62, 0x12,
+    0x52, 0x22, 0x42, 0x32, 0x32, 0x82, 0x82, 0x82, 0x42, 0x22, 0x52, 0x12,
+    0x64, 0x7F, 0x09, 0x0C, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x32, 0x3A, 0x02, 0x82, 0x83, 0x82, 0x83, 0x82,
+    0x82, 0x92, 0x82, 0x92, 0x82, 0x92, 0x82, 0x92, 0x82, 0x83, 0x82, 0x83,
+    0x82, 0x82, 0x0A, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+    0x32, 0x32, 0x32, 0x32, 0x3C, 0x51, 0x93, 0x75, 0x53, 0x13, 0x42, 0x32,
+    0x32, 0x52, 0x12, 0x73, 0x91, 0x0F, 0x0F, 0x02, 0x02, 0x33, 0x43, 0x32,
+    0x26, 0x58, 0xB2, 0xA2, 0x57, 0x39, 0x23, 0x52, 0x22, 0x62, 0x22, 0x53,
+    0x3B, 0x25, 0x14, 0x04, 0x94, 0xB2, 0xB2, 0xB2, 0x15, 0x5A, 0x33, 0x52,
+    0x32, 0x72, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x23, 0x52,
+    0x1C, 0x14, 0x15, 0x45, 0x12, 0x2A, 0x13, 0x56, 0x74, 0x84, 0xA2, 0xA3,
+    0x72, 0x13, 0x53, 0x29, 0x56, 0x74, 0x94, 0xB2, 0xB2, 0x55, 0x12, 0x3A,
+    0x32, 0x53, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72,
+    0x32, 0x53, 0x3C, 0x35, 0x14, 0x36, 0x4A, 0x22, 0x62, 0x12, 0x8F, 0x0D,
+    0xA2, 0xB2, 0x72, 0x1B, 0x37, 0x57, 0x48, 0x32, 0xA2, 0x7B, 0x1B, 0x42,
+    0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0x7A, 0x2A, 0x35, 0x14, 0x1C, 0x12,
+    0x53, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x32,
+    0x53, 0x3A, 0x55, 0x12, 0xB2, 0xB2, 0xA3, 0x48, 0x56, 0x04, 0xA4, 0xC2,
+    0xC2, 0xC2, 0x15, 0x69, 0x53, 0x43, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62,
+    0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x26, 0x2C, 0x26, 0x52, 0xA2, 0xF0,
+    0xF6, 0x66, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0x5F, 0x09, 0x52,
+    0x72, 0xF0, 0x5F, 0x03, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72, 0x72,
+    0x72, 0x72, 0x72, 0x6B, 0x16, 0x04, 0x84, 0xA2, 0xA2, 0xA2, 0x25, 0x32,
+    0x25, 0x32, 0x22, 0x62, 0x12, 0x75, 0x74, 0x85, 0x72, 0x13, 0x62, 0x23,
+    0x34, 0x39, 0x35, 0x16, 0x66, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+    0xA2, 0xA2, 0xA2, 0xA2, 0x5F, 0x09, 0x04, 0x13, 0x14, 0x3E, 0x43, 0x23,
+    0x22, 0x42, 0x32, 0x32, 0x42, 0x32, 0x32, 0x42, 0x32, 0x32, 0x42, 0x32,
+    0x32, 0x42, 0x32, 0x32, 0x42, 0x32, 0x32, 0x26, 0x14, 0x1A, 0x14, 0x14,
+    0x04, 0x15, 0x4B, 0x53, 0x43, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42,
+    0x62, 0x42, 0x62, 0x42, 0x62, 0x26, 0x2C, 0x26, 0x44, 0x68, 0x33, 0x43,
+    0x13, 0x65, 0x84, 0x84, 0x85, 0x63, 0x13, 0x43, 0x38, 0x64, 0x04, 0x15,
+    0x3C, 0x33, 0x52, 0x32, 0x72, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x22,
+    0x72, 0x23, 0x52, 0x3A, 0x32, 0x15, 0x52, 0xB2, 0xB2, 0x97, 0x67, 0x35,
+    0x14, 0x1C, 0x12, 0x53, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72, 0x22, 0x72,
+    0x22, 0x72, 0x32, 0x53, 0x3A, 0x55, 0x12, 0xB2, 0xB2, 0xB2, 0x87, 0x67,
+    0x05, 0x24, 0x15, 0x16, 0x35, 0x22, 0x33, 0x92, 0xA2, 0xA2, 0xA2, 0xA2,
+    0x7A, 0x2A, 0x28, 0x1B, 0x64, 0x68, 0x58, 0x67, 0x64, 0x5C, 0x18, 0x22,
+    0xA2, 0xA2, 0xA2, 0x8A, 0x2A, 0x42, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2, 0xA2,
+    0x53, 0x39, 0x46, 0x04, 0x44, 0x24, 0x44, 0x42, 0x62, 0x42, 0x62, 0x42,
+    0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x62, 0x42, 0x53, 0x5B, 0x45, 0x14,
+    0x05, 0x4A, 0x45, 0x22, 0x62, 0x42, 0x62, 0x52, 0x42, 0x62, 0x42, 0x72,
+    0x22, 0x82, 0x22, 0x86, 0x94, 0xA4, 0x04, 0x58, 0x54, 0x12, 0x31, 0x32,
+    0x22, 0x23, 0x22, 0x22, 0x23, 0x22, 0x32, 0x11, 0x11, 0x12, 0x44, 0x14,
+    0x44, 0x14, 0x43, 0x32, 0x62, 0x32, 0x62, 0x32, 0x05, 0x2A, 0x25, 0x22,
+    0x42, 0x52, 0x22, 0x74, 0x92, 0x94, 0x72, 0x22, 0x52, 0x42, 0x25, 0x2A,
+    0x25, 0x06, 0x4B, 0x45, 0x22, 0x72, 0x52, 0x52, 0x62, 0x52, 0x72, 0x32,
+    0x82, 0x32, 0x92, 0x12, 0xA5, 0xB3, 0xD2, 0xC2, 0xD2, 0xC2, 0x98, 0x78,
+    0x0F, 0x07, 0x52, 0x12, 0x42, 0x72, 0x72, 0x72, 0x72, 0x42, 0x12, 0x5F,
+    0x07, 0x33, 0x24, 0x22, 0x42, 0x42, 0x42, 0x42, 0x42, 0x33, 0x23, 0x43,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x44, 0x33, 0x0F, 0x0F, 0x06, 0x03, 0x34,
+    0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x43, 0x43, 0x23, 0x32, 0x42, 0x42,
+    0x42, 0x42, 0x24, 0x23, 0x23, 0x75, 0x35, 0x13, 0x15, 0x35, 0x73,
+};
+
+static const sGLYPH_RLE Font24_Glyphs[FONT_RLE_GLYPHS + 1] = {
+    {0, 0, 0, 0, 0}, // ' '
+    {0, 6, 2, 3, 15}, // '!'
+    {5, 4, 3, 8, 7}, // '"'
+    {17, 2, 2, 11, 16}, // '#'
+    {45, 3, 1, 9, 19}, // '$'
+    {64, 3, 2, 10, 15}, // '%'
+    {87, 3, 4, 11, 13}, // '&'
+    {104, 6, 3, 3, 7}, // '\''
+    {109, 7, 2, 6, 18}, // '('
+    {127, 3, 2, 6, 18}, // ')'
+    {145, 3, 2, 10, 10}, // '*'
+    {158, 2, 4, 12, 12}, // '+'
+    {170, 6, 14, 5, 7}, // ','
+    {177, 3, 9, 10, 2}, // '-'
+    {179, 6, 14, 4, 3}, // '.'
+    {180, 3, 0, 10, 20}, // '/'
+    {200, 3, 2, 10, 15}, // '0'
+    {220, 3, 2, 10, 15}, // '1'
+    {236, 2, 2, 11, 15}, // '2'
+    {253, 3, 2, 10, 15}, // '3'
+    {268, 2, 2, 11, 15}, // '4'
+    {290, 2, 2, 11, 15}, // '5'
+    {307, 3, 2, 10, 15}, // '6'
+    {326, 3, 2, 10, 15}, // '7'
+    {341, 3, 2, 10, 15}, // '8'
+    {360, 3, 2, 10, 15}, // '9'
+    {379, 6, 6, 4, 11}, // ':'
+    {382, 6, 6, 6, 13}, // ';'
+    {392, 0, 4, 14, 13}, // '<'
+    {405, 1, 7, 13, 6}, // '='
+    {410, 1, 4, 14, 13}, // '>'
+    {423, 3, 3, 9, 14}, // '?'
+    {437, 3, 2, 10, 17}, // '@'
+    {460, 0, 3, 16, 14}, // 'A'
+    {482, 1, 3, 13, 14}, // 'B'
+    {503, 2, 3, 12, 14}, // 'C'
+    {521, 1, 3, 13, 14}, // 'D'
+    {545, 1, 3, 12, 14}, // 'E'
+    {568, 2, 3, 12, 14}, // 'F'
+    {589, 2, 3, 13, 14}, // 'G'
+    {610, 1, 3, 14, 14}, // 'H'
+    {634, 3, 3, 10, 14}, // 'I'
+    {648, 2, 3, 13, 14}, // 'J'
+    {667, 1, 3, 15, 14}, // 'K'
+    {693, 1, 3, 13, 14}, // 'L'
+    {710, 0, 3, 16, 14}, // 'M'
+    {743, 1, 3, 14, 14}, // 'N'
+    {774, 2, 3, 12, 14}, // 'O'
+    {793, 2, 3, 12, 14}, // 'P'
+    {812, 2, 3, 12, 17}, // 'Q'
+    {836, 1, 3, 14, 14}, // 'R'
+    {859, 3, 3, 10, 14}, // 'S'
+    {873, 2, 3, 12, 14}, // 'T'
+    {891, 1, 3, 14, 14}, // 'U'
+    {916, 1, 3, 15, 14}, // 'V'
+    {940, 0, 3, 17, 14}, // 'W'
+    {974, 1, 3, 14, 14}, // 'X'
+    {996, 1, 3, 14, 14}, // 'Y'
+    {1015, 2, 3, 11, 14}, // 'Z'
+    {1035, 7, 2, 5, 18}, // '['
+    {1050, 3, 0, 10, 20}, // '\\'
+    {1070, 4, 2, 5, 18}, // ']'
+    {1085, 3, 1, 11, 8}, // '^'
+    {1097, 0, 22, 16, 2}, // '_'
+    {1100, 6, 1, 5, 4}, // '`'
+    {1104, 2, 6, 12, 11}, // 'a'
+    {1119, 1, 2, 13, 15}, // 'b'
+    {1143, 2, 6, 12, 11}, // 'c'
+    {1157, 2, 2, 13, 15}, // 'd'
+    {1181, 2, 6, 12, 11}, // 'e'
+    {1193, 2, 2, 12, 15}, // 'f'
+    {1208, 2, 6, 13, 16}, // 'g'
+    {1233, 1, 2, 14, 15}, // 'h'
+    {1257, 2, 2, 12, 15}, // 'i'
+    {1271, 3, 2, 9, 20}, // 'j'
+    {1289, 2, 2, 12, 15}, // 'k'
+    {1311, 2, 2, 12, 15}, // 'l'
+    {1326, 0, 6, 16, 11}, // 'm'
+    {1356, 1, 6, 14, 11}, // 'n'
+    {1376, 2, 6, 12, 11}, // 'o'
+    {1390, 1, 6, 13, 16}, // 'p'
+    {1415, 2, 6, 13, 16}, // 'q'
+    {1440, 2, 6, 12, 11}, // 'r'
+    {1454, 3, 6, 10, 11}, // 's'
+    {1463, 2, 2, 12, 15}, // 't'
+    {1479, 1, 6, 14, 11}, // 'u'
+    {1500, 1, 6, 14, 11}, // 'v'
+    {1518, 1, 6, 13, 11}, // 'w'
+    {1544, 2, 6, 12, 11}, // 'x'
+    {1561, 1, 6, 15, 16}, // 'y'
+    {1584, 3, 6, 10, 11}, // 'z'
+    {1597, 5, 2, 6, 18}, // '{'
+    {1615, 7, 2, 2, 18}, // '|'
+    {1618, 5, 2, 6, 18}, // '}'
+    {1636, 2, 8, 11, 5}, // '~'
+    {1643, 0, 0, 0, 0}, // end
+};
+
+sFONT_RLE Font24Rle = {17, 24, Font24_Glyphs, Font24_Runs};
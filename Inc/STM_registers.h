@@ -10,10 +10,11 @@
 
 #include "ov2640.h"
 
-#define RES_STM160x120 (160 * 120 * 3)
-#define RES_STM320x240 (320 * 240 * 3)
-#define RES_STM480x272 (480 * 272 * 3)
-#define RES_STM640x480 (640 * 480 * 3)
+/* Raw (RGB565) output sequences, {0xff, 0xff} terminated. Used by the
+ * camera mode table (camera_mode.c). */
+extern const unsigned char OV2640_480x272[][2];
+extern const unsigned char OV2640_VGA[][2];
+extern const unsigned char OV2640_QVGA[][2];
+extern const unsigned char OV2640_QQVGA[][2];
 
-void STM_OV2640_ResolutionConfiguration(unsigned opt);
 #endif /* STM_REGISTERS_H_ */
@@ -0,0 +1,96 @@
+/*
+ * camera_capture.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * Single frame capture over DCMI + DMA.
+ *
+ * The received length is taken from the DMA stream counter (NDTR) when the
+ * frame end event arrives, so the buffer does not have to be cleared before
+ * a shot and the frame does not have to be scanned for its end afterwards.
+ * The DCMI DMA stream runs in normal mode for these single transfers: a
+ * raw frame filling the buffer exactly ends with NDTR at 0, in circular
+ * mode it would be reloaded and the frame read as empty.
+ * In JPEG modes DCMI runs in hardware JPEG mode (data captured only while
+ * HSYNC is active) and the length is trimmed to the EOI marker, which lies
+ * in the last few bytes of the received data.
+ *
+ * Frames larger than one contiguous buffer are captured with
+ * CAM_CaptureStream(): DMA runs in circular mode over a small
+ * non-cacheable ring and every completed half of the ring is handed to a
+ * sink (copy into a larger destination, UART, marker scanner...).
+ *
+ * A region of interest (CAM_SetRoi()) limits uncompressed captures to a
+ * rectangle of the frame with the DCMI crop window: the pixels outside are
+ * dropped by DCMI before the DMA, so the buffer, the DMA traffic and the
+ * time to display shrink with the area. The window registers are written
+ * before every CAM_Capture(), a new ROI applies from the next frame on
+ * without touching the sensor.
+ *
+ * The first capture after a mode switch (CAM_TakeSettle()) takes two
+ * frames and returns the second, so a frame captured while the sensor
+ * settles never reaches the motion detector, the exposure control or the
+ * uplink.
+ */
+
+#ifndef CAMERA_CAPTURE_H_
+#define CAMERA_CAPTURE_H_
+
+#include "camera_mode.h"
+
+/// Rectangle of a frame in pixels
+typedef struct
+{
+    uint16_t x;
+    uint16_t y;
+    uint16_t width;
+    uint16_t height;
+} CAM_Roi;
+
+/// Published frame
+typedef struct
+{
+    uint8_t* data;            ///< Buffer the frame was captured into
+    uint32_t length;          ///< Exact number of valid bytes
+    uint32_t capacity;        ///< Size of the buffer
+    const CAM_ModeDesc* mode; ///< Mode the frame was captured in
+    uint32_t captureUs;       ///< Time from start of capture to frame end
+    CAM_Roi window;           ///< Part of the mode's frame held in data
+} CAM_Frame;
+
+/// Largest single DCMI DMA transfer (NDTR counts 32-bit words)
+#define CAM_MAX_TRANSFER (0xFFFFU * 4U)
+
+/// Size of the circular capture ring in bytes, drained in halves
+#define CAM_RING_SIZE 8192U
+
+/**
+ * Consumer of streamed frame data. Called from the DMA interrupt for every
+ * half of the ring and from CAM_CaptureStream() for the tail of the frame.
+ * It has to return before the DMA fills the other half of the ring.
+ */
+typedef void (*CAM_Sink)(const uint8_t* data, uint32_t length, void* context);
+
+/// Context of CAM_BufferSink()
+typedef struct
+{
+    uint8_t* dest;     ///< Destination, any alignment and memory
+    uint32_t capacity; ///< Size of dest
+    uint32_t length;   ///< Bytes stored so far
+    uint32_t dropped;  ///< Bytes which did not fit
+} CAM_BufferSinkContext;
+
+CAM_Status CAM_Capture(uint8_t* buffer, uint32_t capacity, CAM_Frame* frame,
+                       uint32_t timeoutMs);
+CAM_Status CAM_CaptureStream(CAM_Sink sink, void* context, CAM_Frame* frame,
+                             uint32_t timeoutMs);
+CAM_Status CAM_CaptureInto(uint8_t* dest, uint32_t capacity, CAM_Frame* frame,
+                           uint32_t timeoutMs);
+void CAM_BufferSink(const uint8_t* data, uint32_t length, void* context);
+CAM_Status CAM_SetRoi(const CAM_Roi* roi);
+uint8_t CAM_GetRoi(CAM_Roi* roi);
+uint32_t CAM_CaptureBytes(void);
+void CAM_CaptureFrameEvent(void);
+void CAM_CaptureError(void);
+
+#endif /* CAMERA_CAPTURE_H_ */
@@ -0,0 +1,84 @@
+/*
+ * camera_exposure.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * Closed-loop exposure control of the OV2640 from frame statistics.
+ *
+ * The sensor's own AEC / AGC is switched off (COM8) and the exposure time
+ * (AEC, in lines) and analog gain (GAIN) are set from the mean luma of the
+ * captured frames (image_stats.h), center weighted over the 3x3 regions.
+ *
+ * Exposure is handled as lines x gain. A step moves it by the ratio of the
+ * target to the measured luma, bounded to CAM_AE_MAX_STEP either way. The
+ * sensor applies new values one frame later, so the next
+ * CAM_AE_SETTLE_FRAMES frames are not measured. Lines are preferred over
+ * gain, and never exceed maxLines so the frame rate does not drop. With a
+ * sensor response close to linear, the target is reached from any
+ * starting point within CAM_AE_MAX_FRAMES frames.
+ *
+ * Registers are written through a shadow of their last known values: a
+ * step writes only the bytes that changed, and the bank is selected only
+ * when it is not bank 1 already. A mode switch rewrites the sensor from
+ * tables, so CAM_Apply() calls CAM_ExposureReapply(). Any other code
+ * which writes the sensor directly must call CAM_ExposureInvalidate().
+ */
+
+#ifndef CAMERA_EXPOSURE_H_
+#define CAMERA_EXPOSURE_H_
+
+#include "image_stats.h"
+
+#include <stdint.h>
+
+/// Largest exposure change of one step (ratio)
+#define CAM_AE_MAX_STEP 4U
+/// Frames not measured after a change
+#define CAM_AE_SETTLE_FRAMES 1U
+/// Steps across the widest range, 1 line x1 to 1248 lines (UXGA frame)
+/// x31: 4^8 > 38688
+#define CAM_AE_MAX_STEPS 8U
+/// Bound of the convergence in frames, the last one confirms the target
+#define CAM_AE_MAX_FRAMES                                                      \
+    (CAM_AE_MAX_STEPS * (1U + CAM_AE_SETTLE_FRAMES) + 1U)
+
+typedef enum
+{
+    CAM_AE_OFF = 0,    ///< Sensor AEC / AGC in control
+    CAM_AE_SETTLING,   ///< Frame skipped after a change
+    CAM_AE_ADJUSTED,   ///< New exposure written
+    CAM_AE_CONVERGED,  ///< Luma within the tolerance of the target
+    CAM_AE_LIMIT,      ///< Off target at the shortest / longest exposure
+    CAM_AE_SCCB_ERROR, ///< Register access failed, shadow invalidated
+} CAM_AeStatus;
+
+typedef struct
+{
+    uint8_t target;    ///< Mean luma aimed at
+    uint8_t tolerance; ///< Luma error accepted as converged
+    uint16_t maxLines; ///< Longest exposure, at most the lines of a frame
+    uint16_t maxGain;  ///< Highest gain in 1/16, 16 ... 496
+} CAM_AeConfig;
+
+typedef struct
+{
+    uint16_t lines; ///< Exposure in lines
+    uint16_t gain;  ///< Gain in 1/16
+    uint8_t luma;   ///< Last metered luma
+    CAM_AeStatus status;
+    uint32_t steps;       ///< Exposure changes written
+    uint32_t sccbWrites;  ///< Register writes, bank selects included
+    uint32_t sccbSkipped; ///< Writes avoided by the shadow
+    /// Frames from the first step after convergence was lost until it
+    /// was regained, last time
+    uint32_t convergeFrames;
+} CAM_AeState;
+
+CAM_AeStatus CAM_ExposureEnable(const CAM_AeConfig* config);
+void CAM_ExposureDisable(void);
+CAM_AeStatus CAM_ExposureUpdate(const STATS_Frame* stats);
+void CAM_ExposureInvalidate(void);
+void CAM_ExposureReapply(void);
+void CAM_ExposureGetState(CAM_AeState* state);
+
+#endif /* CAMERA_EXPOSURE_H_ */
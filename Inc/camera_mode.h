@@ -0,0 +1,82 @@
+/*
+ * camera_mode.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * Runtime selection of the OV2640 output mode (resolution + format).
+ *
+ * Every supported mode is described by an entry of a descriptor table:
+ * geometry, output format, size of the capture buffer and the register
+ * tables written to the sensor. A switch requested while DCMI is capturing
+ * is kept pending and applied by CAM_FrameBoundary() once the frame is
+ * complete, so the sensor is never reconfigured in the middle of a frame.
+ *
+ * The first frame after a switch may still be a mix of the old and the new
+ * setup. A switch leaves a settle flag which the capture functions of
+ * camera_capture.h take with CAM_TakeSettle(): they capture one frame and
+ * drop it before the one they return.
+ */
+
+#ifndef CAMERA_MODE_H_
+#define CAMERA_MODE_H_
+
+#include "main.h"
+
+/// Sensor output format
+typedef enum
+{
+    CAM_FORMAT_JPEG = 0,
+    CAM_FORMAT_YUV422,
+    CAM_FORMAT_RGB565,
+} CAM_Format;
+
+/// Supported modes, index of the descriptor table
+typedef enum
+{
+    CAM_MODE_JPEG_160x120 = 0,
+    CAM_MODE_JPEG_320x240,
+    CAM_MODE_JPEG_640x480,
+    CAM_MODE_JPEG_800x600,
+    CAM_MODE_JPEG_1024x768,
+    CAM_MODE_JPEG_1280x960,
+    CAM_MODE_RGB565_160x120,
+    CAM_MODE_RGB565_320x240,
+    CAM_MODE_RGB565_480x272,
+    CAM_MODE_RGB565_640x480,
+    CAM_MODE_YUV422_160x120,
+    CAM_MODE_YUV422_320x240,
+    CAM_MODE_COUNT
+} CAM_ModeId;
+
+/// Result of a mode switch request
+typedef enum
+{
+    CAM_OK = 0,  ///< Mode applied
+    CAM_PENDING, ///< Capture in progress, applied by CAM_FrameBoundary()
+    CAM_ERROR,   ///< Unknown mode, buffer too large or SCCB failure
+    CAM_TIMEOUT, ///< No frame end within the timeout
+} CAM_Status;
+
+/// Maximum number of register tables written for one mode
+#define CAM_MAX_TABLES 6
+
+/// Mode descriptor
+typedef struct
+{
+    const char* name;
+    uint16_t width;
+    uint16_t height;
+    CAM_Format format;
+    /// Capture buffer size in bytes (upper bound for JPEG)
+    uint32_t bufferSize;
+    /// Register tables written in order, {0xff, 0xff} terminated, NULL ends
+    const unsigned char (*tables[CAM_MAX_TABLES])[2];
+} CAM_ModeDesc;
+
+CAM_Status CAM_SetMode(CAM_ModeId mode, uint32_t* latencyUs);
+CAM_Status CAM_FrameBoundary(uint32_t* latencyUs);
+const CAM_ModeDesc* CAM_GetMode(void);
+const CAM_ModeDesc* CAM_GetModeDesc(CAM_ModeId mode);
+uint8_t CAM_TakeSettle(void);
+
+#endif /* CAMERA_MODE_H_ */
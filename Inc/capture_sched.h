@@ -0,0 +1,93 @@
+/*
+ * capture_sched.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * Capture scheduler: when snapshots are taken, and the queue of captured
+ * frames waiting for the UART.
+ *
+ * CAPSCHED_Tick() runs from the TIM7 update interrupt every
+ * CAPSCHED_TICK_MS and is the time base of the timestamps. A schedule is a
+ * sequence of count frames, periodMs apart:
+ *
+ *  - CAPSCHED_BURST: count frames back to back, as fast as the capture
+ *    goes, from CAPSCHED_Start() on
+ *  - CAPSCHED_INTERVAL: time-lapse, a frame every periodMs from
+ *    CAPSCHED_Start() on, count 0 runs until CAPSCHED_Stop()
+ *  - CAPSCHED_EVENT: every CAPSCHED_Event() (motion) starts a sequence, a
+ *    burst when periodMs is 0
+ *
+ * Timer triggers are latched by the interrupt and taken by CAPSCHED_Poll()
+ * in the main loop between two captures, CAPSCHED_Tick() returns 1 when
+ * one fired so the interrupt can wake the loop. A trigger which fires
+ * before the previous one was taken is counted as missed: the capture does
+ * not keep up with the period.
+ *
+ * Captured frames are queued with a sequence number and the time of their
+ * trigger, the queue holds a reference to their frame pool buffer. They are
+ * sent one after the other while the next ones are captured. A capture
+ * which gets no buffer or finds the queue full is dropped, its sequence
+ * number is skipped so the receiver sees the gap.
+ */
+
+#ifndef CAPTURE_SCHED_H_
+#define CAPTURE_SCHED_H_
+
+#include <stdint.h>
+
+/// Period of CAPSCHED_Tick(), TIM7 update rate
+#define CAPSCHED_TICK_MS 1U
+/// Frames waiting for the UART
+#define CAPSCHED_QUEUE_SIZE 4U
+
+typedef enum
+{
+    CAPSCHED_OFF = 0,
+    CAPSCHED_BURST,
+    CAPSCHED_INTERVAL,
+    CAPSCHED_EVENT,
+    CAPSCHED_MODE_COUNT
+} CAPSCHED_Mode;
+
+typedef struct
+{
+    CAPSCHED_Mode mode;
+    uint32_t count;    ///< Frames of a sequence, 0: until stopped
+    uint32_t periodMs; ///< Time between two frames, 0: back to back
+} CAPSCHED_Config;
+
+/// Queued frame
+typedef struct
+{
+    uint8_t* frame;       ///< Frame pool buffer, with the queue's reference
+    uint32_t length;      ///< Bytes to send
+    uint32_t sequence;    ///< Number of the capture, dropped ones included
+    uint32_t timestampMs; ///< Time of the trigger
+} CAPSCHED_Frame;
+
+typedef struct
+{
+    uint32_t triggers; ///< Triggers taken by CAPSCHED_Poll()
+    uint32_t missed;   ///< Timer triggers lost, the previous was not taken
+    uint32_t queued;
+    uint32_t dropped;  ///< Captures without a buffer, a slot or a transmit
+    uint32_t sent;     ///< Frames taken by CAPSCHED_Dequeue() and sent
+    uint32_t depth;    ///< Frames in the queue
+    uint32_t maxDepth;
+} CAPSCHED_Stats;
+
+uint8_t CAPSCHED_Start(const CAPSCHED_Config* config);
+void CAPSCHED_Stop(void);
+uint8_t CAPSCHED_Event(void);
+uint8_t CAPSCHED_Tick(void);
+uint32_t CAPSCHED_Now(void);
+uint8_t CAPSCHED_Poll(uint32_t* timestampMs);
+
+uint8_t CAPSCHED_Enqueue(uint8_t* frame, uint32_t length,
+                         uint32_t timestampMs);
+void CAPSCHED_Drop(void);
+uint8_t CAPSCHED_Dequeue(CAPSCHED_Frame* frame);
+void CAPSCHED_Unsent(void);
+void CAPSCHED_GetStats(CAPSCHED_Stats* stats);
+
+#endif /* CAPTURE_SCHED_H_ */
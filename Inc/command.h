@@ -0,0 +1,82 @@
+/*
+ * command.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * Remote control commands received on USART3.
+ *
+ * Two encodings are accepted on the same stream:
+ *
+ *  - text lines, for a terminal: a name and up to CMD_MAX_ARGS numbers
+ *    (decimal or 0x hex) separated by spaces, ended by CR or LF:
+ *
+ *      capture | stream <n> | mode <id> | effect <n> | reg <r> [<v>] |
+ *      sched <mode> [<count> [<period ms>]] | perf | help
+ *
+ *  - binary frames, for programs: CMD_SYNC, id, argument count, the
+ *    arguments as 32-bit little endian words and a CRC-8 (polynomial 0x07)
+ *    of the bytes from the id on. CMD_SYNC is not a printable character,
+ *    so the two never mix up.
+ *
+ * Both decode to the same CMD_Command. The parser is fed one byte at a
+ * time and does not depend on the HAL; the encoder is used by the host
+ * CLI (Tools/cam_cli). Replies are text lines starting with "OK" or "ERR".
+ */
+
+#ifndef COMMAND_H_
+#define COMMAND_H_
+
+#include <stdint.h>
+
+#define CMD_SYNC 0xA5U
+#define CMD_MAX_ARGS 4U
+/// Longest text line, terminator excluded
+#define CMD_LINE_SIZE 48U
+/// Longest binary frame
+#define CMD_FRAME_SIZE (4U + CMD_MAX_ARGS * 4U)
+
+typedef enum
+{
+    CMD_NONE = 0,
+    CMD_HELP,
+    CMD_CAPTURE,   ///< One snapshot
+    CMD_STREAM,    ///< n snapshots back to back, 0 stops
+    CMD_MODE,      ///< Snapshot mode, CAM_ModeId
+    CMD_EFFECT,    ///< OV2640_SpecialEffect() 0 ... 7
+    CMD_REG_READ,  ///< SCCB register of the selected bank
+    CMD_REG_WRITE, ///< SCCB register, value
+    CMD_PERF,      ///< Profiling counters
+    CMD_SCHED,     ///< Capture schedule: CAPSCHED_Mode, count, period ms
+    CMD_COUNT
+} CMD_Id;
+
+typedef enum
+{
+    CMD_PENDING = 0, ///< More bytes needed
+    CMD_READY,       ///< A command was decoded
+    CMD_ERROR,       ///< Bad line or frame, skipped
+} CMD_Result;
+
+typedef struct
+{
+    CMD_Id id;
+    uint8_t binary; ///< Received as a binary frame
+    uint8_t argc;
+    uint32_t args[CMD_MAX_ARGS];
+} CMD_Command;
+
+typedef struct
+{
+    uint8_t buffer[CMD_LINE_SIZE + 1U];
+    uint8_t length;
+    uint8_t expected; ///< Length of the binary frame being received
+    uint8_t binary;
+    uint8_t overflow; ///< Line longer than CMD_LINE_SIZE
+} CMD_Parser;
+
+void CMD_Init(CMD_Parser* parser);
+CMD_Result CMD_Feed(CMD_Parser* parser, uint8_t byte, CMD_Command* command);
+uint32_t CMD_Encode(const CMD_Command* command, uint8_t* frame);
+const char* CMD_Name(CMD_Id id);
+
+#endif /* COMMAND_H_ */
@@ -0,0 +1,120 @@
+/*
+ * frame_delta.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * Delta encoding of raw (RGB565 / YUV422) frames for the UART.
+ *
+ * A keyframe carries every 16x16 tile of the frame, the following frames
+ * only the tiles which changed. Changes are found in one of two ways:
+ *
+ *  - with a reference frame (DELTA_Init() reference != NULL): the tile is
+ *    compared with what the receiver holds by SAD (USADA8 on the target)
+ *    and sent when the SAD is above the threshold. Sensor noise below the
+ *    threshold costs nothing, slow drifts are sent once they add up.
+ *  - without one: a 32-bit checksum per tile, lossless, no frame sized
+ *    buffer needed.
+ *
+ * Tiles are run-length coded in 4-byte units (two pixels) or sent raw,
+ * whichever is shorter. Keyframes follow at the configured interval and
+ * after a frame which did not fit the output buffer.
+ *
+ * Stream, little endian, one record per frame:
+ *
+ *   offset  size
+ *    0       4    "FDLT"
+ *    4       1    flags, bit 0: keyframe
+ *    5       1    DELTA_Format
+ *    6       2    width
+ *    8       2    height
+ *   10       2    tiles in the record
+ *   12       4    frame number
+ *   16       4    payload bytes after the header
+ *   20       4    DELTA_Check() of the frame the receiver has afterwards
+ *
+ * followed by the tiles: index (2), coding (1), length (2), data. Tile data
+ * are the rows of the tile, clipped at the right and bottom edges. RLE:
+ * control byte n < 128: n + 1 units follow, n >= 128: the next unit
+ * repeats n - 126 times.
+ *
+ * The receiver (decoder functions, Tools/frame_delta) rebuilds the frames
+ * bit-exact: the frame the encoder compares with is the one the receiver
+ * has, and every record carries its checksum. Also built on the host.
+ */
+
+#ifndef FRAME_DELTA_H_
+#define FRAME_DELTA_H_
+
+#include <stdint.h>
+
+#define DELTA_MAGIC "FDLT"
+#define DELTA_HEADER_BYTES 24U
+#define DELTA_TILE_HEADER_BYTES 5U
+#define DELTA_TILE 16U
+/// Tiles of a 640x480 frame
+#define DELTA_MAX_TILES 1200U
+#define DELTA_FLAG_KEYFRAME 0x01U
+
+typedef enum
+{
+    DELTA_FORMAT_RGB565 = 0,
+    DELTA_FORMAT_YUV422,
+} DELTA_Format;
+
+typedef enum
+{
+    DELTA_CODING_RAW = 0,
+    DELTA_CODING_RLE,
+} DELTA_Coding;
+
+typedef struct
+{
+    uint8_t flags;
+    DELTA_Format format;
+    uint16_t width;
+    uint16_t height;
+    uint16_t tiles;
+    uint32_t frame;
+    uint32_t payload;
+    uint32_t check;
+} DELTA_Header;
+
+typedef struct
+{
+    uint32_t frames;
+    uint32_t keyframes;
+    uint32_t overflows;     ///< Frames which did not fit the output
+    uint32_t lastTiles;     ///< Tiles sent in the last frame
+    uint32_t lastBytes;     ///< Record size of the last frame
+    uint32_t lastRawBytes;  ///< Size of the last frame unencoded
+    uint32_t lastSaved;     ///< Saved by the last frame, permille
+    uint32_t totalBytes;
+    uint32_t totalRawBytes;
+} DELTA_Stats;
+
+/**
+ * @return Largest record of a frame, every tile sent raw.
+ */
+static inline uint32_t DELTA_MaxRecordBytes(uint16_t width, uint16_t height)
+{
+    uint32_t tiles = ((width + DELTA_TILE - 1U) / DELTA_TILE) *
+                     ((height + DELTA_TILE - 1U) / DELTA_TILE);
+
+    return DELTA_HEADER_BYTES + tiles * DELTA_TILE_HEADER_BYTES +
+           (uint32_t)width * height * 2U;
+}
+
+uint8_t DELTA_Init(DELTA_Format format, uint16_t width, uint16_t height,
+                   uint8_t* reference, uint16_t keyInterval,
+                   uint32_t threshold);
+void DELTA_RequestKeyframe(void);
+uint32_t DELTA_Encode(const uint8_t* frame, uint8_t* out, uint32_t capacity);
+void DELTA_GetStats(DELTA_Stats* stats);
+
+uint32_t DELTA_Check(const uint8_t* frame, uint32_t bytes);
+uint8_t DELTA_ParseHeader(const uint8_t* record, uint32_t length,
+                          DELTA_Header* header);
+uint8_t DELTA_Decode(const uint8_t* record, uint32_t length, uint8_t* frame,
+                     uint32_t capacity);
+
+#endif /* FRAME_DELTA_H_ */
@@ -0,0 +1,50 @@
+/*
+ * frame_pool.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * Fixed pool of DMA capable frame and line buffers.
+ *
+ * The pool is a single DMA_BUFFER array (see memory_config.h) divided into
+ * FRAME_BLOCK_SIZE blocks. A buffer is a run of consecutive blocks, so every
+ * buffer is cache line aligned and can be handed to DCMI, SPI or USART DMA
+ * directly. Buffers are reference counted: a stage which keeps using a frame
+ * after passing it on (UART transmit, display) calls FRAME_Retain() and
+ * FRAME_Release() when it is done. The last release returns the blocks.
+ */
+
+#ifndef FRAME_POOL_H_
+#define FRAME_POOL_H_
+
+#include "main.h"
+
+/// Allocation granularity in bytes (multiple of the cache line)
+#define FRAME_BLOCK_SIZE 1024U
+/// Number of blocks in the pool, fits one 320x240 RGB888 frame
+#define FRAME_BLOCK_COUNT 232U
+/// Size of the pool in bytes
+#define FRAME_POOL_SIZE (FRAME_BLOCK_SIZE * FRAME_BLOCK_COUNT)
+
+/// Bytes needed by a line / frame of the given geometry
+#define FRAME_LINE_BYTES(width, bpp) ((uint32_t)(width) * (bpp))
+#define FRAME_BYTES(width, height, bpp)                                        \
+    ((uint32_t)(width) * (uint32_t)(height) * (bpp))
+
+/// Pool usage counters
+typedef struct
+{
+    uint32_t usedBytes;      ///< Bytes currently allocated (whole blocks)
+    uint32_t highWaterBytes; ///< Maximum of usedBytes since FRAME_PoolInit()
+    uint32_t allocations;    ///< Number of successful FRAME_Alloc() calls
+    uint32_t failures;       ///< Number of FRAME_Alloc() calls returning NULL
+} FRAME_Stats;
+
+void FRAME_PoolInit(void);
+uint8_t* FRAME_Alloc(uint32_t size);
+void FRAME_Retain(const uint8_t* buf);
+void FRAME_Release(const uint8_t* buf);
+void FRAME_Shrink(const uint8_t* buf, uint32_t size);
+uint32_t FRAME_Capacity(const uint8_t* buf);
+void FRAME_GetStats(FRAME_Stats* stats);
+
+#endif /* FRAME_POOL_H_ */
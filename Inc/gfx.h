@@ -0,0 +1,86 @@
+/*
+ * gfx.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * 2D operations on RGB565 off-screen canvases and line buffers.
+ *
+ * GFX_Fill(), GFX_Copy(), GFX_ConvertRGB888(), GFX_ConvertYUV422() and
+ * GFX_Blend() clip the operation to the canvas and hand it to the selected
+ * backend:
+ *
+ *  - GFX_Software : plain C loops, also built on the host (Tools/gfx_bench).
+ *  - GFX_Dma2d    : the STM32F7 DMA2D engine (fill in register to memory
+ *                   mode, copy, pixel format conversion and blending in
+ *                   memory to memory mode). Small operations and YUV422,
+ *                   which the DMA2D cannot read interleaved, are done by the
+ *                   software backend.
+ *
+ * Both produce identical pixels: conversions keep the MSBs of every
+ * channel, blending follows the DMA2D equations (5 and 6-bit channels
+ * widened by MSB replication, (fg * a + bg * (255 - a)) / 255, MSBs kept).
+ * The operations are synchronous, the DMA2D backend waits for the transfer.
+ */
+
+#ifndef GFX_H_
+#define GFX_H_
+
+#include <stdint.h>
+
+/// RGB565 destination: off-screen canvas or line buffer
+typedef struct
+{
+    uint16_t* pixels;
+    uint16_t width;
+    uint16_t height;
+    uint16_t stride; ///< Pixels from the start of one row to the next
+} GFX_Canvas;
+
+/**
+ * Backend operations on clipped rectangles. Strides are in pixels,
+ * width and height are never 0.
+ */
+typedef struct
+{
+    const char* name;
+    void (*fill)(uint16_t* dst, uint32_t dstStride, uint32_t width,
+                 uint32_t height, uint16_t color);
+    void (*copy)(uint16_t* dst, uint32_t dstStride, const uint16_t* src,
+                 uint32_t srcStride, uint32_t width, uint32_t height);
+    /// R, G, B bytes
+    void (*rgb888)(uint16_t* dst, uint32_t dstStride, const uint8_t* src,
+                   uint32_t srcStride, uint32_t width, uint32_t height);
+    /// Y0 U Y1 V bytes, width even
+    void (*yuv422)(uint16_t* dst, uint32_t dstStride, const uint8_t* src,
+                   uint32_t srcStride, uint32_t width, uint32_t height);
+    /// src over dst with a constant alpha, 255: src only
+    void (*blend)(uint16_t* dst, uint32_t dstStride, const uint16_t* src,
+                  uint32_t srcStride, uint32_t width, uint32_t height,
+                  uint8_t alpha);
+} GFX_Backend;
+
+extern const GFX_Backend GFX_Software;
+extern const GFX_Backend GFX_Dma2d;
+
+void GFX_SetBackend(const GFX_Backend* backend);
+const GFX_Backend* GFX_GetBackend(void);
+
+void GFX_Fill(const GFX_Canvas* dst, int32_t x, int32_t y, uint32_t width,
+              uint32_t height, uint16_t color);
+void GFX_Copy(const GFX_Canvas* dst, int32_t x, int32_t y,
+              const uint16_t* src, uint32_t srcStride, uint32_t width,
+              uint32_t height);
+void GFX_ConvertRGB888(const GFX_Canvas* dst, int32_t x, int32_t y,
+                       const uint8_t* src, uint32_t srcStride, uint32_t width,
+                       uint32_t height);
+void GFX_ConvertYUV422(const GFX_Canvas* dst, int32_t x, int32_t y,
+                       const uint8_t* src, uint32_t srcStride, uint32_t width,
+                       uint32_t height);
+void GFX_Blend(const GFX_Canvas* dst, int32_t x, int32_t y,
+               const uint16_t* src, uint32_t srcStride, uint32_t width,
+               uint32_t height, uint8_t alpha);
+
+void GFX_Dma2dInit(void);
+void GFX_Benchmark(void);
+
+#endif /* GFX_H_ */
@@ -0,0 +1,44 @@
+/*
+ * glyph_cache.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * LRU cache of expanded RGB565 glyphs.
+ *
+ * Opaque text is mostly the same few glyphs in the same colors (status
+ * lines, counters). Expanding a 1-bpp font glyph costs a bit test per
+ * pixel, so the expanded blocks are kept in a fixed DTCM arena of
+ * GLYPH_CACHE_SLOTS slots, keyed by (font, character, foreground,
+ * background). A hit returns the cached block, which is handed to the LCD
+ * DMA as is: no expansion and no copy.
+ *
+ * A block stays valid until GLYPH_CACHE_SLOTS - 1 other glyphs were looked
+ * up. The least recently used slot is the one reused, so the block most
+ * recently passed to a DMA transfer is never overwritten while it is sent.
+ */
+
+#ifndef GLYPH_CACHE_H_
+#define GLYPH_CACHE_H_
+
+#include "fonts.h"
+#include "main.h"
+
+/// Number of cached glyphs
+#define GLYPH_CACHE_SLOTS 24U
+/// Pixels of one slot, fits the largest font (Font24, 17x24)
+#define GLYPH_SLOT_PIXELS (MAX_WIDTH_FONT * MAX_HEIGHT_FONT)
+
+/// Cache counters
+typedef struct
+{
+    uint32_t hits;      ///< Lookups served from the arena
+    uint32_t misses;    ///< Lookups which expanded the glyph
+    uint32_t evictions; ///< Misses which reused an occupied slot
+} GLYPH_Stats;
+
+void GLYPH_CacheInit(void);
+const uint16_t* GLYPH_Lookup(const sFONT* font, char ch, uint16_t fg,
+                             uint16_t bg);
+void GLYPH_GetStats(GLYPH_Stats* stats);
+
+#endif /* GLYPH_CACHE_H_ */
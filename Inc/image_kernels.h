@@ -0,0 +1,28 @@
+/*
+ * image_kernels.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * Hot inner loops of the rendering and capture paths. The kernels are leaf
+ * functions executed from ITCM RAM (see memory_config.h).
+ */
+
+#ifndef IMAGE_KERNELS_H_
+#define IMAGE_KERNELS_H_
+
+#include "memory_config.h"
+
+ITCM_CODE void IMG_RGB888ToRGB565(const uint8_t* src, uint16_t* dst,
+                                  uint32_t pixels);
+ITCM_CODE void IMG_ExpandGlyph(const uint8_t* bits, uint32_t width,
+                               uint32_t height, uint16_t fg, uint16_t bg,
+                               uint16_t* dst);
+ITCM_CODE void IMG_ExpandGlyphAA(const uint8_t* alpha, uint32_t width,
+                                 uint32_t height, const uint16_t* lut,
+                                 uint16_t* dst);
+ITCM_CODE int32_t IMG_FindJpegMarker(const uint8_t* buf, uint32_t len,
+                                     uint8_t marker);
+
+void IMG_BenchmarkPlacements(void);
+
+#endif /* IMAGE_KERNELS_H_ */
@@ -0,0 +1,69 @@
+/*
+ * image_stats.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * Exposure statistics of a captured frame: 256-bin luma histogram, mean
+ * luma and the pixels at the ends of the range, for the whole frame and
+ * for a 3x3 grid of regions.
+ *
+ * YUV422 frames are read a word (two pixels) at a time: the two Y samples
+ * are summed in the halfwords of one register and compared with the
+ * clipping levels by a carry into bit 8 of each halfword, so a pair costs
+ * no branch. RGB565 luma is BT.601 from the channels widened to 8 bits.
+ *
+ * STATS_Format() writes the telemetry line sent over UART:
+ *
+ *   STAT <mean> <under> <over> <mean0>,<under0>,<over0> ... <mean8>,...
+ *
+ * with the under / over exposed fractions in permille and regions in
+ * row-major order. Also built on the host.
+ */
+
+#ifndef IMAGE_STATS_H_
+#define IMAGE_STATS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define STATS_BINS 256U
+#define STATS_REGIONS_X 3U
+#define STATS_REGIONS_Y 3U
+#define STATS_REGIONS (STATS_REGIONS_X * STATS_REGIONS_Y)
+/// Luma at or below is under exposed
+#define STATS_UNDER_LUMA 16U
+/// Luma at or above is over exposed
+#define STATS_OVER_LUMA 240U
+/// Longest telemetry line, terminator included
+#define STATS_LINE_SIZE 160U
+
+typedef struct
+{
+    uint32_t pixels;
+    uint32_t under; ///< Pixels with luma <= STATS_UNDER_LUMA
+    uint32_t over;  ///< Pixels with luma >= STATS_OVER_LUMA
+    uint8_t mean;
+} STATS_Region;
+
+typedef struct
+{
+    uint32_t histogram[STATS_BINS];
+    STATS_Region frame;
+    STATS_Region regions[STATS_REGIONS]; ///< Row-major
+} STATS_Frame;
+
+/**
+ * @return count as a fraction of pixels in permille.
+ */
+static inline uint32_t STATS_Permille(uint32_t count, uint32_t pixels)
+{
+    return pixels != 0U ? (uint32_t)((uint64_t)count * 1000U / pixels) : 0U;
+}
+
+uint8_t STATS_ComputeYUV422(const uint8_t* yuv, uint16_t width,
+                            uint16_t height, STATS_Frame* stats);
+uint8_t STATS_ComputeRGB565(const uint16_t* rgb, uint16_t width,
+                            uint16_t height, STATS_Frame* stats);
+size_t STATS_Format(const STATS_Frame* stats, char* line, size_t size);
+
+#endif /* IMAGE_STATS_H_ */
@@ -0,0 +1,120 @@
+/*
+ * jpeg_decoder.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * Streaming baseline JPEG decoder.
+ *
+ * The compressed frame is decoded one MCU (minimum coded unit, 8x8 ... 16x16
+ * pixels) at a time. Every decoded MCU is converted to RGB565 and handed to
+ * a sink callback together with its position, so an image is never held in
+ * RAM in decoded form. All working memory (Huffman and quantization tables,
+ * coefficient block, sample planes and two MCU pixel banks) lives in the
+ * JPEG_Decoder structure.
+ *
+ * The two pixel banks are used alternately: the pixels passed to the sink
+ * stay valid while the next MCU is decoded, so the sink can hand them to a
+ * DMA transfer and return immediately. It only has to wait for that
+ * transfer before it starts the next one.
+ *
+ * Supported: baseline (SOF0) and extended Huffman (SOF1) with 8-bit samples,
+ * 1 or 3 components, sampling factors 1 or 2, restart intervals. Not
+ * supported: progressive, arithmetic coding, 12-bit samples.
+ *
+ * The decoder does not depend on the HAL (on the target only the kernel
+ * placement of memory_config.h is used) and is also built by the host
+ * benchmark in Tools/jpeg_bench.
+ */
+
+#ifndef JPEG_DECODER_H_
+#define JPEG_DECODER_H_
+
+#include <stdint.h>
+
+/// Largest MCU: 2x2 sampled luma
+#define JPEG_MCU_MAX_PIXELS (16U * 16U)
+/// Bits resolved by a single Huffman table lookup
+#define JPEG_FAST_BITS 8U
+
+/// Pixels are emitted high byte first (8-bit SPI DMA byte order)
+#define JPEG_FLAG_SWAP_BYTES 0x01U
+
+typedef enum
+{
+    JPEG_OK = 0,
+    JPEG_ERR_FORMAT,      ///< Not a JPEG or damaged marker segment
+    JPEG_ERR_UNSUPPORTED, ///< Progressive, 12-bit, unsupported sampling
+    JPEG_ERR_DATA,        ///< Invalid Huffman code in the entropy coded data
+    JPEG_ABORTED,         ///< The sink requested to stop
+} JPEG_Status;
+
+/**
+ * Receives one decoded MCU, clipped to the image size.
+ * @param context Pointer passed to JPEG_Decode().
+ * @param pixels width * height RGB565 pixels, rows packed.
+ * @param x Column of the MCU in the image.
+ * @param y Row of the MCU in the image.
+ * @param width Width of the MCU in pixels.
+ * @param height Height of the MCU in pixels.
+ * @return 0 to continue, anything else aborts decoding.
+ */
+typedef int (*JPEG_BlockSink)(void* context, const uint16_t* pixels,
+                              uint16_t x, uint16_t y, uint16_t width,
+                              uint16_t height);
+
+/// Canonical Huffman table with a JPEG_FAST_BITS lookup
+typedef struct
+{
+    int32_t maxCode[18];   ///< Largest code of each length, -1 if none
+    int32_t valOffset[17]; ///< values[] index of a code minus the code
+    uint8_t fastLength[1U << JPEG_FAST_BITS]; ///< 0: longer code
+    uint8_t fastValue[1U << JPEG_FAST_BITS];
+    uint8_t values[256];
+} JPEG_Huffman;
+
+typedef struct
+{
+    uint8_t id;
+    uint8_t h;          ///< Horizontal sampling factor
+    uint8_t v;          ///< Vertical sampling factor
+    uint8_t quant;      ///< Quantization table index
+    uint8_t dcTable;
+    uint8_t acTable;
+    int16_t dcPredictor;
+} JPEG_Component;
+
+/// Decoder state and working memory (about 6KB)
+typedef struct
+{
+    const uint8_t* data;
+    uint32_t length;
+    uint32_t pos;
+    uint32_t bitBuffer; ///< MSB aligned
+    uint32_t bitCount;
+    uint8_t marker;     ///< Marker met in the entropy coded data, 0 if none
+
+    uint8_t flags;
+    uint16_t width;
+    uint16_t height;
+    uint16_t restartInterval;
+    uint8_t componentCount;
+    uint8_t hMax;
+    uint8_t vMax;
+    JPEG_Component components[3];
+
+    uint8_t quant[4][64]; ///< Zigzag order
+    JPEG_Huffman dc[2];
+    JPEG_Huffman ac[2];
+
+    int16_t coefficients[64];
+    uint8_t planes[3][JPEG_MCU_MAX_PIXELS];
+    uint16_t pixels[2][JPEG_MCU_MAX_PIXELS];
+    uint8_t bank;
+    uint32_t mcuCount; ///< MCUs decoded by the last JPEG_Decode()
+} JPEG_Decoder;
+
+void JPEG_Init(JPEG_Decoder* dec, uint8_t flags);
+JPEG_Status JPEG_Decode(JPEG_Decoder* dec, const uint8_t* data,
+                        uint32_t length, JPEG_BlockSink sink, void* context);
+
+#endif /* JPEG_DECODER_H_ */
@@ -0,0 +1,76 @@
+/*
+ * lz_compress.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * LZ4 compatible block compressor for the UART uplink.
+ *
+ * Blocks are coded in the LZ4 block format: sequences of a token, literals,
+ * a 16-bit offset and the match length, matches of 4 bytes or more found
+ * through a hash table of the last position of every 4-byte value. The
+ * table (LZ_HASH_SIZE entries of 16 bits) lives in DTCM and is never
+ * cleared: a candidate is verified before it is used, so stale entries of
+ * an earlier block only cost a compare.
+ *
+ * LZ_Stream cuts a buffer into independent blocks of at most 64KB and
+ * wraps them in the LZ4 frame format (magic, descriptor with the content
+ * size, blocks with their size word, end mark), so the output decompresses
+ * with any LZ4 tool as well as with Tools/lz_uplink. A block which does not
+ * get smaller is stored, the stream grows by at most LZ_STREAM_OVERHEAD
+ * bytes plus 4 bytes per block (JPEG data).
+ *
+ * The stream is produced one chunk at a time into a buffer of
+ * LZ_CHUNK_BYTES(), so chunk N can be compressed while chunk N - 1 is
+ * being sent. Also built on the host.
+ */
+
+#ifndef LZ_COMPRESS_H_
+#define LZ_COMPRESS_H_
+
+#include <stdint.h>
+
+#define LZ_HASH_BITS 12U
+#define LZ_HASH_SIZE (1U << LZ_HASH_BITS)
+/// Largest block, offsets and the hash table are 16 bits
+#define LZ_MAX_BLOCK 65536U
+/// Block size of the uplink
+#define LZ_BLOCK_SIZE 4096U
+
+#define LZ_FRAME_MAGIC 0x184D2204UL
+/// Magic, FLG, BD, content size, header checksum
+#define LZ_FRAME_HEADER_BYTES 15U
+#define LZ_BLOCK_HEADER_BYTES 4U
+/// Block size word: the block is stored, not compressed
+#define LZ_BLOCK_STORED 0x80000000UL
+#define LZ_END_MARK_BYTES 4U
+#define LZ_STREAM_OVERHEAD (LZ_FRAME_HEADER_BYTES + LZ_END_MARK_BYTES)
+
+/// Largest chunk LZ_StreamNext() writes for a block size
+#define LZ_CHUNK_BYTES(blockSize)                                              \
+    (LZ_FRAME_HEADER_BYTES + LZ_BLOCK_HEADER_BYTES + (blockSize) +             \
+     LZ_END_MARK_BYTES)
+
+typedef struct
+{
+    const uint8_t* src;
+    uint32_t length;    ///< Bytes of src
+    uint32_t offset;    ///< Bytes of src already coded
+    uint32_t blockSize;
+    uint8_t started;    ///< Frame header written
+    uint8_t finished;   ///< End mark written
+    uint32_t outBytes;  ///< Stream bytes written so far
+    uint32_t stored;    ///< Blocks which did not compress
+} LZ_Stream;
+
+uint32_t LZ_CompressBlock(const uint8_t* src, uint32_t length, uint8_t* dst,
+                          uint32_t capacity);
+int32_t LZ_DecompressBlock(const uint8_t* src, uint32_t length, uint8_t* dst,
+                           uint32_t capacity);
+
+uint8_t LZ_StreamInit(LZ_Stream* stream, const uint8_t* src, uint32_t length,
+                      uint32_t blockSize);
+uint32_t LZ_StreamNext(LZ_Stream* stream, uint8_t* out, uint32_t capacity);
+
+uint32_t LZ_Xxh32(const uint8_t* data, uint32_t length, uint32_t seed);
+
+#endif /* LZ_COMPRESS_H_ */
@@ -0,0 +1,65 @@
+/*
+ * memory_config.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * Cache and MPU configuration of the STM32F767.
+ *
+ * Both L1 caches are enabled. Memory shared with DMA masters (DCMI, SPI,
+ * USART) is kept in dedicated linker sections which the MPU maps with
+ * DMA friendly attributes:
+ *
+ *  - DMA_BUFFER  : ".dma_buffer" in DMA_RAM, normal memory, write-through,
+ *                  no write allocate. CPU writes always reach the SRAM, so
+ *                  buffers handed to a transmitting DMA are coherent. After
+ *                  a DMA master wrote into the buffer (DCMI capture) the
+ *                  range has to be invalidated with MEM_DmaReceived()
+ *                  before the CPU reads it, then it is served from cache.
+ *  - DMA_NOCACHE : ".dma_nocache" in DMA_NOCACHE_RAM, normal memory, not
+ *                  cacheable. For small rings and descriptors which are
+ *                  continuously shared with a DMA and never maintained.
+ *
+ * Tightly coupled memories are zero wait state and bypass the caches:
+ *
+ *  - ITCM_CODE   : ".itcm_text" in ITCMRAM, hot leaf kernels. Copied from
+ *                  FLASH by Reset_Handler. FLASH is out of BL range: calls
+ *                  from ITCM (long_call, or linker veneers for library
+ *                  calls such as memcpy) work, but run from FLASH again.
+ *  - DTCM_DATA   : ".dtcm_data" in DTCMRAM, initialized working data.
+ *  - DTCM_BSS    : ".dtcm_bss" in DTCMRAM, zero initialized working buffers
+ *                  (line buffers, glyph buffer).
+ */
+
+#ifndef MEMORY_CONFIG_H_
+#define MEMORY_CONFIG_H_
+
+#include "main.h"
+
+/// Cortex-M7 L1 data cache line size in bytes
+#define MEM_CACHE_LINE 32U
+
+/// Write-through cached DMA buffer (frames, line buffers)
+#define DMA_BUFFER __attribute__((section(".dma_buffer"), aligned(32)))
+/// Non-cacheable DMA buffer (rings, descriptors)
+#define DMA_NOCACHE __attribute__((section(".dma_nocache"), aligned(32)))
+
+/// Hot code executed from ITCM RAM (long_call: FLASH is out of BL range)
+#define ITCM_CODE                                                              \
+    __attribute__((section(".itcm_text"), long_call, noinline))
+/// Initialized data in DTCM RAM
+#define DTCM_DATA __attribute__((section(".dtcm_data")))
+/// Zero initialized data in DTCM RAM
+#define DTCM_BSS __attribute__((section(".dtcm_bss")))
+
+/// Base address and size of the write-through DMA region (MPU region 0)
+#define MEM_DMA_REGION_BASE 0x20040000UL
+#define MEM_DMA_REGION_SIZE MPU_REGION_SIZE_256KB
+/// Base address and size of the non-cacheable region (MPU region 1)
+#define MEM_NOCACHE_REGION_BASE 0x2007C000UL
+#define MEM_NOCACHE_REGION_SIZE MPU_REGION_SIZE_16KB
+
+void MEM_Init(void);
+void MEM_DmaReceived(const void* addr, uint32_t size);
+void MEM_DmaTransmit(const void* addr, uint32_t size);
+
+#endif /* MEMORY_CONFIG_H_ */
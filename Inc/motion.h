@@ -0,0 +1,85 @@
+/*
+ * motion.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * Motion detection on downscaled luma frames.
+ *
+ * Every YUV422 frame given to MOTION_Process() is reduced to a 40x30 luma
+ * image (box average of the Y samples of a cell, 4x4 pixels for 160x120).
+ * The image is compared with a background model in blocks of 4x3 luma
+ * pixels: the sum of absolute differences of a block is one USADA8 per
+ * row on the target. Blocks whose mean difference is above the threshold
+ * are moving, an event with the bounding box of the moving blocks (in
+ * pixels of the source frame) is raised when enough of them move.
+ *
+ * The background adapts with a running average per pixel (8 fractional
+ * bits): still blocks follow the scene quickly, moving blocks slowly, so
+ * an object which stops becomes background after a while. After an event
+ * no new one is raised for a few frames.
+ *
+ * The state is about 5KB in DTCM. Also built on the host
+ * (Tools/motion_bench).
+ */
+
+#ifndef MOTION_H_
+#define MOTION_H_
+
+#include <stdint.h>
+
+/// Downscaled luma image
+#define MOTION_WIDTH 40U
+#define MOTION_HEIGHT 30U
+/// Block of luma pixels compared with the background, 4 bytes per row
+#define MOTION_BLOCK_W 4U
+#define MOTION_BLOCK_H 3U
+#define MOTION_BLOCKS_X (MOTION_WIDTH / MOTION_BLOCK_W)
+#define MOTION_BLOCKS_Y (MOTION_HEIGHT / MOTION_BLOCK_H)
+
+/// Result of MOTION_Process()
+typedef enum
+{
+    MOTION_IDLE = 0,  ///< No motion, or motion during the hold-off
+    MOTION_DETECTED,  ///< Event raised
+    MOTION_LEARNING,  ///< Background still being learned
+    MOTION_BAD_FRAME, ///< Geometry cannot be downscaled to 40x30
+} MOTION_Status;
+
+typedef struct
+{
+    uint8_t threshold;  ///< Mean absolute luma difference of a moving block
+    uint8_t minBlocks;  ///< Moving blocks needed for an event
+    uint8_t learnShift; ///< Background rate of still blocks, 1 / 2^n
+    uint8_t slowShift;  ///< Background rate of moving blocks, 1 / 2^n
+    uint8_t warmup;     ///< Frames learned before events are raised
+    uint8_t holdoff;    ///< Frames without events after an event
+} MOTION_Config;
+
+typedef struct
+{
+    /// Bounding box of the moving blocks in source frame pixels
+    uint16_t x;
+    uint16_t y;
+    uint16_t width;
+    uint16_t height;
+    uint16_t blocks;  ///< Moving blocks
+    uint32_t peakSad; ///< Largest block SAD
+    uint32_t frame;   ///< Number of the frame, from 0 after MOTION_Init()
+} MOTION_Event;
+
+typedef struct
+{
+    uint32_t frames;
+    uint32_t events;
+    uint32_t suppressed; ///< Frames with motion during the hold-off
+    uint32_t lastBlocks; ///< Moving blocks of the last frame
+} MOTION_Stats;
+
+void MOTION_Init(const MOTION_Config* config);
+MOTION_Status MOTION_Process(const uint8_t* yuv, uint16_t width,
+                             uint16_t height, MOTION_Event* event);
+const uint8_t* MOTION_GetLuma(void);
+const uint8_t* MOTION_GetBackground(void);
+void MOTION_GetStats(MOTION_Stats* stats);
+
+#endif /* MOTION_H_ */
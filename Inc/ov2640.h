@@ -81,6 +81,17 @@ enum imageLightMode {
     Home   = 4
 };
 
+/* JPEG output sequences, {0xff, 0xff} terminated */
+extern const unsigned char OV2640_JPEG_INIT[][2];
+extern const unsigned char OV2640_YUV422[][2];
+extern const unsigned char OV2640_JPEG[][2];
+extern const unsigned char OV2640_160x120_JPEG[][2];
+extern const unsigned char OV2640_320x240_JPEG[][2];
+extern const unsigned char OV2640_640x480_JPEG[][2];
+extern const unsigned char OV2640_800x600_JPEG[][2];
+extern const unsigned char OV2640_1024x768_JPEG[][2];
+extern const unsigned char OV2640_1280x960_JPEG[][2];
+
 short SCCB_Read(uint8_t reg_addr, uint8_t* pdata);
 short SCCB_Write(uint8_t reg_addr, uint8_t data);
 
@@ -0,0 +1,42 @@
+/*
+ * perf.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * Cycle accurate time measurement based on the DWT cycle counter.
+ */
+
+#ifndef PERF_H_
+#define PERF_H_
+
+#include "main.h"
+
+/**
+ * Starts the free running DWT cycle counter. Safe to call more than once.
+ */
+static inline void PERF_Init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55; // Unlock access on Cortex-M7
+    if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0U)
+    {
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+}
+
+/**
+ * @return Current value of the cycle counter (wraps every ~20 s at 210 MHz).
+ */
+static inline uint32_t PERF_Cycles(void) { return DWT->CYCCNT; }
+
+/**
+ * @param cycles Number of core clock cycles.
+ * @return Duration in microseconds.
+ */
+static inline uint32_t PERF_CyclesToUs(uint32_t cycles)
+{
+    return cycles / (SystemCoreClock / 1000000U);
+}
+
+#endif /* PERF_H_ */
@@ -0,0 +1,84 @@
+/*
+ * task_loop.h
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * Cooperative run-to-completion task loop.
+ *
+ * Interrupt handlers (and tasks) post events with TASK_Post(): an event is
+ * a number from 0 to TASK_EVENT_LAST put into a small queue with
+ * interrupts masked. The loop moves the queued events to the pending set
+ * of every task which subscribed to them (TASK_EVENT() bits of
+ * TASK_Desc.events) and runs the ready task of the highest priority class
+ * with all its pending events. A task returns when done, it is never
+ * preempted by another task, only by interrupts. Within a class the tasks
+ * run in table order.
+ *
+ * TASK_Tick() is called from a timer interrupt every millisecond and
+ * delivers TASK_EVENT_TIMER to the tasks with a period. When no task is
+ * ready the core sleeps in WFI until the next interrupt.
+ *
+ * The run time of every task is measured with the DWT cycle counter,
+ * TASK_GetStats() gives the number of runs, the total and the longest run.
+ */
+
+#ifndef TASK_LOOP_H_
+#define TASK_LOOP_H_
+
+#include <stdint.h>
+
+#define TASK_MAX 8U
+/// Events posted and not yet dispatched, more are lost
+#define TASK_QUEUE_SIZE 32U
+/// Highest event number of TASK_Post()
+#define TASK_EVENT_LAST 30U
+#define TASK_EVENT(event) (1UL << (event))
+/// Period of a task elapsed, not posted
+#define TASK_EVENT_TIMER (1UL << 31)
+
+typedef enum
+{
+    TASK_PRIO_HIGH = 0,
+    TASK_PRIO_NORMAL,
+    TASK_PRIO_LOW,
+    TASK_PRIO_COUNT
+} TASK_Priority;
+
+/// Runs with the pending events, bits of TASK_EVENT() and TASK_EVENT_TIMER
+typedef void (*TASK_Handler)(uint32_t events);
+
+typedef struct
+{
+    const char* name;
+    TASK_Priority priority;
+    uint32_t events;   ///< Subscribed events, TASK_EVENT() bits
+    uint32_t periodMs; ///< Period of TASK_EVENT_TIMER, 0 for none
+    TASK_Handler run;
+} TASK_Desc;
+
+typedef struct
+{
+    const char* name;
+    uint32_t runs;
+    uint32_t runUs; ///< Total run time
+    uint32_t maxUs; ///< Longest run
+} TASK_Stats;
+
+typedef struct
+{
+    uint32_t uptimeMs; ///< Time counted by TASK_Tick()
+    uint32_t busyUs;   ///< Run time of all tasks
+    uint32_t sleeps;   ///< Times the core went to sleep
+    uint32_t posted;
+    uint32_t lost;     ///< Events posted to a full queue
+    uint32_t maxQueue; ///< Largest number of events waiting
+} TASK_LoopStats;
+
+uint8_t TASK_Init(const TASK_Desc* tasks, uint32_t count);
+void TASK_Post(uint8_t event);
+void TASK_Tick(void);
+void TASK_Run(void);
+uint8_t TASK_GetStats(uint32_t task, TASK_Stats* stats);
+void TASK_GetLoopStats(TASK_LoopStats* stats);
+
+#endif /* TASK_LOOP_H_ */
@@ -5,6 +5,8 @@
  *      Author: norbe
  */
 
+#include "STM_registers.h"
+
 /* Initialization sequence for 480x272 resolution */
 const unsigned char OV2640_480x272[][2] = {
     {0xff, 0x00}, /* Device control register list Table 12 */
@@ -91,6 +93,7 @@ const unsigned char OV2640_480x272[][2] = {
     {0x50, 0x80}, {0x51, 0x90}, {0x52, 0x2c}, {0x53, 0x00}, {0x54, 0x00},
     {0x55, 0x88}, {0x57, 0x00}, {0x5a, 0x78}, {0x5b, 0x44}, {0x5c, 0x00},
     {0xd3, 0x04}, {0xe0, 0x00},
+    {0xff, 0xff},
 };
 
 /* Initialization sequence for VGA resolution (640x480)*/
@@ -179,6 +182,7 @@ const unsigned char OV2640_VGA[][2] = {
     {0x50, 0x89}, {0x51, 0x90}, {0x52, 0x2c}, {0x53, 0x00}, {0x54, 0x00},
     {0x55, 0x88}, {0x57, 0x00}, {0x5a, 0xA0}, {0x5b, 0x78}, {0x5c, 0x00},
     {0xd3, 0x02}, {0xe0, 0x00},
+    {0xff, 0xff},
 };
 
 /* Initialization sequence for QVGA resolution (320x240) */
@@ -227,6 +231,7 @@ const unsigned char OV2640_QVGA[][2] = {
     {0x54, 0x00}, {0x55, 0x88}, {0x57, 0x00}, {0x5a, 0x50}, {0x5b, 0x3C},
     {0x5c, 0x00}, {0xd3, 0x08}, {0xe0, 0x00}, {0xFF, 0x00}, {0x05, 0x00},
     {0xDA, 0x08}, {0xda, 0x09}, {0x98, 0x00}, {0x99, 0x00}, {0x00, 0x00},
+    {0xff, 0xff},
 };
 
 /* Initialization sequence for QQVGA resolution (160x120) */
@@ -275,41 +280,5 @@ const unsigned char OV2640_QQVGA[][2] = {
     {0x54, 0x00}, {0x55, 0x88}, {0x57, 0x00}, {0x5a, 0x28}, {0x5b, 0x1E},
     {0x5c, 0x00}, {0xd3, 0x08}, {0xe0, 0x00}, {0xFF, 0x00}, {0x05, 0x00},
     {0xDA, 0x08}, {0xda, 0x09}, {0x98, 0x00}, {0x99, 0x00}, {0x00, 0x00},
+    {0xff, 0xff},
 };
-
-#include "STM_registers.h"
-
-#define DEBUG
-
-/**
- * Camera resolution selection.
- * @param opt Resolution option.
- */
-void STM_OV2640_ResolutionConfiguration(unsigned opt)
-{
-#ifdef DEBUG
-    my_printf("Starting resolution choice \r\n");
-#endif
-
-    HAL_Delay(10);
-    SCCB_Write(0xff, 0x01);
-    HAL_Delay(10);
-    SCCB_Write(0x15, 0x00);
-
-    if (opt == RES_STM160x120)
-        OV2640_Configuration(OV2640_QQVGA);
-    else if (opt == RES_STM320x240)
-        OV2640_Configuration(OV2640_QVGA);
-    else if (opt == RES_STM480x272)
-        OV2640_Configuration(OV2640_480x272);
-    else if (opt == RES_STM640x480)
-        OV2640_Configuration(OV2640_VGA);
-    else
-        while (1)
-            // Error
-            ;
-
-#ifdef DEBUG
-    my_printf("Finalize configuration \r\n");
-#endif
-}
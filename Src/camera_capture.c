@@ -0,0 +1,410 @@
+/*
+ * camera_capture.c
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "camera_capture.h"
+#include "dcmi.h"
+#include "memory_config.h"
+#include "perf.h"
+
+#include <string.h>
+
+/// Set by the DCMI frame event / error callbacks
+static volatile uint8_t frameDone;
+static volatile uint8_t frameError;
+
+/// Circular capture ring, non-cacheable: no maintenance while draining
+DMA_NOCACHE static uint8_t camRing[CAM_RING_SIZE];
+/// Ring offset up to which data has been handed to the sink
+static uint32_t ringDrained;
+/// Bytes handed to the sink during the current capture
+static uint32_t ringTotal;
+static CAM_Sink ringSink;
+static void* ringContext;
+
+/// Region of interest and the mode it was set in, NULL: full frame
+static CAM_Roi roi;
+static const CAM_ModeDesc* roiMode;
+
+/**
+ * Looks for the JPEG EOI marker (FFD9) backwards from the end of the
+ * received data. Only the zero padding after the marker is visited.
+ * @param buf Received data.
+ * @param len Number of bytes received.
+ * @return Length up to and including EOI, len when there is no marker.
+ */
+static uint32_t CAM_TrimToEoi(const uint8_t* buf, uint32_t len)
+{
+    for (uint32_t i = len; i >= 2U; --i)
+    {
+        if (buf[i - 2U] == 0xFFU && buf[i - 1U] == 0xD9U)
+            return i;
+    }
+    return len;
+}
+
+/**
+ * Programs the DCMI crop window for the next frame. DCMI is stopped
+ * between frames, so the window registers can be written.
+ * @param mode Active mode.
+ * @param window Set to the part of the frame which will be captured.
+ */
+static void CAM_ApplyRoi(const CAM_ModeDesc* mode, CAM_Roi* window)
+{
+    if (roiMode != mode)
+    {
+        // No ROI, or one set for a mode which is not active any more
+        HAL_DCMI_DisableCrop(&hdcmi);
+        *window = (CAM_Roi){0, 0, mode->width, mode->height};
+        return;
+    }
+    // Counts in pixel clocks: two per pixel on the 8-bit bus
+    HAL_DCMI_ConfigCrop(&hdcmi, roi.x * 2U, roi.y, roi.width * 2U - 1U,
+                        roi.height - 1U);
+    HAL_DCMI_EnableCrop(&hdcmi);
+    *window = roi;
+}
+
+/**
+ * Captures one frame into a buffer, see CAM_Capture().
+ */
+static CAM_Status CAM_CaptureOnce(uint8_t* buffer, uint32_t capacity,
+                                  CAM_Frame* frame, uint32_t timeoutMs)
+{
+    const CAM_ModeDesc* mode = CAM_GetMode();
+    uint32_t words, received, start, tick;
+
+    if (mode == NULL || buffer == NULL || ((uint32_t)buffer & 3U) != 0U)
+        return CAM_ERROR;
+    if (capacity > CAM_MAX_TRANSFER)
+        capacity = CAM_MAX_TRANSFER;
+    words = capacity / 4U;
+    CAM_ApplyRoi(mode, &frame->window);
+
+    frameDone  = 0;
+    frameError = 0;
+    PERF_Init();
+    start = PERF_Cycles();
+    tick  = HAL_GetTick();
+
+    // DMA length is given in words (peripheral data size of the stream)
+    if (HAL_DCMI_Start_DMA(&hdcmi, DCMI_MODE_SNAPSHOT, (uint32_t)buffer,
+                           words) != HAL_OK)
+        return CAM_ERROR;
+
+    while (!frameDone && !frameError)
+    {
+        if (HAL_GetTick() - tick > timeoutMs)
+            break;
+    }
+    frame->captureUs = PERF_CyclesToUs(PERF_Cycles() - start);
+
+    // Stopping the stream flushes the DMA FIFO, NDTR keeps its value. The
+    // stream is not circular here: a raw frame which fills the buffer
+    // exactly leaves NDTR at 0, it is not reloaded.
+    HAL_DCMI_Stop(&hdcmi);
+    received = (words - __HAL_DMA_GET_COUNTER(hdcmi.DMA_Handle)) * 4U;
+    MEM_DmaReceived(buffer, received);
+
+    if (!frameDone)
+        return frameError ? CAM_ERROR : CAM_TIMEOUT;
+
+    if (mode->format == CAM_FORMAT_JPEG)
+        received = CAM_TrimToEoi(buffer, received);
+
+    frame->data     = buffer;
+    frame->length   = received;
+    frame->capacity = capacity;
+    frame->mode     = mode;
+    return CAM_OK;
+}
+
+/**
+ * Captures one frame in the active camera mode (see CAM_SetMode()). After a
+ * mode switch a frame is captured into the buffer and dropped first.
+ * @param buffer Destination, 32-bit aligned DMA capable memory.
+ * @param capacity Size of buffer in bytes, at most CAM_MAX_TRANSFER is used.
+ * @param frame Filled with the published frame on success.
+ * @param timeoutMs Maximum time to wait for the frame end, of each frame.
+ * @return CAM_OK, CAM_TIMEOUT or CAM_ERROR (no mode set, DCMI/DMA error).
+ */
+CAM_Status CAM_Capture(uint8_t* buffer, uint32_t capacity, CAM_Frame* frame,
+                       uint32_t timeoutMs)
+{
+    if (CAM_GetMode() != NULL && CAM_TakeSettle())
+    {
+        CAM_Status status =
+            CAM_CaptureOnce(buffer, capacity, frame, timeoutMs);
+
+        if (status != CAM_OK)
+            return status;
+    }
+    return CAM_CaptureOnce(buffer, capacity, frame, timeoutMs);
+}
+
+/**
+ * Hands the ring data between the drained offset and writePos to the sink,
+ * wrapping around the end of the ring when needed.
+ * @param writePos Ring offset written by the DMA, 0 ... CAM_RING_SIZE.
+ */
+static void CAM_RingDrain(uint32_t writePos)
+{
+    if (writePos < ringDrained)
+    {
+        ringSink(&camRing[ringDrained], CAM_RING_SIZE - ringDrained,
+                 ringContext);
+        ringTotal += CAM_RING_SIZE - ringDrained;
+        ringDrained = 0;
+    }
+    if (writePos > ringDrained)
+    {
+        ringSink(&camRing[ringDrained], writePos - ringDrained, ringContext);
+        ringTotal += writePos - ringDrained;
+    }
+    ringDrained = writePos % CAM_RING_SIZE;
+}
+
+static void CAM_RingHalfCplt(DMA_HandleTypeDef* hdma)
+{
+    (void)hdma;
+    CAM_RingDrain(CAM_RING_SIZE / 2U);
+}
+
+static void CAM_RingCplt(DMA_HandleTypeDef* hdma)
+{
+    (void)hdma;
+    CAM_RingDrain(CAM_RING_SIZE);
+}
+
+static void CAM_RingError(DMA_HandleTypeDef* hdma)
+{
+    (void)hdma;
+    frameError = 1;
+}
+
+/**
+ * Streams one frame to a sink, see CAM_CaptureStream().
+ */
+static CAM_Status CAM_StreamOnce(CAM_Sink sink, void* context,
+                                 CAM_Frame* frame, uint32_t timeoutMs)
+{
+    const CAM_ModeDesc* mode = CAM_GetMode();
+    uint32_t start, tick, writePos;
+
+    if (mode == NULL || sink == NULL ||
+        HAL_DCMI_GetState(&hdcmi) != HAL_DCMI_STATE_READY)
+        return CAM_ERROR;
+    CAM_ApplyRoi(mode, &frame->window);
+
+    frameDone   = 0;
+    frameError  = 0;
+    ringDrained = 0;
+    ringTotal   = 0;
+    ringSink    = sink;
+    ringContext = context;
+    PERF_Init();
+    start = PERF_Cycles();
+    tick  = HAL_GetTick();
+
+    // Same sequence as HAL_DCMI_Start_DMA(), which cannot be used because it
+    // installs its own DMA callbacks and does not use the half transfer one
+    hdcmi.State = HAL_DCMI_STATE_BUSY;
+    __HAL_DCMI_ENABLE(&hdcmi);
+    hdcmi.Instance->CR &= ~(DCMI_CR_CM);
+    hdcmi.Instance->CR |= DCMI_MODE_SNAPSHOT;
+    hdcmi.DMA_Handle->XferHalfCpltCallback = CAM_RingHalfCplt;
+    hdcmi.DMA_Handle->XferCpltCallback     = CAM_RingCplt;
+    hdcmi.DMA_Handle->XferErrorCallback    = CAM_RingError;
+    hdcmi.DMA_Handle->XferAbortCallback    = NULL;
+    // The stream is set up for single transfers (CAM_Capture()), only the
+    // ring wraps around
+    hdcmi.DMA_Handle->Instance->CR |= DMA_SxCR_CIRC;
+    if (HAL_DMA_Start_IT(hdcmi.DMA_Handle, (uint32_t)&hdcmi.Instance->DR,
+                         (uint32_t)camRing, CAM_RING_SIZE / 4U) != HAL_OK)
+    {
+        hdcmi.DMA_Handle->XferHalfCpltCallback = NULL;
+        HAL_DCMI_Stop(&hdcmi);
+        hdcmi.DMA_Handle->Instance->CR &= ~DMA_SxCR_CIRC;
+        return CAM_ERROR;
+    }
+    __HAL_DCMI_ENABLE_IT(&hdcmi, DCMI_IT_FRAME | DCMI_IT_OVR | DCMI_IT_ERR);
+    hdcmi.Instance->CR |= DCMI_CR_CAPTURE;
+
+    while (!frameDone && !frameError)
+    {
+        if (HAL_GetTick() - tick > timeoutMs)
+            break;
+    }
+    frame->captureUs = PERF_CyclesToUs(PERF_Cycles() - start);
+
+    // Stopping flushes the DMA FIFO and disables the DMA interrupts, the
+    // tail of the frame (and a half whose interrupt was still pending) is
+    // drained here
+    HAL_DCMI_Stop(&hdcmi);
+    hdcmi.DMA_Handle->XferHalfCpltCallback = NULL;
+    hdcmi.DMA_Handle->Instance->CR &= ~DMA_SxCR_CIRC;
+    writePos =
+        CAM_RING_SIZE - __HAL_DMA_GET_COUNTER(hdcmi.DMA_Handle) * 4U;
+    if (frameDone)
+        CAM_RingDrain(writePos);
+
+    if (!frameDone)
+        return frameError ? CAM_ERROR : CAM_TIMEOUT;
+
+    frame->data     = NULL;
+    frame->length   = ringTotal;
+    frame->capacity = 0;
+    frame->mode     = mode;
+    return CAM_OK;
+}
+
+/// Sink of the frame dropped after a mode switch
+static void CAM_DropSink(const uint8_t* data, uint32_t length, void* context)
+{
+    (void)data;
+    (void)length;
+    (void)context;
+}
+
+/**
+ * Captures one frame in the active camera mode and streams it to a sink.
+ * The frame size is not limited by any buffer, only by the rate at which
+ * the sink consumes the data. After a mode switch a frame is captured and
+ * dropped first, the sink does not see it.
+ * @param sink Consumer of the data, see CAM_Sink.
+ * @param context Passed to the sink.
+ * @param frame Filled on success. data is NULL (the data went to the sink),
+ * length is the number of bytes streamed.
+ * @param timeoutMs Maximum time to wait for the frame end, of each frame.
+ * @return CAM_OK, CAM_TIMEOUT or CAM_ERROR (no mode set, DCMI/DMA error).
+ */
+CAM_Status CAM_CaptureStream(CAM_Sink sink, void* context, CAM_Frame* frame,
+                             uint32_t timeoutMs)
+{
+    if (sink != NULL && CAM_GetMode() != NULL && CAM_TakeSettle())
+    {
+        CAM_Status status = CAM_StreamOnce(CAM_DropSink, NULL, frame,
+                                           timeoutMs);
+
+        if (status != CAM_OK)
+            return status;
+    }
+    return CAM_StreamOnce(sink, context, frame, timeoutMs);
+}
+
+/**
+ * Sink storing the stream in a buffer (see CAM_BufferSinkContext).
+ */
+void CAM_BufferSink(const uint8_t* data, uint32_t length, void* context)
+{
+    CAM_BufferSinkContext* ctx = context;
+    uint32_t space             = ctx->capacity - ctx->length;
+    uint32_t copy              = length < space ? length : space;
+
+    memcpy(&ctx->dest[ctx->length], data, copy);
+    ctx->length += copy;
+    ctx->dropped += length - copy;
+}
+
+/**
+ * Captures one frame through the circular ring into a destination buffer.
+ * Unlike CAM_Capture() the destination does not have to be DMA capable and
+ * may be larger than a single DMA transfer.
+ * @param dest Destination buffer.
+ * @param capacity Size of dest in bytes.
+ * @param frame Filled with the published frame on success.
+ * @param timeoutMs Maximum time to wait for the frame end.
+ * @return CAM_OK, CAM_TIMEOUT or CAM_ERROR (also when the frame did not fit).
+ */
+CAM_Status CAM_CaptureInto(uint8_t* dest, uint32_t capacity, CAM_Frame* frame,
+                           uint32_t timeoutMs)
+{
+    CAM_BufferSinkContext ctx = {dest, capacity, 0, 0};
+    CAM_Status status =
+        CAM_CaptureStream(CAM_BufferSink, &ctx, frame, timeoutMs);
+
+    if (status != CAM_OK)
+        return status;
+    if (ctx.dropped != 0U)
+        return CAM_ERROR;
+
+    frame->data     = dest;
+    frame->capacity = capacity;
+    frame->length   = ctx.length;
+    if (frame->mode->format == CAM_FORMAT_JPEG)
+        frame->length = CAM_TrimToEoi(dest, ctx.length);
+    return CAM_OK;
+}
+
+/**
+ * To be called from HAL_DCMI_FrameEventCallback().
+ */
+void CAM_CaptureFrameEvent(void) { frameDone = 1; }
+
+/**
+ * To be called from HAL_DCMI_ErrorCallback().
+ */
+void CAM_CaptureError(void) { frameError = 1; }
+
+/**
+ * Limits the following captures to a rectangle of the frame. The ROI
+ * belongs to the active mode, a mode switch returns to full frames.
+ * @param window Rectangle in pixels of the active mode, x and width even
+ * (YUV422 pairs), NULL: full frame.
+ * @return CAM_OK, CAM_ERROR when no mode is set, the mode is JPEG (DCMI
+ * cannot crop compressed data) or the rectangle does not fit the frame.
+ */
+CAM_Status CAM_SetRoi(const CAM_Roi* window)
+{
+    const CAM_ModeDesc* mode = CAM_GetMode();
+
+    if (window == NULL)
+    {
+        roiMode = NULL;
+        return CAM_OK;
+    }
+    if (mode == NULL || mode->format == CAM_FORMAT_JPEG ||
+        window->width == 0U || window->height == 0U ||
+        ((window->x | window->width) & 1U) ||
+        (uint32_t)window->x + window->width > mode->width ||
+        (uint32_t)window->y + window->height > mode->height)
+        return CAM_ERROR;
+    roi     = *window;
+    roiMode = mode;
+    return CAM_OK;
+}
+
+/**
+ * @param window Set to the part of the frame the next capture will hold.
+ * @return 1 when an ROI is active, 0 for full frames or no mode set.
+ */
+uint8_t CAM_GetRoi(CAM_Roi* window)
+{
+    const CAM_ModeDesc* mode = CAM_GetMode();
+
+    if (mode != NULL && roiMode == mode)
+    {
+        *window = roi;
+        return 1;
+    }
+    *window = (CAM_Roi){0, 0, mode != NULL ? mode->width : 0U,
+                        mode != NULL ? mode->height : 0U};
+    return 0;
+}
+
+/**
+ * @return Buffer size needed by the next CAM_Capture(): the ROI at 2 bytes
+ * per pixel, the mode's buffer size without one, 0 when no mode is set.
+ */
+uint32_t CAM_CaptureBytes(void)
+{
+    const CAM_ModeDesc* mode = CAM_GetMode();
+
+    if (mode == NULL)
+        return 0;
+    if (roiMode == mode)
+        return (uint32_t)roi.width * roi.height * 2U;
+    return mode->bufferSize;
+}
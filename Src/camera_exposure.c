@@ -0,0 +1,330 @@
+/*
+ * camera_exposure.c
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "camera_exposure.h"
+#include "ov2640.h"
+
+#include <stddef.h>
+
+/* Sensor registers, bank 1 (0xff = 0x01) */
+#define AE_BANK_SELECT 0xffU
+#define AE_BANK_SENSOR 0x01U
+#define AE_GAIN 0x00U  ///< Bit[7:4]: x2 each, Bit[3:0]: 1 + n / 16
+#define AE_REG04 0x04U ///< Bit[1:0]: AEC[1:0]
+#define AE_AEC 0x10U   ///< AEC[9:2]
+#define AE_COM8 0x13U  ///< Bit[2]: AGC auto, Bit[0]: AEC auto
+#define AE_REG45 0x45U ///< Bit[5:0]: AEC[15:10]
+#define AE_COM8_AUTO 0x05U
+
+/// Center region weight of the metering, the others count 1
+#define AE_CENTER_WEIGHT 4U
+
+static const CAM_AeConfig defaultConfig = {
+    .target    = 110,
+    .tolerance = 8,
+    // Conservative, shorter than a frame in every mode of camera_mode.c
+    .maxLines  = 320,
+    .maxGain   = 8 * 16,
+};
+
+/// Last value known to be in a register
+typedef struct
+{
+    uint8_t reg;
+    uint8_t value;
+    uint8_t valid;
+} AE_Shadow;
+
+static AE_Shadow shadow[] = {
+    {AE_GAIN, 0, 0}, {AE_REG04, 0, 0}, {AE_AEC, 0, 0},
+    {AE_COM8, 0, 0}, {AE_REG45, 0, 0},
+};
+/// Selected bank, -1 when unknown
+static int16_t bank = -1;
+
+static CAM_AeConfig config;
+static CAM_AeState state;
+static uint8_t enabled;
+static uint32_t settle;
+/// Frames since the luma left the tolerance, 0 when converged
+static uint32_t chase;
+
+static AE_Shadow* CAM_AeShadow(uint8_t reg)
+{
+    for (uint32_t i = 0; i < sizeof(shadow) / sizeof(shadow[0]); ++i)
+        if (shadow[i].reg == reg)
+            return &shadow[i];
+    return NULL;
+}
+
+/**
+ * Selects bank 1 unless it is known to be selected.
+ * @return 1 on success.
+ */
+static uint8_t CAM_AeBank(void)
+{
+    if (bank == AE_BANK_SENSOR)
+        return 1;
+    state.sccbWrites++;
+    if (!SCCB_Write(AE_BANK_SELECT, AE_BANK_SENSOR))
+        return 0;
+    bank = AE_BANK_SENSOR;
+    return 1;
+}
+
+/**
+ * Reads a bank 1 register, from the shadow when it is known.
+ * @return 1 on success.
+ */
+static uint8_t CAM_AeRead(uint8_t reg, uint8_t* value)
+{
+    AE_Shadow* s = CAM_AeShadow(reg);
+
+    if (!s->valid)
+    {
+        if (!CAM_AeBank() || SCCB_Read(reg, &s->value) != 0)
+            return 0;
+        s->valid = 1;
+    }
+    *value = s->value;
+    return 1;
+}
+
+/**
+ * Writes a bank 1 register unless the shadow already holds the value.
+ * @return 1 on success.
+ */
+static uint8_t CAM_AeWrite(uint8_t reg, uint8_t value)
+{
+    AE_Shadow* s = CAM_AeShadow(reg);
+
+    if (s->valid && s->value == value)
+    {
+        state.sccbSkipped++;
+        return 1;
+    }
+    if (!CAM_AeBank())
+        return 0;
+    state.sccbWrites++;
+    if (!SCCB_Write(reg, value))
+        return 0;
+    s->value = value;
+    s->valid = 1;
+    return 1;
+}
+
+/**
+ * @param gain Gain in 1/16, 16 ... 496.
+ * @return GAIN register value, doubling bits set from bit 4 upwards.
+ */
+static uint8_t CAM_AeGainToReg(uint32_t gain)
+{
+    uint32_t doublings = 0;
+
+    while (gain >= 32U && doublings < 4U)
+    {
+        gain >>= 1;
+        doublings++;
+    }
+    if (gain > 31U)
+        gain = 31U;
+    return (uint8_t)((((1U << doublings) - 1U) << 4) | (gain - 16U));
+}
+
+/**
+ * @return Gain in 1/16 of a GAIN register value.
+ */
+static uint16_t CAM_AeRegToGain(uint8_t reg)
+{
+    uint32_t gain = 16U + (reg & 0x0FU);
+
+    for (uint32_t bit = 0x10U; bit <= 0x80U; bit <<= 1)
+        if (reg & bit)
+            gain <<= 1;
+    return (uint16_t)gain;
+}
+
+/**
+ * Writes manual exposure and gain, only the registers which change.
+ * @return 1 on success, 0 after an SCCB error (shadow invalidated).
+ */
+static uint8_t CAM_AeProgram(uint16_t lines, uint16_t gain)
+{
+    uint8_t com8, reg04, reg45;
+    uint8_t ok = CAM_AeRead(AE_COM8, &com8) && CAM_AeRead(AE_REG04, &reg04) &&
+                 CAM_AeRead(AE_REG45, &reg45);
+
+    ok = ok && CAM_AeWrite(AE_COM8, com8 & (uint8_t)~AE_COM8_AUTO) &&
+         CAM_AeWrite(AE_REG04,
+                     (uint8_t)((reg04 & 0xFCU) | (lines & 0x03U))) &&
+         CAM_AeWrite(AE_AEC, (uint8_t)(lines >> 2)) &&
+         CAM_AeWrite(AE_REG45,
+                     (uint8_t)((reg45 & 0xC0U) | ((lines >> 10) & 0x3FU))) &&
+         CAM_AeWrite(AE_GAIN, CAM_AeGainToReg(gain));
+    if (!ok)
+        CAM_ExposureInvalidate();
+    return ok;
+}
+
+/**
+ * Center weighted mean luma of the 3x3 regions.
+ */
+static uint8_t CAM_AeMeter(const STATS_Frame* stats)
+{
+    const uint32_t center = STATS_REGIONS / 2U;
+    uint32_t sum          = 0;
+
+    for (uint32_t r = 0; r < STATS_REGIONS; ++r)
+        sum += stats->regions[r].mean * (r == center ? AE_CENTER_WEIGHT : 1U);
+    return (uint8_t)(sum / (STATS_REGIONS - 1U + AE_CENTER_WEIGHT));
+}
+
+/**
+ * Takes exposure over from the sensor's AEC / AGC, starting from the
+ * values they reached.
+ * @param cfg Controller settings, NULL: defaults.
+ * @return CAM_AE_ADJUSTED, or CAM_AE_SCCB_ERROR (the controller stays off).
+ */
+CAM_AeStatus CAM_ExposureEnable(const CAM_AeConfig* cfg)
+{
+    uint8_t reg04, aec, reg45, gain;
+
+    config = cfg != NULL ? *cfg : defaultConfig;
+    if (config.maxLines == 0U)
+        config.maxLines = 1;
+    if (config.maxGain < 16U)
+        config.maxGain = 16;
+    if (config.maxGain > 496U)
+        config.maxGain = 496;
+
+    CAM_ExposureInvalidate();
+    state = (CAM_AeState){0};
+    if (!CAM_AeRead(AE_REG04, &reg04) || !CAM_AeRead(AE_AEC, &aec) ||
+        !CAM_AeRead(AE_REG45, &reg45) || !CAM_AeRead(AE_GAIN, &gain))
+    {
+        CAM_ExposureInvalidate();
+        return state.status = CAM_AE_SCCB_ERROR;
+    }
+    state.lines = (uint16_t)(((reg45 & 0x3FU) << 10) | (aec << 2) |
+                             (reg04 & 0x03U));
+    state.gain  = CAM_AeRegToGain(gain);
+    if (state.lines == 0U)
+        state.lines = 1;
+    if (state.lines > config.maxLines)
+        state.lines = config.maxLines;
+    if (state.gain > config.maxGain)
+        state.gain = config.maxGain;
+
+    if (!CAM_AeProgram(state.lines, state.gain))
+        return state.status = CAM_AE_SCCB_ERROR;
+    enabled = 1;
+    settle  = CAM_AE_SETTLE_FRAMES;
+    chase   = 0;
+    return state.status = CAM_AE_ADJUSTED;
+}
+
+/**
+ * Gives exposure back to the sensor's AEC / AGC.
+ */
+void CAM_ExposureDisable(void)
+{
+    uint8_t com8;
+
+    if (!enabled)
+        return;
+    enabled = 0;
+    if (CAM_AeRead(AE_COM8, &com8))
+        CAM_AeWrite(AE_COM8, com8 | AE_COM8_AUTO);
+    state.status = CAM_AE_OFF;
+}
+
+/**
+ * One control step, call with the statistics of every captured frame.
+ * @param stats Statistics of the frame.
+ * @return Result of the step.
+ */
+CAM_AeStatus CAM_ExposureUpdate(const STATS_Frame* stats)
+{
+    uint32_t exposure, desired, lines, gain;
+    uint8_t luma;
+
+    if (!enabled)
+        return CAM_AE_OFF;
+    if (chase)
+        chase++;
+    if (settle)
+    {
+        settle--;
+        return state.status = CAM_AE_SETTLING;
+    }
+
+    luma       = CAM_AeMeter(stats);
+    state.luma = luma;
+    if (luma + config.tolerance >= config.target &&
+        luma <= config.target + config.tolerance)
+    {
+        if (chase)
+            state.convergeFrames = chase;
+        chase = 0;
+        return state.status = CAM_AE_CONVERGED;
+    }
+    if (!chase)
+        chase = 1;
+
+    // Luma is taken as proportional to lines x gain
+    exposure = (uint32_t)state.lines * state.gain;
+    desired  = (uint32_t)((uint64_t)exposure * config.target /
+                         (luma != 0U ? luma : 1U));
+    if (desired > exposure * CAM_AE_MAX_STEP)
+        desired = exposure * CAM_AE_MAX_STEP;
+    if (desired < exposure / CAM_AE_MAX_STEP)
+        desired = exposure / CAM_AE_MAX_STEP;
+
+    // Lines first, the gain makes up the rest
+    lines = desired / 16U;
+    lines = lines < 1U ? 1U : lines > config.maxLines ? config.maxLines : lines;
+    gain  = desired / lines;
+    gain  = gain < 16U ? 16U : gain > config.maxGain ? config.maxGain : gain;
+    gain  = CAM_AeRegToGain(CAM_AeGainToReg(gain));
+
+    if (lines == state.lines && gain == state.gain)
+        return state.status = CAM_AE_LIMIT;
+    if (!CAM_AeProgram((uint16_t)lines, (uint16_t)gain))
+        return state.status = CAM_AE_SCCB_ERROR;
+    state.lines = (uint16_t)lines;
+    state.gain  = (uint16_t)gain;
+    state.steps++;
+    settle = CAM_AE_SETTLE_FRAMES;
+    return state.status = CAM_AE_ADJUSTED;
+}
+
+/**
+ * Forgets the register shadow, call after the sensor was written
+ * directly.
+ */
+void CAM_ExposureInvalidate(void)
+{
+    for (uint32_t i = 0; i < sizeof(shadow) / sizeof(shadow[0]); ++i)
+        shadow[i].valid = 0;
+    bank = -1;
+}
+
+/**
+ * Writes the controller's exposure again after the sensor was
+ * reconfigured from register tables (mode switch), which turn AEC / AGC
+ * back on. Does nothing while the controller is off.
+ */
+void CAM_ExposureReapply(void)
+{
+    CAM_ExposureInvalidate();
+    if (!enabled)
+        return;
+    if (!CAM_AeProgram(state.lines, state.gain))
+        state.status = CAM_AE_SCCB_ERROR;
+    settle = CAM_AE_SETTLE_FRAMES;
+}
+
+void CAM_ExposureGetState(CAM_AeState* out) { *out = state; }
@@ -0,0 +1,204 @@
+/*
+ * camera_mode.c
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "camera_mode.h"
+#include "STM_registers.h"
+#include "camera_exposure.h"
+#include "dcmi.h"
+#include "frame_pool.h"
+#include "ov2640.h"
+#include "perf.h"
+
+/* DVP output setup shared by all modes (bank 1, COM10 = 0) */
+static const unsigned char CAM_DVP_SETUP[][2] = {
+    {0xff, 0x01},
+    {0x15, 0x00},
+    {0xff, 0xff},
+};
+
+/* Raw output switched from RGB565 to YUV422 (IMAGE_MODE = 0) */
+static const unsigned char CAM_YUV422_OUTPUT[][2] = {
+    {0xff, 0x00}, {0x05, 0x00}, {0xda, 0x00}, {0xe0, 0x00}, {0xff, 0xff},
+};
+
+#define CAM_JPEG_TABLES(size)                                                  \
+    {OV2640_JPEG_INIT, OV2640_YUV422, OV2640_JPEG, CAM_DVP_SETUP, size, NULL}
+#define CAM_RGB565_TABLES(size) {CAM_DVP_SETUP, size, NULL}
+#define CAM_YUV422_TABLES(size) {CAM_DVP_SETUP, size, CAM_YUV422_OUTPUT, NULL}
+
+/* Descriptor table, indexed by CAM_ModeId */
+static const CAM_ModeDesc camModes[CAM_MODE_COUNT] = {
+    [CAM_MODE_JPEG_160x120] = {"JPEG 160x120", 160, 120, CAM_FORMAT_JPEG,
+                               RES_160X120,
+                               CAM_JPEG_TABLES(OV2640_160x120_JPEG)},
+    [CAM_MODE_JPEG_320x240] = {"JPEG 320x240", 320, 240, CAM_FORMAT_JPEG,
+                               RES_320X240,
+                               CAM_JPEG_TABLES(OV2640_320x240_JPEG)},
+    [CAM_MODE_JPEG_640x480] = {"JPEG 640x480", 640, 480, CAM_FORMAT_JPEG,
+                               RES_640X480,
+                               CAM_JPEG_TABLES(OV2640_640x480_JPEG)},
+    [CAM_MODE_JPEG_800x600] = {"JPEG 800x600", 800, 600, CAM_FORMAT_JPEG,
+                               RES_800x600,
+                               CAM_JPEG_TABLES(OV2640_800x600_JPEG)},
+    // Captured through the circular ring (CAM_CaptureInto()), the buffer
+    // is not limited to a single DMA transfer
+    [CAM_MODE_JPEG_1024x768] = {"JPEG 1024x768", 1024, 768, CAM_FORMAT_JPEG,
+                                128 * 1024,
+                                CAM_JPEG_TABLES(OV2640_1024x768_JPEG)},
+    [CAM_MODE_JPEG_1280x960] = {"JPEG 1280x960", 1280, 960, CAM_FORMAT_JPEG,
+                                192 * 1024,
+                                CAM_JPEG_TABLES(OV2640_1280x960_JPEG)},
+    [CAM_MODE_RGB565_160x120] = {"RGB565 160x120", 160, 120,
+                                 CAM_FORMAT_RGB565, 160 * 120 * 2,
+                                 CAM_RGB565_TABLES(OV2640_QQVGA)},
+    [CAM_MODE_RGB565_320x240] = {"RGB565 320x240", 320, 240,
+                                 CAM_FORMAT_RGB565, 320 * 240 * 2,
+                                 CAM_RGB565_TABLES(OV2640_QVGA)},
+    [CAM_MODE_RGB565_480x272] = {"RGB565 480x272", 480, 272,
+                                 CAM_FORMAT_RGB565, 480 * 272 * 2,
+                                 CAM_RGB565_TABLES(OV2640_480x272)},
+    [CAM_MODE_RGB565_640x480] = {"RGB565 640x480", 640, 480,
+                                 CAM_FORMAT_RGB565, 640 * 480 * 2,
+                                 CAM_RGB565_TABLES(OV2640_VGA)},
+    [CAM_MODE_YUV422_160x120] = {"YUV422 160x120", 160, 120,
+                                 CAM_FORMAT_YUV422, 160 * 120 * 2,
+                                 CAM_YUV422_TABLES(OV2640_QQVGA)},
+    [CAM_MODE_YUV422_320x240] = {"YUV422 320x240", 320, 240,
+                                 CAM_FORMAT_YUV422, 320 * 240 * 2,
+                                 CAM_YUV422_TABLES(OV2640_QVGA)},
+};
+
+static const CAM_ModeDesc* currentMode = NULL;
+static volatile int32_t pendingMode    = -1;
+/// A mode was applied, the next frame is dropped (see CAM_TakeSettle())
+static uint8_t settlePending;
+
+/**
+ * Writes a {0xff, 0xff} terminated register table. Unlike
+ * OV2640_Configuration() registers are not read back and there is no delay
+ * between them, which keeps a mode switch in the range of milliseconds.
+ * @param table Register table.
+ * @return Number of failed SCCB writes.
+ */
+static uint32_t CAM_WriteTable(const unsigned char table[][2])
+{
+    uint32_t failures = 0;
+
+    for (uint32_t i = 0; !(table[i][0] == 0xff && table[i][1] == 0xff); ++i)
+    {
+        if (!SCCB_Write(table[i][0], table[i][1]))
+            ++failures;
+    }
+    return failures;
+}
+
+/**
+ * Reconfigures the sensor for a mode. The next capture drops a frame first,
+ * the sensor settles on the new tables during it.
+ * @param desc Mode descriptor.
+ * @param latencyUs If not NULL, set to the duration of the switch.
+ * @return CAM_OK or CAM_ERROR when a register write failed.
+ */
+static CAM_Status CAM_Apply(const CAM_ModeDesc* desc, uint32_t* latencyUs)
+{
+    uint32_t failures = 0;
+    uint32_t start;
+
+    PERF_Init();
+    start = PERF_Cycles();
+
+    // Hardware JPEG mode: DCMI captures only while HSYNC is active. DCMI is
+    // not capturing here, so CR can be changed directly.
+    hdcmi.Init.JPEGMode = desc->format == CAM_FORMAT_JPEG ? DCMI_JPEG_ENABLE
+                                                          : DCMI_JPEG_DISABLE;
+    MODIFY_REG(hdcmi.Instance->CR, DCMI_CR_JPEG, hdcmi.Init.JPEGMode);
+
+    for (uint32_t t = 0; t < CAM_MAX_TABLES && desc->tables[t] != NULL; ++t)
+        failures += CAM_WriteTable(desc->tables[t]);
+    // The tables switch the sensor's AEC / AGC back on
+    CAM_ExposureReapply();
+    if (latencyUs != NULL)
+        *latencyUs = PERF_CyclesToUs(PERF_Cycles() - start);
+
+    currentMode   = desc;
+    settlePending = 1;
+#ifdef DEBUG
+    my_printf("Camera mode %s, %lu SCCB errors \r\n", desc->name, failures);
+#endif
+    return failures == 0U ? CAM_OK : CAM_ERROR;
+}
+
+/**
+ * Requests a new camera mode. Applied at once when DCMI is idle, otherwise
+ * at the next CAM_FrameBoundary().
+ * @param mode Requested mode.
+ * @param latencyUs If not NULL and the mode was applied, set to the time
+ * spent reconfiguring the sensor in microseconds.
+ * @return CAM_OK, CAM_PENDING or CAM_ERROR (unknown mode, frame larger than
+ * the frame pool, SCCB failure).
+ */
+CAM_Status CAM_SetMode(CAM_ModeId mode, uint32_t* latencyUs)
+{
+    if ((uint32_t)mode >= CAM_MODE_COUNT ||
+        camModes[mode].bufferSize > FRAME_POOL_SIZE)
+        return CAM_ERROR;
+
+    if (HAL_DCMI_GetState(&hdcmi) == HAL_DCMI_STATE_BUSY)
+    {
+        pendingMode = (int32_t)mode;
+        return CAM_PENDING;
+    }
+    pendingMode = -1;
+    return CAM_Apply(&camModes[mode], latencyUs);
+}
+
+/**
+ * Applies a pending mode switch. Call after a frame has been captured and
+ * DCMI has been stopped.
+ * @param latencyUs If not NULL and a mode was applied, set to the time spent
+ * reconfiguring the sensor in microseconds.
+ * @return CAM_OK when nothing was pending or the switch succeeded,
+ * CAM_PENDING when DCMI is still busy, CAM_ERROR on SCCB failure.
+ */
+CAM_Status CAM_FrameBoundary(uint32_t* latencyUs)
+{
+    int32_t mode = pendingMode;
+
+    if (mode < 0)
+        return CAM_OK;
+    if (HAL_DCMI_GetState(&hdcmi) == HAL_DCMI_STATE_BUSY)
+        return CAM_PENDING;
+    pendingMode = -1;
+    return CAM_Apply(&camModes[mode], latencyUs);
+}
+
+/**
+ * @return Descriptor of the active mode, NULL before the first
+ * CAM_SetMode().
+ */
+const CAM_ModeDesc* CAM_GetMode(void) { return currentMode; }
+
+/**
+ * @param mode Mode to look up.
+ * @return Descriptor of the mode or NULL for an unknown mode.
+ */
+const CAM_ModeDesc* CAM_GetModeDesc(CAM_ModeId mode)
+{
+    return (uint32_t)mode < CAM_MODE_COUNT ? &camModes[mode] : NULL;
+}
+
+/**
+ * Takes the settle flag left by a mode switch.
+ * @return 1 when a mode was applied since the last call: the next frame
+ * should be captured and dropped.
+ */
+uint8_t CAM_TakeSettle(void)
+{
+    uint8_t settle = settlePending;
+
+    settlePending = 0;
+    return settle;
+}
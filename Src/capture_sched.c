@@ -0,0 +1,272 @@
+/*
+ * capture_sched.c
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "capture_sched.h"
+#include "frame_pool.h"
+
+static CAPSCHED_Config config;
+/// Time base, advanced by CAPSCHED_Tick()
+static volatile uint32_t nowMs;
+/// Sequence in progress
+static volatile uint8_t running;
+/// Triggers left in the sequence, UINT32_MAX until stopped
+static volatile uint32_t remaining;
+/// Time to the next timer trigger
+static volatile uint32_t countdown;
+/// Timer trigger waiting for CAPSCHED_Poll(), and its time
+static volatile uint8_t due;
+static volatile uint32_t dueMs;
+
+/// Frames waiting for the UART, oldest at queueHead. The queue is only used
+/// from the main loop.
+static CAPSCHED_Frame queue[CAPSCHED_QUEUE_SIZE];
+static uint32_t queueHead;
+static uint32_t queueCount;
+static uint32_t sequence;
+
+static CAPSCHED_Stats stats;
+
+/**
+ * The schedule is shared with the TIM7 interrupt, it is changed with
+ * interrupts masked. PRIMASK is restored, not blindly cleared.
+ */
+static inline uint32_t CAPSCHED_Lock(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    return primask;
+}
+
+static inline void CAPSCHED_Unlock(uint32_t primask)
+{
+    __set_PRIMASK(primask);
+}
+
+/**
+ * Latches a timer trigger, counted as missed when the previous one was not
+ * taken yet. Interrupts masked or from the interrupt.
+ */
+static void CAPSCHED_Fire(void)
+{
+    if (due)
+    {
+        ++stats.missed;
+    }
+    else
+    {
+        due   = 1;
+        dueMs = nowMs;
+    }
+    if (remaining != UINT32_MAX && --remaining == 0U)
+        running = 0;
+}
+
+/**
+ * Starts a sequence, interrupts masked. A timed sequence triggers its first
+ * frame right away.
+ */
+static void CAPSCHED_Begin(void)
+{
+    remaining = config.count != 0U ? config.count : UINT32_MAX;
+    countdown = config.periodMs;
+    due       = 0;
+    running   = 1;
+    if (config.periodMs != 0U)
+        CAPSCHED_Fire();
+}
+
+/**
+ * Replaces the schedule. Burst and interval sequences start right away, the
+ * event mode waits for CAPSCHED_Event().
+ * @param cfg Schedule, CAPSCHED_OFF stops.
+ * @return 1 for an unknown mode or a sequence which would never end
+ *         (count and period 0), 0 otherwise.
+ */
+uint8_t CAPSCHED_Start(const CAPSCHED_Config* cfg)
+{
+    if (cfg->mode >= CAPSCHED_MODE_COUNT ||
+        (cfg->mode != CAPSCHED_OFF && cfg->count == 0U &&
+         (cfg->periodMs == 0U || cfg->mode == CAPSCHED_BURST)))
+        return 1;
+
+    uint32_t primask = CAPSCHED_Lock();
+    config  = *cfg;
+    running = 0;
+    due     = 0;
+    if (config.mode == CAPSCHED_BURST)
+    {
+        config.periodMs = 0;
+        CAPSCHED_Begin();
+    }
+    else if (config.mode == CAPSCHED_INTERVAL)
+    {
+        CAPSCHED_Begin();
+    }
+    CAPSCHED_Unlock(primask);
+    return 0;
+}
+
+/**
+ * Stops the schedule, a trigger not taken yet is discarded. Queued frames
+ * are still sent.
+ */
+void CAPSCHED_Stop(void)
+{
+    static const CAPSCHED_Config off = {CAPSCHED_OFF, 0, 0};
+
+    CAPSCHED_Start(&off);
+}
+
+/**
+ * Reports an event (motion). In the event mode it starts a sequence, a
+ * sequence in progress starts over.
+ * @return 1 when a sequence was started, 0 when the event is not scheduled
+ *         and left to the caller.
+ */
+uint8_t CAPSCHED_Event(void)
+{
+    if (config.mode != CAPSCHED_EVENT)
+        return 0;
+
+    uint32_t primask = CAPSCHED_Lock();
+    CAPSCHED_Begin();
+    CAPSCHED_Unlock(primask);
+    return 1;
+}
+
+/**
+ * Advances the time base and fires the timer triggers. Called from the
+ * TIM7 update interrupt.
+ * @return 1 when a trigger fired, 0 otherwise.
+ */
+uint8_t CAPSCHED_Tick(void)
+{
+    nowMs += CAPSCHED_TICK_MS;
+    if (!running || config.periodMs == 0U)
+        return 0;
+    if (countdown > CAPSCHED_TICK_MS)
+    {
+        countdown -= CAPSCHED_TICK_MS;
+        return 0;
+    }
+    countdown = config.periodMs;
+    CAPSCHED_Fire();
+    return 1;
+}
+
+/**
+ * @return Milliseconds since the timer was started.
+ */
+uint32_t CAPSCHED_Now(void) { return nowMs; }
+
+/**
+ * Takes the next trigger: the latched timer trigger, or the next frame of a
+ * back to back sequence.
+ * @param timestampMs Set to the time of the trigger.
+ * @return 1 when a snapshot should be taken.
+ */
+uint8_t CAPSCHED_Poll(uint32_t* timestampMs)
+{
+    uint8_t taken = 0;
+
+    uint32_t primask = CAPSCHED_Lock();
+    if (due)
+    {
+        due          = 0;
+        *timestampMs = dueMs;
+        taken        = 1;
+    }
+    else if (running && config.periodMs == 0U)
+    {
+        *timestampMs = nowMs;
+        taken        = 1;
+        if (remaining != UINT32_MAX && --remaining == 0U)
+            running = 0;
+    }
+    if (taken)
+        ++stats.triggers;
+    CAPSCHED_Unlock(primask);
+    return taken;
+}
+
+/**
+ * Queues a captured frame for the UART and takes a reference to it, the
+ * caller keeps its own.
+ * @param frame Frame pool buffer.
+ * @param length Bytes to send.
+ * @param timestampMs Time of the trigger.
+ * @return 0 when queued, 1 when the queue is full and the frame dropped.
+ */
+uint8_t CAPSCHED_Enqueue(uint8_t* frame, uint32_t length,
+                         uint32_t timestampMs)
+{
+    CAPSCHED_Frame* slot;
+
+    if (queueCount == CAPSCHED_QUEUE_SIZE)
+    {
+        CAPSCHED_Drop();
+        return 1;
+    }
+    slot = &queue[(queueHead + queueCount) % CAPSCHED_QUEUE_SIZE];
+    slot->frame       = frame;
+    slot->length      = length;
+    slot->sequence    = sequence++;
+    slot->timestampMs = timestampMs;
+    FRAME_Retain(frame);
+    ++queueCount;
+    ++stats.queued;
+    if (queueCount > stats.maxDepth)
+        stats.maxDepth = queueCount;
+    return 0;
+}
+
+/**
+ * Counts a capture which was triggered but got no buffer or failed, and
+ * skips its sequence number.
+ */
+void CAPSCHED_Drop(void)
+{
+    ++sequence;
+    ++stats.dropped;
+}
+
+/**
+ * Takes the oldest queued frame, with the queue's reference: the caller
+ * releases it once the frame is sent.
+ * @param frame Filled with the frame.
+ * @return 0 when a frame was taken, 1 when the queue is empty.
+ */
+uint8_t CAPSCHED_Dequeue(CAPSCHED_Frame* frame)
+{
+    if (queueCount == 0U)
+        return 1;
+    *frame    = queue[queueHead];
+    queueHead = (queueHead + 1U) % CAPSCHED_QUEUE_SIZE;
+    --queueCount;
+    ++stats.sent;
+    return 0;
+}
+
+/**
+ * Counts a frame taken by CAPSCHED_Dequeue() which could not be sent as
+ * dropped. Its sequence number is already used, the receiver sees the gap.
+ */
+void CAPSCHED_Unsent(void)
+{
+    --stats.sent;
+    ++stats.dropped;
+}
+
+/**
+ * @param out Filled with a snapshot of the scheduler counters.
+ */
+void CAPSCHED_GetStats(CAPSCHED_Stats* out)
+{
+    uint32_t primask = CAPSCHED_Lock();
+    *out       = stats;
+    out->depth = queueCount;
+    CAPSCHED_Unlock(primask);
+}
@@ -0,0 +1,211 @@
+/*
+ * command.c
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "command.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct
+{
+    const char* name;
+    CMD_Id id;
+    uint8_t minArgs;
+    uint8_t maxArgs;
+} CMD_Spec;
+
+/// Text names, the first entry of a name whose argument count fits wins
+static const CMD_Spec specs[] = {
+    {"help", CMD_HELP, 0, 0},     {"capture", CMD_CAPTURE, 0, 0},
+    {"stream", CMD_STREAM, 1, 1}, {"mode", CMD_MODE, 1, 1},
+    {"effect", CMD_EFFECT, 1, 1}, {"reg", CMD_REG_READ, 1, 1},
+    {"reg", CMD_REG_WRITE, 2, 2}, {"perf", CMD_PERF, 0, 0},
+    {"sched", CMD_SCHED, 1, 3},
+};
+
+#define CMD_SPECS (sizeof(specs) / sizeof(specs[0]))
+
+static uint8_t CMD_Crc8(const uint8_t* data, uint32_t length)
+{
+    uint8_t crc = 0;
+
+    while (length-- != 0U)
+    {
+        crc ^= *data++;
+        for (uint32_t bit = 0; bit < 8U; ++bit)
+            crc = (uint8_t)(crc & 0x80U ? (crc << 1) ^ 0x07 : crc << 1);
+    }
+    return crc;
+}
+
+static const CMD_Spec* CMD_Find(const char* name, CMD_Id id, uint32_t argc)
+{
+    for (uint32_t i = 0; i < CMD_SPECS; ++i)
+        if ((name != NULL ? strcmp(specs[i].name, name) == 0
+                          : specs[i].id == id) &&
+            argc >= specs[i].minArgs && argc <= specs[i].maxArgs)
+            return &specs[i];
+    return NULL;
+}
+
+static void CMD_Reset(CMD_Parser* parser)
+{
+    parser->length   = 0;
+    parser->expected = 0;
+    parser->binary   = 0;
+    parser->overflow = 0;
+}
+
+/**
+ * Splits a text line into the name and its numbers.
+ */
+static CMD_Result CMD_ParseLine(CMD_Parser* parser, CMD_Command* command)
+{
+    static const char separators[] = " \t";
+    char* line = (char*)parser->buffer;
+    const CMD_Spec* spec;
+    char* name;
+    char* token;
+
+    line[parser->length] = '\0';
+    name = strtok(line, separators);
+    if (name == NULL)
+        return CMD_PENDING;
+
+    command->argc   = 0;
+    command->binary = 0;
+    while ((token = strtok(NULL, separators)) != NULL)
+    {
+        char* end;
+
+        if (command->argc == CMD_MAX_ARGS)
+            return CMD_ERROR;
+        command->args[command->argc++] = strtoul(token, &end, 0);
+        if (end == token || *end != '\0')
+            return CMD_ERROR;
+    }
+    spec = CMD_Find(name, CMD_NONE, command->argc);
+    if (spec == NULL)
+        return CMD_ERROR;
+    command->id = spec->id;
+    return CMD_READY;
+}
+
+/**
+ * Checks a complete binary frame (without CMD_SYNC) and decodes it.
+ */
+static CMD_Result CMD_ParseFrame(CMD_Parser* parser, CMD_Command* command)
+{
+    const uint8_t* frame = parser->buffer;
+    const uint32_t argc  = frame[1];
+
+    if (CMD_Crc8(frame, parser->length - 1U) != frame[parser->length - 1U] ||
+        frame[0] >= CMD_COUNT || CMD_Find(NULL, frame[0], argc) == NULL)
+        return CMD_ERROR;
+    command->id     = (CMD_Id)frame[0];
+    command->binary = 1;
+    command->argc   = (uint8_t)argc;
+    for (uint32_t i = 0; i < argc; ++i)
+    {
+        const uint8_t* p = &frame[2U + i * 4U];
+        command->args[i] = (uint32_t)p[0] | (uint32_t)p[1] << 8 |
+                           (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+    }
+    return CMD_READY;
+}
+
+void CMD_Init(CMD_Parser* parser) { CMD_Reset(parser); }
+
+/**
+ * Feeds one received byte.
+ * @param parser Parser state.
+ * @param byte Received byte.
+ * @param command Filled when CMD_READY is returned.
+ * @return CMD_READY when the byte completed a command, CMD_ERROR when it
+ *         completed a line or frame which is not valid.
+ */
+CMD_Result CMD_Feed(CMD_Parser* parser, uint8_t byte, CMD_Command* command)
+{
+    CMD_Result result;
+
+    if (parser->binary)
+    {
+        parser->buffer[parser->length++] = byte;
+        // Id and argument count known: the length of the frame
+        if (parser->length == 2U)
+        {
+            if (byte > CMD_MAX_ARGS)
+            {
+                CMD_Reset(parser);
+                return CMD_ERROR;
+            }
+            parser->expected = (uint8_t)(3U + byte * 4U);
+        }
+        if (parser->length != parser->expected)
+            return CMD_PENDING;
+        result = CMD_ParseFrame(parser, command);
+        CMD_Reset(parser);
+        return result;
+    }
+
+    if (byte == CMD_SYNC && parser->length == 0U)
+    {
+        parser->binary = 1;
+        return CMD_PENDING;
+    }
+    if (byte != '\r' && byte != '\n')
+    {
+        if (parser->length < CMD_LINE_SIZE)
+            parser->buffer[parser->length++] = byte;
+        else
+            parser->overflow = 1;
+        return CMD_PENDING;
+    }
+
+    // End of line, an empty one (CR LF) is ignored
+    result = parser->overflow ? CMD_ERROR : CMD_ParseLine(parser, command);
+    CMD_Reset(parser);
+    return result;
+}
+
+/**
+ * Writes the binary frame of a command.
+ * @param command Command, argc at most CMD_MAX_ARGS.
+ * @param frame Output, CMD_FRAME_SIZE bytes.
+ * @return Frame length.
+ */
+uint32_t CMD_Encode(const CMD_Command* command, uint8_t* frame)
+{
+    uint32_t length = 3;
+
+    frame[0] = CMD_SYNC;
+    frame[1] = (uint8_t)command->id;
+    frame[2] = command->argc;
+    for (uint32_t i = 0; i < command->argc; ++i)
+    {
+        const uint32_t v = command->args[i];
+
+        frame[length++] = (uint8_t)v;
+        frame[length++] = (uint8_t)(v >> 8);
+        frame[length++] = (uint8_t)(v >> 16);
+        frame[length++] = (uint8_t)(v >> 24);
+    }
+    frame[length] = CMD_Crc8(&frame[1], length - 1U);
+    return length + 1U;
+}
+
+/**
+ * @return Text name of a command, "?" when unknown.
+ */
+const char* CMD_Name(CMD_Id id)
+{
+    const CMD_Spec* spec = NULL;
+
+    for (uint32_t i = 0; i < CMD_SPECS && spec == NULL; ++i)
+        if (specs[i].id == id)
+            spec = &specs[i];
+    return spec != NULL ? spec->name : "?";
+}
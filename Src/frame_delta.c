@@ -0,0 +1,484 @@
+/*
+ * frame_delta.c
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "frame_delta.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#if defined(__ARM_ARCH)
+#include "memory_config.h"
+/// Tile kernels run from ITCM, the tile state lives in DTCM on the target
+#define DELTA_ITCM ITCM_CODE
+#define DELTA_DTCM DTCM_BSS
+#else
+#define DELTA_ITCM
+#define DELTA_DTCM
+#endif
+
+#if defined(__ARM_FEATURE_SIMD32)
+#include <arm_acle.h>
+#endif
+
+/// Two pixels of a frame, the unit of the tile kernels and of the RLE
+typedef uint32_t DELTA_Word __attribute__((may_alias));
+
+#define DELTA_TILE_WORDS (DELTA_TILE * DELTA_TILE / 2U)
+#define DELTA_FNV_BASIS 2166136261U
+#define DELTA_FNV_PRIME 16777619U
+#define DELTA_RLE_LITERALS 128U
+#define DELTA_RLE_REPEATS 129U
+
+/// Checksums of the tiles the receiver has, checksum mode
+DELTA_DTCM static uint32_t tileChecks[DELTA_MAX_TILES];
+/// Words of the tile being encoded
+DELTA_DTCM static uint32_t tileWords[DELTA_TILE_WORDS];
+
+static DELTA_Format format;
+static uint16_t width, height;
+static uint16_t tilesX, tilesY;
+/// Frame the receiver has, NULL in checksum mode
+static uint8_t* reference;
+static uint16_t keyInterval;
+static uint32_t threshold;
+static uint32_t sinceKey;
+static uint8_t forceKey;
+static uint32_t frameNumber;
+static DELTA_Stats stats;
+
+static inline __attribute__((always_inline)) uint32_t
+DELTA_Sad4(uint32_t a, uint32_t b, uint32_t acc)
+{
+#if defined(__ARM_FEATURE_SIMD32)
+    return __usada8(a, b, acc);
+#else
+    for (uint32_t i = 0; i < 32U; i += 8U)
+    {
+        int32_t d = (int32_t)((a >> i) & 0xFFU) - (int32_t)((b >> i) & 0xFFU);
+        acc += (uint32_t)(d < 0 ? -d : d);
+    }
+    return acc;
+#endif
+}
+
+static void DELTA_Put16(uint8_t* p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void DELTA_Put32(uint8_t* p, uint32_t v)
+{
+    DELTA_Put16(p, v);
+    DELTA_Put16(p + 2, v >> 16);
+}
+
+static uint32_t DELTA_Get16(const uint8_t* p)
+{
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8;
+}
+
+static uint32_t DELTA_Get32(const uint8_t* p)
+{
+    return DELTA_Get16(p) | DELTA_Get16(p + 2) << 16;
+}
+
+/**
+ * Sum of absolute differences of a tile against the reference.
+ * @param src First word of the tile in the frame.
+ * @param ref First word of the tile in the reference.
+ * @param rowWords Words of a frame row.
+ * @param words Words of a tile row.
+ * @param rows Rows of the tile.
+ */
+DELTA_ITCM static uint32_t DELTA_TileSad(const DELTA_Word* src,
+                                         const DELTA_Word* ref,
+                                         uint32_t rowWords, uint32_t words,
+                                         uint32_t rows)
+{
+    uint32_t sad = 0;
+
+    for (; rows != 0U; --rows, src += rowWords, ref += rowWords)
+        for (uint32_t w = 0; w < words; ++w)
+            sad = DELTA_Sad4(src[w], ref[w], sad);
+    return sad;
+}
+
+/**
+ * Copies a tile into tileWords and returns its checksum.
+ */
+DELTA_ITCM static uint32_t DELTA_TileLoad(const DELTA_Word* src,
+                                          uint32_t rowWords, uint32_t words,
+                                          uint32_t rows)
+{
+    uint32_t check = DELTA_FNV_BASIS;
+    uint32_t* dst  = tileWords;
+
+    for (; rows != 0U; --rows, src += rowWords)
+        for (uint32_t w = 0; w < words; ++w)
+        {
+            *dst++ = src[w];
+            check  = (check ^ src[w]) * DELTA_FNV_PRIME;
+        }
+    return check;
+}
+
+/**
+ * Run-length codes tileWords.
+ * @param units Words in tileWords.
+ * @param out Output.
+ * @param limit Output bytes at most.
+ * @return Coded bytes, 0 when longer than limit.
+ */
+static uint32_t DELTA_RleEncode(uint32_t units, uint8_t* out, uint32_t limit)
+{
+    uint32_t length  = 0;
+    uint32_t literal = 0; ///< Units of the pending literal run
+    uint32_t start   = 0; ///< Its first unit
+    uint32_t i       = 0;
+
+    while (i <= units)
+    {
+        uint32_t run = 1;
+
+        if (i < units)
+            while (i + run < units && run < DELTA_RLE_REPEATS &&
+                   tileWords[i + run] == tileWords[i])
+                run++;
+        // A repeat, the end or a full literal closes the literal run
+        if (literal != 0U &&
+            (run >= 2U || i == units || literal == DELTA_RLE_LITERALS))
+        {
+            if (length + 1U + literal * 4U > limit)
+                return 0;
+            out[length++] = (uint8_t)(literal - 1U);
+            memcpy(&out[length], &tileWords[start], literal * 4U);
+            length += literal * 4U;
+            literal = 0;
+        }
+        if (i == units)
+            break;
+        if (run >= 2U)
+        {
+            if (length + 5U > limit)
+                return 0;
+            out[length++] = (uint8_t)(run + 126U);
+            memcpy(&out[length], &tileWords[i], 4U);
+            length += 4U;
+            i += run;
+            continue;
+        }
+        if (literal == 0U)
+            start = i;
+        literal++;
+        i++;
+    }
+    return length;
+}
+
+/**
+ * Undoes DELTA_RleEncode().
+ * @return 0 on success, 1 on data not decoding to exactly units words.
+ */
+static uint8_t DELTA_RleDecode(const uint8_t* in, uint32_t length,
+                               uint32_t* units, uint32_t count)
+{
+    uint32_t n = 0;
+
+    for (uint32_t i = 0; i < length;)
+    {
+        uint32_t control = in[i++];
+
+        if (control < DELTA_RLE_LITERALS)
+        {
+            uint32_t literal = control + 1U;
+
+            if (n + literal > count || i + literal * 4U > length)
+                return 1;
+            memcpy(&units[n], &in[i], literal * 4U);
+            n += literal;
+            i += literal * 4U;
+        }
+        else
+        {
+            uint32_t run = control - 126U;
+            uint32_t unit;
+
+            if (n + run > count || i + 4U > length)
+                return 1;
+            memcpy(&unit, &in[i], 4U);
+            i += 4U;
+            while (run-- != 0U)
+                units[n++] = unit;
+        }
+    }
+    return n != count;
+}
+
+/**
+ * Sets the encoder up for a stream, the next frame is a keyframe.
+ * @param fmt Pixel format of the frames.
+ * @param w Frame width, even.
+ * @param h Frame height.
+ * @param ref Frame sized buffer for the reference (SAD mode), word
+ *            aligned, NULL: checksum mode.
+ * @param interval Frames from a keyframe to the next, 0: only the first
+ *                 and after an overflow.
+ * @param sad Per tile SAD (bytes) a tile may differ from the reference
+ *            and not be sent, SAD mode only. 0 is lossless.
+ * @return 0 on success, 1 on a frame size which is not supported.
+ */
+uint8_t DELTA_Init(DELTA_Format fmt, uint16_t w, uint16_t h, uint8_t* ref,
+                   uint16_t interval, uint32_t sad)
+{
+    uint32_t tx = (w + DELTA_TILE - 1U) / DELTA_TILE;
+    uint32_t ty = (h + DELTA_TILE - 1U) / DELTA_TILE;
+
+    if (w == 0U || h == 0U || (w & 1U) || tx * ty > DELTA_MAX_TILES)
+        return 1;
+    format      = fmt;
+    width       = w;
+    height      = h;
+    tilesX      = (uint16_t)tx;
+    tilesY      = (uint16_t)ty;
+    reference   = ref;
+    keyInterval = interval;
+    threshold   = sad;
+    sinceKey    = 0;
+    forceKey    = 1;
+    frameNumber = 0;
+    stats       = (DELTA_Stats){0};
+    return 0;
+}
+
+/**
+ * Makes the next frame a keyframe, e.g. when a receiver connects.
+ */
+void DELTA_RequestKeyframe(void) { forceKey = 1; }
+
+/**
+ * Encodes a frame into one record.
+ * @param frame Frame of the size given to DELTA_Init(), word aligned.
+ * @param out Record output.
+ * @param capacity Size of out, DELTA_MaxRecordBytes() always fits.
+ * @return Record bytes, 0 when it did not fit (the next frame is a
+ *         keyframe then).
+ */
+uint32_t DELTA_Encode(const uint8_t* frame, uint8_t* out, uint32_t capacity)
+{
+    const uint32_t rowWords = width / 2U;
+    const uint8_t key =
+        forceKey || (keyInterval != 0U && sinceKey >= keyInterval);
+    uint32_t length = DELTA_HEADER_BYTES;
+    uint32_t sent   = 0;
+
+    frameNumber++;
+    if (capacity < DELTA_HEADER_BYTES)
+        goto overflow;
+
+    for (uint32_t ty = 0; ty < tilesY; ++ty)
+        for (uint32_t tx = 0; tx < tilesX; ++tx)
+        {
+            const uint32_t index = ty * tilesX + tx;
+            const uint32_t x     = tx * DELTA_TILE;
+            const uint32_t y     = ty * DELTA_TILE;
+            const uint32_t words =
+                ((width - x < DELTA_TILE) ? width - x : DELTA_TILE) / 2U;
+            const uint32_t rows =
+                (height - y < DELTA_TILE) ? height - y : DELTA_TILE;
+            const uint32_t offset = y * rowWords + x / 2U;
+            const DELTA_Word* src = (const DELTA_Word*)frame + offset;
+            uint32_t check, raw, coded;
+            uint8_t* tile;
+
+            if (reference != NULL && !key &&
+                DELTA_TileSad(src, (const DELTA_Word*)reference + offset,
+                              rowWords, words, rows) <= threshold)
+                continue;
+            check = DELTA_TileLoad(src, rowWords, words, rows);
+            if (reference == NULL)
+            {
+                if (!key && tileChecks[index] == check)
+                    continue;
+                tileChecks[index] = check;
+            }
+
+            raw = words * rows * 4U;
+            if (capacity - length < DELTA_TILE_HEADER_BYTES + raw)
+                goto overflow;
+            tile  = &out[length];
+            coded = DELTA_RleEncode(words * rows,
+                                    &tile[DELTA_TILE_HEADER_BYTES], raw - 1U);
+            DELTA_Put16(tile, index);
+            tile[2] = coded != 0U ? DELTA_CODING_RLE : DELTA_CODING_RAW;
+            if (coded == 0U)
+            {
+                coded = raw;
+                memcpy(&tile[DELTA_TILE_HEADER_BYTES], tileWords, raw);
+            }
+            DELTA_Put16(&tile[3], coded);
+            length += DELTA_TILE_HEADER_BYTES + coded;
+            sent++;
+
+            if (reference != NULL)
+            {
+                DELTA_Word* dst = (DELTA_Word*)reference + offset;
+                const uint32_t* t = tileWords;
+
+                for (uint32_t r = 0; r < rows; ++r, dst += rowWords)
+                    for (uint32_t w = 0; w < words; ++w)
+                        dst[w] = *t++;
+            }
+        }
+
+    memcpy(out, DELTA_MAGIC, 4U);
+    out[4] = key ? DELTA_FLAG_KEYFRAME : 0U;
+    out[5] = (uint8_t)format;
+    DELTA_Put16(&out[6], width);
+    DELTA_Put16(&out[8], height);
+    DELTA_Put16(&out[10], sent);
+    DELTA_Put32(&out[12], frameNumber);
+    DELTA_Put32(&out[16], length - DELTA_HEADER_BYTES);
+    DELTA_Put32(&out[20],
+                DELTA_Check(reference != NULL ? reference : frame,
+                            (uint32_t)width * height * 2U));
+
+    sinceKey = key ? 1U : sinceKey + 1U;
+    forceKey = 0;
+    stats.frames++;
+    stats.keyframes += key;
+    stats.lastTiles    = sent;
+    stats.lastBytes    = length;
+    stats.lastRawBytes = (uint32_t)width * height * 2U;
+    stats.lastSaved    = length < stats.lastRawBytes
+                             ? (uint32_t)((uint64_t)(stats.lastRawBytes -
+                                                     length) *
+                                          1000U / stats.lastRawBytes)
+                             : 0U;
+    stats.totalBytes += length;
+    stats.totalRawBytes += stats.lastRawBytes;
+    return length;
+
+overflow:
+    stats.overflows++;
+    forceKey = 1;
+    return 0;
+}
+
+void DELTA_GetStats(DELTA_Stats* out) { *out = stats; }
+
+/**
+ * Checksum of a whole frame (FNV-1a over its words).
+ * @param frame Frame, word aligned.
+ * @param bytes Size of the frame.
+ */
+uint32_t DELTA_Check(const uint8_t* frame, uint32_t bytes)
+{
+    const DELTA_Word* w = (const DELTA_Word*)frame;
+    uint32_t check      = DELTA_FNV_BASIS;
+
+    for (uint32_t i = 0; i < bytes / 4U; ++i)
+        check = (check ^ w[i]) * DELTA_FNV_PRIME;
+    for (uint32_t i = bytes & ~3U; i < bytes; ++i)
+        check = (check ^ frame[i]) * DELTA_FNV_PRIME;
+    return check;
+}
+
+/**
+ * Reads the header of a record.
+ * @param record Record, starting with DELTA_MAGIC.
+ * @param length Bytes available at record.
+ * @param header Filled with the fields.
+ * @return 0 on success, 1 on a header which is short or not valid.
+ */
+uint8_t DELTA_ParseHeader(const uint8_t* record, uint32_t length,
+                          DELTA_Header* header)
+{
+    if (length < DELTA_HEADER_BYTES || memcmp(record, DELTA_MAGIC, 4U) != 0)
+        return 1;
+    header->flags   = record[4];
+    header->format  = (DELTA_Format)record[5];
+    header->width   = (uint16_t)DELTA_Get16(&record[6]);
+    header->height  = (uint16_t)DELTA_Get16(&record[8]);
+    header->tiles   = (uint16_t)DELTA_Get16(&record[10]);
+    header->frame   = DELTA_Get32(&record[12]);
+    header->payload = DELTA_Get32(&record[16]);
+    header->check   = DELTA_Get32(&record[20]);
+    return record[5] > DELTA_FORMAT_YUV422 || header->width == 0U ||
+           (header->width & 1U) || header->height == 0U;
+}
+
+/**
+ * Applies a record to the frame the receiver holds.
+ * @param record Whole record.
+ * @param length Bytes available at record.
+ * @param frame Frame, word aligned. Updated by a delta record, fully
+ *              written by a keyframe.
+ * @param capacity Size of frame.
+ * @return 0 on success, 1 on a record which is malformed or does not fit
+ *         frame, 2 when the result differs from the sender's frame (a
+ *         record was lost since the last keyframe).
+ */
+uint8_t DELTA_Decode(const uint8_t* record, uint32_t length, uint8_t* frame,
+                     uint32_t capacity)
+{
+    DELTA_Header header;
+    uint32_t units[DELTA_TILE_WORDS];
+    uint32_t tx, ty, rowWords, offset;
+    const uint8_t* p;
+    const uint8_t* end;
+
+    if (DELTA_ParseHeader(record, length, &header) ||
+        length - DELTA_HEADER_BYTES < header.payload ||
+        capacity < (uint32_t)header.width * header.height * 2U)
+        return 1;
+    tx       = (header.width + DELTA_TILE - 1U) / DELTA_TILE;
+    ty       = (header.height + DELTA_TILE - 1U) / DELTA_TILE;
+    rowWords = header.width / 2U;
+    p        = record + DELTA_HEADER_BYTES;
+    end      = p + header.payload;
+
+    for (uint32_t t = 0; t < header.tiles; ++t)
+    {
+        uint32_t index, coding, size, x, y, words, rows;
+        DELTA_Word* dst;
+
+        if ((uint32_t)(end - p) < DELTA_TILE_HEADER_BYTES)
+            return 1;
+        index  = DELTA_Get16(p);
+        coding = p[2];
+        size   = DELTA_Get16(&p[3]);
+        p += DELTA_TILE_HEADER_BYTES;
+        if (index >= tx * ty || (uint32_t)(end - p) < size)
+            return 1;
+        x     = index % tx * DELTA_TILE;
+        y     = index / tx * DELTA_TILE;
+        words = ((header.width - x < DELTA_TILE) ? header.width - x
+                                                  : DELTA_TILE) /
+                2U;
+        rows  = (header.height - y < DELTA_TILE) ? header.height - y
+                                                  : DELTA_TILE;
+
+        if (coding == DELTA_CODING_RAW && size == words * rows * 4U)
+            memcpy(units, p, size);
+        else if (coding != DELTA_CODING_RLE ||
+                 DELTA_RleDecode(p, size, units, words * rows))
+            return 1;
+        p += size;
+
+        offset = y * rowWords + x / 2U;
+        dst    = (DELTA_Word*)frame + offset;
+        for (uint32_t r = 0; r < rows; ++r, dst += rowWords)
+            for (uint32_t w = 0; w < words; ++w)
+                dst[w] = units[r * words + w];
+    }
+    if (p != end)
+        return 1;
+    return DELTA_Check(frame, (uint32_t)header.width * header.height * 2U) !=
+                   header.check
+               ? 2U
+               : 0U;
+}
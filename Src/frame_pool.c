@@ -0,0 +1,195 @@
+/*
+ * frame_pool.c
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "frame_pool.h"
+#include "memory_config.h"
+
+/// Backing storage of all frame and line buffers
+DMA_BUFFER static uint8_t framePool[FRAME_POOL_SIZE];
+
+/// Number of blocks of the buffer starting at a block, 0 when not a start
+static uint16_t blockRun[FRAME_BLOCK_COUNT];
+/// Reference count of the buffer starting at a block
+static uint8_t blockRefs[FRAME_BLOCK_COUNT];
+/// Non-zero for every block belonging to an allocated buffer
+static uint8_t blockUsed[FRAME_BLOCK_COUNT];
+
+static FRAME_Stats stats;
+
+/**
+ * Buffers are released from DMA completion callbacks, so the bookkeeping is
+ * guarded with interrupts masked. PRIMASK is restored, not blindly cleared.
+ */
+static inline uint32_t FRAME_Lock(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    return primask;
+}
+
+static inline void FRAME_Unlock(uint32_t primask) { __set_PRIMASK(primask); }
+
+/**
+ * @param buf Buffer returned by FRAME_Alloc().
+ * @return Index of the first block of buf or -1 when buf is not a buffer
+ * start inside of the pool.
+ */
+static int32_t FRAME_BlockOf(const uint8_t* buf)
+{
+    uint32_t offset;
+
+    if (buf < framePool || buf >= framePool + FRAME_POOL_SIZE)
+        return -1;
+    offset = (uint32_t)(buf - framePool);
+    if (offset % FRAME_BLOCK_SIZE != 0U ||
+        blockRun[offset / FRAME_BLOCK_SIZE] == 0U)
+        return -1;
+    return (int32_t)(offset / FRAME_BLOCK_SIZE);
+}
+
+/**
+ * Frees all buffers and clears the statistics.
+ */
+void FRAME_PoolInit(void)
+{
+    uint32_t primask = FRAME_Lock();
+    for (uint32_t i = 0; i < FRAME_BLOCK_COUNT; ++i)
+    {
+        blockRun[i]  = 0;
+        blockRefs[i] = 0;
+        blockUsed[i] = 0;
+    }
+    stats = (FRAME_Stats){0};
+    FRAME_Unlock(primask);
+}
+
+/**
+ * Allocates a buffer from the pool (first fit). The buffer is aligned to
+ * FRAME_BLOCK_SIZE and its reference count is 1.
+ * @param size Requested size in bytes.
+ * @return Buffer or NULL when no free run of blocks is large enough.
+ */
+uint8_t* FRAME_Alloc(uint32_t size)
+{
+    uint32_t blocks = (size + FRAME_BLOCK_SIZE - 1U) / FRAME_BLOCK_SIZE;
+    uint32_t run    = 0;
+    uint8_t* buf    = NULL;
+
+    if (blocks == 0U)
+        blocks = 1U;
+
+    uint32_t primask = FRAME_Lock();
+    for (uint32_t i = 0; i < FRAME_BLOCK_COUNT && blocks <= FRAME_BLOCK_COUNT;
+         ++i)
+    {
+        run = blockUsed[i] ? 0U : run + 1U;
+        if (run == blocks)
+        {
+            uint32_t first = i + 1U - blocks;
+            for (uint32_t b = first; b <= i; ++b)
+                blockUsed[b] = 1U;
+            blockRun[first]  = (uint16_t)blocks;
+            blockRefs[first] = 1U;
+            buf              = &framePool[first * FRAME_BLOCK_SIZE];
+            break;
+        }
+    }
+
+    if (buf != NULL)
+    {
+        ++stats.allocations;
+        stats.usedBytes += blocks * FRAME_BLOCK_SIZE;
+        if (stats.usedBytes > stats.highWaterBytes)
+            stats.highWaterBytes = stats.usedBytes;
+    }
+    else
+    {
+        ++stats.failures;
+    }
+    FRAME_Unlock(primask);
+    return buf;
+}
+
+/**
+ * Adds a reference to a buffer, e.g. before it is handed to a DMA transfer
+ * which completes asynchronously.
+ * @param buf Buffer returned by FRAME_Alloc().
+ */
+void FRAME_Retain(const uint8_t* buf)
+{
+    uint32_t primask = FRAME_Lock();
+    int32_t block    = FRAME_BlockOf(buf);
+    if (block >= 0 && blockRefs[block] < UINT8_MAX)
+        ++blockRefs[block];
+    FRAME_Unlock(primask);
+}
+
+/**
+ * Drops a reference to a buffer. The last reference returns it to the pool.
+ * Can be called from interrupt context.
+ * @param buf Buffer returned by FRAME_Alloc(), NULL is ignored.
+ */
+void FRAME_Release(const uint8_t* buf)
+{
+    uint32_t primask = FRAME_Lock();
+    int32_t block    = FRAME_BlockOf(buf);
+    if (block >= 0 && --blockRefs[block] == 0U)
+    {
+        uint32_t blocks = blockRun[block];
+        for (uint32_t b = (uint32_t)block; b < (uint32_t)block + blocks; ++b)
+            blockUsed[b] = 0U;
+        blockRun[block] = 0U;
+        stats.usedBytes -= blocks * FRAME_BLOCK_SIZE;
+    }
+    FRAME_Unlock(primask);
+}
+
+/**
+ * Returns the blocks past size to the pool, e.g. after a JPEG capture into a
+ * worst case buffer. Nothing must access the buffer past size afterwards.
+ * @param buf Buffer returned by FRAME_Alloc().
+ * @param size Bytes still needed, the buffer keeps at least one block.
+ */
+void FRAME_Shrink(const uint8_t* buf, uint32_t size)
+{
+    uint32_t blocks = (size + FRAME_BLOCK_SIZE - 1U) / FRAME_BLOCK_SIZE;
+
+    if (blocks == 0U)
+        blocks = 1U;
+
+    uint32_t primask = FRAME_Lock();
+    int32_t block    = FRAME_BlockOf(buf);
+    if (block >= 0 && blocks < blockRun[block])
+    {
+        uint32_t end = (uint32_t)block + blockRun[block];
+        for (uint32_t b = (uint32_t)block + blocks; b < end; ++b)
+            blockUsed[b] = 0U;
+        stats.usedBytes -= (blockRun[block] - blocks) * FRAME_BLOCK_SIZE;
+        blockRun[block] = (uint16_t)blocks;
+    }
+    FRAME_Unlock(primask);
+}
+
+/**
+ * @param buf Buffer returned by FRAME_Alloc().
+ * @return Usable size of the buffer in bytes (whole blocks), 0 if buf is not
+ * an allocated buffer.
+ */
+uint32_t FRAME_Capacity(const uint8_t* buf)
+{
+    int32_t block = FRAME_BlockOf(buf);
+    return block < 0 ? 0U : blockRun[block] * FRAME_BLOCK_SIZE;
+}
+
+/**
+ * @param out Filled with a snapshot of the pool counters.
+ */
+void FRAME_GetStats(FRAME_Stats* out)
+{
+    uint32_t primask = FRAME_Lock();
+    *out             = stats;
+    FRAME_Unlock(primask);
+}
@@ -0,0 +1,308 @@
+/*
+ * gfx.c
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "gfx.h"
+
+#include <stddef.h>
+
+#if defined(__ARM_ARCH)
+#include "memory_config.h"
+/// Software kernels run from ITCM on the target
+#define GFX_ITCM ITCM_CODE
+#else
+#define GFX_ITCM
+#endif
+
+static const GFX_Backend* backend = &GFX_Software;
+
+/* Software backend ---------------------------------------------------------*/
+
+static inline __attribute__((always_inline)) uint8_t GFX_Clamp(int32_t v)
+{
+    return v < 0 ? 0U : v > 255 ? 255U : (uint8_t)v;
+}
+
+static inline __attribute__((always_inline)) uint16_t
+GFX_Pack(uint32_t r, uint32_t g, uint32_t b)
+{
+    return (uint16_t)(((r & 0xF8U) << 8) | ((g & 0xFCU) << 3) | (b >> 3));
+}
+
+/**
+ * One pixel of src over dst, as the DMA2D blends an opaque RGB565
+ * background with a foreground of constant alpha.
+ */
+static inline __attribute__((always_inline)) uint16_t
+GFX_BlendPixel(uint16_t fg, uint16_t bg, uint32_t alpha)
+{
+    uint32_t fr = fg >> 11, fgr = (fg >> 5) & 0x3FU, fb = fg & 0x1FU;
+    uint32_t br = bg >> 11, bgr = (bg >> 5) & 0x3FU, bb = bg & 0x1FU;
+    uint32_t inv = 255U - alpha;
+
+    fr  = (fr << 3) | (fr >> 2);
+    fgr = (fgr << 2) | (fgr >> 4);
+    fb  = (fb << 3) | (fb >> 2);
+    br  = (br << 3) | (br >> 2);
+    bgr = (bgr << 2) | (bgr >> 4);
+    bb  = (bb << 3) | (bb >> 2);
+    return GFX_Pack((fr * alpha + br * inv) / 255U,
+                    (fgr * alpha + bgr * inv) / 255U,
+                    (fb * alpha + bb * inv) / 255U);
+}
+
+GFX_ITCM static void GFX_SoftFill(uint16_t* dst, uint32_t dstStride,
+                                  uint32_t width, uint32_t height,
+                                  uint16_t color)
+{
+    for (uint32_t row = 0; row < height; ++row, dst += dstStride)
+        for (uint32_t col = 0; col < width; ++col)
+            dst[col] = color;
+}
+
+GFX_ITCM static void GFX_SoftCopy(uint16_t* dst, uint32_t dstStride,
+                                  const uint16_t* src, uint32_t srcStride,
+                                  uint32_t width, uint32_t height)
+{
+    for (uint32_t row = 0; row < height;
+         ++row, dst += dstStride, src += srcStride)
+        for (uint32_t col = 0; col < width; ++col)
+            dst[col] = src[col];
+}
+
+GFX_ITCM static void GFX_SoftRGB888(uint16_t* dst, uint32_t dstStride,
+                                    const uint8_t* src, uint32_t srcStride,
+                                    uint32_t width, uint32_t height)
+{
+    for (uint32_t row = 0; row < height;
+         ++row, dst += dstStride, src += srcStride * 3U)
+    {
+        const uint8_t* p = src;
+        for (uint32_t col = 0; col < width; ++col, p += 3)
+            dst[col] = GFX_Pack(p[0], p[1], p[2]);
+    }
+}
+
+/**
+ * BT.601 full range, fixed point with 16 fractional bits as the JPEG
+ * decoder. A pair of pixels shares U and V.
+ */
+GFX_ITCM static void GFX_SoftYUV422(uint16_t* dst, uint32_t dstStride,
+                                    const uint8_t* src, uint32_t srcStride,
+                                    uint32_t width, uint32_t height)
+{
+    for (uint32_t row = 0; row < height;
+         ++row, dst += dstStride, src += srcStride * 2U)
+    {
+        const uint8_t* p = src;
+        for (uint32_t col = 0; col < width; col += 2U, p += 4)
+        {
+            int32_t u  = (int32_t)p[1] - 128;
+            int32_t v  = (int32_t)p[3] - 128;
+            int32_t dr = (91881 * v) >> 16;
+            int32_t dg = (22554 * u + 46802 * v) >> 16;
+            int32_t db = (116130 * u) >> 16;
+            int32_t y  = p[0];
+
+            dst[col] = GFX_Pack(GFX_Clamp(y + dr), GFX_Clamp(y - dg),
+                                GFX_Clamp(y + db));
+            if (col + 1U < width)
+            {
+                y            = p[2];
+                dst[col + 1] = GFX_Pack(GFX_Clamp(y + dr), GFX_Clamp(y - dg),
+                                        GFX_Clamp(y + db));
+            }
+        }
+    }
+}
+
+GFX_ITCM static void GFX_SoftBlend(uint16_t* dst, uint32_t dstStride,
+                                   const uint16_t* src, uint32_t srcStride,
+                                   uint32_t width, uint32_t height,
+                                   uint8_t alpha)
+{
+    for (uint32_t row = 0; row < height;
+         ++row, dst += dstStride, src += srcStride)
+        for (uint32_t col = 0; col < width; ++col)
+            dst[col] = GFX_BlendPixel(src[col], dst[col], alpha);
+}
+
+const GFX_Backend GFX_Software = {
+    .name   = "software",
+    .fill   = GFX_SoftFill,
+    .copy   = GFX_SoftCopy,
+    .rgb888 = GFX_SoftRGB888,
+    .yuv422 = GFX_SoftYUV422,
+    .blend  = GFX_SoftBlend,
+};
+
+/* Front end ----------------------------------------------------------------*/
+
+/**
+ * Clips a rectangle to the canvas.
+ * @param dst Destination canvas.
+ * @param x Column of the rectangle, updated to the first visible one.
+ * @param y Row of the rectangle, updated to the first visible one.
+ * @param width Updated to the visible width.
+ * @param height Updated to the visible height.
+ * @param skipX Set to the source columns cut on the left.
+ * @param skipY Set to the source rows cut on the top.
+ * @return 0 when nothing is visible.
+ */
+static int GFX_Clip(const GFX_Canvas* dst, int32_t* x, int32_t* y,
+                    uint32_t* width, uint32_t* height, uint32_t* skipX,
+                    uint32_t* skipY)
+{
+    *skipX = *x < 0 ? (uint32_t)-*x : 0U;
+    *skipY = *y < 0 ? (uint32_t)-*y : 0U;
+    if (*skipX >= *width || *skipY >= *height || *x >= dst->width ||
+        *y >= dst->height)
+        return 0;
+    *x += (int32_t)*skipX;
+    *y += (int32_t)*skipY;
+    *width -= *skipX;
+    *height -= *skipY;
+    if (*width > dst->width - (uint32_t)*x)
+        *width = dst->width - (uint32_t)*x;
+    if (*height > dst->height - (uint32_t)*y)
+        *height = dst->height - (uint32_t)*y;
+    return 1;
+}
+
+static inline uint16_t* GFX_At(const GFX_Canvas* dst, int32_t x, int32_t y)
+{
+    return &dst->pixels[(uint32_t)y * dst->stride + (uint32_t)x];
+}
+
+/**
+ * @param b Backend used by the following operations, NULL: software.
+ */
+void GFX_SetBackend(const GFX_Backend* b)
+{
+    backend = b != NULL ? b : &GFX_Software;
+}
+
+/**
+ * @return Backend in use.
+ */
+const GFX_Backend* GFX_GetBackend(void) { return backend; }
+
+/**
+ * Fills a rectangle of the canvas.
+ * @param dst Destination canvas.
+ * @param x Left column, may be outside of the canvas.
+ * @param y Top row, may be outside of the canvas.
+ * @param width Width in pixels.
+ * @param height Height in pixels.
+ * @param color RGB565 color.
+ */
+void GFX_Fill(const GFX_Canvas* dst, int32_t x, int32_t y, uint32_t width,
+              uint32_t height, uint16_t color)
+{
+    uint32_t skipX, skipY;
+
+    if (GFX_Clip(dst, &x, &y, &width, &height, &skipX, &skipY))
+        backend->fill(GFX_At(dst, x, y), dst->stride, width, height, color);
+}
+
+/**
+ * Copies RGB565 pixels into the canvas.
+ * @param dst Destination canvas.
+ * @param x Left column, may be outside of the canvas.
+ * @param y Top row, may be outside of the canvas.
+ * @param src Source pixels.
+ * @param srcStride Source pixels from one row to the next.
+ * @param width Width in pixels.
+ * @param height Height in pixels.
+ */
+void GFX_Copy(const GFX_Canvas* dst, int32_t x, int32_t y,
+              const uint16_t* src, uint32_t srcStride, uint32_t width,
+              uint32_t height)
+{
+    uint32_t skipX, skipY;
+
+    if (GFX_Clip(dst, &x, &y, &width, &height, &skipX, &skipY))
+        backend->copy(GFX_At(dst, x, y), dst->stride,
+                      src + skipY * srcStride + skipX, srcStride, width,
+                      height);
+}
+
+/**
+ * Converts RGB888 pixels (R, G, B bytes) into the canvas.
+ * @param dst Destination canvas.
+ * @param x Left column, may be outside of the canvas.
+ * @param y Top row, may be outside of the canvas.
+ * @param src Source pixels.
+ * @param srcStride Source pixels from one row to the next.
+ * @param width Width in pixels.
+ * @param height Height in pixels.
+ */
+void GFX_ConvertRGB888(const GFX_Canvas* dst, int32_t x, int32_t y,
+                       const uint8_t* src, uint32_t srcStride, uint32_t width,
+                       uint32_t height)
+{
+    uint32_t skipX, skipY;
+
+    if (GFX_Clip(dst, &x, &y, &width, &height, &skipX, &skipY))
+        backend->rgb888(GFX_At(dst, x, y), dst->stride,
+                        src + (skipY * srcStride + skipX) * 3U, srcStride,
+                        width, height);
+}
+
+/**
+ * Converts YUV422 pixels (Y0 U Y1 V, the OV2640 order) into the canvas.
+ * When the left edge is clipped in the middle of a pair, the whole pair is
+ * dropped.
+ * @param dst Destination canvas.
+ * @param x Left column, may be outside of the canvas.
+ * @param y Top row, may be outside of the canvas.
+ * @param src Source pixels, 2 bytes each.
+ * @param srcStride Source pixels from one row to the next, even.
+ * @param width Width in pixels.
+ * @param height Height in pixels.
+ */
+void GFX_ConvertYUV422(const GFX_Canvas* dst, int32_t x, int32_t y,
+                       const uint8_t* src, uint32_t srcStride, uint32_t width,
+                       uint32_t height)
+{
+    uint32_t skipX, skipY;
+
+    if (!GFX_Clip(dst, &x, &y, &width, &height, &skipX, &skipY))
+        return;
+    if (skipX & 1U)
+    {
+        if (width < 2U)
+            return;
+        ++skipX;
+        ++x;
+        --width;
+    }
+    backend->yuv422(GFX_At(dst, x, y), dst->stride,
+                    src + (skipY * srcStride + skipX) * 2U, srcStride, width,
+                    height);
+}
+
+/**
+ * Blends RGB565 pixels over the canvas with a constant alpha.
+ * @param dst Destination canvas.
+ * @param x Left column, may be outside of the canvas.
+ * @param y Top row, may be outside of the canvas.
+ * @param src Source pixels.
+ * @param srcStride Source pixels from one row to the next.
+ * @param width Width in pixels.
+ * @param height Height in pixels.
+ * @param alpha Opacity of src, 0 (dst unchanged) ... 255 (src).
+ */
+void GFX_Blend(const GFX_Canvas* dst, int32_t x, int32_t y,
+               const uint16_t* src, uint32_t srcStride, uint32_t width,
+               uint32_t height, uint8_t alpha)
+{
+    uint32_t skipX, skipY;
+
+    if (GFX_Clip(dst, &x, &y, &width, &height, &skipX, &skipY))
+        backend->blend(GFX_At(dst, x, y), dst->stride,
+                       src + skipY * srcStride + skipX, srcStride, width,
+                       height, alpha);
+}
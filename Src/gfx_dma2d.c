@@ -0,0 +1,281 @@
+/*
+ * gfx_dma2d.c
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "frame_pool.h"
+#include "gfx.h"
+#include "memory_config.h"
+#include "perf.h"
+
+/// Below this many pixels the CPU is done before the DMA2D is set up
+#define GFX_DMA2D_MIN_PIXELS 64U
+
+/* DMA2D_CR MODE */
+#define GFX_MODE_M2M 0x00000U
+#define GFX_MODE_M2M_PFC 0x10000U
+#define GFX_MODE_M2M_BLEND 0x20000U
+#define GFX_MODE_R2M 0x30000U
+
+/* DMA2D_xPFCCR CM */
+#define GFX_CM_RGB888 0x1U
+#define GFX_CM_RGB565 0x2U
+/// DMA2D_FGPFCCR AM: replace the alpha of the pixels with ALPHA
+#define GFX_AM_REPLACE (1U << 16)
+/// DMA2D_FGPFCCR RBS: R, G, B byte order in memory
+#define GFX_RBS (1U << 21)
+
+/// Transfers which failed and were redone by the CPU
+static uint32_t dma2dErrors;
+
+static inline int GFX_Dma2dWorth(uint32_t width, uint32_t height)
+{
+    return width * height >= GFX_DMA2D_MIN_PIXELS && width <= 0x3FFFU &&
+           height <= 0xFFFFU;
+}
+
+/**
+ * Writes back the cache lines of a rectangle the DMA2D reads or writes.
+ */
+static void GFX_Dma2dClean(const void* start, uint32_t stride,
+                           uint32_t width, uint32_t height, uint32_t bpp)
+{
+    MEM_DmaTransmit(start, ((height - 1U) * stride + width) * bpp);
+}
+
+/**
+ * Programs the output, starts the transfer and waits for it.
+ * @return 0 when the transfer completed, 1 on a transfer or configuration
+ * error.
+ */
+static uint32_t GFX_Dma2dRun(uint32_t mode, uint16_t* dst, uint32_t dstStride,
+                             uint32_t width, uint32_t height)
+{
+    uint32_t isr;
+
+    GFX_Dma2dClean(dst, dstStride, width, height, 2U);
+    DMA2D->OPFCCR = GFX_CM_RGB565;
+    DMA2D->OMAR   = (uint32_t)dst;
+    DMA2D->OOR    = dstStride - width;
+    DMA2D->NLR    = (width << DMA2D_NLR_PL_Pos) | height;
+    DMA2D->IFCR   = DMA2D_IFCR_CTEIF | DMA2D_IFCR_CTCIF | DMA2D_IFCR_CCEIF;
+    DMA2D->CR     = mode | DMA2D_CR_START;
+
+    while (DMA2D->CR & DMA2D_CR_START)
+        ;
+    isr = DMA2D->ISR;
+    // The CPU reads the result from its cache
+    MEM_DmaReceived(dst, ((height - 1U) * dstStride + width) * 2U);
+    return (isr & (DMA2D_ISR_TEIF | DMA2D_ISR_CEIF)) != 0U;
+}
+
+static void GFX_Dma2dFill(uint16_t* dst, uint32_t dstStride, uint32_t width,
+                          uint32_t height, uint16_t color)
+{
+    if (GFX_Dma2dWorth(width, height))
+    {
+        DMA2D->OCOLR = color;
+        if (GFX_Dma2dRun(GFX_MODE_R2M, dst, dstStride, width, height) == 0U)
+            return;
+        ++dma2dErrors;
+    }
+    GFX_Software.fill(dst, dstStride, width, height, color);
+}
+
+/**
+ * Sets up the foreground (source) layer.
+ */
+static void GFX_Dma2dSource(const void* src, uint32_t srcStride,
+                            uint32_t width, uint32_t height, uint32_t bpp,
+                            uint32_t pfccr)
+{
+    GFX_Dma2dClean(src, srcStride, width, height, bpp);
+    DMA2D->FGMAR   = (uint32_t)src;
+    DMA2D->FGOR    = srcStride - width;
+    DMA2D->FGPFCCR = pfccr;
+}
+
+static void GFX_Dma2dCopy(uint16_t* dst, uint32_t dstStride,
+                          const uint16_t* src, uint32_t srcStride,
+                          uint32_t width, uint32_t height)
+{
+    if (GFX_Dma2dWorth(width, height))
+    {
+        GFX_Dma2dSource(src, srcStride, width, height, 2U, GFX_CM_RGB565);
+        if (GFX_Dma2dRun(GFX_MODE_M2M, dst, dstStride, width, height) == 0U)
+            return;
+        ++dma2dErrors;
+    }
+    GFX_Software.copy(dst, dstStride, src, srcStride, width, height);
+}
+
+static void GFX_Dma2dRGB888(uint16_t* dst, uint32_t dstStride,
+                            const uint8_t* src, uint32_t srcStride,
+                            uint32_t width, uint32_t height)
+{
+    if (GFX_Dma2dWorth(width, height))
+    {
+        GFX_Dma2dSource(src, srcStride, width, height, 3U,
+                        GFX_CM_RGB888 | GFX_RBS);
+        if (GFX_Dma2dRun(GFX_MODE_M2M_PFC, dst, dstStride, width, height) ==
+            0U)
+            return;
+        ++dma2dErrors;
+    }
+    GFX_Software.rgb888(dst, dstStride, src, srcStride, width, height);
+}
+
+static void GFX_Dma2dBlend(uint16_t* dst, uint32_t dstStride,
+                           const uint16_t* src, uint32_t srcStride,
+                           uint32_t width, uint32_t height, uint8_t alpha)
+{
+    if (GFX_Dma2dWorth(width, height))
+    {
+        GFX_Dma2dSource(src, srcStride, width, height, 2U,
+                        GFX_CM_RGB565 | GFX_AM_REPLACE |
+                            ((uint32_t)alpha << DMA2D_FGPFCCR_ALPHA_Pos));
+        // The background layer is the destination itself, opaque
+        DMA2D->BGMAR   = (uint32_t)dst;
+        DMA2D->BGOR    = dstStride - width;
+        DMA2D->BGPFCCR = GFX_CM_RGB565;
+        if (GFX_Dma2dRun(GFX_MODE_M2M_BLEND, dst, dstStride, width, height) ==
+            0U)
+            return;
+        ++dma2dErrors;
+    }
+    GFX_Software.blend(dst, dstStride, src, srcStride, width, height, alpha);
+}
+
+/**
+ * Interleaved YUV422 is not an input format of the DMA2D (its YCbCr mode
+ * reads JPEG MCU blocks), the CPU converts it.
+ */
+static void GFX_Dma2dYUV422(uint16_t* dst, uint32_t dstStride,
+                            const uint8_t* src, uint32_t srcStride,
+                            uint32_t width, uint32_t height)
+{
+    GFX_Software.yuv422(dst, dstStride, src, srcStride, width, height);
+}
+
+const GFX_Backend GFX_Dma2d = {
+    .name   = "DMA2D",
+    .fill   = GFX_Dma2dFill,
+    .copy   = GFX_Dma2dCopy,
+    .rgb888 = GFX_Dma2dRGB888,
+    .yuv422 = GFX_Dma2dYUV422,
+    .blend  = GFX_Dma2dBlend,
+};
+
+/**
+ * Enables the DMA2D clock. Call before GFX_Dma2d is selected.
+ */
+void GFX_Dma2dInit(void)
+{
+    __HAL_RCC_DMA2D_CLK_ENABLE();
+    DMA2D->AMTCR = 0;
+    dma2dErrors  = 0;
+}
+
+/* Benchmark ----------------------------------------------------------------*/
+
+#define BENCH_WIDTH 160U
+#define BENCH_HEIGHT 120U
+#define BENCH_PIXELS (BENCH_WIDTH * BENCH_HEIGHT)
+
+/**
+ * Runs one operation of both backends on identical canvases, prints both
+ * times and the number of pixels which differ.
+ */
+static void GFX_BenchOp(const char* name, int op, GFX_Canvas* a,
+                        GFX_Canvas* b, const uint8_t* rgb888,
+                        const uint16_t* rgb565)
+{
+    const GFX_Backend* backends[2] = {&GFX_Software, &GFX_Dma2d};
+    GFX_Canvas* canvases[2]        = {a, b};
+    uint32_t us[2], differ = 0;
+
+    for (int i = 0; i < 2; ++i)
+    {
+        GFX_Canvas* c = canvases[i];
+        uint32_t t0;
+
+        for (uint32_t p = 0; p < BENCH_PIXELS; ++p)
+            c->pixels[p] = (uint16_t)(p * 0x9E37U);
+        GFX_SetBackend(backends[i]);
+        t0 = PERF_Cycles();
+        switch (op)
+        {
+            case 0:
+                GFX_Fill(c, 0, 0, BENCH_WIDTH, BENCH_HEIGHT, 0x7BEF);
+                break;
+            case 1:
+                GFX_Copy(c, 0, 0, rgb565, BENCH_WIDTH, BENCH_WIDTH,
+                         BENCH_HEIGHT);
+                break;
+            case 2:
+                GFX_ConvertRGB888(c, 0, 0, rgb888, BENCH_WIDTH, BENCH_WIDTH,
+                                  BENCH_HEIGHT);
+                break;
+            case 3:
+                GFX_ConvertYUV422(c, 0, 0, rgb888, BENCH_WIDTH, BENCH_WIDTH,
+                                  BENCH_HEIGHT);
+                break;
+            default:
+                GFX_Blend(c, 0, 0, rgb565, BENCH_WIDTH, BENCH_WIDTH,
+                          BENCH_HEIGHT, 0x60);
+                break;
+        }
+        us[i] = PERF_CyclesToUs(PERF_Cycles() - t0);
+    }
+    for (uint32_t p = 0; p < BENCH_PIXELS; ++p)
+        differ += a->pixels[p] != b->pixels[p];
+    my_printf("  %s: %lu / %lu, %lu pixels differ\r\n", name, us[0], us[1],
+              differ);
+}
+
+/**
+ * Compares the software and the DMA2D backend on a 160x120 canvas in the
+ * frame pool and prints the results over UART. Needs about 210KB of free
+ * pool. The backend in use is selected again afterwards.
+ */
+void GFX_Benchmark(void)
+{
+    static const char* names[5] = {"fill", "copy", "RGB888", "YUV422",
+                                   "blend"};
+    const GFX_Backend* previous = GFX_GetBackend();
+    uint8_t* rgb888             = FRAME_Alloc(BENCH_PIXELS * 3U);
+    uint8_t* rgb565             = FRAME_Alloc(BENCH_PIXELS * 2U);
+    uint8_t* bufA               = FRAME_Alloc(BENCH_PIXELS * 2U);
+    uint8_t* bufB               = FRAME_Alloc(BENCH_PIXELS * 2U);
+
+    if (rgb888 != NULL && rgb565 != NULL && bufA != NULL && bufB != NULL)
+    {
+        GFX_Canvas a = {(uint16_t*)bufA, BENCH_WIDTH, BENCH_HEIGHT,
+                        BENCH_WIDTH};
+        GFX_Canvas b = {(uint16_t*)bufB, BENCH_WIDTH, BENCH_HEIGHT,
+                        BENCH_WIDTH};
+
+        PERF_Init();
+        for (uint32_t i = 0; i < BENCH_PIXELS * 3U; ++i)
+            rgb888[i] = (uint8_t)(i * 7U + (i >> 8));
+        for (uint32_t i = 0; i < BENCH_PIXELS * 2U; ++i)
+            rgb565[i] = (uint8_t)(i * 13U + (i >> 9));
+
+        my_printf("2D operations, %ux%u [us] (software / DMA2D)\r\n",
+                  BENCH_WIDTH, BENCH_HEIGHT);
+        for (int op = 0; op < 5; ++op)
+            GFX_BenchOp(names[op], op, &a, &b, rgb888,
+                        (const uint16_t*)rgb565);
+        my_printf("  DMA2D errors: %lu\r\n", dma2dErrors);
+    }
+    else
+    {
+        my_printf("2D benchmark: frame pool exhausted\r\n");
+    }
+    GFX_SetBackend(previous);
+    FRAME_Release(rgb888);
+    FRAME_Release(rgb565);
+    FRAME_Release(bufA);
+    FRAME_Release(bufB);
+}
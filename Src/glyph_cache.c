@@ -0,0 +1,93 @@
+/*
+ * glyph_cache.c
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "glyph_cache.h"
+#include "image_kernels.h"
+#include "memory_config.h"
+
+// The MRU slot may still be read by the DMA, eviction needs another one
+#if GLYPH_CACHE_SLOTS < 2
+#error "GLYPH_CACHE_SLOTS must be at least 2"
+#endif
+
+/// Slot key, font == NULL marks a free slot
+typedef struct
+{
+    const sFONT* font;
+    uint32_t colors; ///< fg << 16 | bg
+    uint32_t lastUse;
+    char ch;
+} GLYPH_Entry;
+
+/// Expanded glyphs, read by the SPI DMA straight from DTCM
+DTCM_BSS static uint16_t glyphArena[GLYPH_CACHE_SLOTS][GLYPH_SLOT_PIXELS];
+DTCM_BSS static GLYPH_Entry glyphEntries[GLYPH_CACHE_SLOTS];
+
+static uint32_t useCounter;
+static GLYPH_Stats stats;
+
+/**
+ * Drops all cached glyphs and clears the statistics.
+ */
+void GLYPH_CacheInit(void)
+{
+    for (uint32_t i = 0; i < GLYPH_CACHE_SLOTS; ++i)
+        glyphEntries[i] = (GLYPH_Entry){0};
+    useCounter = 0;
+    stats      = (GLYPH_Stats){0};
+}
+
+/**
+ * Returns the expanded glyph, expanding it into the least recently used slot
+ * on a miss.
+ * @param font Font of the glyph, at most MAX_WIDTH_FONT x MAX_HEIGHT_FONT.
+ * @param ch Printable ASCII character.
+ * @param fg Color of the glyph.
+ * @param bg Color of the glyph background.
+ * @return font->Width * font->Height RGB565 pixels, rows packed. Valid until
+ * GLYPH_CACHE_SLOTS - 1 other glyphs were looked up. NULL when the font does
+ * not fit a slot.
+ */
+const uint16_t* GLYPH_Lookup(const sFONT* font, char ch, uint16_t fg,
+                             uint16_t bg)
+{
+    uint32_t colors = ((uint32_t)fg << 16) | bg;
+    uint32_t victim = 0;
+
+    if (font->Width > MAX_WIDTH_FONT || font->Height > MAX_HEIGHT_FONT)
+        return NULL;
+
+    ++useCounter;
+    for (uint32_t i = 0; i < GLYPH_CACHE_SLOTS; ++i)
+    {
+        GLYPH_Entry* e = &glyphEntries[i];
+        if (e->font == font && e->ch == ch && e->colors == colors)
+        {
+            e->lastUse = useCounter;
+            ++stats.hits;
+            return glyphArena[i];
+        }
+        // Free slots have lastUse 0 and are taken first (wrap safe age)
+        if (useCounter - e->lastUse > useCounter - glyphEntries[victim].lastUse)
+            victim = i;
+    }
+
+    ++stats.misses;
+    if (glyphEntries[victim].font != NULL)
+        ++stats.evictions;
+
+    uint32_t rowBytes = (font->Width + 7U) / 8U;
+    IMG_ExpandGlyph(&font->table[(uint32_t)(ch - ' ') * font->Height *
+                                 rowBytes],
+                    font->Width, font->Height, fg, bg, glyphArena[victim]);
+    glyphEntries[victim] = (GLYPH_Entry){font, colors, useCounter, ch};
+    return glyphArena[victim];
+}
+
+/**
+ * @param out Filled with a snapshot of the cache counters.
+ */
+void GLYPH_GetStats(GLYPH_Stats* out) { *out = stats; }
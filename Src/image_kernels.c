@@ -0,0 +1,201 @@
+/*
+ * image_kernels.c
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "image_kernels.h"
+#include "perf.h"
+
+/**
+ * Kernel bodies are shared by the ITCM entry points and by the FLASH copies
+ * used in IMG_BenchmarkPlacements().
+ */
+static inline __attribute__((always_inline)) void
+RGB888ToRGB565_Body(const uint8_t* src, uint16_t* dst, uint32_t pixels)
+{
+    while (pixels--)
+    {
+        uint16_t r = src[0];
+        uint16_t g = src[1];
+        uint16_t b = src[2];
+        *dst++     = (uint16_t)(((r & 0xF8U) << 8) | ((g & 0xFCU) << 3) |
+                            (b >> 3));
+        src += 3;
+    }
+}
+
+static inline __attribute__((always_inline)) void
+ExpandGlyph_Body(const uint8_t* bits, uint32_t width, uint32_t height,
+                 uint16_t fg, uint16_t bg, uint16_t* dst)
+{
+    uint32_t rowBytes = (width + 7U) / 8U;
+
+    for (uint32_t row = 0; row < height; ++row)
+    {
+        const uint8_t* line = bits + row * rowBytes;
+        for (uint32_t column = 0; column < width; ++column)
+            *dst++ = (line[column >> 3] & (0x80U >> (column & 7U))) ? fg : bg;
+    }
+}
+
+static inline __attribute__((always_inline)) int32_t
+FindJpegMarker_Body(const uint8_t* buf, uint32_t len, uint8_t marker)
+{
+    for (uint32_t i = 0; i + 1U < len; ++i)
+    {
+        if (buf[i] == 0xFFU && buf[i + 1U] == marker)
+            return (int32_t)i;
+    }
+    return -1;
+}
+
+/**
+ * Converts packed RGB888 pixels to RGB565.
+ * @param src Source pixels, 3 bytes each (R, G, B).
+ * @param dst Destination pixels.
+ * @param pixels Number of pixels to convert.
+ */
+ITCM_CODE void IMG_RGB888ToRGB565(const uint8_t* src, uint16_t* dst,
+                                  uint32_t pixels)
+{
+    RGB888ToRGB565_Body(src, dst, pixels);
+}
+
+/**
+ * Expands a 1-bpp glyph (rows padded to whole bytes, MSB first) into
+ * RGB565 pixels.
+ * @param bits Glyph bitmap.
+ * @param width Glyph width in pixels.
+ * @param height Glyph height in pixels.
+ * @param fg Color of set bits.
+ * @param bg Color of cleared bits.
+ * @param dst Destination, width * height pixels.
+ */
+ITCM_CODE void IMG_ExpandGlyph(const uint8_t* bits, uint32_t width,
+                               uint32_t height, uint16_t fg, uint16_t bg,
+                               uint16_t* dst)
+{
+    ExpandGlyph_Body(bits, width, height, fg, bg, dst);
+}
+
+/**
+ * Expands a 4-bpp anti-aliased glyph (two pixels per byte, high nibble
+ * first, rows padded to whole bytes) into RGB565 pixels.
+ * @param alpha Glyph coverage, 0 background ... 15 ink.
+ * @param width Glyph width in pixels.
+ * @param height Glyph height in pixels.
+ * @param lut 16 colors blended from the background to the ink color.
+ * @param dst Destination, width * height pixels.
+ */
+ITCM_CODE void IMG_ExpandGlyphAA(const uint8_t* alpha, uint32_t width,
+                                 uint32_t height, const uint16_t* lut,
+                                 uint16_t* dst)
+{
+    for (uint32_t row = 0; row < height; ++row)
+    {
+        uint32_t column = 0;
+        for (; column + 1U < width; column += 2U)
+        {
+            uint8_t pair = *alpha++;
+            *dst++       = lut[pair >> 4];
+            *dst++       = lut[pair & 0x0FU];
+        }
+        if (column < width)
+            *dst++ = lut[*alpha++ >> 4];
+    }
+}
+
+/**
+ * Looks for a JPEG marker (0xFF followed by the marker code).
+ * @param buf Data to scan.
+ * @param len Number of bytes in buf.
+ * @param marker Marker code, e.g. 0xD8 (SOI) or 0xD9 (EOI).
+ * @return Index of the 0xFF byte or -1 when not found.
+ */
+ITCM_CODE int32_t IMG_FindJpegMarker(const uint8_t* buf, uint32_t len,
+                                     uint8_t marker)
+{
+    return FindJpegMarker_Body(buf, len, marker);
+}
+
+/* Benchmark ---------------------------------------------------------------*/
+
+#define BENCH_PIXELS 480U
+#define BENCH_SCAN_BYTES 4096U
+
+static __attribute__((noinline)) void
+RGB888ToRGB565_Flash(const uint8_t* src, uint16_t* dst, uint32_t pixels)
+{
+    RGB888ToRGB565_Body(src, dst, pixels);
+}
+
+static __attribute__((noinline)) void
+ExpandGlyph_Flash(const uint8_t* bits, uint32_t width, uint32_t height,
+                  uint16_t fg, uint16_t bg, uint16_t* dst)
+{
+    ExpandGlyph_Body(bits, width, height, fg, bg, dst);
+}
+
+static __attribute__((noinline)) int32_t
+FindJpegMarker_Flash(const uint8_t* buf, uint32_t len, uint8_t marker)
+{
+    return FindJpegMarker_Body(buf, len, marker);
+}
+
+DTCM_BSS static uint8_t benchSrcDtcm[BENCH_SCAN_BYTES];
+DTCM_BSS static uint16_t benchDstDtcm[BENCH_PIXELS];
+static uint8_t benchSrcSram[BENCH_SCAN_BYTES];
+static uint16_t benchDstSram[BENCH_PIXELS];
+
+/**
+ * Runs every kernel from ITCM and from FLASH, with working buffers in DTCM
+ * and in AXI SRAM, and prints the cycle counts over UART.
+ */
+void IMG_BenchmarkPlacements(void)
+{
+    const uint8_t* src[2] = {benchSrcDtcm, benchSrcSram};
+    uint16_t* dst[2]      = {benchDstDtcm, benchDstSram};
+    const char* name[2]   = {"DTCM", "SRAM"};
+    uint32_t t0, itcm, flash;
+
+    PERF_Init();
+    for (uint32_t i = 0; i < BENCH_SCAN_BYTES; ++i)
+    {
+        benchSrcDtcm[i] = (uint8_t)(i * 7U);
+        benchSrcSram[i] = (uint8_t)(i * 7U);
+    }
+
+    my_printf("Kernel placement benchmark [cycles] (ITCM / FLASH)\r\n");
+    for (uint32_t m = 0; m < 2U; ++m)
+    {
+        t0 = PERF_Cycles();
+        IMG_RGB888ToRGB565(src[m], dst[m], BENCH_PIXELS);
+        itcm = PERF_Cycles() - t0;
+        t0   = PERF_Cycles();
+        RGB888ToRGB565_Flash(src[m], dst[m], BENCH_PIXELS);
+        flash = PERF_Cycles() - t0;
+        my_printf("  RGB888->RGB565 %u px, data in %s: %lu / %lu\r\n",
+                  BENCH_PIXELS, name[m], itcm, flash);
+
+        // Font24 sized glyph: 17x24, 3 bytes per row
+        t0 = PERF_Cycles();
+        IMG_ExpandGlyph(src[m], 17U, 24U, 0xFFFF, 0x0000, dst[m]);
+        itcm = PERF_Cycles() - t0;
+        t0   = PERF_Cycles();
+        ExpandGlyph_Flash(src[m], 17U, 24U, 0xFFFF, 0x0000, dst[m]);
+        flash = PERF_Cycles() - t0;
+        my_printf("  Glyph 17x24, data in %s: %lu / %lu\r\n", name[m], itcm,
+                  flash);
+
+        // 0x01 does not occur after 0xFF in the pattern: full scan
+        t0 = PERF_Cycles();
+        (void)IMG_FindJpegMarker(src[m], BENCH_SCAN_BYTES, 0x01);
+        itcm = PERF_Cycles() - t0;
+        t0   = PERF_Cycles();
+        (void)FindJpegMarker_Flash(src[m], BENCH_SCAN_BYTES, 0x01);
+        flash = PERF_Cycles() - t0;
+        my_printf("  Marker scan %u B, data in %s: %lu / %lu\r\n",
+                  BENCH_SCAN_BYTES, name[m], itcm, flash);
+    }
+}
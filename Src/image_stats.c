@@ -0,0 +1,248 @@
+/*
+ * image_stats.c
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "image_stats.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#if defined(__ARM_ARCH)
+#include "memory_config.h"
+/// Row kernels run from ITCM, the histograms live in DTCM on the target
+#define STATS_ITCM ITCM_CODE
+#define STATS_DTCM DTCM_BSS
+#else
+#define STATS_ITCM
+#define STATS_DTCM
+#endif
+
+/// Two pixels of a YUV422 or RGB565 frame
+typedef uint32_t STATS_Word __attribute__((may_alias));
+
+/// Sums of a region while a frame is read
+typedef struct
+{
+    uint32_t sum;
+    uint32_t pixels;
+    uint32_t under;
+    uint32_t over;
+} STATS_Acc;
+
+/// Halfwords of the YUV422 sums overflow after 257 pairs
+#define STATS_MAX_PAIRS 256U
+#define STATS_HALVES(v) (((v) & 0xFFFFU) + ((v) >> 16))
+
+/// Histograms of the even and odd pixels, consecutive increments of the
+/// same bin do not wait for each other
+STATS_DTCM static uint32_t histEven[STATS_BINS];
+STATS_DTCM static uint32_t histOdd[STATS_BINS];
+
+/**
+ * Accumulates a run of YUV422 pixel pairs (Y0 U Y1 V).
+ */
+STATS_ITCM static void STATS_RowYUV422(const STATS_Word* src, uint32_t pairs,
+                                       STATS_Acc* acc)
+{
+    while (pairs != 0U)
+    {
+        uint32_t n        = pairs < STATS_MAX_PAIRS ? pairs : STATS_MAX_PAIRS;
+        uint32_t sums     = 0;
+        uint32_t notUnder = 0;
+        uint32_t over     = 0;
+
+        pairs -= n;
+        acc->pixels += n * 2U;
+        for (uint32_t i = 0; i < n; ++i)
+        {
+            uint32_t y = *src++ & 0x00FF00FFU;
+
+            histEven[y & 0xFFU]++;
+            histOdd[y >> 16]++;
+            sums += y;
+            // Bit 8 of a halfword is set when Y is above the level
+            notUnder +=
+                ((y + (255U - STATS_UNDER_LUMA) * 0x00010001U) >> 8) &
+                0x00010001U;
+            over += ((y + (256U - STATS_OVER_LUMA) * 0x00010001U) >> 8) &
+                    0x00010001U;
+        }
+        acc->sum += STATS_HALVES(sums);
+        acc->under += n * 2U - STATS_HALVES(notUnder);
+        acc->over += STATS_HALVES(over);
+    }
+}
+
+static inline __attribute__((always_inline)) uint32_t
+STATS_Luma565(uint32_t p)
+{
+    uint32_t r = p >> 11, g = (p >> 5) & 0x3FU, b = p & 0x1FU;
+
+    r = (r << 3) | (r >> 2);
+    g = (g << 2) | (g >> 4);
+    b = (b << 3) | (b >> 2);
+    return (77U * r + 150U * g + 29U * b) >> 8;
+}
+
+/**
+ * Accumulates a run of RGB565 pixels, two at a time.
+ */
+STATS_ITCM static void STATS_RowRGB565(const uint16_t* src, uint32_t pixels,
+                                       STATS_Acc* acc)
+{
+    uint32_t sum = 0, under = 0, over = 0;
+
+    acc->pixels += pixels;
+    for (; pixels != 0U; --pixels, ++src)
+    {
+        uint32_t y = STATS_Luma565(*src);
+
+        if (pixels & 1U)
+            histOdd[y]++;
+        else
+            histEven[y]++;
+        sum += y;
+        under += y <= STATS_UNDER_LUMA;
+        over += y >= STATS_OVER_LUMA;
+    }
+    acc->sum += sum;
+    acc->under += under;
+    acc->over += over;
+}
+
+static void STATS_Finish(const STATS_Acc* acc, STATS_Frame* stats)
+{
+    STATS_Acc total = {0};
+
+    for (uint32_t i = 0; i < STATS_BINS; ++i)
+        stats->histogram[i] = histEven[i] + histOdd[i];
+    for (uint32_t r = 0; r < STATS_REGIONS; ++r)
+    {
+        STATS_Region* region = &stats->regions[r];
+
+        region->pixels = acc[r].pixels;
+        region->under  = acc[r].under;
+        region->over   = acc[r].over;
+        region->mean =
+            (uint8_t)(acc[r].pixels ? acc[r].sum / acc[r].pixels : 0U);
+        total.sum += acc[r].sum;
+        total.pixels += acc[r].pixels;
+        total.under += acc[r].under;
+        total.over += acc[r].over;
+    }
+    stats->frame.pixels = total.pixels;
+    stats->frame.under  = total.under;
+    stats->frame.over   = total.over;
+    stats->frame.mean   = (uint8_t)(total.sum / total.pixels);
+}
+
+/**
+ * Column where region rx starts, even so YUV422 pairs are not split.
+ */
+static inline uint32_t STATS_RegionX(uint32_t width, uint32_t rx)
+{
+    return width * rx / STATS_REGIONS_X & ~1U;
+}
+
+/**
+ * Computes the statistics of a YUV422 frame.
+ * @param yuv Frame, Y0 U Y1 V, word aligned.
+ * @param width Frame width, even.
+ * @param height Frame height.
+ * @param stats Filled with the results.
+ * @return 0 on success, 1 on a frame which cannot be read.
+ */
+uint8_t STATS_ComputeYUV422(const uint8_t* yuv, uint16_t width,
+                            uint16_t height, STATS_Frame* stats)
+{
+    STATS_Acc acc[STATS_REGIONS] = {0};
+
+    if (width < 2U * STATS_REGIONS_X || (width & 1U) ||
+        height < STATS_REGIONS_Y)
+        return 1;
+    memset(histEven, 0, sizeof(histEven));
+    memset(histOdd, 0, sizeof(histOdd));
+    for (uint32_t row = 0; row < height; ++row)
+    {
+        const STATS_Word* line = (const STATS_Word*)yuv + row * width / 2U;
+        STATS_Acc* regions = &acc[row * STATS_REGIONS_Y / height *
+                                  STATS_REGIONS_X];
+
+        for (uint32_t rx = 0; rx < STATS_REGIONS_X; ++rx)
+        {
+            uint32_t x0 = STATS_RegionX(width, rx);
+            uint32_t x1 = STATS_RegionX(width, rx + 1U);
+
+            STATS_RowYUV422(line + x0 / 2U, (x1 - x0) / 2U, &regions[rx]);
+        }
+    }
+    STATS_Finish(acc, stats);
+    return 0;
+}
+
+/**
+ * Computes the statistics of an RGB565 frame.
+ * @param rgb Frame.
+ * @param width Frame width.
+ * @param height Frame height.
+ * @param stats Filled with the results.
+ * @return 0 on success, 1 on a frame which cannot be read.
+ */
+uint8_t STATS_ComputeRGB565(const uint16_t* rgb, uint16_t width,
+                            uint16_t height, STATS_Frame* stats)
+{
+    STATS_Acc acc[STATS_REGIONS] = {0};
+
+    if (width < 2U * STATS_REGIONS_X || height < STATS_REGIONS_Y)
+        return 1;
+    memset(histEven, 0, sizeof(histEven));
+    memset(histOdd, 0, sizeof(histOdd));
+    for (uint32_t row = 0; row < height; ++row)
+    {
+        const uint16_t* line = rgb + row * width;
+        STATS_Acc* regions = &acc[row * STATS_REGIONS_Y / height *
+                                  STATS_REGIONS_X];
+
+        for (uint32_t rx = 0; rx < STATS_REGIONS_X; ++rx)
+        {
+            uint32_t x0 = STATS_RegionX(width, rx);
+            uint32_t x1 = rx + 1U < STATS_REGIONS_X
+                              ? STATS_RegionX(width, rx + 1U)
+                              : width;
+
+            STATS_RowRGB565(line + x0, x1 - x0, &regions[rx]);
+        }
+    }
+    STATS_Finish(acc, stats);
+    return 0;
+}
+
+/**
+ * Writes the telemetry line of a frame (format in image_stats.h).
+ * @param stats Statistics of the frame.
+ * @param line Output, STATS_LINE_SIZE bytes are always enough.
+ * @param size Size of line.
+ * @return Length of the line, without the terminator.
+ */
+size_t STATS_Format(const STATS_Frame* stats, char* line, size_t size)
+{
+    const STATS_Region* f = &stats->frame;
+    int length = snprintf(line, size, "STAT %u %lu %lu", f->mean,
+                          (unsigned long)STATS_Permille(f->under, f->pixels),
+                          (unsigned long)STATS_Permille(f->over, f->pixels));
+
+    for (uint32_t r = 0; r < STATS_REGIONS && length > 0 &&
+                         (size_t)length < size;
+         ++r)
+    {
+        const STATS_Region* region = &stats->regions[r];
+
+        length += snprintf(
+            line + length, size - (size_t)length, " %u,%lu,%lu", region->mean,
+            (unsigned long)STATS_Permille(region->under, region->pixels),
+            (unsigned long)STATS_Permille(region->over, region->pixels));
+    }
+    return length < 0 ? 0U : (size_t)length < size ? (size_t)length : size - 1U;
+}
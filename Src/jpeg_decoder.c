@@ -0,0 +1,751 @@
+/*
+ * jpeg_decoder.c
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "jpeg_decoder.h"
+
+#include <string.h>
+
+#if defined(__ARM_ARCH)
+#include "memory_config.h"
+/// Leaf kernels of the decoder run from ITCM on the target
+#define JPEG_ITCM ITCM_CODE
+#else
+#define JPEG_ITCM
+#endif
+
+/* Markers */
+#define M_SOF0 0xC0U
+#define M_SOF1 0xC1U
+#define M_DHT 0xC4U
+#define M_RST0 0xD0U
+#define M_RST7 0xD7U
+#define M_SOI 0xD8U
+#define M_EOI 0xD9U
+#define M_SOS 0xDAU
+#define M_DQT 0xDBU
+#define M_DRI 0xDDU
+
+/// Natural order index of the n-th coefficient in zigzag order
+static const uint8_t zigzag[64] = {
+    0,  1,  8,  16, 9,  2,  3,  10, 17, 24, 32, 25, 18, 11, 4,  5,
+    12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13, 6,  7,  14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63};
+
+/* Marker segments ----------------------------------------------------------*/
+
+static uint16_t JPEG_Read16(const uint8_t* p)
+{
+    return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+static JPEG_Status JPEG_ParseDQT(JPEG_Decoder* dec, const uint8_t* p,
+                                 uint32_t len)
+{
+    while (len >= 65U)
+    {
+        uint8_t precision = p[0] >> 4;
+        uint8_t table     = p[0] & 0x0FU;
+
+        if (precision != 0U)
+            return JPEG_ERR_UNSUPPORTED;
+        if (table > 3U)
+            return JPEG_ERR_FORMAT;
+        memcpy(dec->quant[table], &p[1], 64);
+        p += 65;
+        len -= 65U;
+    }
+    return len == 0U ? JPEG_OK : JPEG_ERR_FORMAT;
+}
+
+/**
+ * Builds the canonical code limits and the lookup table of one Huffman
+ * table from the code length counts and symbol values of a DHT segment.
+ */
+static JPEG_Status JPEG_BuildHuffman(JPEG_Huffman* h, const uint8_t* counts,
+                                     const uint8_t* values, uint32_t total)
+{
+    uint32_t code = 0, k = 0;
+
+    memset(h->fastLength, 0, sizeof(h->fastLength));
+    memcpy(h->values, values, total);
+    for (uint32_t length = 1; length <= 16U; ++length)
+    {
+        uint32_t n = counts[length - 1U];
+
+        h->valOffset[length] = (int32_t)k - (int32_t)code;
+        for (uint32_t i = 0; i < n; ++i, ++k, ++code)
+        {
+            // Over-subscribed code lengths, checked before the code indexes
+            // the lookup table
+            if (code >= (1U << length))
+                return JPEG_ERR_FORMAT;
+            if (length <= JPEG_FAST_BITS)
+            {
+                uint32_t shift = JPEG_FAST_BITS - length;
+                for (uint32_t j = 0; j < (1U << shift); ++j)
+                {
+                    h->fastLength[(code << shift) | j] = (uint8_t)length;
+                    h->fastValue[(code << shift) | j]  = values[k];
+                }
+            }
+        }
+        h->maxCode[length] = n != 0U ? (int32_t)code - 1 : -1;
+        code <<= 1;
+    }
+    h->maxCode[17] = INT32_MAX;
+    return JPEG_OK;
+}
+
+static JPEG_Status JPEG_ParseDHT(JPEG_Decoder* dec, const uint8_t* p,
+                                 uint32_t len)
+{
+    while (len >= 17U)
+    {
+        uint8_t tableClass = p[0] >> 4;
+        uint8_t table      = p[0] & 0x0FU;
+        uint32_t total     = 0;
+
+        for (uint32_t i = 1; i <= 16U; ++i)
+            total += p[i];
+        if (tableClass > 1U || table > 1U || total > 256U ||
+            len < 17U + total)
+            return JPEG_ERR_FORMAT;
+
+        JPEG_Huffman* h = tableClass == 0U ? &dec->dc[table] : &dec->ac[table];
+        JPEG_Status status = JPEG_BuildHuffman(h, &p[1], &p[17], total);
+        if (status != JPEG_OK)
+            return status;
+        p += 17U + total;
+        len -= 17U + total;
+    }
+    return len == 0U ? JPEG_OK : JPEG_ERR_FORMAT;
+}
+
+static JPEG_Status JPEG_ParseSOF(JPEG_Decoder* dec, const uint8_t* p,
+                                 uint32_t len)
+{
+    if (len < 6U)
+        return JPEG_ERR_FORMAT;
+    if (p[0] != 8U)
+        return JPEG_ERR_UNSUPPORTED;
+    dec->height         = JPEG_Read16(&p[1]);
+    dec->width          = JPEG_Read16(&p[3]);
+    dec->componentCount = p[5];
+    if (dec->width == 0U || dec->height == 0U)
+        return JPEG_ERR_UNSUPPORTED; // DNL is not supported
+    if (dec->componentCount != 1U && dec->componentCount != 3U)
+        return JPEG_ERR_UNSUPPORTED;
+    if (len < 6U + 3U * dec->componentCount)
+        return JPEG_ERR_FORMAT;
+
+    dec->hMax = 1;
+    dec->vMax = 1;
+    for (uint32_t i = 0; i < dec->componentCount; ++i)
+    {
+        JPEG_Component* c = &dec->components[i];
+        const uint8_t* s  = &p[6U + 3U * i];
+
+        c->id    = s[0];
+        c->h     = s[1] >> 4;
+        c->v     = s[1] & 0x0FU;
+        c->quant = s[2] & 0x03U;
+        if (c->h < 1U || c->h > 2U || c->v < 1U || c->v > 2U)
+            return JPEG_ERR_UNSUPPORTED;
+        if (c->h > dec->hMax)
+            dec->hMax = c->h;
+        if (c->v > dec->vMax)
+            dec->vMax = c->v;
+    }
+    // Chroma is replicated from full resolution luma only
+    if (dec->componentCount == 3U &&
+        (dec->components[0].h != dec->hMax ||
+         dec->components[0].v != dec->vMax ||
+         dec->components[1].h != dec->components[2].h ||
+         dec->components[1].v != dec->components[2].v))
+        return JPEG_ERR_UNSUPPORTED;
+    // A single component scan is not interleaved: one block per MCU
+    if (dec->componentCount == 1U)
+    {
+        dec->components[0].h = dec->components[0].v = 1;
+        dec->hMax = dec->vMax = 1;
+    }
+    return JPEG_OK;
+}
+
+static JPEG_Status JPEG_ParseSOS(JPEG_Decoder* dec, const uint8_t* p,
+                                 uint32_t len)
+{
+    if (len < 1U || p[0] != dec->componentCount ||
+        len < 1U + 2U * p[0] + 3U)
+        return dec->width == 0U ? JPEG_ERR_FORMAT : JPEG_ERR_UNSUPPORTED;
+
+    for (uint32_t i = 0; i < p[0]; ++i)
+    {
+        const uint8_t* s = &p[1U + 2U * i];
+        uint32_t c;
+
+        for (c = 0; c < dec->componentCount; ++c)
+        {
+            if (dec->components[c].id == s[0])
+                break;
+        }
+        if (c == dec->componentCount || (s[1] >> 4) > 1U ||
+            (s[1] & 0x0FU) > 1U)
+            return JPEG_ERR_FORMAT;
+        dec->components[c].dcTable = s[1] >> 4;
+        dec->components[c].acTable = s[1] & 0x0FU;
+    }
+    return JPEG_OK;
+}
+
+/* Entropy decoding ---------------------------------------------------------*/
+
+/**
+ * Tops the bit buffer up to more than 24 bits. Stuffed zero bytes after
+ * 0xFF are dropped. At a marker (or the end of data) zero bits are fed and
+ * the marker code is kept in dec->marker.
+ */
+static inline void JPEG_FillBits(JPEG_Decoder* dec)
+{
+    while (dec->bitCount <= 24U)
+    {
+        uint32_t byte = 0;
+
+        if (dec->marker == 0U && dec->pos < dec->length)
+        {
+            byte = dec->data[dec->pos++];
+            if (byte == 0xFFU)
+            {
+                uint8_t next =
+                    dec->pos < dec->length ? dec->data[dec->pos] : M_EOI;
+                if (next == 0x00U)
+                {
+                    ++dec->pos;
+                }
+                else
+                {
+                    dec->marker = next;
+                    ++dec->pos;
+                    byte = 0;
+                }
+            }
+        }
+        dec->bitBuffer |= byte << (24U - dec->bitCount);
+        dec->bitCount += 8U;
+    }
+}
+
+/// Reads 1 ... 16 bits
+static inline uint32_t JPEG_GetBits(JPEG_Decoder* dec, uint32_t n)
+{
+    uint32_t value;
+
+    JPEG_FillBits(dec);
+    value = dec->bitBuffer >> (32U - n);
+    dec->bitBuffer <<= n;
+    dec->bitCount -= n;
+    return value;
+}
+
+/// Sign extension of an n bit magnitude category value (F.12)
+static inline int32_t JPEG_Extend(uint32_t value, uint32_t n)
+{
+    return value < (1U << (n - 1U)) ? (int32_t)value - (int32_t)(1U << n) + 1
+                                     : (int32_t)value;
+}
+
+/// @return Decoded symbol, -1 for an invalid code
+static inline int32_t JPEG_DecodeSymbol(JPEG_Decoder* dec,
+                                        const JPEG_Huffman* h)
+{
+    uint32_t peek, length;
+
+    JPEG_FillBits(dec);
+    peek   = dec->bitBuffer >> (32U - JPEG_FAST_BITS);
+    length = h->fastLength[peek];
+    if (length != 0U)
+    {
+        dec->bitBuffer <<= length;
+        dec->bitCount -= length;
+        return h->fastValue[peek];
+    }
+    for (length = JPEG_FAST_BITS + 1U; length <= 16U; ++length)
+    {
+        int32_t code = (int32_t)(dec->bitBuffer >> (32U - length));
+        if (code <= h->maxCode[length])
+        {
+            dec->bitBuffer <<= length;
+            dec->bitCount -= length;
+            return h->values[code + h->valOffset[length]];
+        }
+    }
+    return -1;
+}
+
+/**
+ * Dequantized coefficients of 8-bit samples fit in 12 bits. Corrupted data
+ * (a damaged DCMI frame) is clamped to that range, which keeps the IDCT
+ * products within 32 bits.
+ */
+static inline int16_t JPEG_Dequantize(int32_t value, uint8_t q)
+{
+    int32_t v = value * q;
+
+    return (int16_t)(v < -2048 ? -2048 : v > 2047 ? 2047 : v);
+}
+
+/**
+ * Decodes and dequantizes one 8x8 block into dec->coefficients (natural
+ * order).
+ */
+static JPEG_Status JPEG_DecodeBlock(JPEG_Decoder* dec, JPEG_Component* c)
+{
+    const uint8_t* q = dec->quant[c->quant];
+    int16_t* coef    = dec->coefficients;
+    int32_t symbol;
+
+    memset(coef, 0, sizeof(dec->coefficients));
+
+    symbol = JPEG_DecodeSymbol(dec, &dec->dc[c->dcTable]);
+    if (symbol < 0 || symbol > 11)
+        return JPEG_ERR_DATA;
+    if (symbol != 0)
+        c->dcPredictor += (int16_t)JPEG_Extend(
+            JPEG_GetBits(dec, (uint32_t)symbol), (uint32_t)symbol);
+    coef[0] = JPEG_Dequantize(c->dcPredictor, q[0]);
+
+    for (uint32_t k = 1; k < 64U;)
+    {
+        uint32_t run, size;
+
+        symbol = JPEG_DecodeSymbol(dec, &dec->ac[c->acTable]);
+        if (symbol < 0)
+            return JPEG_ERR_DATA;
+        run  = (uint32_t)symbol >> 4;
+        size = (uint32_t)symbol & 0x0FU;
+        if (size == 0U)
+        {
+            if (run != 15U)
+                break; // End of block
+            k += 16U;  // ZRL
+            continue;
+        }
+        k += run;
+        if (k > 63U)
+            return JPEG_ERR_DATA;
+        coef[zigzag[k]] =
+            JPEG_Dequantize(JPEG_Extend(JPEG_GetBits(dec, size), size), q[k]);
+        ++k;
+    }
+    return JPEG_OK;
+}
+
+/* Reconstruction -----------------------------------------------------------*/
+
+#define CONST_BITS 13
+#define PASS1_BITS 2
+#define FIX_0_298631336 2446
+#define FIX_0_390180644 3196
+#define FIX_0_541196100 4433
+#define FIX_0_765366865 6270
+#define FIX_0_899976223 7373
+#define FIX_1_175875602 9633
+#define FIX_1_501321110 12299
+#define FIX_1_847759065 15137
+#define FIX_1_961570560 16069
+#define FIX_2_053119869 16819
+#define FIX_2_562915447 20995
+#define FIX_3_072711026 25172
+#define DESCALE(x, n) (((x) + (1 << ((n)-1))) >> (n))
+
+/**
+ * Accurate integer inverse DCT (Loeffler, Ligtenberg, Moschytz, the
+ * algorithm of the IJG "islow" IDCT). The samples are level shifted and
+ * clamped to 0 ... 255.
+ * @param in Dequantized coefficients, natural order.
+ * @param out Destination of the top left sample.
+ * @param stride Distance between rows of out in bytes.
+ */
+JPEG_ITCM static void JPEG_IDCT(const int16_t* in, uint8_t* out,
+                                uint32_t stride)
+{
+    int32_t work[64];
+    int32_t tmp0, tmp1, tmp2, tmp3, tmp10, tmp11, tmp12, tmp13;
+    int32_t z1, z2, z3, z4, z5;
+
+    // Columns; many blocks only have low frequencies
+    for (uint32_t col = 0; col < 8U; ++col)
+    {
+        const int16_t* s = &in[col];
+        int32_t* w       = &work[col];
+
+        if ((s[8] | s[16] | s[24] | s[32] | s[40] | s[48] | s[56]) == 0)
+        {
+            int32_t dc = s[0] * (1 << PASS1_BITS);
+            w[0] = w[8] = w[16] = w[24] = w[32] = w[40] = w[48] = w[56] = dc;
+            continue;
+        }
+
+        z2    = s[16];
+        z3    = s[48];
+        z1    = (z2 + z3) * FIX_0_541196100;
+        tmp2  = z1 - z3 * FIX_1_847759065;
+        tmp3  = z1 + z2 * FIX_0_765366865;
+        tmp0  = (s[0] + s[32]) * (1 << CONST_BITS);
+        tmp1  = (s[0] - s[32]) * (1 << CONST_BITS);
+        tmp10 = tmp0 + tmp3;
+        tmp13 = tmp0 - tmp3;
+        tmp11 = tmp1 + tmp2;
+        tmp12 = tmp1 - tmp2;
+
+        tmp0 = s[56];
+        tmp1 = s[40];
+        tmp2 = s[24];
+        tmp3 = s[8];
+        z1   = tmp0 + tmp3;
+        z2   = tmp1 + tmp2;
+        z3   = tmp0 + tmp2;
+        z4   = tmp1 + tmp3;
+        z5   = (z3 + z4) * FIX_1_175875602;
+        tmp0 *= FIX_0_298631336;
+        tmp1 *= FIX_2_053119869;
+        tmp2 *= FIX_3_072711026;
+        tmp3 *= FIX_1_501321110;
+        z1 *= -FIX_0_899976223;
+        z2 *= -FIX_2_562915447;
+        z3 = z3 * -FIX_1_961570560 + z5;
+        z4 = z4 * -FIX_0_390180644 + z5;
+        tmp0 += z1 + z3;
+        tmp1 += z2 + z4;
+        tmp2 += z2 + z3;
+        tmp3 += z1 + z4;
+
+        w[0]  = DESCALE(tmp10 + tmp3, CONST_BITS - PASS1_BITS);
+        w[56] = DESCALE(tmp10 - tmp3, CONST_BITS - PASS1_BITS);
+        w[8]  = DESCALE(tmp11 + tmp2, CONST_BITS - PASS1_BITS);
+        w[48] = DESCALE(tmp11 - tmp2, CONST_BITS - PASS1_BITS);
+        w[16] = DESCALE(tmp12 + tmp1, CONST_BITS - PASS1_BITS);
+        w[40] = DESCALE(tmp12 - tmp1, CONST_BITS - PASS1_BITS);
+        w[24] = DESCALE(tmp13 + tmp0, CONST_BITS - PASS1_BITS);
+        w[32] = DESCALE(tmp13 - tmp0, CONST_BITS - PASS1_BITS);
+    }
+
+    // Rows, the level shift is folded into the DC term
+    for (uint32_t row = 0; row < 8U; ++row, out += stride)
+    {
+        const int32_t* w = &work[row * 8U];
+        int32_t r[8];
+
+        z2    = w[2];
+        z3    = w[6];
+        z1    = (z2 + z3) * FIX_0_541196100;
+        tmp2  = z1 - z3 * FIX_1_847759065;
+        tmp3  = z1 + z2 * FIX_0_765366865;
+        z4    = w[0] + ((128 << (PASS1_BITS + 3)) + (1 << (PASS1_BITS + 2)));
+        tmp0  = (z4 + w[4]) * (1 << CONST_BITS);
+        tmp1  = (z4 - w[4]) * (1 << CONST_BITS);
+        tmp10 = tmp0 + tmp3;
+        tmp13 = tmp0 - tmp3;
+        tmp11 = tmp1 + tmp2;
+        tmp12 = tmp1 - tmp2;
+
+        tmp0 = w[7];
+        tmp1 = w[5];
+        tmp2 = w[3];
+        tmp3 = w[1];
+        z1   = tmp0 + tmp3;
+        z2   = tmp1 + tmp2;
+        z3   = tmp0 + tmp2;
+        z4   = tmp1 + tmp3;
+        z5   = (z3 + z4) * FIX_1_175875602;
+        tmp0 *= FIX_0_298631336;
+        tmp1 *= FIX_2_053119869;
+        tmp2 *= FIX_3_072711026;
+        tmp3 *= FIX_1_501321110;
+        z1 *= -FIX_0_899976223;
+        z2 *= -FIX_2_562915447;
+        z3 = z3 * -FIX_1_961570560 + z5;
+        z4 = z4 * -FIX_0_390180644 + z5;
+        tmp0 += z1 + z3;
+        tmp1 += z2 + z4;
+        tmp2 += z2 + z3;
+        tmp3 += z1 + z4;
+
+        // Rounding was added to the DC term above
+        r[0] = (tmp10 + tmp3) >> (CONST_BITS + PASS1_BITS + 3);
+        r[7] = (tmp10 - tmp3) >> (CONST_BITS + PASS1_BITS + 3);
+        r[1] = (tmp11 + tmp2) >> (CONST_BITS + PASS1_BITS + 3);
+        r[6] = (tmp11 - tmp2) >> (CONST_BITS + PASS1_BITS + 3);
+        r[2] = (tmp12 + tmp1) >> (CONST_BITS + PASS1_BITS + 3);
+        r[5] = (tmp12 - tmp1) >> (CONST_BITS + PASS1_BITS + 3);
+        r[3] = (tmp13 + tmp0) >> (CONST_BITS + PASS1_BITS + 3);
+        r[4] = (tmp13 - tmp0) >> (CONST_BITS + PASS1_BITS + 3);
+        for (uint32_t i = 0; i < 8U; ++i)
+            out[i] = (uint8_t)(r[i] < 0 ? 0 : (r[i] > 255 ? 255 : r[i]));
+    }
+}
+
+static inline __attribute__((always_inline)) uint32_t JPEG_Clamp(int32_t v)
+{
+    return (uint32_t)(v < 0 ? 0 : (v > 255 ? 255 : v));
+}
+
+/**
+ * Converts the sample planes of one MCU to RGB565 (JFIF YCbCr, chroma
+ * replicated). Only the visible width x height part is written, rows packed.
+ */
+JPEG_ITCM static void JPEG_ColorConvert(const JPEG_Decoder* dec,
+                                        uint16_t* dst, uint32_t width,
+                                        uint32_t height)
+{
+    const uint8_t* yPlane  = dec->planes[0];
+    const uint8_t* cbPlane = dec->planes[1];
+    const uint8_t* crPlane = dec->planes[2];
+    uint32_t yStride       = 8U * dec->components[0].h;
+    uint32_t cStride       = 8U * dec->components[1].h;
+    uint32_t hShift        = dec->hMax / dec->components[1].h - 1U;
+    uint32_t vShift        = dec->vMax / dec->components[1].v - 1U;
+    uint32_t swap          = dec->flags & JPEG_FLAG_SWAP_BYTES;
+
+    for (uint32_t py = 0; py < height; ++py)
+    {
+        const uint8_t* yRow  = &yPlane[py * yStride];
+        const uint8_t* cbRow = &cbPlane[(py >> vShift) * cStride];
+        const uint8_t* crRow = &crPlane[(py >> vShift) * cStride];
+
+        for (uint32_t px = 0; px < width; ++px)
+        {
+            int32_t y  = yRow[px] << 16;
+            int32_t cb = cbRow[px >> hShift] - 128;
+            int32_t cr = crRow[px >> hShift] - 128;
+            uint32_t r = JPEG_Clamp((y + 91881 * cr + 32768) >> 16);
+            uint32_t g =
+                JPEG_Clamp((y - 22554 * cb - 46802 * cr + 32768) >> 16);
+            uint32_t b  = JPEG_Clamp((y + 116130 * cb + 32768) >> 16);
+            uint32_t px565 = ((r & 0xF8U) << 8) | ((g & 0xFCU) << 3) | (b >> 3);
+            *dst++ = (uint16_t)(swap ? ((px565 >> 8) | (px565 << 8)) : px565);
+        }
+    }
+}
+
+/// Grayscale variant of JPEG_ColorConvert()
+static void JPEG_GrayConvert(const JPEG_Decoder* dec, uint16_t* dst,
+                             uint32_t width, uint32_t height)
+{
+    uint32_t swap = dec->flags & JPEG_FLAG_SWAP_BYTES;
+
+    for (uint32_t py = 0; py < height; ++py)
+    {
+        const uint8_t* yRow = &dec->planes[0][py * 8U];
+        for (uint32_t px = 0; px < width; ++px)
+        {
+            uint32_t y     = yRow[px];
+            uint32_t px565 = ((y & 0xF8U) << 8) | ((y & 0xFCU) << 3) | (y >> 3);
+            *dst++ = (uint16_t)(swap ? ((px565 >> 8) | (px565 << 8)) : px565);
+        }
+    }
+}
+
+/**
+ * Expects an RSTn marker after a restart interval and resets the bit reader
+ * and the DC predictors.
+ */
+static JPEG_Status JPEG_Restart(JPEG_Decoder* dec)
+{
+    if (dec->marker == 0U)
+    {
+        // Skip the fill bits, the marker follows
+        while (dec->pos + 1U < dec->length &&
+               !(dec->data[dec->pos] == 0xFFU &&
+                 dec->data[dec->pos + 1U] >= M_RST0 &&
+                 dec->data[dec->pos + 1U] <= M_RST7))
+            ++dec->pos;
+        dec->pos += 2U;
+    }
+    else if (dec->marker < M_RST0 || dec->marker > M_RST7)
+    {
+        return JPEG_ERR_DATA;
+    }
+    dec->marker    = 0;
+    dec->bitBuffer = 0;
+    dec->bitCount  = 0;
+    for (uint32_t c = 0; c < dec->componentCount; ++c)
+        dec->components[c].dcPredictor = 0;
+    return JPEG_OK;
+}
+
+static JPEG_Status JPEG_DecodeScan(JPEG_Decoder* dec, JPEG_BlockSink sink,
+                                   void* context)
+{
+    uint32_t mcuWidth  = 8U * dec->hMax;
+    uint32_t mcuHeight = 8U * dec->vMax;
+    uint32_t mcusX     = (dec->width + mcuWidth - 1U) / mcuWidth;
+    uint32_t mcusY     = (dec->height + mcuHeight - 1U) / mcuHeight;
+    uint32_t untilRestart = dec->restartInterval;
+
+    dec->bitBuffer = 0;
+    dec->bitCount  = 0;
+    dec->marker    = 0;
+    for (uint32_t c = 0; c < dec->componentCount; ++c)
+        dec->components[c].dcPredictor = 0;
+
+    for (uint32_t my = 0; my < mcusY; ++my)
+    {
+        for (uint32_t mx = 0; mx < mcusX; ++mx)
+        {
+            if (dec->restartInterval != 0U)
+            {
+                if (untilRestart == 0U)
+                {
+                    JPEG_Status status = JPEG_Restart(dec);
+                    if (status != JPEG_OK)
+                        return status;
+                    untilRestart = dec->restartInterval;
+                }
+                --untilRestart;
+            }
+
+            for (uint32_t c = 0; c < dec->componentCount; ++c)
+            {
+                JPEG_Component* comp = &dec->components[c];
+                uint32_t stride      = 8U * comp->h;
+
+                for (uint32_t by = 0; by < comp->v; ++by)
+                {
+                    for (uint32_t bx = 0; bx < comp->h; ++bx)
+                    {
+                        JPEG_Status status = JPEG_DecodeBlock(dec, comp);
+                        if (status != JPEG_OK)
+                            return status;
+                        JPEG_IDCT(dec->coefficients,
+                                  &dec->planes[c][by * 8U * stride + bx * 8U],
+                                  stride);
+                    }
+                }
+            }
+
+            uint32_t x      = mx * mcuWidth;
+            uint32_t y      = my * mcuHeight;
+            uint32_t width  = dec->width - x < mcuWidth ? dec->width - x
+                                                        : mcuWidth;
+            uint32_t height = dec->height - y < mcuHeight ? dec->height - y
+                                                          : mcuHeight;
+            uint16_t* pixels = dec->pixels[dec->bank];
+
+            if (dec->componentCount == 3U)
+                JPEG_ColorConvert(dec, pixels, width, height);
+            else
+                JPEG_GrayConvert(dec, pixels, width, height);
+            dec->bank ^= 1U;
+            ++dec->mcuCount;
+
+            if (sink != NULL &&
+                sink(context, pixels, (uint16_t)x, (uint16_t)y,
+                     (uint16_t)width, (uint16_t)height) != 0)
+                return JPEG_ABORTED;
+        }
+    }
+    return JPEG_OK;
+}
+
+/* Public API ---------------------------------------------------------------*/
+
+/**
+ * Prepares a decoder.
+ * @param dec Decoder, can be reused for any number of images.
+ * @param flags JPEG_FLAG_ values.
+ */
+void JPEG_Init(JPEG_Decoder* dec, uint8_t flags)
+{
+    memset(dec, 0, sizeof(*dec));
+    dec->flags = flags;
+}
+
+/**
+ * Decodes a complete JPEG image (SOI ... EOI) and passes it MCU by MCU to
+ * the sink, left to right and top to bottom.
+ * @param dec Decoder prepared by JPEG_Init().
+ * @param data Compressed image.
+ * @param length Number of bytes in data, trailing padding is ignored.
+ * @param sink Receiver of the decoded MCUs, NULL only decodes.
+ * @param context Passed to the sink.
+ * @return JPEG_OK or the reason decoding stopped.
+ */
+JPEG_Status JPEG_Decode(JPEG_Decoder* dec, const uint8_t* data,
+                        uint32_t length, JPEG_BlockSink sink, void* context)
+{
+    uint32_t pos = 2;
+
+    dec->width           = 0;
+    dec->height          = 0;
+    dec->restartInterval = 0;
+    dec->mcuCount        = 0;
+    if (length < 4U || data[0] != 0xFFU || data[1] != M_SOI)
+        return JPEG_ERR_FORMAT;
+
+    while (pos + 4U <= length)
+    {
+        uint8_t marker;
+        uint32_t segment;
+        JPEG_Status status = JPEG_OK;
+
+        if (data[pos] != 0xFFU)
+            return JPEG_ERR_FORMAT;
+        marker = data[pos + 1U];
+        if (marker == 0xFFU)
+        {
+            ++pos; // Fill byte
+            continue;
+        }
+        if (marker == M_EOI)
+            break;
+
+        segment = JPEG_Read16(&data[pos + 2U]);
+        if (segment < 2U || pos + 2U + segment > length)
+            return JPEG_ERR_FORMAT;
+        const uint8_t* p = &data[pos + 4U];
+        segment -= 2U;
+
+        switch (marker)
+        {
+        case M_SOF0:
+        case M_SOF1:
+            status = JPEG_ParseSOF(dec, p, segment);
+            break;
+        case M_DHT:
+            status = JPEG_ParseDHT(dec, p, segment);
+            break;
+        case M_DQT:
+            status = JPEG_ParseDQT(dec, p, segment);
+            break;
+        case M_DRI:
+            if (segment < 2U)
+                return JPEG_ERR_FORMAT;
+            dec->restartInterval = JPEG_Read16(p);
+            break;
+        case M_SOS:
+            status = JPEG_ParseSOS(dec, p, segment);
+            if (status != JPEG_OK)
+                return status;
+            dec->data   = data;
+            dec->length = length;
+            dec->pos    = pos + 4U + segment;
+            // Only a single (interleaved) scan is decoded
+            return JPEG_DecodeScan(dec, sink, context);
+        default:
+            // Remaining SOFn: progressive, lossless or arithmetic coding
+            if (marker >= 0xC2U && marker <= 0xCFU && marker != 0xC4U &&
+                marker != 0xC8U && marker != 0xCCU)
+                return JPEG_ERR_UNSUPPORTED;
+            break; // APPn, COM, ...
+        }
+        if (status != JPEG_OK)
+            return status;
+        pos += 4U + segment;
+    }
+    return JPEG_ERR_FORMAT;
+}
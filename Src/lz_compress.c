@@ -0,0 +1,377 @@
+/*
+ * lz_compress.c
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "lz_compress.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#if defined(__ARM_ARCH)
+#include "memory_config.h"
+/// The hash table lives in DTCM on the target
+#define LZ_DTCM DTCM_BSS
+#else
+#define LZ_DTCM
+#endif
+
+#define LZ_MIN_MATCH 4U
+/// The last bytes of a block are always literals
+#define LZ_LAST_LITERALS 5U
+/// The last match starts at least this far from the end of the block
+#define LZ_MF_LIMIT 12U
+/// Search step grows by 1 every 64 bytes without a match
+#define LZ_SKIP_SHIFT 6U
+#define LZ_RUN_MASK 15U
+
+#define LZ_PRIME1 2654435761U
+#define LZ_PRIME2 2246822519U
+#define LZ_PRIME3 3266489917U
+#define LZ_PRIME4 668265263U
+#define LZ_PRIME5 374761393U
+
+/// FLG: version 01, independent blocks, content size. BD: 64KB blocks.
+#define LZ_FRAME_FLG 0x68U
+#define LZ_FRAME_BD 0x40U
+
+/// Block offset of the last position of each hashed 4-byte value
+LZ_DTCM static uint16_t hashTable[LZ_HASH_SIZE];
+
+static inline uint32_t LZ_Read32(const uint8_t* p)
+{
+    uint32_t v;
+
+    // Unaligned loads are single instructions on the Cortex-M7
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint32_t LZ_Hash(uint32_t v)
+{
+    return (v * LZ_PRIME1) >> (32U - LZ_HASH_BITS);
+}
+
+static void LZ_Put32(uint8_t* p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static uint32_t LZ_Get32(const uint8_t* p)
+{
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 |
+           (uint32_t)p[3] << 24;
+}
+
+static inline uint32_t LZ_Rotl(uint32_t v, uint32_t n)
+{
+    return (v << n) | (v >> (32U - n));
+}
+
+/**
+ * Writes the extension bytes of a literal or match length.
+ */
+static uint8_t* LZ_PutLength(uint8_t* op, uint32_t n)
+{
+    for (; n >= 255U; n -= 255U)
+        *op++ = 255U;
+    *op++ = (uint8_t)n;
+    return op;
+}
+
+/**
+ * Reads the extension bytes of a literal or match length.
+ * @return Length, UINT32_MAX past the end of the input.
+ */
+static uint32_t LZ_GetLength(const uint8_t** ip, const uint8_t* end)
+{
+    uint32_t n = 0;
+    uint8_t b;
+
+    do
+    {
+        if (*ip >= end || n > LZ_MAX_BLOCK)
+            return UINT32_MAX;
+        b = *(*ip)++;
+        n += b;
+    } while (b == 255U);
+    return n;
+}
+
+/**
+ * Writes a sequence: literals from anchor, then a match.
+ * @param match Match length minus LZ_MIN_MATCH, no match when offset is 0.
+ */
+static uint8_t* LZ_PutSequence(uint8_t* op, const uint8_t* anchor,
+                               uint32_t literals, uint32_t offset,
+                               uint32_t match)
+{
+    uint8_t* token = op++;
+
+    *token = (uint8_t)((literals < LZ_RUN_MASK ? literals : LZ_RUN_MASK)
+                       << 4);
+    if (literals >= LZ_RUN_MASK)
+        op = LZ_PutLength(op, literals - LZ_RUN_MASK);
+    memcpy(op, anchor, literals);
+    op += literals;
+    if (offset == 0U)
+        return op;
+    *op++ = (uint8_t)offset;
+    *op++ = (uint8_t)(offset >> 8);
+    *token |= (uint8_t)(match < LZ_RUN_MASK ? match : LZ_RUN_MASK);
+    if (match >= LZ_RUN_MASK)
+        op = LZ_PutLength(op, match - LZ_RUN_MASK);
+    return op;
+}
+
+/**
+ * Compresses a block into the LZ4 block format.
+ * @param src Block data.
+ * @param length Bytes of src, at most LZ_MAX_BLOCK.
+ * @param dst Output.
+ * @param capacity Size of dst.
+ * @return Compressed bytes, 0 when they do not fit dst.
+ */
+uint32_t LZ_CompressBlock(const uint8_t* src, uint32_t length, uint8_t* dst,
+                          uint32_t capacity)
+{
+    const uint8_t* const end = src + length;
+    const uint8_t* ip        = src;
+    const uint8_t* anchor    = src;
+    uint8_t* op              = dst;
+    uint32_t literals;
+
+    if (length > LZ_MAX_BLOCK)
+        return 0;
+
+    while (length > LZ_MF_LIMIT && ip < end - LZ_MF_LIMIT)
+    {
+        const uint32_t v = LZ_Read32(ip);
+        const uint32_t h = LZ_Hash(v);
+        const uint8_t* ref = src + hashTable[h];
+        uint32_t match;
+
+        hashTable[h] = (uint16_t)(ip - src);
+        // Stale entries of earlier blocks fail one of the two tests
+        if (ref >= ip || LZ_Read32(ref) != v)
+        {
+            ip += 1U + ((uint32_t)(ip - anchor) >> LZ_SKIP_SHIFT);
+            continue;
+        }
+
+        while (ip > anchor && ref > src && ip[-1] == ref[-1])
+        {
+            ip--;
+            ref--;
+        }
+        match = LZ_MIN_MATCH;
+        while (ip + match < end - LZ_LAST_LITERALS && ip[match] == ref[match])
+            match++;
+
+        literals = (uint32_t)(ip - anchor);
+        if ((uint32_t)(dst + capacity - op) <
+            1U + literals / 255U + 1U + literals + 2U + match / 255U + 1U)
+            return 0;
+        op = LZ_PutSequence(op, anchor, literals, (uint32_t)(ip - ref),
+                            match - LZ_MIN_MATCH);
+        ip += match;
+        anchor = ip;
+        if (ip < end - LZ_MF_LIMIT)
+            hashTable[LZ_Hash(LZ_Read32(ip - 2))] = (uint16_t)(ip - 2 - src);
+    }
+
+    literals = (uint32_t)(end - anchor);
+    if ((uint32_t)(dst + capacity - op) < 1U + literals / 255U + 1U + literals)
+        return 0;
+    op = LZ_PutSequence(op, anchor, literals, 0, 0);
+    return (uint32_t)(op - dst);
+}
+
+/**
+ * Decompresses an LZ4 block.
+ * @param src Compressed block.
+ * @param length Bytes of src.
+ * @param dst Output.
+ * @param capacity Size of dst.
+ * @return Decompressed bytes, -1 on a block which is damaged or does not
+ *         fit dst.
+ */
+int32_t LZ_DecompressBlock(const uint8_t* src, uint32_t length, uint8_t* dst,
+                           uint32_t capacity)
+{
+    const uint8_t* ip         = src;
+    const uint8_t* const iend = src + length;
+    uint8_t* op               = dst;
+    uint8_t* const oend       = dst + capacity;
+
+    while (ip < iend)
+    {
+        const uint32_t token = *ip++;
+        uint32_t literals    = token >> 4;
+        uint32_t match       = token & LZ_RUN_MASK;
+        uint32_t offset;
+        const uint8_t* ref;
+
+        if (literals == LZ_RUN_MASK)
+        {
+            uint32_t n = LZ_GetLength(&ip, iend);
+            if (n == UINT32_MAX)
+                return -1;
+            literals += n;
+        }
+        if (literals > (uint32_t)(iend - ip) ||
+            literals > (uint32_t)(oend - op))
+            return -1;
+        memcpy(op, ip, literals);
+        ip += literals;
+        op += literals;
+        // The last sequence has no match
+        if (ip == iend)
+            break;
+
+        if (iend - ip < 2)
+            return -1;
+        offset = (uint32_t)ip[0] | (uint32_t)ip[1] << 8;
+        ip += 2;
+        if (offset == 0U || offset > (uint32_t)(op - dst))
+            return -1;
+        if (match == LZ_RUN_MASK)
+        {
+            uint32_t n = LZ_GetLength(&ip, iend);
+            if (n == UINT32_MAX)
+                return -1;
+            match += n;
+        }
+        match += LZ_MIN_MATCH;
+        if (match > (uint32_t)(oend - op))
+            return -1;
+        // Byte by byte, the match may overlap what it writes
+        for (ref = op - offset; match != 0U; --match)
+            *op++ = *ref++;
+    }
+    return (int32_t)(op - dst);
+}
+
+/**
+ * Starts the LZ4 frame of a buffer.
+ * @param stream State of the frame.
+ * @param src Data, must stay unchanged until the last chunk is written.
+ * @param length Bytes of src.
+ * @param blockSize Bytes per block, 1 ... LZ_MAX_BLOCK.
+ * @return 0 on success, 1 on a block size which is not supported.
+ */
+uint8_t LZ_StreamInit(LZ_Stream* stream, const uint8_t* src, uint32_t length,
+                      uint32_t blockSize)
+{
+    if (blockSize == 0U || blockSize > LZ_MAX_BLOCK)
+        return 1;
+    *stream = (LZ_Stream){
+        .src       = src,
+        .length    = length,
+        .blockSize = blockSize,
+    };
+    return 0;
+}
+
+/**
+ * Writes the next chunk of the frame: the header with the first block,
+ * one block, or the last block with the end mark.
+ * @param stream State of the frame.
+ * @param out Output.
+ * @param capacity Size of out, at least LZ_CHUNK_BYTES(blockSize).
+ * @return Bytes written, 0 when the frame is complete (or out is too
+ *         small).
+ */
+uint32_t LZ_StreamNext(LZ_Stream* stream, uint8_t* out, uint32_t capacity)
+{
+    uint32_t n = 0;
+
+    if (stream->finished || capacity < LZ_CHUNK_BYTES(stream->blockSize))
+        return 0;
+
+    if (!stream->started)
+    {
+        LZ_Put32(out, LZ_FRAME_MAGIC);
+        out[4] = LZ_FRAME_FLG;
+        out[5] = LZ_FRAME_BD;
+        LZ_Put32(&out[6], stream->length);
+        LZ_Put32(&out[10], 0);
+        out[14] = (uint8_t)(LZ_Xxh32(&out[4], 10, 0) >> 8);
+        n       = LZ_FRAME_HEADER_BYTES;
+        stream->started = 1;
+    }
+
+    if (stream->offset < stream->length)
+    {
+        const uint8_t* block = stream->src + stream->offset;
+        uint32_t size        = stream->length - stream->offset;
+        uint32_t coded;
+
+        if (size > stream->blockSize)
+            size = stream->blockSize;
+        // Kept only when it got smaller
+        coded = LZ_CompressBlock(block, size, &out[n + LZ_BLOCK_HEADER_BYTES],
+                                 size - 1U);
+        if (coded == 0U)
+        {
+            memcpy(&out[n + LZ_BLOCK_HEADER_BYTES], block, size);
+            LZ_Put32(&out[n], size | LZ_BLOCK_STORED);
+            coded = size;
+            stream->stored++;
+        }
+        else
+            LZ_Put32(&out[n], coded);
+        n += LZ_BLOCK_HEADER_BYTES + coded;
+        stream->offset += size;
+    }
+
+    if (stream->offset >= stream->length)
+    {
+        LZ_Put32(&out[n], 0);
+        n += LZ_END_MARK_BYTES;
+        stream->finished = 1;
+    }
+    stream->outBytes += n;
+    return n;
+}
+
+/**
+ * xxHash32, used for the header checksum of the frame.
+ */
+uint32_t LZ_Xxh32(const uint8_t* data, uint32_t length, uint32_t seed)
+{
+    const uint8_t* p   = data;
+    const uint8_t* end = data + length;
+    uint32_t h;
+
+    if (length >= 16U)
+    {
+        uint32_t v[4] = {seed + LZ_PRIME1 + LZ_PRIME2, seed + LZ_PRIME2, seed,
+                         seed - LZ_PRIME1};
+
+        for (; end - p >= 16; p += 16)
+            for (uint32_t i = 0; i < 4U; ++i)
+                v[i] = LZ_Rotl(v[i] + LZ_Get32(p + i * 4U) * LZ_PRIME2, 13) *
+                       LZ_PRIME1;
+        h = LZ_Rotl(v[0], 1) + LZ_Rotl(v[1], 7) + LZ_Rotl(v[2], 12) +
+            LZ_Rotl(v[3], 18);
+    }
+    else
+        h = seed + LZ_PRIME5;
+
+    h += length;
+    for (; end - p >= 4; p += 4)
+        h = LZ_Rotl(h + LZ_Get32(p) * LZ_PRIME3, 17) * LZ_PRIME4;
+    for (; p < end; ++p)
+        h = LZ_Rotl(h + *p * LZ_PRIME5, 11) * LZ_PRIME1;
+    h ^= h >> 15;
+    h *= LZ_PRIME2;
+    h ^= h >> 13;
+    h *= LZ_PRIME3;
+    h ^= h >> 16;
+    return h;
+}
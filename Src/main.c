@@ -47,9 +47,26 @@
 /* USER CODE BEGIN Includes */
 #include "ov2640.h"
 
-#include "STM_registers.h"
+#include "camera_capture.h"
+#include "capture_sched.h"
+#include "camera_exposure.h"
+#include "camera_mode.h"
+#include "command.h"
+#include "frame_delta.h"
+#include "frame_pool.h"
+#include "gfx.h"
+#include "glyph_cache.h"
+#include "image_kernels.h"
+#include "image_stats.h"
+#include "lz_compress.h"
+#include "memory_config.h"
+#include "motion.h"
+#include "perf.h"
+#include "task_loop.h"
 // LCD
 #include "LCD_Driver.h"
+#include "GUI_Queue.h"
+#include "LCD_Present.h"
 #include "LCD_GUI.h"
 
 #include <stdarg.h>
@@ -60,6 +77,16 @@
 /* Private typedef -----------------------------------------------------------*/
 /* USER CODE BEGIN PTD */
 
+/// Events of the task loop, posted by the interrupts and the tasks
+typedef enum
+{
+    EVT_BUTTON = 0, ///< Edge of the user button
+    EVT_UART_RX,    ///< Command bytes received, or a reception error
+    EVT_UART_TX,    ///< Frame sent, the UART is free
+    EVT_CAPTURE,    ///< Snapshot requested
+    EVT_FRAME,      ///< Snapshot waiting for the display
+    EVT_SEND        ///< Snapshot queued for the UART
+} AppEvent;
 /* USER CODE END PTD */
 
 /* Private define ------------------------------------------------------------*/
@@ -69,86 +96,153 @@
  * Code debugging option
  */
 //#define DEBUG
-/* USER CODE END PD */
 
-/* Private macro -------------------------------------------------------------*/
-/* USER CODE BEGIN PM */
+/**
+ * Snapshots on motion: between snapshots small YUV422 frames are captured
+ * for the motion detector (see motion.h), an event takes a snapshot as the
+ * button does. Snapshots are then taken in MOTION_SNAPSHOT_MODE, or the mode
+ * set by the mode command.
+ */
+#define MOTION_TRIGGER
+#define MOTION_MODE CAM_MODE_YUV422_160x120
+#define MOTION_SNAPSHOT_MODE CAM_MODE_JPEG_1280x960
+/// Time between two detector frames
+#define MOTION_POLL_MS 100U
 
-/* USER CODE END PM */
+/**
+ * Luma histogram of every RGB565 / YUV422 snapshot drawn over the bottom
+ * right corner of the image (see image_stats.h)
+ */
+#define STATS_OVERLAY
+#define STATS_OVERLAY_WIDTH 128U
+#define STATS_OVERLAY_HEIGHT 48U
+/// Time between two telemetry lines of the motion detector frames
+#define STATS_TELEMETRY_MS 1000U
 
-/* Private variables ---------------------------------------------------------*/
+/**
+ * Exposure and gain set from the statistics of the captured frames instead
+ * of the sensor's AEC / AGC (see camera_exposure.h)
+ */
+#define CAMERA_AE
 
-/* USER CODE BEGIN PV */
+/**
+ * Motion detector frames streamed over the UART between snapshots, keyframe
+ * then tiles which changed (see frame_delta.h, receiver in
+ * Tools/frame_delta). A frame is only encoded while the UART is idle, so
+ * the preview rate follows the link. Needs MOTION_TRIGGER.
+ */
+//#define DELTA_PREVIEW
+/// Frames from a keyframe to the next
+#define DELTA_KEY_INTERVAL 50U
+/// SAD a 16x16 tile may differ by and not be sent, sensor noise
+#define DELTA_THRESHOLD (DELTA_TILE * DELTA_TILE * 2U * 3U)
 
 /**
- * Resolution selection
+ * Frames sent over the UART as LZ4 frames (see lz_compress.h, host side in
+ * Tools/lz_uplink). Raw frames shrink 2 to 6 times, JPEG by a few percent.
  */
+//#define UART_COMPRESS
 
-//#define RES160X120
-//#define RES320X240
-//#define RES640X480
-//#define RES800x600
-//#define RES1024x768
-//#define RES1280x960
+/**
+ * Commands received on USART3 (see command.h, host side in Tools/cam_cli):
+ * capture, stream, mode and effect changes, SCCB register access and the
+ * profiling counters. They run between two captures.
+ */
+#define REMOTE_CONTROL
+/// Circular RX DMA buffer, commands not parsed within this many bytes are
+/// overwritten
+#define REMOTE_RX_SIZE 256U
 
-//#define STM160x120
-#define STM320x240
-//#define STM480x272
-//#define STM640x480
+/// Text held back while a frame is on the UART, see my_printf()
+#define TEXT_LOG_SIZE 2048U
 
-#ifdef STM160x120
-unsigned imgRes                     = RES_STM160x120;
-uint8_t frameBuffer[RES_STM160x120] = {0};
-#endif
+/// Button edges closer than this are contact bounce
+#define BUTTON_DEBOUNCE_MS 200U
+/* USER CODE END PD */
 
-#ifdef STM320x240
-unsigned imgRes                     = RES_STM320x240;
-uint8_t frameBuffer[RES_STM320x240] = {0};
-#endif
+/* Private macro -------------------------------------------------------------*/
+/* USER CODE BEGIN PM */
 
-#ifdef STM480x272
-unsigned imgRes                     = RES_STM480x272;
-uint8_t frameBuffer[RES_STM480x272] = {0};
-#endif
+/* USER CODE END PM */
 
-#ifdef STM640x480
-unsigned imgRes                     = RES_STM640x480;
-uint8_t frameBuffer[RES_STM640x480] = {0};
-#endif
+/* Private variables ---------------------------------------------------------*/
 
-#ifdef RES160X120
-enum imageResolution imgRes      = RES_160X120;
-uint8_t frameBuffer[RES_160X120] = {0};
-#endif
+/* USER CODE BEGIN PV */
 
-#ifdef RES320X240
-enum imageResolution imgRes      = RES_320X240;
-uint8_t frameBuffer[RES_320X240] = {0};
+/**
+ * Resolution and format selection, can be changed at runtime with
+ * CAM_SetMode() (see camera_mode.h). The frame buffer of the active mode is
+ * taken from the frame pool for every capture.
+ */
+#define CAMERA_MODE_DFT CAM_MODE_RGB565_320x240
+/// Display size in the current scan direction (LCD_Driver.c)
+extern LCD_DIS sLCD_DIS;
+/// Snapshot waiting for displayTask(), with the capture's reference. Only
+/// the latest one is kept, the display skips frames the capture outruns.
+static struct
+{
+    uint8_t* frame;
+    const CAM_ModeDesc* mode;
+    CAM_Roi window;
+    uint32_t length;
+    uint8_t statsOk; ///< frameStats belongs to the frame
+    /// Frame blitted by the render queue, kept until the queue is past fence
+    uint8_t* drawn;
+    uint32_t fence;
+} display;
+#ifdef STATS_OVERLAY
+/// Histogram overlay, read by the render queue until display.fence
+DTCM_BSS static COLOR overlay[STATS_OVERLAY_WIDTH * STATS_OVERLAY_HEIGHT];
 #endif
-
-#ifdef RES640X480
-enum imageResolution imgRes      = RES_640X480;
-uint8_t frameBuffer[RES_640X480] = {0};
+/// Frame being sent by the USART3 TX DMA, NULL when idle
+uint8_t* volatile uartFrame = NULL;
+/// Part of uartFrame not yet handed to the USART3 TX DMA
+uint32_t uartOffset    = 0;
+uint32_t uartRemaining = 0;
+/// Frames cut short by a USART3 TX error
+static uint32_t uartTxErrors;
+/// Text lines printed while the TX DMA sends a frame, written by the main
+/// loop and the interrupts, sent by textFlush() between two frames
+static char textLog[TEXT_LOG_SIZE];
+static volatile uint32_t textHead;
+static volatile uint32_t textCount;
+/// Bytes of the lines which did not fit in textLog
+static uint32_t textDropped;
+#ifdef UART_COMPRESS
+/// LZ4 frame of uartFrame, sent in chunks of one block: one is on the wire
+/// while the next is compressed. DTCM is read by the DMA directly.
+static LZ_Stream uartStream;
+DTCM_BSS static uint8_t uartChunks[2][LZ_CHUNK_BYTES(LZ_BLOCK_SIZE)];
+static uint8_t uartChunk;
+#ifdef DEBUG
+static uint32_t uartCompressCycles;
 #endif
-
-#ifdef RES800x600
-enum imageResolution imgRes      = RES_800x600;
-uint8_t frameBuffer[RES_800x600] = {0};
 #endif
-
-#ifdef RES1024x768
-enum imageResolution imgRes       = RES_1024x768;
-uint8_t frameBuffer[RES_1024x768] = {0};
+/// Exposure statistics of the last RGB565 / YUV422 snapshot
+STATS_Frame frameStats;
+#ifdef DELTA_PREVIEW
+/// Preview frame the receiver holds, MOTION_MODE sized
+static uint32_t deltaReference[160 * 120 * 2 / 4];
 #endif
-
-#ifdef RES1280x960
-enum imageResolution imgRes       = RES_1280x960;
-uint8_t frameBuffer[RES_1280x960] = {0};
+#ifdef MOTION_TRIGGER
+/// Mode of the snapshots, changed by the mode command
+static CAM_ModeId snapshotMode = MOTION_SNAPSHOT_MODE;
 #endif
-
-ushort mutex           = 0;
-uint16_t bufferPointer = 0;
-ushort headerFound     = 0;
+#ifdef REMOTE_CONTROL
+/// Written by the USART3 RX DMA at any time, uncached
+DMA_NOCACHE static uint8_t remoteRx[REMOTE_RX_SIZE];
+/// End of the received bytes, from HAL_UARTEx_RxEventCallback()
+static volatile uint32_t remoteHead;
+/// Next byte to parse
+static uint32_t remoteTail;
+/// Reception stopped by an error, restarted by remotePoll()
+static volatile uint8_t remoteRestart;
+static CMD_Parser remoteParser;
+/// Snapshots left of a capture / stream command
+static uint32_t remoteShots;
+#endif
+/// Snapshots asked for by the button and the motion detector
+static uint32_t captureRequests;
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -159,13 +253,69 @@ void SystemClock_Config(void);
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
+/**
+ * Keeps a line for textFlush(), the UART is busy with a frame. A line which
+ * does not fit is dropped whole and counted.
+ * @return 1 when the line was kept or dropped, 0 when it can be sent now.
+ */
+static uint8_t textHold(const char* string, uint32_t length)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint8_t held     = 0;
+
+    __disable_irq();
+    // Behind the lines already held, so the order is kept
+    if (uartFrame != NULL || textCount != 0U)
+    {
+        held = 1;
+        if (TEXT_LOG_SIZE - textCount < length)
+        {
+            textDropped += length;
+        }
+        else
+        {
+            for (uint32_t i = 0; i < length; ++i)
+                textLog[(textHead + textCount + i) % TEXT_LOG_SIZE] =
+                    string[i];
+            textCount += length;
+        }
+    }
+    __set_PRIMASK(primask);
+    return held;
+}
+
+/**
+ * Sends the held text. Called from the main loop while no frame is being
+ * sent.
+ */
+static void textFlush(void)
+{
+    while (textCount != 0U)
+    {
+        uint32_t part = TEXT_LOG_SIZE - textHead;
+        uint32_t primask;
+
+        if (part > textCount)
+            part = textCount;
+        HAL_UART_Transmit(&huart3, (uint8_t*)&textLog[textHead],
+                          (uint16_t)part, 0xffffff);
+        primask = __get_PRIMASK();
+        __disable_irq();
+        textHead = (textHead + part) % TEXT_LOG_SIZE;
+        textCount -= part;
+        __set_PRIMASK(primask);
+    }
+}
+
 void vprint(const char* fmt, va_list argp)
 {
     char string[200];
     if (0 < vsprintf(string, fmt, argp)) // build string
     {
-        HAL_UART_Transmit(&huart3, (uint8_t*)string, strlen(string),
-                          0xffffff); // send message via UART
+        // Blocking transmit fails while the TX DMA sends a frame
+        if (!textHold(string, strlen(string)))
+            HAL_UART_Transmit(&huart3, (uint8_t*)string, strlen(string),
+                              0xffffff); // send message via UART
     }
 }
 
@@ -177,16 +327,6 @@ void my_printf(const char* fmt, ...) // custom printf() function
     va_end(argp);
 }
 
-int32_t firstNonZeroValue(const uint8_t* array, int32_t size)
-{
-    for (int32_t i = 0; i < size; ++i)
-    {
-        if (array[i] != 0U)
-            return i;
-    }
-    return -1;
-}
-
 /// Refreshes DCMI status information on display
 void refreshStatusInfo()
 {
@@ -231,14 +371,8 @@ void HAL_DCMI_FrameEventCallback(DCMI_HandleTypeDef* hdcmi)
 
     // This is the user implementation.
 
-    my_printf("End of shooting\r\n");
-    // HAL_UART_DMAStop(&huart1);FF D8 FF E0
-    my_printf("%x  %x  %x  %x\r\n", frameBuffer[0], frameBuffer[1],
-              frameBuffer[2], frameBuffer[3]);
-
-    int32_t index = firstNonZeroValue(frameBuffer, imgRes);
-    if (index != -1)
-        my_printf("Success\r\n");
+    // Frame length is taken from the DMA counter by CAM_Capture()
+    CAM_CaptureFrameEvent();
 }
 
 void HAL_DCMI_ErrorCallback(DCMI_HandleTypeDef* hdcmi)
@@ -249,6 +383,8 @@ void HAL_DCMI_ErrorCallback(DCMI_HandleTypeDef* hdcmi)
     //
     // This is the user implementation.
 
+    CAM_CaptureError();
+
     char* text = "Unknown error";
     switch (HAL_DCMI_GetError(hdcmi))
     {
@@ -274,6 +410,827 @@ void HAL_DCMI_ErrorCallback(DCMI_HandleTypeDef* hdcmi)
     refreshStatusInfo();
 }
 
+/**
+ * Starts the USART3 TX DMA for the next part of uartFrame. A single transfer
+ * is limited to 65535 bytes, larger frames are sent in several parts.
+ * Compressed frames are sent a chunk at a time, the following chunk is
+ * compressed here while the DMA sends (about 1 ms for a block, which takes
+ * 350 ms on the wire).
+ * @return HAL_OK when a transfer was started.
+ */
+static HAL_StatusTypeDef sendNextFramePart(void)
+{
+#ifdef UART_COMPRESS
+    if (HAL_UART_Transmit_DMA(&huart3, uartChunks[uartChunk],
+                              (uint16_t)uartRemaining) != HAL_OK)
+        return HAL_ERROR;
+#ifdef DEBUG
+    uint32_t start = PERF_Cycles();
+#endif
+    uartChunk ^= 1U;
+    uartRemaining = LZ_StreamNext(&uartStream, uartChunks[uartChunk],
+                                  sizeof(uartChunks[0]));
+#ifdef DEBUG
+    uartCompressCycles += PERF_Cycles() - start;
+#endif
+#else
+    uint16_t part = (uint16_t)(uartRemaining < 65535U ? uartRemaining : 65535U);
+
+    if (HAL_UART_Transmit_DMA(&huart3, &uartFrame[uartOffset], part) != HAL_OK)
+        return HAL_ERROR;
+    uartOffset += part;
+    uartRemaining -= part;
+#endif
+    return HAL_OK;
+}
+
+/**
+ * Sends a frame with the USART3 TX DMA. The frame is released in
+ * HAL_UART_TxCpltCallback() once sent.
+ * @return HAL_OK when the transfer was started, the frame is not released
+ *         otherwise.
+ */
+static HAL_StatusTypeDef startFrameUplink(uint8_t* frame, uint32_t length)
+{
+    // Text held back during the last frame goes out before this one
+    textFlush();
+#ifdef UART_COMPRESS
+#ifdef DEBUG
+    // Text cannot be sent while the TX DMA runs, the last frame is reported
+    if (uartStream.finished && uartStream.length != 0U)
+        my_printf("Uplink: %lu of %lu bytes, %lu cycles per byte \r\n",
+                  uartStream.outBytes, uartStream.length,
+                  uartCompressCycles / uartStream.length);
+    uint32_t start = PERF_Cycles();
+#endif
+    LZ_StreamInit(&uartStream, frame, length, LZ_BLOCK_SIZE);
+    uartChunk     = 0;
+    uartRemaining = LZ_StreamNext(&uartStream, uartChunks[0],
+                                  sizeof(uartChunks[0]));
+#ifdef DEBUG
+    uartCompressCycles = PERF_Cycles() - start;
+#endif
+#else
+    uartOffset    = 0;
+    uartRemaining = length;
+#endif
+    uartFrame = frame;
+    if (sendNextFramePart() == HAL_OK)
+        return HAL_OK;
+    uartFrame = NULL;
+    return HAL_ERROR;
+}
+
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef* huart)
+{
+    if (huart == &huart3 && uartFrame != NULL)
+    {
+        if (uartRemaining != 0U && sendNextFramePart() == HAL_OK)
+            return;
+        FRAME_Release(uartFrame);
+        uartFrame = NULL;
+        TASK_Post(EVT_UART_TX);
+    }
+}
+
+void HAL_UART_ErrorCallback(UART_HandleTypeDef* huart)
+{
+    if (huart != &huart3)
+        return;
+    // A TX DMA error ends the transmit, the rest of the frame is dropped.
+    // Receive errors leave the frame alone, even while startFrameUplink()
+    // has set uartFrame but not yet started the DMA (gState still READY)
+    if ((huart->ErrorCode & HAL_UART_ERROR_DMA) != 0U &&
+        huart->hdmatx->ErrorCode != HAL_DMA_ERROR_NONE &&
+        huart->gState == HAL_UART_STATE_READY && uartFrame != NULL)
+    {
+        FRAME_Release(uartFrame);
+        uartFrame     = NULL;
+        uartRemaining = 0;
+        ++uartTxErrors;
+#ifdef DELTA_PREVIEW
+        // It may have been a delta record the receiver now misses
+        DELTA_RequestKeyframe();
+#endif
+        TASK_Post(EVT_UART_TX);
+    }
+#ifdef REMOTE_CONTROL
+    // Framing, noise or overrun errors abort the reception
+    if (huart->RxState == HAL_UART_STATE_READY)
+    {
+        remoteRestart = 1;
+        TASK_Post(EVT_UART_RX);
+    }
+#endif
+}
+
+/**
+ * Starts sending the oldest queued snapshot when the UART is idle, after a
+ * line with its sequence number and timestamp.
+ */
+static void uplinkDrain(void)
+{
+    CAPSCHED_Frame queued;
+
+    if (uartFrame != NULL || CAPSCHED_Dequeue(&queued) != 0)
+        return;
+    my_printf("Frame %lu at %lu ms: %lu bytes \r\n", queued.sequence,
+              queued.timestampMs, queued.length);
+    // The queue's reference goes to the transmit
+    if (startFrameUplink(queued.frame, queued.length) != HAL_OK)
+    {
+        FRAME_Release(queued.frame);
+        CAPSCHED_Unsent();
+    }
+}
+
+void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef* htim)
+{
+    // Time base of the task periods and of the capture triggers
+    if (htim == &htim7)
+    {
+        TASK_Tick();
+        if (CAPSCHED_Tick())
+            TASK_Post(EVT_CAPTURE);
+    }
+}
+
+void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
+{
+    if (GPIO_Pin == USER_Btn_Pin)
+        TASK_Post(EVT_BUTTON);
+}
+
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef* hspi)
+{
+    // Pixel DMA of the LCD, the render queue starts its next part
+    if (hspi == &hspi2)
+        GUI_QueueDmaDone();
+}
+
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef* hspi)
+{
+    if (hspi == &hspi2)
+        GUI_QueueDmaDone();
+}
+
+#ifdef DELTA_PREVIEW
+/**
+ * Sends a motion detector frame as a delta record, reporting the bandwidth
+ * it saved. The record is taken from the frame pool and released in
+ * HAL_UART_TxCpltCallback().
+ */
+static void deltaSend(const uint8_t* frame, uint16_t width, uint16_t height)
+{
+    static uint16_t deltaWidth, deltaHeight;
+    uint32_t capacity = DELTA_MaxRecordBytes(width, height);
+    uint8_t* record;
+    uint32_t length;
+    DELTA_Stats stats;
+
+    if (width != deltaWidth || height != deltaHeight)
+    {
+        if ((uint32_t)width * height * 2U > sizeof(deltaReference) ||
+            DELTA_Init(DELTA_FORMAT_YUV422, width, height,
+                       (uint8_t*)deltaReference, DELTA_KEY_INTERVAL,
+                       DELTA_THRESHOLD) != 0U)
+            return;
+        deltaWidth  = width;
+        deltaHeight = height;
+    }
+    record = FRAME_Alloc(capacity);
+    if (record == NULL)
+        return;
+    length = DELTA_Encode(frame, record, capacity);
+    if (length == 0U)
+    {
+        FRAME_Release(record);
+        return;
+    }
+
+    // Text cannot be sent while the TX DMA runs
+    DELTA_GetStats(&stats);
+    my_printf("Delta: %lu tiles, %lu of %lu bytes, saved %lu.%lu%% \r\n",
+              stats.lastTiles, stats.lastBytes, stats.lastRawBytes,
+              stats.lastSaved / 10U, stats.lastSaved % 10U);
+    if (startFrameUplink(record, length) != HAL_OK)
+    {
+        // The receiver did not get it, it has to start over
+        FRAME_Release(record);
+        DELTA_RequestKeyframe();
+    }
+}
+#endif
+
+#if defined(DEBUG) || defined(REMOTE_CONTROL)
+/**
+ * Prints the profiling counters of the pipeline modules.
+ */
+static void printCounters(void)
+{
+    FRAME_Stats poolStats;
+    FRAME_GetStats(&poolStats);
+    my_printf("Frame pool: %lu B used, %lu B high-water \r\n",
+              poolStats.usedBytes, poolStats.highWaterBytes);
+    LCD_Stats lcdStats;
+    LCD_GetStats(&lcdStats);
+    my_printf("LCD: %lu windows, %lu commands, %lu skipped, %lu B saved \r\n",
+              lcdStats.Windows, lcdStats.Commands, lcdStats.CommandsSkipped,
+              lcdStats.BytesSaved);
+    GLYPH_Stats glyphStats;
+    GLYPH_GetStats(&glyphStats);
+    my_printf("Glyph cache: %lu hits, %lu misses, %lu evicted \r\n",
+              glyphStats.hits, glyphStats.misses, glyphStats.evictions);
+    GUI_QueueStats queueStats;
+    GUI_QueueGetStats(&queueStats);
+    // Busy time the CPU did not spend waiting for the queue ran in the
+    // background of the other tasks
+    uint32_t blockedUs = queueStats.WaitUs + queueStats.StallUs;
+    my_printf("Render queue: %lu done, depth %lu (max %lu), "
+              "%lu stalls %lu us, %lu us waited, %lu us busy, "
+              "%lu us overlapped \r\n",
+              queueStats.Completed, queueStats.Depth, queueStats.MaxDepth,
+              queueStats.Stalls, queueStats.StallUs, queueStats.WaitUs,
+              queueStats.BusyUs,
+              queueStats.BusyUs > blockedUs ? queueStats.BusyUs - blockedUs
+                                            : 0UL);
+    LCD_PresentStats presentStats;
+    LCD_PresentGetStats(&presentStats);
+    my_printf("Present: %lu frames, %lu skipped, %lu overruns, "
+              "%lu us waited (last %lu us) \r\n",
+              presentStats.Frames, presentStats.Skipped, presentStats.Overruns,
+              presentStats.WaitUs, presentStats.LastWaitUs);
+    CAM_AeState aeState;
+    CAM_ExposureGetState(&aeState);
+    my_printf("Exposure: %u lines, gain %u/16, luma %u, status %d, %lu steps, "
+              "%lu SCCB writes (%lu skipped), converged in %lu frames \r\n",
+              aeState.lines, aeState.gain, aeState.luma, aeState.status,
+              aeState.steps, aeState.sccbWrites, aeState.sccbSkipped,
+              aeState.convergeFrames);
+#ifdef MOTION_TRIGGER
+    MOTION_Stats motionStats;
+    MOTION_GetStats(&motionStats);
+    my_printf("Motion: %lu frames, %lu events, %lu suppressed \r\n",
+              motionStats.frames, motionStats.events, motionStats.suppressed);
+#endif
+    CAPSCHED_Stats schedStats;
+    CAPSCHED_GetStats(&schedStats);
+    my_printf("Capture: %lu triggers, %lu missed, %lu queued, %lu dropped, "
+              "%lu sent, depth %lu (max %lu) \r\n",
+              schedStats.triggers, schedStats.missed, schedStats.queued,
+              schedStats.dropped, schedStats.sent, schedStats.depth,
+              schedStats.maxDepth);
+    my_printf("Uplink: %lu TX errors, %lu text bytes dropped \r\n",
+              uartTxErrors, textDropped);
+    TASK_Stats taskStats;
+    for (uint32_t i = 0; TASK_GetStats(i, &taskStats) == 0U; ++i)
+        my_printf("Task %s: %lu runs, %lu us, max %lu us \r\n",
+                  taskStats.name, taskStats.runs, taskStats.runUs,
+                  taskStats.maxUs);
+    TASK_LoopStats loopStats;
+    TASK_GetLoopStats(&loopStats);
+    my_printf("Loop: %lu ms, %lu us busy, %lu sleeps, %lu events (%lu lost), "
+              "queue max %lu \r\n",
+              loopStats.uptimeMs, loopStats.busyUs, loopStats.sleeps,
+              loopStats.posted, loopStats.lost, loopStats.maxQueue);
+}
+#endif
+
+#ifdef MOTION_TRIGGER
+/**
+ * Captures a MOTION_MODE frame for the motion detector. Paused while a
+ * snapshot is being sent, its buffer may take most of the frame pool.
+ * @return 1 when motion was detected and a snapshot should be taken.
+ */
+static uint8_t motionPoll(void)
+{
+    static uint32_t lastTelemetry;
+    MOTION_Status status = MOTION_IDLE;
+    MOTION_Event event;
+    CAM_Frame frame;
+    uint8_t* buffer;
+    uint32_t size;
+
+    if (uartFrame != NULL)
+        return 0;
+    if (CAM_GetMode() != CAM_GetModeDesc(MOTION_MODE) &&
+        CAM_SetMode(MOTION_MODE, NULL) != CAM_OK)
+        return 0;
+    size   = CAM_CaptureBytes();
+    buffer = FRAME_Alloc(size);
+    if (buffer == NULL)
+        return 0;
+    if (CAM_Capture(buffer, size, &frame, 500) == CAM_OK)
+    {
+        uint16_t width  = frame.window.width;
+        uint16_t height = frame.window.height;
+#ifdef DEBUG
+        uint32_t start = PERF_Cycles();
+#endif
+        status = MOTION_Process(buffer, width, height, &event);
+#ifdef DEBUG
+        MOTION_Stats stats;
+        MOTION_GetStats(&stats);
+        my_printf("Motion: %lu blocks, %lu us \r\n", stats.lastBlocks,
+                  PERF_CyclesToUs(PERF_Cycles() - start));
+#endif
+        // Exposure control on every frame, telemetry between snapshots
+        if (STATS_ComputeYUV422(buffer, width, height, &frameStats) == 0U)
+        {
+#ifdef CAMERA_AE
+            CAM_ExposureUpdate(&frameStats);
+#endif
+            if (HAL_GetTick() - lastTelemetry >= STATS_TELEMETRY_MS)
+            {
+                char line[STATS_LINE_SIZE];
+                STATS_Format(&frameStats, line, sizeof(line));
+                my_printf("%s\r\n", line);
+                lastTelemetry = HAL_GetTick();
+            }
+        }
+#ifdef DELTA_PREVIEW
+        deltaSend(buffer, width, height);
+#endif
+    }
+    FRAME_Release(buffer);
+    if (status != MOTION_DETECTED)
+        return 0;
+    my_printf("Motion detected: %u blocks at %u,%u %ux%u \r\n", event.blocks,
+              event.x, event.y, event.width, event.height);
+    return 1;
+}
+#endif
+
+#ifdef REMOTE_CONTROL
+/**
+ * Starts the reception of commands: the RX DMA runs over remoteRx in
+ * circular mode for good, HAL_UARTEx_RxEventCallback() tells how far it got
+ * on an idle line, half and full buffer.
+ */
+static void remoteStart(void)
+{
+    CMD_Init(&remoteParser);
+    remoteTail = remoteHead = 0;
+    if (HAL_UARTEx_ReceiveToIdle_DMA(&huart3, remoteRx, sizeof(remoteRx)) !=
+        HAL_OK)
+        my_printf("Command reception failed \r\n");
+}
+
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef* huart, uint16_t Size)
+{
+    if (huart == &huart3)
+    {
+        remoteHead = Size % REMOTE_RX_SIZE;
+        TASK_Post(EVT_UART_RX);
+    }
+}
+
+/**
+ * Runs a decoded command, the reply is a line starting with OK or ERR.
+ */
+static void remoteRun(const CMD_Command* command)
+{
+    const char* name = CMD_Name(command->id);
+    const uint32_t* args = command->args;
+
+    switch (command->id)
+    {
+        case CMD_HELP:
+            my_printf("OK help: capture, stream <n>, mode <0-%u>, effect "
+                      "<0-7>, reg <r> [<v>], sched <0-3> [<n> [<ms>]], "
+                      "perf\r\n",
+                      CAM_MODE_COUNT - 1U);
+            return;
+        case CMD_CAPTURE:
+            remoteShots = 1;
+            break;
+        case CMD_STREAM:
+            remoteShots = args[0];
+            break;
+        case CMD_MODE:
+        {
+            uint32_t switchUs = 0;
+
+            if (args[0] >= CAM_MODE_COUNT ||
+                CAM_SetMode((CAM_ModeId)args[0], &switchUs) != CAM_OK)
+            {
+                my_printf("ERR %s %lu\r\n", name, args[0]);
+                return;
+            }
+#ifdef MOTION_TRIGGER
+            snapshotMode = (CAM_ModeId)args[0];
+#endif
+            my_printf("OK %s %s %lu us\r\n", name, CAM_GetMode()->name,
+                      switchUs);
+            return;
+        }
+        case CMD_EFFECT:
+            if (args[0] > 7U)
+            {
+                my_printf("ERR %s %lu\r\n", name, args[0]);
+                return;
+            }
+            OV2640_SpecialEffect((short)args[0]);
+            CAM_ExposureInvalidate();
+            break;
+        case CMD_REG_READ:
+        {
+            uint8_t value;
+
+            if (args[0] > 0xFFU || SCCB_Read((uint8_t)args[0], &value) != 0)
+            {
+                my_printf("ERR %s 0x%02lx\r\n", name, args[0]);
+                return;
+            }
+            my_printf("OK %s 0x%02lx 0x%02x\r\n", name, args[0], value);
+            return;
+        }
+        case CMD_REG_WRITE:
+            if (args[0] > 0xFFU || args[1] > 0xFFU ||
+                !SCCB_Write((uint8_t)args[0], (uint8_t)args[1]))
+            {
+                my_printf("ERR %s 0x%02lx\r\n", name, args[0]);
+                return;
+            }
+            // The register may be one the exposure control keeps a copy of
+            CAM_ExposureInvalidate();
+            break;
+        case CMD_SCHED:
+        {
+            // Off, burst, interval or event, with count and period
+            CAPSCHED_Config schedule = {
+                (CAPSCHED_Mode)args[0], command->argc > 1U ? args[1] : 0U,
+                command->argc > 2U ? args[2] : 0U};
+
+            if (args[0] >= CAPSCHED_MODE_COUNT ||
+                CAPSCHED_Start(&schedule) != 0U)
+            {
+                my_printf("ERR %s %lu\r\n", name, args[0]);
+                return;
+            }
+            TASK_Post(EVT_CAPTURE);
+            break;
+        }
+        case CMD_PERF:
+            printCounters();
+            break;
+        default:
+            my_printf("ERR %s\r\n", name);
+            return;
+    }
+    my_printf("OK %s\r\n", name);
+}
+
+/**
+ * Parses and runs the commands received since the last call. Called between
+ * two captures, so a command never stalls a frame, and not while a frame is
+ * being sent: the replies could not go out and a mode switch would need
+ * its buffer. The snapshots of a capture / stream command are left in
+ * remoteShots for captureTask().
+ */
+static void remotePoll(void)
+{
+    CMD_Command command;
+
+    if (uartFrame != NULL)
+        return;
+    if (remoteRestart)
+    {
+        remoteRestart = 0;
+        remoteStart();
+    }
+    while (remoteTail != remoteHead)
+    {
+        uint8_t byte = remoteRx[remoteTail];
+
+        remoteTail = (remoteTail + 1U) % REMOTE_RX_SIZE;
+        switch (CMD_Feed(&remoteParser, byte, &command))
+        {
+            case CMD_READY:
+                remoteRun(&command);
+                break;
+            case CMD_ERROR:
+                my_printf("ERR syntax\r\n");
+                break;
+            default:
+                break;
+        }
+    }
+    if (remoteShots != 0U)
+        TASK_Post(EVT_CAPTURE);
+}
+#endif
+
+/**
+ * Releases the snapshot waiting for the display.
+ * @return 1 when there was one.
+ */
+static uint8_t displayDiscard(void)
+{
+    if (display.frame == NULL)
+        return 0;
+    FRAME_Release(display.frame);
+    display.frame = NULL;
+    return 1;
+}
+
+/**
+ * Drops the snapshot waiting for the display, a newer one replaces it.
+ * @return 1 when there was one.
+ */
+static uint8_t displaySkip(void)
+{
+    if (!displayDiscard())
+        return 0;
+    LCD_PresentSkip();
+    return 1;
+}
+
+/**
+ * Waits for the render queue to be done with the last drawn snapshot and
+ * releases it.
+ * @return 1 when there was one.
+ */
+static uint8_t displayRetire(void)
+{
+    GUI_QueueWait(display.fence);
+    if (display.drawn == NULL)
+        return 0;
+    FRAME_Release(display.drawn);
+    display.drawn = NULL;
+    return 1;
+}
+
+/**
+ * Takes a snapshot in the current mode, queues it for the UART and hands it
+ * to the display.
+ * @param triggerMs Time of the trigger, sent with the frame.
+ */
+static void snapshot(uint32_t triggerMs)
+{
+    uint32_t switchUs = 0;
+    uint8_t* frameBuffer;
+
+#ifdef MOTION_TRIGGER
+    // The detector leaves the sensor in MOTION_MODE
+    if (CAM_GetMode() != CAM_GetModeDesc(snapshotMode) &&
+        CAM_SetMode(snapshotMode, &switchUs) != CAM_OK)
+        my_printf("Camera mode configuration failed \r\n");
+#endif
+    // Smaller than the mode's buffer when an ROI is set
+    const CAM_ModeDesc* mode = CAM_GetMode();
+    uint32_t frameBytes      = CAM_CaptureBytes();
+    frameBuffer              = FRAME_Alloc(frameBytes);
+    // The frame not displayed yet gives way to the new one, then the one
+    // still being sent to the display
+    while (frameBuffer == NULL && (displaySkip() || displayRetire()))
+        frameBuffer = FRAME_Alloc(frameBytes);
+    if (frameBuffer == NULL)
+    {
+        // Previous frames are still being transmitted
+        my_printf("No free frame buffer. \r\n");
+        CAPSCHED_Drop();
+        return;
+    }
+    // JPEG frames go through the circular ring, so their size is not limited
+    // to a single DMA transfer
+    CAM_Frame frame;
+    CAM_Status status =
+        mode->format == CAM_FORMAT_JPEG
+            ? CAM_CaptureInto(frameBuffer, frameBytes, &frame, 2000)
+            : CAM_Capture(frameBuffer, frameBytes, &frame, 2000);
+
+    // Frame boundary, a requested mode switch can be applied
+    if (CAM_FrameBoundary(&switchUs) == CAM_OK && switchUs != 0U)
+        my_printf("Camera mode switch: %lu us \r\n", switchUs);
+
+    if (status != CAM_OK)
+    {
+        my_printf("Capture failed: %d \r\n", status);
+        CAPSCHED_Drop();
+        FRAME_Release(frameBuffer);
+        return;
+    }
+    my_printf("End of shooting\r\n");
+    const CAM_Roi* window = &frame.window;
+
+    // Telemetry line with the exposure of uncompressed frames
+#ifdef DEBUG
+    uint32_t statsStart = PERF_Cycles();
+#endif
+    uint8_t statsError =
+        mode->format == CAM_FORMAT_YUV422
+            ? STATS_ComputeYUV422(frameBuffer, window->width, window->height,
+                                  &frameStats)
+        : mode->format == CAM_FORMAT_RGB565
+            ? STATS_ComputeRGB565((const uint16_t*)frameBuffer,
+                                  window->width, window->height, &frameStats)
+            : 1U;
+    if (!statsError)
+    {
+#ifdef DEBUG
+        my_printf("Image statistics: %lu us \r\n",
+                  PERF_CyclesToUs(PERF_Cycles() - statsStart));
+#endif
+        char line[STATS_LINE_SIZE];
+        STATS_Format(&frameStats, line, sizeof(line));
+        my_printf("%s\r\n", line);
+#ifdef CAMERA_AE
+        CAM_ExposureUpdate(&frameStats);
+#endif
+    }
+
+#ifdef DEBUG
+    my_printf("Image size: %lu bytes, captured in %lu us \r\n", frame.length,
+              frame.captureUs);
+#endif
+
+    // The unused end of the buffer (JPEG, ROI) goes back to the pool, so
+    // more frames fit in the queue. Queued frames are sent by DMA while the
+    // next ones are captured, the queue shares the frame until
+    // HAL_UART_TxCpltCallback()
+    FRAME_Shrink(frameBuffer, frame.length);
+    if (CAPSCHED_Enqueue(frameBuffer, frame.length, triggerMs) != 0U)
+        my_printf("Uplink queue full, frame dropped \r\n");
+    TASK_Post(EVT_SEND);
+
+    // The display takes the capture's reference
+    displaySkip();
+    display.frame   = frameBuffer;
+    display.mode    = mode;
+    display.window  = frame.window;
+    display.length  = frame.length;
+    display.statsOk = !statsError;
+    TASK_Post(EVT_FRAME);
+}
+
+/**
+ * Sends the text held back during the last frame and starts the next queued
+ * snapshot, when one was queued or the UART became free.
+ */
+static void uplinkTask(uint32_t events)
+{
+    if (uartFrame != NULL)
+        return;
+    textFlush();
+    uplinkDrain();
+}
+
+/**
+ * User input: the button and the remote commands. The commands wait while
+ * a frame is sent, they are run once the UART is free.
+ */
+static void controlTask(uint32_t events)
+{
+    static uint32_t lastPush;
+
+    if ((events & TASK_EVENT(EVT_BUTTON)) &&
+        HAL_GetTick() - lastPush >= BUTTON_DEBOUNCE_MS)
+    {
+        lastPush = HAL_GetTick();
+        my_printf("Button pushed. \r\n");
+        ++captureRequests;
+        TASK_Post(EVT_CAPTURE);
+    }
+#ifdef REMOTE_CONTROL
+    remotePoll();
+#endif
+}
+
+/**
+ * Takes one snapshot per run: a scheduled one first, then the button and
+ * motion requests, then the shots of a remote command. It posts itself
+ * again, so the UART and the commands are served between two snapshots.
+ */
+static void captureTask(uint32_t events)
+{
+    uint32_t triggerMs = CAPSCHED_Now();
+
+    if (!CAPSCHED_Poll(&triggerMs))
+    {
+        if (captureRequests != 0U)
+            --captureRequests;
+#ifdef REMOTE_CONTROL
+        else if (remoteShots != 0U)
+            --remoteShots;
+#endif
+        else
+            return;
+    }
+    snapshot(triggerMs);
+    TASK_Post(EVT_CAPTURE);
+}
+
+/**
+ * Draws the latest snapshot, with the histogram overlay.
+ */
+static void displayTask(uint32_t events)
+{
+    uint8_t* frameBuffer     = display.frame;
+    const CAM_ModeDesc* mode = display.mode;
+    const CAM_Roi* window    = &display.window;
+
+    if (frameBuffer == NULL)
+        return;
+    // An ROI is drawn where it lies in the frame
+    POINT x = LCD_X + window->x, y = LCD_Y + window->y;
+    // The frame rate cap and the refresh scan are not waited for in the
+    // task: it runs again once the other ready tasks are done
+    if (LCD_PresentWaitUs(x, y, x + window->width, y + window->height) != 0U)
+    {
+        TASK_Post(EVT_FRAME);
+        return;
+    }
+    // The previous snapshot and overlay are done before they are replaced
+    displayRetire();
+    LCD_PresentBegin(x, y, x + window->width, y + window->height);
+    if (mode->format == CAM_FORMAT_RGB565 &&
+        x + window->width <= sLCD_DIS.LCD_Dis_Column &&
+        y + window->height <= sLCD_DIS.LCD_Dis_Page)
+    {
+        // Sent by the render queue while the next snapshot is captured, the
+        // frame is kept until the queue is past it
+        GUI_QueueBlit(x, y, window->width, window->height,
+                      (const COLOR*)frameBuffer);
+        display.drawn = frameBuffer;
+        display.frame = NULL;
+        my_printf("Queued for display \r\n");
+    }
+    else if (mode->format == CAM_FORMAT_RGB565)
+    {
+        // Cropped by the panel edge, drawn directly
+        GUI_QueueFlush();
+        GUI_DrawRGB565(x, y, window->width, window->height,
+                       (const COLOR*)frameBuffer);
+        my_printf("Displayed \r\n");
+    }
+    else if (mode->format == CAM_FORMAT_YUV422)
+    {
+        GUI_QueueFlush();
+        GUI_DrawYUV422(x, y, window->width, window->height, frameBuffer);
+        my_printf("Displayed \r\n");
+    }
+    else if (mode->format == CAM_FORMAT_JPEG)
+    {
+        GUI_QueueFlush();
+        uint32_t start = PERF_Cycles();
+        JPEG_Status jpeg =
+            GUI_DrawJpeg(LCD_X, LCD_Y, frameBuffer, display.length);
+        uint32_t decodeUs = PERF_CyclesToUs(PERF_Cycles() - start);
+        my_printf("Decoded and displayed: %d, %lu us \r\n", jpeg, decodeUs);
+    }
+#ifdef STATS_OVERLAY
+    if (display.statsOk && window->width >= STATS_OVERLAY_WIDTH + 8U &&
+        window->height >= STATS_OVERLAY_HEIGHT + 8U)
+    {
+        GUI_RenderHistogram(STATS_OVERLAY_WIDTH, STATS_OVERLAY_HEIGHT,
+                            frameStats.histogram, BLACK, WHITE, overlay);
+        GUI_QueueBlit(x + window->width - STATS_OVERLAY_WIDTH - 4U,
+                      y + window->height - STATS_OVERLAY_HEIGHT - 4U,
+                      STATS_OVERLAY_WIDTH, STATS_OVERLAY_HEIGHT, overlay);
+    }
+#endif
+    display.fence = GUI_QueueFence();
+    displayDiscard();
+#ifdef DEBUG
+    printCounters();
+#endif
+}
+
+#ifdef MOTION_TRIGGER
+/**
+ * Runs the motion detector every MOTION_POLL_MS while no snapshot is
+ * waiting. In the event mode motion starts a scheduled sequence.
+ */
+static void motionTask(uint32_t events)
+{
+    if (captureRequests != 0U || !motionPoll())
+        return;
+    if (!CAPSCHED_Event())
+        ++captureRequests;
+    TASK_Post(EVT_CAPTURE);
+}
+#endif
+
+/**
+ * Tasks of the main loop. Within a class they run in this order: the
+ * commands are answered before the next frame takes the UART, the display
+ * runs before the motion detector overwrites frameStats.
+ */
+static const TASK_Desc tasks[] = {
+    {"control", TASK_PRIO_HIGH,
+     TASK_EVENT(EVT_BUTTON) | TASK_EVENT(EVT_UART_RX) |
+         TASK_EVENT(EVT_UART_TX),
+     0, controlTask},
+    {"uplink", TASK_PRIO_HIGH, TASK_EVENT(EVT_UART_TX) | TASK_EVENT(EVT_SEND),
+     0, uplinkTask},
+    {"capture", TASK_PRIO_NORMAL, TASK_EVENT(EVT_CAPTURE), 0, captureTask},
+    {"display", TASK_PRIO_LOW, TASK_EVENT(EVT_FRAME), 0, displayTask},
+#ifdef MOTION_TRIGGER
+    {"motion", TASK_PRIO_LOW, 0, MOTION_POLL_MS, motionTask},
+#endif
+};
+
 /* USER CODE END 0 */
 
 /**
@@ -283,7 +1240,8 @@ void HAL_DCMI_ErrorCallback(DCMI_HandleTypeDef* hdcmi)
 int main(void)
 {
     /* USER CODE BEGIN 1 */
-
+    // MPU regions for DMA buffers and I/D cache, before any DMA is started
+    MEM_Init();
     /* USER CODE END 1 */
 
     /* MCU
@@ -312,19 +1270,46 @@ int main(void)
     MX_I2C1_Init();
     MX_SPI2_Init();
     MX_TIM1_Init();
+    MX_TIM7_Init();
     /* USER CODE BEGIN 2 */
+    FRAME_PoolInit();
+    GLYPH_CacheInit();
+    GFX_Dma2dInit();
+    GFX_SetBackend(&GFX_Dma2d);
+
     LCD_SCAN_DIR Lcd_ScanDir = SCAN_DIR_DFT; // SCAN_DIR_DFT = D2U_L2R
     LCD_Init(Lcd_ScanDir, 1000);
-    GUI_Clear(WHITE);
+    // The shield has no TE line: the refresh is estimated, at most 30 fps
+    LCD_PresentInit(LCD_SYNC_TIMER, 30);
+    // Cleared in the background while the sensor is configured
+    GUI_QueueFill(0, 0, sLCD_DIS.LCD_Dis_Column, sLCD_DIS.LCD_Dis_Page, WHITE);
 
     OV2640_Init(&hi2c1, &hdcmi);
     HAL_Delay(10);
-    // OV2640_ResolutionOptions(imgRes);
-    STM_OV2640_ResolutionConfiguration(imgRes);
+    uint32_t switchUs = 0;
+    if (CAM_SetMode(CAMERA_MODE_DFT, &switchUs) != CAM_OK)
+        my_printf("Camera mode configuration failed \r\n");
     HAL_Delay(10);
+#ifdef CAMERA_AE
+    if (CAM_ExposureEnable(NULL) != CAM_AE_ADJUSTED)
+        my_printf("Auto exposure configuration failed \r\n");
+#endif
+#ifdef MOTION_TRIGGER
+    MOTION_Init(NULL);
+#endif
+    // Before the interrupts which post events are started
+    if (TASK_Init(tasks, sizeof(tasks) / sizeof(tasks[0])) != 0U)
+        my_printf("Task table too large \r\n");
+#ifdef REMOTE_CONTROL
+    remoteStart();
+#endif
+    // Time base and triggers of the capture scheduler
+    if (HAL_TIM_Base_Start_IT(&htim7) != HAL_OK)
+        my_printf("Capture scheduler timer failed \r\n");
 
     /**
-     * Extra options
+     * Extra options. They write the sensor directly, call
+     * CAM_ExposureInvalidate() after them.
      */
     // OV2640_Brightness(Brightness_2);
     // HAL_Delay(10);
@@ -336,7 +1321,20 @@ int main(void)
     // HAL_Delay(10);
     // OV2640_LightMode(Auto);
     // HAL_Delay(10);
+    // Only a band of the image, captured and displayed at its place:
+    // CAM_Roi band = {0, 80, 320, 80};
+    // CAM_SetRoi(&band);
+    // Time-lapse, a snapshot every minute:
+    // CAPSCHED_Config lapse = {CAPSCHED_INTERVAL, 0, 60000};
+    // CAPSCHED_Start(&lapse);
 #ifdef DEBUG
+    my_printf("Camera mode switch: %lu us \r\n", switchUs);
+    GUI_QueueFlush();
+    IMG_BenchmarkPlacements();
+    LCD_BenchmarkPixelModes();
+    LCD_BenchmarkReadback();
+    GFX_Benchmark();
+    GUI_QueueFill(0, 0, sLCD_DIS.LCD_Dis_Column, sLCD_DIS.LCD_Dis_Page, WHITE);
     my_printf("Finishing configuration \r\n");
 #endif
 
@@ -347,71 +1345,12 @@ int main(void)
 
     /**
      * Pressing button (B1) on the Nucleo board will take a picture
-     * and return JPEG via the serial port.
+     * and return JPEG via the serial port. The tasks run from here on,
+     * TASK_Run() does not return.
      */
+    TASK_Run();
     while (1)
     {
-        if (HAL_GPIO_ReadPin(USER_Btn_GPIO_Port, USER_Btn_Pin))
-        {
-            if (mutex == 1)
-            {
-                my_printf("Button pushed. \r\n");
-                memset(frameBuffer, 0, sizeof frameBuffer);
-                OV2640_CaptureSnapshot((uint32_t)frameBuffer, imgRes);
-                // while (1)
-                {
-                    if (headerFound == 0 &&
-                        frameBuffer[bufferPointer] == 0xFF &&
-                        frameBuffer[bufferPointer + 1] == 0xD8)
-                    {
-                        headerFound = 1;
-#ifdef DEBUG
-                        my_printf("Found header of JPEG file \r\n");
-#endif
-                    }
-                    if (headerFound == 1 &&
-                        frameBuffer[bufferPointer] == 0xFF &&
-                        frameBuffer[bufferPointer + 1] == 0xD9)
-                    {
-                        bufferPointer = bufferPointer + 2;
-#ifdef DEBUG
-                        my_printf("Found EOF of JPEG file \r\n");
-#endif
-                        headerFound = 0;
-                        break;
-                    }
-
-                    if (bufferPointer >= 65535)
-                    {
-                        break;
-                    }
-                    bufferPointer++;
-                }
-#ifdef DEBUG
-                my_printf("Image size: %d bytes \r\n", bufferPointer);
-#endif
-
-                HAL_UART_Transmit_DMA(
-                    &huart3, frameBuffer,
-                    bufferPointer); // Use of DMA may be necessary for
-                                    // larger data streams.
-                GUI_DrawImage(LCD_X, LCD_Y, frameBuffer, imgRes);
-                bufferPointer = 0;
-                mutex         = 0;
-                my_printf("Displayed \r\n");
-
-                int i = firstNonZeroValue(frameBuffer, imgRes);
-                if (i != -1)
-                    my_printf("There is no zero value idx: %d\r\n", i);
-                // dump bin value
-                // C:\Users\norbe\STM32CubeIDE\workspace_1.8.0\Test_DCMI\out\dumpt.jpg
-                // frameBuffer
-            }
-        }
-        else
-        {
-            mutex = 1;
-        }
         /* USER CODE END WHILE */
 
         /* USER CODE BEGIN 3 */
@@ -0,0 +1,94 @@
+/*
+ * memory_config.c
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "memory_config.h"
+
+/**
+ * Configures the MPU regions used for DMA buffers. Called with the MPU
+ * disabled, before the caches are turned on.
+ */
+static void MEM_ConfigMPU(void)
+{
+    MPU_Region_InitTypeDef region = {0};
+
+    HAL_MPU_Disable();
+
+    // Region 0: DMA_RAM + DMA_NOCACHE_RAM, write-through, no write allocate
+    region.Enable           = MPU_REGION_ENABLE;
+    region.Number           = MPU_REGION_NUMBER0;
+    region.BaseAddress      = MEM_DMA_REGION_BASE;
+    region.Size             = MEM_DMA_REGION_SIZE;
+    region.SubRegionDisable = 0x00;
+    region.TypeExtField     = MPU_TEX_LEVEL0;
+    region.AccessPermission = MPU_REGION_FULL_ACCESS;
+    region.DisableExec      = MPU_INSTRUCTION_ACCESS_DISABLE;
+    region.IsShareable      = MPU_ACCESS_NOT_SHAREABLE;
+    region.IsCacheable      = MPU_ACCESS_CACHEABLE;
+    region.IsBufferable     = MPU_ACCESS_NOT_BUFFERABLE;
+    HAL_MPU_ConfigRegion(&region);
+
+    // Region 1: DMA_NOCACHE_RAM (SRAM2), normal memory, not cacheable.
+    // Overlaps the end of region 0, the higher region number wins.
+    region.Number       = MPU_REGION_NUMBER1;
+    region.BaseAddress  = MEM_NOCACHE_REGION_BASE;
+    region.Size         = MEM_NOCACHE_REGION_SIZE;
+    region.TypeExtField = MPU_TEX_LEVEL1;
+    region.IsShareable  = MPU_ACCESS_SHAREABLE;
+    region.IsCacheable  = MPU_ACCESS_NOT_CACHEABLE;
+    region.IsBufferable = MPU_ACCESS_NOT_BUFFERABLE;
+    HAL_MPU_ConfigRegion(&region);
+
+    // Everything else keeps the default memory map attributes
+    HAL_MPU_Enable(MPU_PRIVILEGED_DEFAULT);
+}
+
+/**
+ * Configures the MPU and enables the instruction and data caches.
+ * Has to be called before any DMA transfer is started.
+ */
+void MEM_Init(void)
+{
+    MEM_ConfigMPU();
+
+    SCB_EnableICache();
+    SCB_EnableDCache();
+}
+
+/**
+ * Makes data written by a DMA master visible to the CPU.
+ * Lines are invalidated, so the range must not hold dirty CPU data. This is
+ * guaranteed for DMA_BUFFER (write-through) and DMA_NOCACHE memory.
+ * @param addr Start of the received data.
+ * @param size Number of bytes received.
+ */
+void MEM_DmaReceived(const void* addr, uint32_t size)
+{
+    uint32_t start = (uint32_t)addr & ~(MEM_CACHE_LINE - 1U);
+    uint32_t end   = ((uint32_t)addr + size + MEM_CACHE_LINE - 1U) &
+                   ~(MEM_CACHE_LINE - 1U);
+
+    if (size == 0U)
+        return;
+    SCB_InvalidateDCache_by_Addr((uint32_t*)start, (int32_t)(end - start));
+}
+
+/**
+ * Makes data written by the CPU visible to a DMA master reading it.
+ * Required only for buffers outside of DMA_BUFFER and DMA_NOCACHE memory
+ * (stack, ordinary .bss), harmless for the others.
+ * @param addr Start of the data to transmit.
+ * @param size Number of bytes to transmit.
+ */
+void MEM_DmaTransmit(const void* addr, uint32_t size)
+{
+    uint32_t start = (uint32_t)addr & ~(MEM_CACHE_LINE - 1U);
+    uint32_t end   = ((uint32_t)addr + size + MEM_CACHE_LINE - 1U) &
+                   ~(MEM_CACHE_LINE - 1U);
+
+    if (size == 0U)
+        return;
+    SCB_CleanDCache_by_Addr((uint32_t*)start, (int32_t)(end - start));
+}
@@ -0,0 +1,271 @@
+/*
+ * motion.c
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "motion.h"
+
+#include <stddef.h>
+
+#if defined(__ARM_ARCH)
+#include "memory_config.h"
+/// Kernels run from ITCM, the images live in DTCM on the target
+#define MOTION_ITCM ITCM_CODE
+#define MOTION_DTCM DTCM_BSS
+#else
+#define MOTION_ITCM
+#define MOTION_DTCM
+#endif
+
+#if defined(__ARM_FEATURE_SIMD32)
+#include <arm_acle.h>
+#endif
+
+/// 4 bytes of an image, the buffers are read a word at a time
+typedef uint32_t MOTION_Word __attribute__((may_alias));
+
+#define MOTION_PIXELS (MOTION_WIDTH * MOTION_HEIGHT)
+#define MOTION_ROW_WORDS (MOTION_WIDTH / 4U)
+#define MOTION_BLOCKS (MOTION_BLOCKS_X * MOTION_BLOCKS_Y)
+
+static const MOTION_Config defaultConfig = {
+    .threshold  = 12,
+    .minBlocks  = 2,
+    .learnShift = 4,
+    .slowShift  = 8,
+    .warmup     = 8,
+    .holdoff    = 10,
+};
+
+static MOTION_Config config;
+/// Last downscaled frame and the background it is compared with
+MOTION_DTCM static MOTION_Word luma[MOTION_PIXELS / 4U];
+MOTION_DTCM static MOTION_Word background[MOTION_PIXELS / 4U];
+/// Background with 8 fractional bits, background is its rounded copy
+MOTION_DTCM static uint16_t model[MOTION_PIXELS];
+static uint8_t moving[MOTION_BLOCKS];
+static uint32_t holdoff;
+static MOTION_Stats stats;
+
+/**
+ * Box average of the Y samples of every cell of a YUV422 frame.
+ * @param src Frame, Y0 U Y1 V, word aligned.
+ * @param rowWords Words of a frame row.
+ * @param cellWords Words of a cell row (pairs of pixels).
+ * @param cellRows Frame rows of a cell.
+ * @param dst 40x30 luma image.
+ */
+MOTION_ITCM static void MOTION_Downscale(const MOTION_Word* src,
+                                         uint32_t rowWords, uint32_t cellWords,
+                                         uint32_t cellRows, uint8_t* dst)
+{
+    uint32_t pixels = cellWords * 2U * cellRows;
+
+    for (uint32_t cy = 0; cy < MOTION_HEIGHT; ++cy, dst += MOTION_WIDTH)
+    {
+        // Y0 and Y1 are summed in the two halfwords, U and V masked out
+        uint32_t sums[MOTION_WIDTH];
+
+        for (uint32_t row = 0; row < cellRows; ++row, src += rowWords)
+        {
+            const MOTION_Word* p = src;
+            for (uint32_t cx = 0; cx < MOTION_WIDTH; ++cx)
+            {
+                uint32_t sum = row == 0U ? 0U : sums[cx];
+                for (uint32_t w = 0; w < cellWords; ++w)
+                    sum += *p++ & 0x00FF00FFU;
+                sums[cx] = sum;
+            }
+        }
+        for (uint32_t cx = 0; cx < MOTION_WIDTH; ++cx)
+            dst[cx] = (uint8_t)(((sums[cx] & 0xFFFFU) + (sums[cx] >> 16)) /
+                                pixels);
+    }
+}
+
+/**
+ * Sum of absolute differences of 4 bytes added to acc.
+ */
+static inline __attribute__((always_inline)) uint32_t
+MOTION_Sad4(uint32_t a, uint32_t b, uint32_t acc)
+{
+#if defined(__ARM_FEATURE_SIMD32)
+    return __usada8(a, b, acc);
+#else
+    for (uint32_t shift = 0; shift < 32U; shift += 8U)
+    {
+        int32_t d = (int32_t)((a >> shift) & 0xFFU) -
+                    (int32_t)((b >> shift) & 0xFFU);
+        acc += (uint32_t)(d < 0 ? -d : d);
+    }
+    return acc;
+#endif
+}
+
+/**
+ * Flags the blocks whose SAD against the background is above limit.
+ * @param peak Set to the largest block SAD.
+ * @return Number of moving blocks.
+ */
+MOTION_ITCM static uint32_t MOTION_CompareBlocks(uint32_t limit,
+                                                 uint32_t* peak)
+{
+    uint32_t count = 0, max = 0;
+
+    for (uint32_t by = 0; by < MOTION_BLOCKS_Y; ++by)
+    {
+        const MOTION_Word* l = &luma[by * MOTION_BLOCK_H * MOTION_ROW_WORDS];
+        const MOTION_Word* b =
+            &background[by * MOTION_BLOCK_H * MOTION_ROW_WORDS];
+
+        for (uint32_t bx = 0; bx < MOTION_BLOCKS_X; ++bx)
+        {
+            uint32_t sad = 0;
+            for (uint32_t r = 0; r < MOTION_BLOCK_H; ++r)
+                sad = MOTION_Sad4(l[r * MOTION_ROW_WORDS + bx],
+                                  b[r * MOTION_ROW_WORDS + bx], sad);
+            moving[by * MOTION_BLOCKS_X + bx] = sad > limit;
+            count += sad > limit;
+            if (sad > max)
+                max = sad;
+        }
+    }
+    *peak = max;
+    return count;
+}
+
+/**
+ * Moves the background towards the last frame, slower in moving blocks.
+ */
+MOTION_ITCM static void MOTION_Learn(uint32_t fastShift, uint32_t slowShift)
+{
+    const uint8_t* src = (const uint8_t*)luma;
+    uint8_t* dst       = (uint8_t*)background;
+
+    for (uint32_t y = 0, i = 0; y < MOTION_HEIGHT; ++y)
+    {
+        const uint8_t* blocks = &moving[y / MOTION_BLOCK_H * MOTION_BLOCKS_X];
+
+        for (uint32_t x = 0; x < MOTION_WIDTH; ++x, ++i)
+        {
+            uint32_t shift = blocks[x / MOTION_BLOCK_W] ? slowShift : fastShift;
+            int32_t m      = model[i];
+
+            m += (((int32_t)src[i] << 8) - m) >> shift;
+            model[i] = (uint16_t)m;
+            dst[i]   = (uint8_t)((m + 128) >> 8);
+        }
+    }
+}
+
+/**
+ * Resets the background and the statistics.
+ * @param cfg Detector settings, NULL: defaults.
+ */
+void MOTION_Init(const MOTION_Config* cfg)
+{
+    config  = cfg != NULL ? *cfg : defaultConfig;
+    holdoff = 0;
+    stats   = (MOTION_Stats){0};
+}
+
+/**
+ * Downscales a frame, compares it with the background and updates the
+ * background.
+ * @param yuv YUV422 frame (Y0 U Y1 V), word aligned.
+ * @param width Frame width, a multiple of 80.
+ * @param height Frame height, a multiple of 30.
+ * @param event Filled when MOTION_DETECTED is returned.
+ * @return MOTION_DETECTED when an event is raised.
+ */
+MOTION_Status MOTION_Process(const uint8_t* yuv, uint16_t width,
+                             uint16_t height, MOTION_Event* event)
+{
+    uint32_t cellWidth  = width / MOTION_WIDTH;
+    uint32_t cellHeight = height / MOTION_HEIGHT;
+    uint32_t frame      = stats.frames;
+    uint32_t count, peak;
+    uint32_t x0 = MOTION_BLOCKS_X, y0 = MOTION_BLOCKS_Y, x1 = 0, y1 = 0;
+
+    // Pairs of pixels per cell, halfword sums must not overflow
+    if (cellWidth < 2U || (cellWidth & 1U) || cellHeight == 0U ||
+        width != cellWidth * MOTION_WIDTH ||
+        height != cellHeight * MOTION_HEIGHT ||
+        cellWidth / 2U * cellHeight > 0xFFFFU / 255U)
+        return MOTION_BAD_FRAME;
+
+    MOTION_Downscale((const MOTION_Word*)yuv, width / 2U, cellWidth / 2U,
+                     cellHeight, (uint8_t*)luma);
+    stats.frames++;
+    if (frame == 0U)
+    {
+        const uint8_t* src = (const uint8_t*)luma;
+        uint8_t* dst       = (uint8_t*)background;
+
+        for (uint32_t i = 0; i < MOTION_PIXELS; ++i)
+        {
+            model[i] = (uint16_t)(src[i] << 8);
+            dst[i]   = src[i];
+        }
+        return MOTION_LEARNING;
+    }
+
+    count = MOTION_CompareBlocks((uint32_t)config.threshold * MOTION_BLOCK_W *
+                                     MOTION_BLOCK_H,
+                                 &peak);
+    MOTION_Learn(config.learnShift, config.slowShift);
+    stats.lastBlocks = count;
+
+    if (frame < config.warmup)
+        return MOTION_LEARNING;
+    if (count < config.minBlocks || count == 0U)
+    {
+        if (holdoff)
+            holdoff--;
+        return MOTION_IDLE;
+    }
+    if (holdoff)
+    {
+        holdoff--;
+        stats.suppressed++;
+        return MOTION_IDLE;
+    }
+
+    for (uint32_t i = 0; i < MOTION_BLOCKS; ++i)
+    {
+        uint32_t bx = i % MOTION_BLOCKS_X, by = i / MOTION_BLOCKS_X;
+
+        if (!moving[i])
+            continue;
+        x0 = bx < x0 ? bx : x0;
+        x1 = bx > x1 ? bx : x1;
+        y0 = by < y0 ? by : y0;
+        y1 = by > y1 ? by : y1;
+    }
+    event->x       = (uint16_t)(x0 * MOTION_BLOCK_W * cellWidth);
+    event->y       = (uint16_t)(y0 * MOTION_BLOCK_H * cellHeight);
+    event->width   = (uint16_t)((x1 - x0 + 1U) * MOTION_BLOCK_W * cellWidth);
+    event->height  = (uint16_t)((y1 - y0 + 1U) * MOTION_BLOCK_H * cellHeight);
+    event->blocks  = (uint16_t)count;
+    event->peakSad = peak;
+    event->frame   = frame;
+    holdoff        = config.holdoff;
+    stats.events++;
+    return MOTION_DETECTED;
+}
+
+/**
+ * @return Last downscaled frame, 40x30 bytes.
+ */
+const uint8_t* MOTION_GetLuma(void) { return (const uint8_t*)luma; }
+
+/**
+ * @return Background model rounded to bytes, 40x30.
+ */
+const uint8_t* MOTION_GetBackground(void)
+{
+    return (const uint8_t*)background;
+}
+
+void MOTION_GetStats(MOTION_Stats* out) { *out = stats; }
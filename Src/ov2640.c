@@ -30,6 +30,7 @@
 #define DEBUG
 
 #include "ov2640.h"
+#include "memory_config.h"
 /**
  * Code debugging option
  */
@@ -1211,6 +1212,9 @@ void OV2640_CaptureSnapshot(uint32_t frameBuffer, int length)
     HAL_Delay(2000);
     HAL_DCMI_Suspend(phdcmi);
     HAL_DCMI_Stop(phdcmi);
+
+    // Drop cached lines of the buffer, DCMI wrote to it behind the D-cache
+    MEM_DmaReceived((const void*)frameBuffer, length);
 }
 
 /**
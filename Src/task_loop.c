@@ -0,0 +1,218 @@
+/*
+ * task_loop.c
+ *
+ *  Created on: Oct 19, 2026
+ */
+
+#include "task_loop.h"
+#include "perf.h"
+
+static const TASK_Desc* taskTable;
+static uint32_t taskCount;
+
+/// Posted events, written by interrupts, read by the loop
+static volatile uint8_t queue[TASK_QUEUE_SIZE];
+static volatile uint32_t queueHead;
+static volatile uint32_t queueCount;
+
+/// Events of every task not handled yet
+static uint32_t pending[TASK_MAX];
+/// Tasks whose period elapsed, bit per task, set by TASK_Tick()
+static volatile uint32_t timerDue;
+static uint32_t timerLeft[TASK_MAX];
+
+static TASK_Stats stats[TASK_MAX];
+static TASK_LoopStats loopStats;
+
+/**
+ * The queue is fed from several interrupts, it is changed with interrupts
+ * masked. PRIMASK is restored, not blindly cleared.
+ */
+static inline uint32_t TASK_Lock(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    return primask;
+}
+
+static inline void TASK_Unlock(uint32_t primask) { __set_PRIMASK(primask); }
+
+/**
+ * Sets up the task table and clears the queue and the statistics.
+ * @param tasks Table, kept by reference.
+ * @param count Number of tasks, at most TASK_MAX.
+ * @return 1 when there are too many tasks, 0 otherwise.
+ */
+uint8_t TASK_Init(const TASK_Desc* tasks, uint32_t count)
+{
+    if (count > TASK_MAX)
+        return 1;
+
+    uint32_t primask = TASK_Lock();
+    taskTable  = tasks;
+    taskCount  = count;
+    queueHead  = 0;
+    queueCount = 0;
+    timerDue   = 0;
+    loopStats  = (TASK_LoopStats){0};
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        pending[i]    = 0;
+        timerLeft[i]  = tasks[i].periodMs;
+        stats[i]      = (TASK_Stats){0};
+        stats[i].name = tasks[i].name;
+    }
+    TASK_Unlock(primask);
+    PERF_Init();
+    return 0;
+}
+
+/**
+ * Queues an event. Can be called from interrupt context.
+ * @param event Event number, 0 ... TASK_EVENT_LAST.
+ */
+void TASK_Post(uint8_t event)
+{
+    uint32_t primask = TASK_Lock();
+    ++loopStats.posted;
+    if (queueCount == TASK_QUEUE_SIZE || event > TASK_EVENT_LAST)
+    {
+        ++loopStats.lost;
+    }
+    else
+    {
+        queue[(queueHead + queueCount) % TASK_QUEUE_SIZE] = event;
+        ++queueCount;
+        if (queueCount > loopStats.maxQueue)
+            loopStats.maxQueue = queueCount;
+    }
+    TASK_Unlock(primask);
+}
+
+/**
+ * Counts the periods of the tasks. Called from a timer interrupt every
+ * millisecond.
+ */
+void TASK_Tick(void)
+{
+    ++loopStats.uptimeMs;
+    for (uint32_t i = 0; i < taskCount; ++i)
+    {
+        if (taskTable[i].periodMs == 0U || --timerLeft[i] != 0U)
+            continue;
+        timerLeft[i] = taskTable[i].periodMs;
+        timerDue |= 1UL << i;
+    }
+}
+
+/**
+ * Moves the queued events and the elapsed periods to the pending events of
+ * the tasks.
+ */
+static void TASK_Dispatch(void)
+{
+    uint32_t primask = TASK_Lock();
+    uint32_t due     = timerDue;
+
+    timerDue = 0;
+    while (queueCount != 0U)
+    {
+        uint32_t event = TASK_EVENT(queue[queueHead]);
+
+        queueHead = (queueHead + 1U) % TASK_QUEUE_SIZE;
+        --queueCount;
+        for (uint32_t i = 0; i < taskCount; ++i)
+            if (taskTable[i].events & event)
+                pending[i] |= event;
+    }
+    TASK_Unlock(primask);
+
+    for (uint32_t i = 0; i < taskCount; ++i)
+        if (due & (1UL << i))
+            pending[i] |= TASK_EVENT_TIMER;
+}
+
+/**
+ * @return Ready task of the highest class, -1 when all are idle.
+ */
+static int32_t TASK_Next(void)
+{
+    int32_t next = -1;
+
+    for (uint32_t i = 0; i < taskCount; ++i)
+        if (pending[i] != 0U &&
+            (next < 0 || taskTable[i].priority < taskTable[next].priority))
+            next = (int32_t)i;
+    return next;
+}
+
+/**
+ * Sleeps until the next interrupt unless an event came in meanwhile. WFI
+ * wakes on a pending interrupt with interrupts masked, the handler runs
+ * once they are unmasked.
+ */
+static void TASK_Sleep(void)
+{
+    __disable_irq();
+    if (queueCount == 0U && timerDue == 0U)
+    {
+        ++loopStats.sleeps;
+        __DSB();
+        __WFI();
+    }
+    __enable_irq();
+}
+
+/**
+ * Runs the tasks, never returns.
+ */
+void TASK_Run(void)
+{
+    for (;;)
+    {
+        int32_t next;
+
+        TASK_Dispatch();
+        next = TASK_Next();
+        if (next < 0)
+        {
+            TASK_Sleep();
+            continue;
+        }
+
+        uint32_t events = pending[next];
+        uint32_t start  = PERF_Cycles();
+        pending[next]   = 0;
+        taskTable[next].run(events);
+
+        uint32_t us = PERF_CyclesToUs(PERF_Cycles() - start);
+        ++stats[next].runs;
+        stats[next].runUs += us;
+        if (us > stats[next].maxUs)
+            stats[next].maxUs = us;
+        loopStats.busyUs += us;
+    }
+}
+
+/**
+ * @param task Index in the task table.
+ * @param out Filled with the counters of the task.
+ * @return 1 for an unknown task, 0 otherwise.
+ */
+uint8_t TASK_GetStats(uint32_t task, TASK_Stats* out)
+{
+    if (task >= taskCount)
+        return 1;
+    *out = stats[task];
+    return 0;
+}
+
+/**
+ * @param out Filled with a snapshot of the loop counters.
+ */
+void TASK_GetLoopStats(TASK_LoopStats* out)
+{
+    uint32_t primask = TASK_Lock();
+    *out             = loopStats;
+    TASK_Unlock(primask);
+}
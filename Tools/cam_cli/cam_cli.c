@@ -0,0 +1,376 @@
+/*
+ * cam_cli.c
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * Host side of the remote control commands (Inc/command.h), over the
+ * ST-LINK virtual COM port (USART3, 115200 8N1).
+ *
+ * Build from the repository root (POSIX hosts):
+ *
+ *   cc -O2 -IInc -o cam_cli Tools/cam_cli/cam_cli.c Src/command.c
+ *
+ * Usage:
+ *
+ *   ./cam_cli [-b] [-o capture.bin] [-w seconds] /dev/ttyACM0 command ...
+ *
+ *   ./cam_cli /dev/ttyACM0 mode 2
+ *   ./cam_cli /dev/ttyACM0 reg 0xff 1
+ *   ./cam_cli -o capture.bin /dev/ttyACM0 stream 10
+ *
+ * The command is sent as a text line, or as a binary frame with -b, and the
+ * reply lines are printed up to the one starting with OK or ERR. With -o
+ * everything received after it is written to the file until the line has
+ * been quiet for -w seconds (2 by default): the frames of a capture or
+ * stream command, which Tools/lz_uplink and Tools/frame_delta read.
+ *
+ *   ./cam_cli -t
+ *
+ * checks that the text and binary encodings of every command decode to
+ * the same command and that damaged input is rejected.
+ */
+
+#include "command.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/select.h>
+#include <termios.h>
+#include <unistd.h>
+
+/// Longest reply line kept, longer ones are printed in pieces
+#define REPLY_SIZE 256U
+
+/**
+ * Feeds a whole buffer to the parser.
+ * @return Number of commands decoded into commands[], -1 on a parse error.
+ */
+static int feed(CMD_Parser* parser, const uint8_t* data, uint32_t length,
+                CMD_Command* commands, int capacity)
+{
+    int count = 0;
+
+    for (uint32_t i = 0; i < length; ++i)
+    {
+        CMD_Command command;
+        CMD_Result result = CMD_Feed(parser, data[i], &command);
+
+        if (result == CMD_ERROR)
+            return -1;
+        if (result == CMD_READY && count < capacity)
+            commands[count++] = command;
+    }
+    return count;
+}
+
+static int sameCommand(const CMD_Command* a, const CMD_Command* b)
+{
+    if (a->id != b->id || a->argc != b->argc)
+        return 0;
+    for (uint32_t i = 0; i < a->argc; ++i)
+        if (a->args[i] != b->args[i])
+            return 0;
+    return 1;
+}
+
+static int selfTest(void)
+{
+    static const struct
+    {
+        const char* line;
+        CMD_Id id;
+        uint8_t argc;
+        uint32_t args[3];
+    } valid[] = {
+        {"help\n", CMD_HELP, 0, {0}},
+        {"capture\r\n", CMD_CAPTURE, 0, {0}},
+        {"  stream 10\r", CMD_STREAM, 1, {10}},
+        {"mode\t0x3\n", CMD_MODE, 1, {3}},
+        {"effect 7\n", CMD_EFFECT, 1, {7}},
+        {"reg 0xff\n", CMD_REG_READ, 1, {0xFF}},
+        {"reg 0x11 128\n", CMD_REG_WRITE, 2, {0x11, 128}},
+        {"perf\n", CMD_PERF, 0, {0}},
+        {"sched 2 0 60000\n", CMD_SCHED, 3, {2, 0, 60000}},
+    };
+    static const char* const invalid[] = {
+        "snap\n",     "stream\n",   "stream 1 2\n", "reg 1 2 3\n",
+        "mode 12x\n", "effect -\n", "help 1\n",     "sched\n",
+        "reg 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20\n",
+    };
+    CMD_Parser parser;
+    CMD_Command decoded[2];
+    uint8_t frame[CMD_FRAME_SIZE];
+    int failures = 0;
+
+    CMD_Init(&parser);
+    for (size_t i = 0; i < sizeof(valid) / sizeof(valid[0]); ++i)
+    {
+        CMD_Command expected = {valid[i].id, 0, valid[i].argc, {0}};
+        uint32_t length;
+
+        memcpy(expected.args, valid[i].args, sizeof(valid[i].args));
+        // Text line, then the same command as a binary frame
+        if (feed(&parser, (const uint8_t*)valid[i].line,
+                 (uint32_t)strlen(valid[i].line), decoded, 1) != 1 ||
+            !sameCommand(&decoded[0], &expected) || decoded[0].binary)
+        {
+            printf("FAIL text \"%s\"\n", valid[i].line);
+            failures++;
+        }
+        length = CMD_Encode(&expected, frame);
+        if (feed(&parser, frame, length, decoded, 1) != 1 ||
+            !sameCommand(&decoded[0], &expected) || !decoded[0].binary)
+        {
+            printf("FAIL binary %s\n", CMD_Name(expected.id));
+            failures++;
+        }
+        // Every damaged byte of the frame is caught by the CRC, a bad
+        // argument count before it
+        for (uint32_t j = 1; j < length; ++j)
+        {
+            frame[j] ^= 0x10U;
+            if (feed(&parser, frame, length, decoded, 1) == 1)
+            {
+                printf("FAIL damaged %s byte %u\n", CMD_Name(expected.id),
+                       j);
+                failures++;
+            }
+            frame[j] ^= 0x10U;
+            CMD_Init(&parser);
+        }
+    }
+    for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i)
+    {
+        if (feed(&parser, (const uint8_t*)invalid[i],
+                 (uint32_t)strlen(invalid[i]), decoded, 1) != -1)
+        {
+            printf("FAIL accepted \"%s\"\n", invalid[i]);
+            failures++;
+        }
+        CMD_Init(&parser);
+    }
+    // The parser is back in sync after an error
+    {
+        static const char stream[] = "bogus\ncapture\n";
+        if (feed(&parser, (const uint8_t*)stream + 6, sizeof(stream) - 7U,
+                 decoded, 2) != 1 ||
+            decoded[0].id != CMD_CAPTURE)
+        {
+            printf("FAIL resync\n");
+            failures++;
+        }
+    }
+    printf("%s: %d failure(s)\n", failures ? "FAILED" : "passed", failures);
+    return failures ? 1 : 0;
+}
+
+static int openPort(const char* path)
+{
+    struct termios tio;
+    int fd = open(path, O_RDWR | O_NOCTTY);
+
+    if (fd < 0 || tcgetattr(fd, &tio) != 0)
+    {
+        perror(path);
+        if (fd >= 0)
+            close(fd);
+        return -1;
+    }
+    cfmakeraw(&tio);
+    cfsetispeed(&tio, B115200);
+    cfsetospeed(&tio, B115200);
+    tio.c_cflag |= CLOCAL | CREAD;
+    tio.c_cc[VMIN]  = 0;
+    tio.c_cc[VTIME] = 0;
+    if (tcsetattr(fd, TCSANOW, &tio) != 0)
+    {
+        perror(path);
+        close(fd);
+        return -1;
+    }
+    tcflush(fd, TCIOFLUSH);
+    return fd;
+}
+
+/**
+ * Reads what arrives within timeoutMs.
+ * @return Bytes read, 0 on timeout, -1 on error.
+ */
+static int readSome(int fd, uint8_t* buffer, size_t size, int timeoutMs)
+{
+    struct timeval tv = {timeoutMs / 1000, (timeoutMs % 1000) * 1000};
+    fd_set set;
+
+    FD_ZERO(&set);
+    FD_SET(fd, &set);
+    if (select(fd + 1, &set, NULL, NULL, &tv) <= 0)
+        return 0;
+    return (int)read(fd, buffer, size);
+}
+
+/**
+ * Joins the arguments into a text line and decodes it as the firmware does.
+ * @param line Output, CMD_LINE_SIZE + 2 bytes.
+ */
+static int buildCommand(int argc, char** argv, char* line,
+                        CMD_Command* command)
+{
+    const size_t size = CMD_LINE_SIZE + 2U;
+    CMD_Parser parser;
+
+    line[0] = '\0';
+    for (int i = 0; i < argc; ++i)
+    {
+        if (strlen(line) + strlen(argv[i]) + 3U > size)
+            return -1;
+        if (i != 0)
+            strcat(line, " ");
+        strcat(line, argv[i]);
+    }
+    strcat(line, "\n");
+    CMD_Init(&parser);
+    return feed(&parser, (const uint8_t*)line, (uint32_t)strlen(line),
+                command, 1) == 1
+               ? 0
+               : -1;
+}
+
+static int run(const char* port, int binary, const char* output,
+               int quietMs, int argc, char** argv)
+{
+    CMD_Command command;
+    char line[CMD_LINE_SIZE + 2U];
+    uint8_t frame[CMD_FRAME_SIZE];
+    const uint8_t* request;
+    char reply[REPLY_SIZE];
+    uint32_t replyLength = 0, length;
+    uint8_t buffer[512];
+    FILE* out = NULL;
+    int fd, status = 1, done = 0;
+
+    if (buildCommand(argc, argv, line, &command) != 0)
+    {
+        fprintf(stderr, "not a valid command, try: help\n");
+        return 2;
+    }
+    fd = openPort(port);
+    if (fd < 0)
+        return 1;
+    if (binary)
+    {
+        length  = CMD_Encode(&command, frame);
+        request = frame;
+    }
+    else
+    {
+        length  = (uint32_t)strlen(line);
+        request = (const uint8_t*)line;
+    }
+    if (write(fd, request, length) != (ssize_t)length)
+    {
+        perror(port);
+        goto fail;
+    }
+
+    // Reply lines, the one starting with OK or ERR ends the reply. Commands
+    // wait on the target while a frame is being sent: be patient.
+    while (!done)
+    {
+        int n = readSome(fd, buffer, sizeof(buffer), 10000);
+
+        if (n <= 0)
+        {
+            fprintf(stderr, "no reply\n");
+            goto fail;
+        }
+        for (int i = 0; i < n && !done; ++i)
+        {
+            if (buffer[i] == '\n' || replyLength == REPLY_SIZE - 1U)
+            {
+                reply[replyLength] = '\0';
+                if (replyLength != 0U && reply[replyLength - 1U] == '\r')
+                    reply[replyLength - 1U] = '\0';
+                printf("%s\n", reply);
+                if (strncmp(reply, "OK", 2) == 0)
+                    done = 1, status = 0;
+                else if (strncmp(reply, "ERR", 3) == 0)
+                    done = 1;
+                replyLength = 0;
+            }
+            else
+            {
+                reply[replyLength++] = (char)buffer[i];
+            }
+            if (done && output != NULL && i + 1 < n)
+            {
+                out = fopen(output, "wb");
+                if (out == NULL)
+                {
+                    perror(output);
+                    goto fail;
+                }
+                fwrite(&buffer[i + 1], 1, (size_t)(n - i - 1), out);
+            }
+        }
+    }
+
+    // Data of a capture or stream, until the line is quiet
+    if (status == 0 && output != NULL)
+    {
+        unsigned long total = 0;
+        int n;
+
+        if (out == NULL && (out = fopen(output, "wb")) == NULL)
+        {
+            perror(output);
+            goto fail;
+        }
+        total = (unsigned long)ftell(out);
+        while ((n = readSome(fd, buffer, sizeof(buffer), quietMs)) > 0)
+        {
+            fwrite(buffer, 1, (size_t)n, out);
+            total += (unsigned long)n;
+        }
+        fprintf(stderr, "%lu bytes written to %s\n", total, output);
+    }
+    if (out != NULL)
+        fclose(out);
+    close(fd);
+    return status;
+
+fail:
+    if (out != NULL)
+        fclose(out);
+    close(fd);
+    return 1;
+}
+
+int main(int argc, char** argv)
+{
+    const char* output = NULL;
+    int binary = 0, quietMs = 2000, i = 1;
+
+    if (argc == 2 && strcmp(argv[1], "-t") == 0)
+        return selfTest();
+    for (; i < argc && argv[i][0] == '-'; ++i)
+    {
+        if (strcmp(argv[i], "-b") == 0)
+            binary = 1;
+        else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+            output = argv[++i];
+        else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc)
+            quietMs = atoi(argv[++i]) * 1000;
+        else
+            break;
+    }
+    if (argc - i >= 2)
+        return run(argv[i], binary, output, quietMs, argc - i - 1,
+                   &argv[i + 1]);
+    fprintf(stderr,
+            "usage: %s [-b] [-o capture.bin] [-w seconds] port command ...\n"
+            "       %s -t\n",
+            argv[0], argv[0]);
+    return 2;
+}
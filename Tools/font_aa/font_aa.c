@@ -0,0 +1,237 @@
+/*
+ * font_aa.c
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * Renders anti-aliased 4-bpp fonts (sFONT_AA, see fonts.h) from a TrueType
+ * font with FreeType.
+ *
+ * Build and run from the repository root:
+ *
+ *   cc -O2 $(pkg-config --cflags freetype2) -IILI9486 -o font_aa \
+ *      Tools/font_aa/font_aa.c $(pkg-config --libs freetype2)
+ *   ./font_aa -o ILI9486/fonts_aa.c SourceCodePro-Regular.ttf \
+ *      Font8Aa:5x8 Font12Aa:7x12 Font16Aa:11x16 Font20Aa:14x20 \
+ *      Font24Aa:17x24
+ *
+ * Every font argument is a name and a character cell. The largest pixel
+ * size at which the ink of all ASCII glyphs and their advance fit the cell
+ * is used, glyphs are centered horizontally on the advance and share one
+ * baseline. Coverage is
+ * quantized to 16 levels, two pixels per byte (high nibble first), rows
+ * padded to whole bytes. With -p the given character of every font is
+ * printed to stderr as a preview.
+ */
+
+#include "fonts.h"
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char shades[] = " .:-=+*#%@@@@@@@";
+
+/**
+ * Finds the largest pixel size at which all glyphs fit the cell. The font
+ * metrics include accents and line gap, so the ink is measured instead.
+ * @param ascent Receives the largest extent of ink above the baseline.
+ * @return Pixel size or 0 when even 1 pixel does not fit.
+ */
+static FT_UInt fitSize(FT_Face face, uint32_t width, uint32_t height,
+                       int32_t* ascent)
+{
+    for (FT_UInt size = height * 2U; size > 0U; --size)
+    {
+        int32_t above = 0, below = 0, advance = 0;
+
+        if (FT_Set_Pixel_Sizes(face, 0, size) != 0)
+            continue;
+        for (uint32_t ch = 0; ch < FONT_AA_GLYPHS; ++ch)
+        {
+            FT_GlyphSlot slot = face->glyph;
+            if (FT_Load_Char(face, FONT_AA_FIRST + ch,
+                             FT_LOAD_RENDER | FT_LOAD_TARGET_LIGHT) != 0)
+                continue;
+            if (slot->bitmap.rows != 0U)
+            {
+                int32_t top    = slot->bitmap_top;
+                int32_t bottom = (int32_t)slot->bitmap.rows - top;
+                above          = top > above ? top : above;
+                below          = bottom > below ? bottom : below;
+            }
+            if ((int32_t)(slot->advance.x >> 6) > advance)
+                advance = (int32_t)(slot->advance.x >> 6);
+        }
+        if (above + below <= (int32_t)height && advance <= (int32_t)width)
+        {
+            *ascent = above + ((int32_t)height - above - below) / 2;
+            return size;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Renders one character into a cell of 4-bit coverage values.
+ */
+static int renderGlyph(FT_Face face, char ch, uint32_t width, uint32_t height,
+                       int32_t baseline, uint8_t* cell)
+{
+    FT_GlyphSlot slot;
+
+    memset(cell, 0, (size_t)width * height);
+    if (FT_Load_Char(face, (FT_ULong)ch, FT_LOAD_RENDER |
+                                             FT_LOAD_TARGET_LIGHT) != 0)
+        return -1;
+    slot = face->glyph;
+
+    int32_t left = ((int32_t)width - (int32_t)(slot->advance.x >> 6)) / 2 +
+                   slot->bitmap_left;
+    int32_t top  = baseline - slot->bitmap_top;
+
+    for (uint32_t row = 0; row < slot->bitmap.rows; ++row)
+    {
+        for (uint32_t col = 0; col < slot->bitmap.width; ++col)
+        {
+            int32_t x = left + (int32_t)col;
+            int32_t y = top + (int32_t)row;
+            uint8_t v = slot->bitmap.buffer[row * slot->bitmap.pitch + col];
+
+            if (x >= 0 && y >= 0 && x < (int32_t)width && y < (int32_t)height)
+                cell[y * width + x] = (uint8_t)((v * 15U + 127U) / 255U);
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    const char* out = NULL;
+    char preview    = 0;
+    FT_Library library;
+    FT_Face face;
+    FILE* f;
+    int i;
+
+    for (i = 1; i < argc && argv[i][0] == '-'; ++i)
+    {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+            out = argv[++i];
+        else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc)
+            preview = argv[++i][0];
+        else
+            break;
+    }
+    if (out == NULL || i + 2 > argc)
+    {
+        fprintf(stderr,
+                "usage: %s [-p char] -o fonts_aa.c font.ttf Name:WxH ...\n",
+                argv[0]);
+        return 2;
+    }
+    if (FT_Init_FreeType(&library) != 0 ||
+        FT_New_Face(library, argv[i], 0, &face) != 0)
+    {
+        fprintf(stderr, "%s: cannot load\n", argv[i]);
+        return 1;
+    }
+    f = fopen(out, "w");
+    if (f == NULL)
+    {
+        fprintf(stderr, "%s: cannot write\n", out);
+        return 1;
+    }
+
+    fprintf(f,
+            "/*\n"
+            " * fonts_aa.c\n"
+            " *\n"
+            " * Generated by Tools/font_aa from %s %s, do not edit.\n"
+            " * 4-bpp anti-aliased glyphs, see sFONT_AA in fonts.h.\n"
+            " */\n\n"
+            "#include \"fonts.h\"\n",
+            face->family_name, face->style_name);
+
+    for (++i; i < argc; ++i)
+    {
+        static uint8_t cell[256 * 256];
+        char name[64];
+        unsigned width, height;
+
+        if (sscanf(argv[i], "%63[^:]:%ux%u", name, &width, &height) != 3 ||
+            width == 0U || height == 0U || width > 255U || height > 255U)
+        {
+            fprintf(stderr, "%s: expected Name:WxH\n", argv[i]);
+            fclose(f);
+            return 2;
+        }
+
+        int32_t baseline;
+        FT_UInt size = fitSize(face, width, height, &baseline);
+        uint32_t rowBytes = (width + 1U) / 2U;
+
+        if (size == 0U)
+        {
+            fprintf(stderr, "%s: cell too small\n", argv[i]);
+            fclose(f);
+            return 1;
+        }
+
+        fprintf(f, "\nstatic const uint8_t %s_Table[] = {\n", name);
+        for (uint32_t ch = 0; ch < FONT_AA_GLYPHS; ++ch)
+        {
+            char c = (char)(FONT_AA_FIRST + ch);
+
+            if (renderGlyph(face, c, width, height, baseline, cell) != 0)
+            {
+                fprintf(stderr, "%s: no glyph for '%c'\n", argv[i], c);
+                fclose(f);
+                return 1;
+            }
+            fprintf(f, "    // @%u '%c' (%u pixels wide)\n",
+                    ch * height * rowBytes, c, width);
+            for (uint32_t y = 0; y < height; ++y)
+            {
+                fprintf(f, "   ");
+                for (uint32_t x = 0; x < width; x += 2U)
+                {
+                    uint8_t lo = x + 1U < width ? cell[y * width + x + 1U] : 0U;
+                    fprintf(f, " 0x%02X,", (cell[y * width + x] << 4) | lo);
+                }
+                // Preview of the row without trailing blanks
+                uint32_t ink = width;
+                while (ink > 0U && cell[y * width + ink - 1U] == 0U)
+                    --ink;
+                fprintf(f, " //%s", ink != 0U ? " " : "");
+                for (uint32_t x = 0; x < ink; ++x)
+                    fputc(shades[cell[y * width + x]], f);
+                fprintf(f, "\n");
+            }
+
+            if (c == preview)
+            {
+                fprintf(stderr, "%s '%c' (%upx):\n", name, c, size);
+                for (uint32_t y = 0; y < height; ++y)
+                {
+                    for (uint32_t x = 0; x < width; ++x)
+                        fputc(shades[cell[y * width + x]], stderr);
+                    fputc('\n', stderr);
+                }
+            }
+        }
+        fprintf(f, "};\n\n");
+        int indent = (int)strlen("sFONT_AA  = {") + (int)strlen(name);
+        fprintf(f, "sFONT_AA %s = {%u, /* Width */\n", name, width);
+        fprintf(f, "%*s%u, /* Height */\n", indent, "", height);
+        fprintf(f, "%*s%s_Table};\n", indent, "", name);
+        fprintf(stderr, "%s: %ux%u cell, %u px, %u B\n", name, width, height,
+                size, FONT_AA_GLYPHS * height * rowBytes);
+    }
+    fclose(f);
+    FT_Done_Face(face);
+    FT_Done_FreeType(library);
+    return 0;
+}
@@ -0,0 +1,246 @@
+/*
+ * font_rle.c
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * Converts the 1-bpp font tables (ILI9486/font8.c ... font24.c) to the
+ * run-length encoded format of sFONT_RLE (see fonts.h) and writes
+ * ILI9486/fonts_rle.c.
+ *
+ * Build and run from the repository root:
+ *
+ *   cc -O2 -IILI9486 -o font_rle Tools/font_rle/font_rle.c \
+ *      ILI9486/font8.c ILI9486/font12.c ILI9486/font16.c \
+ *      ILI9486/font20.c ILI9486/font24.c
+ *   ./font_rle ILI9486/fonts_rle.c
+ *
+ * Every glyph is cropped to the bounding box of its set pixels. The box is
+ * scanned row by row as one sequence of alternating background and ink
+ * runs, one byte per pair: high nibble background run, low nibble ink run,
+ * 0..15 pixels each. Longer runs continue in the next byte with a zero
+ * background or ink part. Every encoded glyph is decoded again and compared
+ * with the source table, the sizes of both formats are printed to stderr.
+ */
+
+#include "fonts.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// Largest run of one nibble
+#define RUN_MAX 15U
+
+typedef struct
+{
+    const char* name;
+    const sFONT* font;
+} SourceFont;
+
+static const SourceFont sources[] = {
+    {"Font8", &Font8},   {"Font12", &Font12}, {"Font16", &Font16},
+    {"Font20", &Font20}, {"Font24", &Font24},
+};
+
+static int pixelAt(const sFONT* font, uint32_t ch, uint32_t x, uint32_t y)
+{
+    uint32_t rowBytes    = (font->Width + 7U) / 8U;
+    const uint8_t* glyph = &font->table[ch * font->Height * rowBytes];
+    return (glyph[y * rowBytes + x / 8U] & (0x80U >> (x % 8U))) != 0U;
+}
+
+/**
+ * Encodes one glyph.
+ * @param glyph Filled with the bounding box, Offset is left untouched.
+ * @param out Receives the run bytes.
+ * @return Number of bytes written to out.
+ */
+static uint32_t encodeGlyph(const sFONT* font, uint32_t ch, sGLYPH_RLE* glyph,
+                            uint8_t* out)
+{
+    uint32_t x0 = font->Width, y0 = font->Height, x1 = 0, y1 = 0;
+    uint32_t bytes = 0, background = 0, ink = 0;
+
+    for (uint32_t y = 0; y < font->Height; ++y)
+    {
+        for (uint32_t x = 0; x < font->Width; ++x)
+        {
+            if (pixelAt(font, ch, x, y))
+            {
+                x0 = x < x0 ? x : x0;
+                y0 = y < y0 ? y : y0;
+                x1 = x + 1U > x1 ? x + 1U : x1;
+                y1 = y + 1U > y1 ? y + 1U : y1;
+            }
+        }
+    }
+    if (x1 == 0U)
+    {
+        *glyph = (sGLYPH_RLE){0, 0, 0, 0, 0};
+        return 0;
+    }
+    glyph->X      = (uint8_t)x0;
+    glyph->Y      = (uint8_t)y0;
+    glyph->Width  = (uint8_t)(x1 - x0);
+    glyph->Height = (uint8_t)(y1 - y0);
+
+    // Runs in raster order over the box, flushed as (background, ink) pairs
+    for (uint32_t y = y0; y < y1; ++y)
+    {
+        for (uint32_t x = x0; x < x1; ++x)
+        {
+            if (pixelAt(font, ch, x, y))
+            {
+                if (ink == RUN_MAX)
+                {
+                    out[bytes++] = (uint8_t)((background << 4) | ink);
+                    background   = 0;
+                    ink          = 0;
+                }
+                ++ink;
+            }
+            else
+            {
+                if (ink != 0U)
+                {
+                    out[bytes++] = (uint8_t)((background << 4) | ink);
+                    background   = 0;
+                    ink          = 0;
+                }
+                if (background == RUN_MAX)
+                {
+                    out[bytes++] = (uint8_t)(background << 4);
+                    background   = 0;
+                }
+                ++background;
+            }
+        }
+    }
+    // The last row of the box ends with ink or with background which is
+    // never stored
+    if (ink != 0U)
+        out[bytes++] = (uint8_t)((background << 4) | ink);
+    return bytes;
+}
+
+/**
+ * Decodes one glyph into a cell sized bitmap (one byte per pixel).
+ */
+static void decodeGlyph(const sFONT* font, const sGLYPH_RLE* glyph,
+                        const uint8_t* runs, uint32_t bytes, uint8_t* cell)
+{
+    uint32_t pos = 0;
+
+    memset(cell, 0, (size_t)font->Width * font->Height);
+    for (uint32_t i = 0; i < bytes; ++i)
+    {
+        pos += runs[i] >> 4;
+        for (uint32_t n = runs[i] & 0x0FU; n != 0U; --n, ++pos)
+        {
+            uint32_t x = glyph->X + pos % glyph->Width;
+            uint32_t y = glyph->Y + pos / glyph->Width;
+            cell[y * font->Width + x] = 1U;
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    static uint8_t runs[FONT_RLE_GLYPHS * MAX_WIDTH_FONT * MAX_HEIGHT_FONT];
+    static sGLYPH_RLE glyphs[FONT_RLE_GLYPHS + 1U];
+    static uint8_t cell[MAX_WIDTH_FONT * MAX_HEIGHT_FONT];
+    const uint32_t table = (FONT_RLE_GLYPHS + 1U) * sizeof(sGLYPH_RLE);
+    uint32_t totalRaw = 0, totalRle = 0;
+    FILE* f;
+
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: %s ILI9486/fonts_rle.c\n", argv[0]);
+        return 2;
+    }
+    f = fopen(argv[1], "w");
+    if (f == NULL)
+    {
+        fprintf(stderr, "%s: cannot write\n", argv[1]);
+        return 1;
+    }
+
+    fprintf(f, "/*\n"
+               " * fonts_rle.c\n"
+               " *\n"
+               " * Generated by Tools/font_rle from font8.c ... font24.c, "
+               "do not edit.\n"
+               " * Run-length encoded glyphs, see sFONT_RLE in fonts.h.\n"
+               " */\n\n"
+               "#include \"fonts.h\"\n");
+
+    for (size_t s = 0; s < sizeof(sources) / sizeof(sources[0]); ++s)
+    {
+        const sFONT* font = sources[s].font;
+        uint32_t raw = FONT_RLE_GLYPHS * font->Height *
+                       ((font->Width + 7U) / 8U);
+        uint32_t bytes = 0;
+
+        for (uint32_t ch = 0; ch < FONT_RLE_GLYPHS; ++ch)
+        {
+            uint32_t n = encodeGlyph(font, ch, &glyphs[ch], &runs[bytes]);
+
+            decodeGlyph(font, &glyphs[ch], &runs[bytes], n, cell);
+            for (uint32_t p = 0; p < (uint32_t)font->Width * font->Height;
+                 ++p)
+            {
+                if (cell[p] != pixelAt(font, ch, p % font->Width,
+                                       p / font->Width))
+                {
+                    fprintf(stderr, "%s: '%c' does not round trip\n",
+                            sources[s].name, (char)(ch + FONT_RLE_FIRST));
+                    fclose(f);
+                    return 1;
+                }
+            }
+            glyphs[ch].Offset = (uint16_t)bytes;
+            bytes += n;
+        }
+        glyphs[FONT_RLE_GLYPHS] = (sGLYPH_RLE){(uint16_t)bytes, 0, 0, 0, 0};
+
+        fprintf(f, "\nstatic const uint8_t %s_Runs[%u] = {", sources[s].name,
+                bytes);
+        for (uint32_t i = 0; i < bytes; ++i)
+            fprintf(f, "%s0x%02X,", i % 12U ? " " : "\n    ", runs[i]);
+        fprintf(f, "\n};\n\n");
+
+        fprintf(f,
+                "static const sGLYPH_RLE %s_Glyphs[FONT_RLE_GLYPHS + 1] = "
+                "{\n",
+                sources[s].name);
+        for (uint32_t ch = 0; ch <= FONT_RLE_GLYPHS; ++ch)
+        {
+            const sGLYPH_RLE* g = &glyphs[ch];
+            fprintf(f, "    {%u, %u, %u, %u, %u},", g->Offset, g->X, g->Y,
+                    g->Width, g->Height);
+            if (ch < FONT_RLE_GLYPHS)
+            {
+                char c = (char)(ch + FONT_RLE_FIRST);
+                fprintf(f, " // '%s%c'\n", c == '\\' || c == '\'' ? "\\" : "",
+                        c);
+            }
+            else
+            {
+                fprintf(f, " // end\n");
+            }
+        }
+        fprintf(f, "};\n\n");
+        fprintf(f, "sFONT_RLE %sRle = {%u, %u, %s_Glyphs, %s_Runs};\n",
+                sources[s].name, font->Width, font->Height, sources[s].name,
+                sources[s].name);
+
+        fprintf(stderr, "%-7s %2ux%-2u: %5u B raw, %5u B run-length\n",
+                sources[s].name, font->Width, font->Height, raw,
+                bytes + table);
+        totalRaw += raw;
+        totalRle += bytes + table;
+    }
+    fclose(f);
+    fprintf(stderr, "Total: %u B raw, %u B run-length\n", totalRaw, totalRle);
+    return 0;
+}
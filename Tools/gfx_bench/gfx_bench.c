@@ -0,0 +1,179 @@
+/*
+ * gfx_bench.c
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * Host check and benchmark of the software 2D backend (Src/gfx.c), the
+ * reference the DMA2D backend is compared with by GFX_Benchmark().
+ *
+ * Build and run from the repository root:
+ *
+ *   cc -O2 -IInc -o gfx_bench Tools/gfx_bench/gfx_bench.c Src/gfx.c
+ *   ./gfx_bench [-n iterations] [-o out.ppm]
+ *
+ * Checks the edge cases of every operation (clipping, alpha 0 and 255,
+ * conversion of pure colors), then times them on a 320x240 canvas. With
+ * -o a composition of all operations is written as a PPM.
+ */
+
+#include "gfx.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define W 320U
+#define H 240U
+
+static uint16_t canvasPixels[H * W];
+static uint16_t rgb565[H * W];
+static uint8_t rgb888[H * W * 3];
+static uint8_t yuv422[H * W * 2];
+
+static double nowMs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static int check(int ok, const char* what)
+{
+    if (!ok)
+        fprintf(stderr, "FAILED: %s\n", what);
+    return ok ? 0 : 1;
+}
+
+static int selfTest(GFX_Canvas* c)
+{
+    uint16_t small[4 * 4];
+    GFX_Canvas s           = {small, 4, 4, 4};
+    const uint8_t red[3]   = {255, 0, 0};
+    const uint8_t white[4] = {255, 128, 255, 128};
+    uint16_t src[4]        = {0xF800, 0x07E0, 0x001F, 0xFFFF};
+    int failed             = 0;
+
+    GFX_Fill(&s, -2, -2, 4, 4, 0x1234);
+    failed += check(small[0] == 0x1234 && small[1] == 0x1234 &&
+                        small[2] != 0x1234 && small[8] != 0x1234,
+                    "fill clipped at the top left");
+    GFX_Fill(&s, 0, 0, 100, 100, 0);
+    GFX_Fill(&s, 3, 3, 5, 5, 0xFFFF);
+    failed += check(small[15] == 0xFFFF && small[14] == 0,
+                    "fill clipped at the bottom right");
+
+    GFX_ConvertRGB888(&s, 0, 0, red, 1, 1, 1);
+    failed += check(small[0] == 0xF800, "RGB888 red");
+    GFX_ConvertYUV422(&s, 0, 0, white, 2, 2, 1);
+    failed += check(small[0] == 0xFFFF && small[1] == 0xFFFF, "YUV422 white");
+
+    GFX_Fill(&s, 0, 0, 4, 4, 0x0000);
+    GFX_Blend(&s, 0, 0, src, 4, 4, 1, 255);
+    failed += check(memcmp(small, src, sizeof(src)) == 0, "blend alpha 255");
+    GFX_Blend(&s, 0, 0, src, 4, 4, 1, 0);
+    failed += check(memcmp(small, src, sizeof(src)) == 0, "blend alpha 0");
+    GFX_Fill(&s, 0, 0, 4, 4, 0x0000);
+    GFX_Blend(&s, 0, 0, src, 4, 4, 1, 128);
+    failed += check(small[3] == 0x8410, "blend white over black at 50%");
+
+    GFX_Copy(c, (int32_t)W - 2, 0, src, 4, 4, 1);
+    failed += check(c->pixels[W - 2] == 0xF800 && c->pixels[W - 1] == 0x07E0,
+                    "copy clipped at the right edge");
+    return failed;
+}
+
+int main(int argc, char** argv)
+{
+    const char* names[5] = {"fill", "copy", "RGB888", "YUV422", "blend"};
+    GFX_Canvas c         = {canvasPixels, W, H, W};
+    const char* out      = NULL;
+    int iterations       = 50;
+    int failed;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+            iterations = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+            out = argv[++i];
+        else
+        {
+            fprintf(stderr, "usage: %s [-n iterations] [-o out.ppm]\n",
+                    argv[0]);
+            return 2;
+        }
+    }
+
+    for (uint32_t i = 0; i < W * H; ++i)
+    {
+        uint32_t x = i % W, y = i / W;
+
+        // Gradients, U / V alternate in the odd bytes of YUV422
+        rgb565[i] = (uint16_t)((x * 31U / W) << 11 | (y * 63U / H) << 5);
+        rgb888[i * 3]     = (uint8_t)(x * 255U / W);
+        rgb888[i * 3 + 1] = (uint8_t)(255U - y * 255U / H);
+        rgb888[i * 3 + 2] = (uint8_t)((x + y) & 0xFFU);
+        yuv422[i * 2]     = (uint8_t)(y * 255U / H);
+        yuv422[i * 2 + 1] =
+            (uint8_t)(i & 1U ? x * 255U / W : 255U - x * 255U / W);
+    }
+
+    failed = selfTest(&c);
+    printf("Self test: %s\n", failed ? "FAILED" : "passed");
+
+    printf("Software backend, %ux%u, %d iterations [us per operation]\n", W, H,
+           iterations);
+    for (int op = 0; op < 5; ++op)
+    {
+        double start = nowMs();
+        for (int n = 0; n < iterations; ++n)
+        {
+            switch (op)
+            {
+                case 0:
+                    GFX_Fill(&c, 0, 0, W, H, 0x7BEF);
+                    break;
+                case 1:
+                    GFX_Copy(&c, 0, 0, rgb565, W, W, H);
+                    break;
+                case 2:
+                    GFX_ConvertRGB888(&c, 0, 0, rgb888, W, W, H);
+                    break;
+                case 3:
+                    GFX_ConvertYUV422(&c, 0, 0, yuv422, W, W, H);
+                    break;
+                default:
+                    GFX_Blend(&c, 0, 0, rgb565, W, W, H, 0x60);
+                    break;
+            }
+        }
+        printf("  %-6s %8.1f\n", names[op],
+               (nowMs() - start) * 1e3 / iterations);
+    }
+
+    if (out != NULL)
+    {
+        FILE* f = fopen(out, "wb");
+
+        // Quadrants: RGB888, YUV422, RGB565 and RGB565 blended over RGB888
+        GFX_ConvertRGB888(&c, 0, 0, rgb888, W, W / 2, H / 2);
+        GFX_ConvertYUV422(&c, W / 2, 0, yuv422, W, W / 2, H / 2);
+        GFX_Copy(&c, 0, H / 2, rgb565, W, W / 2, H / 2);
+        GFX_ConvertRGB888(&c, W / 2, H / 2, rgb888, W, W / 2, H / 2);
+        GFX_Blend(&c, W / 2, H / 2, rgb565, W, W / 2, H / 2, 0x80);
+        if (f == NULL)
+            return 1;
+        fprintf(f, "P6\n%u %u\n255\n", W, H);
+        for (uint32_t i = 0; i < W * H; ++i)
+        {
+            uint16_t p     = canvasPixels[i];
+            uint8_t rgb[3] = {(uint8_t)(((p >> 11) & 0x1FU) * 255U / 31U),
+                              (uint8_t)(((p >> 5) & 0x3FU) * 255U / 63U),
+                              (uint8_t)((p & 0x1FU) * 255U / 31U)};
+            fwrite(rgb, 1, 3, f);
+        }
+        fclose(f);
+    }
+    return failed != 0;
+}
@@ -0,0 +1,236 @@
+/*
+ * jpeg_bench.c
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * Host benchmark of the streaming JPEG decoder (Src/jpeg_decoder.c).
+ *
+ * Build and run from the repository root:
+ *
+ *   cc -O2 -IInc -o jpeg_bench Tools/jpeg_bench/jpeg_bench.c \
+ *      Src/jpeg_decoder.c
+ *   ./jpeg_bench [-n iterations] [-o out.ppm] readme/MinRes.jpg ...
+ *
+ * Every image is decoded the given number of times with a sink which only
+ * touches the pixels, the mean time per image and per MCU is printed. With
+ * -o the last image is also written as a PPM (RGB565 expanded to 8 bits)
+ * for a visual check.
+ *
+ *   ./jpeg_bench -t
+ *
+ * checks that damaged headers are rejected without touching memory outside
+ * of the decoder (build with -fsanitize=address,undefined to be sure).
+ */
+
+#include "jpeg_decoder.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+typedef struct
+{
+    uint8_t* rgb; ///< width * height * 3, NULL when not saving
+    uint32_t width;
+    uint32_t checksum;
+} BenchSink;
+
+static int benchSink(void* context, const uint16_t* pixels, uint16_t x,
+                     uint16_t y, uint16_t width, uint16_t height)
+{
+    BenchSink* s = context;
+
+    for (uint32_t row = 0; row < height; ++row)
+    {
+        for (uint32_t col = 0; col < width; ++col)
+        {
+            uint16_t p = pixels[row * width + col];
+            s->checksum = s->checksum * 31U + p;
+            if (s->rgb != NULL)
+            {
+                uint8_t* d = &s->rgb[((y + row) * s->width + x + col) * 3U];
+                d[0]       = (uint8_t)(((p >> 11) & 0x1FU) * 255U / 31U);
+                d[1]       = (uint8_t)(((p >> 5) & 0x3FU) * 255U / 63U);
+                d[2]       = (uint8_t)((p & 0x1FU) * 255U / 31U);
+            }
+        }
+    }
+    return 0;
+}
+
+static double nowMs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static uint8_t* readFile(const char* path, uint32_t* length)
+{
+    FILE* f = fopen(path, "rb");
+    uint8_t* data;
+    long size;
+
+    if (f == NULL)
+        return NULL;
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    data = malloc((size_t)size);
+    if (data != NULL && fread(data, 1, (size_t)size, f) != (size_t)size)
+    {
+        free(data);
+        data = NULL;
+    }
+    fclose(f);
+    *length = (uint32_t)size;
+    return data;
+}
+
+/**
+ * Decodes SOI, one DHT segment with the given code length counts and EOI.
+ * @return Status of JPEG_Decode().
+ */
+static JPEG_Status decodeDht(JPEG_Decoder* dec, const uint8_t counts[16])
+{
+    static uint8_t data[4 + 2 + 17 + 256 + 2];
+    uint32_t total = 0, length = 0;
+
+    for (uint32_t i = 0; i < 16U; ++i)
+        total += counts[i];
+    data[length++] = 0xFF;
+    data[length++] = 0xD8;
+    data[length++] = 0xFF;
+    data[length++] = 0xC4;
+    data[length++] = (uint8_t)((2U + 17U + total) >> 8);
+    data[length++] = (uint8_t)(2U + 17U + total);
+    data[length++] = 0x00; // DC table 0
+    memcpy(&data[length], counts, 16);
+    length += 16U;
+    for (uint32_t i = 0; i < total; ++i)
+        data[length++] = (uint8_t)i;
+    data[length++] = 0xFF;
+    data[length++] = 0xD9;
+    JPEG_Init(dec, 0);
+    return JPEG_Decode(dec, data, length, benchSink, NULL);
+}
+
+static int selfTest(void)
+{
+    // Code lengths which do not form a prefix code, in and beyond the
+    // lookup table
+    static const struct
+    {
+        const char* name;
+        uint8_t counts[16];
+    } invalid[] = {
+        {"200 codes of 1 bit", {200}},
+        {"3 codes of 1 bit", {3}},
+        {"2 of 1 bit, 1 of 2 bits", {2, 1}},
+        {"255 codes of 4 bits", {0, 0, 0, 255}},
+        {"255 codes of 7 bits", {0, 0, 0, 0, 0, 0, 255}},
+        {"1 of 1 bit, 200 of 9 bits", {1, 0, 0, 0, 0, 0, 0, 0, 200}},
+    };
+    static JPEG_Decoder dec;
+    int failures = 0;
+
+    for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i)
+    {
+        if (decodeDht(&dec, invalid[i].counts) != JPEG_ERR_FORMAT)
+        {
+            printf("FAIL accepted DHT: %s\n", invalid[i].name);
+            failures++;
+        }
+    }
+    printf("%s: %d failure(s)\n", failures ? "FAILED" : "passed", failures);
+    return failures ? 1 : 0;
+}
+
+int main(int argc, char** argv)
+{
+    static JPEG_Decoder dec;
+    const char* out = NULL;
+    int iterations  = 20;
+    int result      = 0;
+    int i;
+
+    if (argc == 2 && strcmp(argv[1], "-t") == 0)
+        return selfTest();
+    for (i = 1; i < argc && argv[i][0] == '-'; ++i)
+    {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+            iterations = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+            out = argv[++i];
+        else
+            break;
+    }
+    if (i == argc || iterations < 1)
+    {
+        fprintf(stderr,
+                "usage: %s [-n iterations] [-o out.ppm] image.jpg ...\n"
+                "       %s -t\n",
+                argv[0], argv[0]);
+        return 2;
+    }
+
+    printf("Decoder working memory: %zu bytes\n", sizeof(dec));
+    for (; i < argc; ++i)
+    {
+        uint32_t length;
+        uint8_t* data = readFile(argv[i], &length);
+        BenchSink sink = {0};
+        JPEG_Status status;
+        double start, elapsed;
+
+        if (data == NULL)
+        {
+            fprintf(stderr, "%s: cannot read\n", argv[i]);
+            result = 1;
+            continue;
+        }
+
+        JPEG_Init(&dec, 0);
+        start = nowMs();
+        for (int n = 0; n < iterations; ++n)
+        {
+            sink.checksum = 0;
+            status        = JPEG_Decode(&dec, data, length, benchSink, &sink);
+        }
+        elapsed = (nowMs() - start) / iterations;
+
+        if (status != JPEG_OK)
+        {
+            fprintf(stderr, "%s: decoding failed (%d)\n", argv[i], status);
+            result = 1;
+        }
+        else
+        {
+            printf("%s: %ux%u, %u bytes, %lu MCUs: %.3f ms/image, "
+                   "%.3f us/MCU, checksum %08x\n",
+                   argv[i], dec.width, dec.height, length,
+                   (unsigned long)dec.mcuCount, elapsed,
+                   elapsed * 1e3 / dec.mcuCount, sink.checksum);
+        }
+
+        if (status == JPEG_OK && out != NULL && i == argc - 1)
+        {
+            FILE* f;
+
+            sink.width = dec.width;
+            sink.rgb   = malloc((size_t)dec.width * dec.height * 3U);
+            JPEG_Decode(&dec, data, length, benchSink, &sink);
+            f = fopen(out, "wb");
+            if (f != NULL)
+            {
+                fprintf(f, "P6\n%u %u\n255\n", dec.width, dec.height);
+                fwrite(sink.rgb, 3, (size_t)dec.width * dec.height, f);
+                fclose(f);
+            }
+            free(sink.rgb);
+        }
+        free(data);
+    }
+    return result;
+}
@@ -0,0 +1,307 @@
+/*
+ * lcd_readback.c
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * Host counterpart of the GRAM readback path (LCD_ReadWindow(),
+ * GUI_Screenshot()).
+ *
+ * Build from the repository root:
+ *
+ *   cc -O2 -IILI9486 -o lcd_readback Tools/lcd_readback/lcd_readback.c
+ *
+ * Emulator:
+ *
+ *   ./lcd_readback -e
+ *
+ * Models the ILI9486 serial interface (column / page window, 0x2C memory
+ * write, 0x2E memory read with its dummy byte and 3 byte pixels), writes
+ * test patterns with the command sequence of the driver, reads them back
+ * line by line as LCD_ReadRegion() does and compares. It also prints the
+ * full screen write and read times expected from the SPI clocks and the
+ * bytes on the wire.
+ *
+ * Screenshot:
+ *
+ *   ./lcd_readback capture.bin out.ppm
+ *
+ * Converts the UART stream of GUI_Screenshot() (format in LCD_Gram.h) to a
+ * PPM image.
+ */
+
+#include "LCD_Gram.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define EMU_COLUMNS 480U
+#define EMU_PAGES 320U
+
+/// SCK of SPI2: 52.5 MHz APB1 (210 MHz SYSCLK / 4) / 2 for writes, / 16 for
+/// reads
+#define WRITE_HZ 26250000.0
+#define READ_HZ 3281250.0
+
+/// Controller state seen through the serial interface
+typedef struct
+{
+    uint16_t gram[EMU_PAGES][EMU_COLUMNS];
+    uint16_t xs, xe, ys, ye; ///< Window, inclusive
+    uint16_t x, y;           ///< Memory pointer
+    uint8_t command;
+    uint8_t params;          ///< Parameter words received
+    uint16_t value[4];
+    uint8_t readBytes;       ///< Bytes of the current read pixel sent
+    uint8_t dummy;           ///< Dummy bytes left before the first pixel
+    uint64_t writeBytes;     ///< Bytes clocked in (SPI write clock)
+    uint64_t readClocked;    ///< Bytes clocked out (SPI read clock)
+} Emu;
+
+static void emuNext(Emu* e)
+{
+    if (++e->x > e->xe)
+    {
+        e->x = e->xs;
+        if (++e->y > e->ye)
+            e->y = e->ys;
+    }
+}
+
+/// Command byte (DC low)
+static void emuCommand(Emu* e, uint8_t command)
+{
+    e->command = command;
+    e->params  = 0;
+    e->writeBytes += 1;
+    if (command == 0x2C || command == 0x2E)
+    {
+        e->x         = e->xs;
+        e->y         = e->ys;
+        e->readBytes = 0;
+        e->dummy     = LCD_GRAM_READ_DUMMY;
+    }
+}
+
+/// Parameter or pixel word (DC high), 0x00 + byte for parameters
+static void emuWord(Emu* e, uint16_t word)
+{
+    e->writeBytes += 2;
+    if (e->command == 0x2C)
+    {
+        if (e->x < EMU_COLUMNS && e->y < EMU_PAGES)
+            e->gram[e->y][e->x] = word;
+        emuNext(e);
+        return;
+    }
+    if ((e->command == 0x2A || e->command == 0x2B) && e->params < 4)
+    {
+        e->value[e->params++] = word & 0xFFU;
+        if (e->params == 4)
+        {
+            uint16_t start = (uint16_t)(e->value[0] << 8 | e->value[1]);
+            uint16_t end   = (uint16_t)(e->value[2] << 8 | e->value[3]);
+            if (e->command == 0x2A)
+            {
+                e->xs = start;
+                e->xe = end;
+            }
+            else
+            {
+                e->ys = start;
+                e->ye = end;
+            }
+        }
+    }
+}
+
+/// Byte clocked out during 0x2E
+static uint8_t emuRead(Emu* e)
+{
+    uint8_t rgb[LCD_GRAM_READ_BYTES];
+    uint8_t byte;
+
+    e->readClocked += 1;
+    if (e->command != 0x2E)
+        return 0xFF;
+    if (e->dummy)
+    {
+        e->dummy--;
+        return 0x00;
+    }
+    LCD_Rgb565ToGram(e->gram[e->y][e->x], rgb);
+    byte = rgb[e->readBytes];
+    if (++e->readBytes == LCD_GRAM_READ_BYTES)
+    {
+        e->readBytes = 0;
+        emuNext(e);
+    }
+    return byte;
+}
+
+/// 0x2A / 0x2B as sent by LCD_AddressRange(), end exclusive
+static void hostWindow(Emu* e, uint16_t xs, uint16_t ys, uint16_t xe,
+                       uint16_t ye)
+{
+    emuCommand(e, 0x2A);
+    emuWord(e, xs >> 8);
+    emuWord(e, xs & 0xFFU);
+    emuWord(e, (uint16_t)(xe - 1U) >> 8);
+    emuWord(e, (uint16_t)(xe - 1U) & 0xFFU);
+    emuCommand(e, 0x2B);
+    emuWord(e, ys >> 8);
+    emuWord(e, ys & 0xFFU);
+    emuWord(e, (uint16_t)(ye - 1U) >> 8);
+    emuWord(e, (uint16_t)(ye - 1U) & 0xFFU);
+}
+
+/// LCD_WriteWindow()
+static void hostWrite(Emu* e, uint16_t xs, uint16_t ys, uint16_t xe,
+                      uint16_t ye, const uint16_t* pixels)
+{
+    hostWindow(e, xs, ys, xe, ye);
+    emuCommand(e, 0x2C);
+    for (uint32_t i = 0; i < (uint32_t)(xe - xs) * (ye - ys); ++i)
+        emuWord(e, pixels[i]);
+}
+
+/// LCD_ReadWindow()
+static void hostRead(Emu* e, uint16_t xs, uint16_t ys, uint16_t xe,
+                     uint16_t ye, uint16_t* pixels)
+{
+    uint8_t raw[LCD_GRAM_READ_BYTES];
+
+    hostWindow(e, xs, ys, xe, ye);
+    emuCommand(e, 0x2E);
+    for (uint32_t i = 0; i < LCD_GRAM_READ_DUMMY; ++i)
+        emuRead(e);
+    for (uint32_t i = 0; i < (uint32_t)(xe - xs) * (ye - ys); ++i)
+    {
+        for (uint32_t b = 0; b < LCD_GRAM_READ_BYTES; ++b)
+            raw[b] = emuRead(e);
+        pixels[i] = LCD_GramToRgb565(raw);
+    }
+}
+
+static int emulate(void)
+{
+    static Emu emu;
+    static uint16_t line[EMU_COLUMNS];
+    uint32_t errors     = 0;
+    uint32_t seed       = 1;
+    uint64_t writeBytes = 0, readCommands = 0, readBytes = 0;
+
+    for (int pattern = 0; pattern < 2; ++pattern)
+    {
+        // Gradient as LCD_BenchmarkReadback(), then noise
+        for (uint16_t y = 0; y < EMU_PAGES; ++y)
+        {
+            for (uint16_t x = 0; x < EMU_COLUMNS; ++x)
+            {
+                seed    = seed * 1103515245U + 12345U;
+                line[x] = pattern == 0 ? (uint16_t)(x * 0x0841U)
+                                       : (uint16_t)(seed >> 16);
+            }
+            hostWrite(&emu, 0, y, EMU_COLUMNS, y + 1U, line);
+        }
+        if (pattern == 0)
+            writeBytes = emu.writeBytes;
+        for (uint16_t y = 0; y < EMU_PAGES; ++y)
+        {
+            hostRead(&emu, 0, y, EMU_COLUMNS, y + 1U, line);
+            for (uint16_t x = 0; x < EMU_COLUMNS; ++x)
+                errors += line[x] != emu.gram[y][x];
+        }
+        if (pattern == 0)
+        {
+            // Window commands of the reads still use the write clock
+            readCommands = emu.writeBytes - writeBytes;
+            readBytes    = emu.readClocked;
+        }
+    }
+
+    // A region inside of the screen, window arithmetic of the driver
+    hostRead(&emu, 100, 50, 164, 51, line);
+    for (uint16_t x = 0; x < 64; ++x)
+        errors += line[x] != emu.gram[50][100 + x];
+
+    printf("Round trip: %u pixel errors\n", errors);
+    printf("Full screen line by line, bytes on the wire: write %llu, read "
+           "%llu + %llu\n",
+           (unsigned long long)writeBytes, (unsigned long long)readCommands,
+           (unsigned long long)readBytes);
+    printf("Expected time: write %.1f ms at %.2f MHz, read %.1f ms at "
+           "%.3f MHz\n",
+           writeBytes * 8.0 / WRITE_HZ * 1e3, WRITE_HZ / 1e6,
+           (readCommands * 8.0 / WRITE_HZ + readBytes * 8.0 / READ_HZ) * 1e3,
+           READ_HZ / 1e6);
+    return errors != 0;
+}
+
+static int convert(const char* in, const char* out)
+{
+    FILE* f = fopen(in, "rb");
+    uint8_t header[LCD_SHOT_HEADER_BYTES];
+    uint32_t width, height;
+    uint8_t* rgb;
+    int result = 0;
+
+    if (f == NULL)
+    {
+        fprintf(stderr, "%s: cannot read\n", in);
+        return 1;
+    }
+    if (fread(header, 1, sizeof(header), f) != sizeof(header) ||
+        memcmp(header, LCD_SHOT_MAGIC, 4) != 0)
+    {
+        fprintf(stderr, "%s: not a screenshot stream\n", in);
+        fclose(f);
+        return 1;
+    }
+    width  = header[4] | (uint32_t)header[5] << 8;
+    height = header[6] | (uint32_t)header[7] << 8;
+    rgb    = calloc((size_t)width * height, 3);
+
+    for (uint32_t i = 0; rgb != NULL && i < width * height; ++i)
+    {
+        uint8_t px[2];
+        uint16_t p;
+
+        if (fread(px, 1, 2, f) != 2)
+        {
+            fprintf(stderr, "%s: truncated after %u pixels\n", in, i);
+            result = 1;
+            break;
+        }
+        p              = (uint16_t)(px[0] | px[1] << 8);
+        rgb[i * 3]     = (uint8_t)(((p >> 11) & 0x1FU) * 255U / 31U);
+        rgb[i * 3 + 1] = (uint8_t)(((p >> 5) & 0x3FU) * 255U / 63U);
+        rgb[i * 3 + 2] = (uint8_t)((p & 0x1FU) * 255U / 31U);
+    }
+    fclose(f);
+
+    f = rgb != NULL ? fopen(out, "wb") : NULL;
+    if (f == NULL)
+    {
+        fprintf(stderr, "%s: cannot write\n", out);
+        free(rgb);
+        return 1;
+    }
+    fprintf(f, "P6\n%u %u\n255\n", width, height);
+    fwrite(rgb, 3, (size_t)width * height, f);
+    fclose(f);
+    free(rgb);
+    printf("%s: %ux%u\n", out, width, height);
+    return result;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc == 2 && strcmp(argv[1], "-e") == 0)
+        return emulate();
+    if (argc == 3)
+        return convert(argv[1], argv[2]);
+    fprintf(stderr, "usage: %s -e\n       %s capture.bin out.ppm\n", argv[0],
+            argv[0]);
+    return 2;
+}
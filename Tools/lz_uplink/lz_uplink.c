@@ -0,0 +1,434 @@
+/*
+ * lz_uplink.c
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * Host decompressor and benchmark of the compressed UART uplink
+ * (Src/lz_compress.c).
+ *
+ * Build from the repository root:
+ *
+ *   cc -O2 -IInc -o lz_uplink Tools/lz_uplink/lz_uplink.c \
+ *      Src/lz_compress.c Src/jpeg_decoder.c
+ *
+ * Benchmark:
+ *
+ *   ./lz_uplink -b [-n iterations] readme/MinRes.jpg readme/7.jpg ...
+ *
+ * Every image is streamed as the camera sends it (JPEG) and, decoded, as
+ * the raw RGB565 and YUV422 frames of the other modes. Each stream is
+ * decompressed and compared with its input, then the ratio, the
+ * compression speed and cycles per byte (TSC, x86 hosts) are printed.
+ * Decoded JPEGs are smoother than raw sensor frames, the raw ratios are
+ * an upper bound.
+ *
+ * Decompressor:
+ *
+ *   ./lz_uplink capture.bin prefix
+ *
+ * Finds the LZ4 frames in a UART capture (text lines in between are
+ * skipped), decompresses them and writes prefix_NNNN.jpg, .fdlt (delta
+ * records, see Tools/frame_delta) or .bin depending on the content. The
+ * frames also decompress with the lz4 command line tool.
+ */
+
+#include "jpeg_decoder.h"
+#include "lz_compress.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#endif
+
+/// FLG bits of the LZ4 frame descriptor
+#define FLG_VERSION_MASK 0xC0U
+#define FLG_VERSION 0x40U
+#define FLG_BLOCK_CHECKSUM 0x10U
+#define FLG_CONTENT_SIZE 0x08U
+#define FLG_CONTENT_CHECKSUM 0x04U
+#define FLG_DICT_ID 0x01U
+
+typedef struct
+{
+    uint16_t* rgb;
+    uint32_t width;
+} Canvas;
+
+static double nowMs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static uint64_t cycles(void)
+{
+#ifdef HAVE_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+static uint8_t* readFile(const char* path, uint32_t* length)
+{
+    FILE* f = fopen(path, "rb");
+    uint8_t* data;
+    long size;
+
+    if (f == NULL)
+        return NULL;
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    data = malloc((size_t)size + 1U);
+    if (data != NULL && fread(data, 1, (size_t)size, f) != (size_t)size)
+    {
+        free(data);
+        data = NULL;
+    }
+    fclose(f);
+    *length = (uint32_t)size;
+    return data;
+}
+
+static uint32_t get32(const uint8_t* p)
+{
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 |
+           (uint32_t)p[3] << 24;
+}
+
+/**
+ * Decompresses one LZ4 frame.
+ * @param data Frame, starting with the magic.
+ * @param size Bytes available at data.
+ * @param out Set to the malloc'ed content.
+ * @param outLength Set to its length.
+ * @return Frame bytes, 0 on a frame which is damaged or truncated.
+ */
+static uint32_t decodeFrame(const uint8_t* data, uint32_t size, uint8_t** out,
+                            uint32_t* outLength)
+{
+    uint32_t pos = 6, length = 0, capacity = 1U << 16;
+    uint8_t flg, bd;
+    uint8_t* buffer;
+
+    if (size < 7U || get32(data) != LZ_FRAME_MAGIC)
+        return 0;
+    flg = data[4];
+    bd  = data[5];
+    if ((flg & FLG_VERSION_MASK) != FLG_VERSION || (flg & FLG_DICT_ID) ||
+        ((bd >> 4) & 7U) < 4U)
+        return 0;
+    if (flg & FLG_CONTENT_SIZE)
+    {
+        if (size < pos + 8U)
+            return 0;
+        capacity = get32(&data[pos]) + 1U;
+        pos += 8U;
+    }
+    if (size < pos + 1U ||
+        data[pos] != (uint8_t)(LZ_Xxh32(&data[4], pos - 4U, 0) >> 8))
+        return 0;
+    pos++;
+
+    buffer = malloc(capacity);
+    while (buffer != NULL)
+    {
+        uint32_t word, blockSize;
+
+        if (size < pos + 4U)
+            break;
+        word = get32(&data[pos]);
+        pos += 4U;
+        if (word == 0U)
+        {
+            if (flg & FLG_CONTENT_CHECKSUM)
+            {
+                if (size < pos + 4U ||
+                    get32(&data[pos]) != LZ_Xxh32(buffer, length, 0))
+                    break;
+                pos += 4U;
+            }
+            *out       = buffer;
+            *outLength = length;
+            return pos;
+        }
+
+        blockSize = word & ~LZ_BLOCK_STORED;
+        if (size - pos < blockSize +
+                             (flg & FLG_BLOCK_CHECKSUM ? 4U : 0U))
+            break;
+        if (capacity - length < LZ_MAX_BLOCK * 64U)
+        {
+            uint8_t* grown;
+
+            capacity = length + LZ_MAX_BLOCK * 64U;
+            grown    = realloc(buffer, capacity);
+            if (grown == NULL)
+                break;
+            buffer = grown;
+        }
+        if (word & LZ_BLOCK_STORED)
+        {
+            memcpy(&buffer[length], &data[pos], blockSize);
+            length += blockSize;
+        }
+        else
+        {
+            int32_t n = LZ_DecompressBlock(&data[pos], blockSize,
+                                           &buffer[length],
+                                           capacity - length);
+            if (n < 0)
+                break;
+            length += (uint32_t)n;
+        }
+        pos += blockSize + (flg & FLG_BLOCK_CHECKSUM ? 4U : 0U);
+    }
+    free(buffer);
+    return 0;
+}
+
+/**
+ * Streams data in chunks as the uplink does.
+ * @return Stream bytes, 0 on an error.
+ */
+static uint32_t compress(const uint8_t* data, uint32_t length, uint8_t* out,
+                         uint32_t capacity, uint32_t* stored)
+{
+    static uint8_t chunk[LZ_CHUNK_BYTES(LZ_BLOCK_SIZE)];
+    LZ_Stream stream;
+    uint32_t n, total = 0;
+
+    if (LZ_StreamInit(&stream, data, length, LZ_BLOCK_SIZE))
+        return 0;
+    while ((n = LZ_StreamNext(&stream, chunk, sizeof(chunk))) != 0U)
+    {
+        if (capacity - total < n)
+            return 0;
+        memcpy(&out[total], chunk, n);
+        total += n;
+    }
+    *stored = stream.stored;
+    return total;
+}
+
+/**
+ * Compresses, checks and times one stream.
+ * @return 1 on a failed round trip.
+ */
+static int bench(const char* name, const char* kind, const uint8_t* data,
+                 uint32_t length, int iterations)
+{
+    uint32_t capacity = length + length / LZ_BLOCK_SIZE * 4U + 64U;
+    uint8_t* stream   = malloc(capacity);
+    uint8_t* back     = NULL;
+    uint32_t streamBytes = 0, backLength = 0, stored = 0;
+    double start, elapsed;
+    uint64_t c0, c1;
+    int failed;
+
+    start = nowMs();
+    c0    = cycles();
+    for (int n = 0; n < iterations; ++n)
+        streamBytes = compress(data, length, stream, capacity, &stored);
+    c1      = cycles();
+    elapsed = (nowMs() - start) / iterations;
+
+    failed = streamBytes == 0U ||
+             decodeFrame(stream, streamBytes, &back, &backLength) !=
+                 streamBytes ||
+             backLength != length || memcmp(back, data, length) != 0;
+    printf("%-20s %-6s %8u -> %8u  %5.1f%%  %7.1f MB/s", name, kind, length,
+           streamBytes, streamBytes * 100.0 / length,
+           length / (elapsed * 1e3));
+#ifdef HAVE_TSC
+    printf("  %5.1f cycles/byte", (double)(c1 - c0) / iterations / length);
+#else
+    (void)c0;
+    (void)c1;
+#endif
+    printf("  %u stored%s\n", stored, failed ? "  ROUND TRIP FAILED" : "");
+    free(stream);
+    free(back);
+    return failed;
+}
+
+static int canvasSink(void* context, const uint16_t* pixels, uint16_t x,
+                      uint16_t y, uint16_t width, uint16_t height)
+{
+    Canvas* c = context;
+
+    for (uint32_t row = 0; row < height; ++row)
+        memcpy(&c->rgb[(y + row) * c->width + x], &pixels[row * width],
+               width * sizeof(uint16_t));
+    return 0;
+}
+
+static uint8_t clampByte(int32_t v)
+{
+    return (uint8_t)(v < 0 ? 0 : v > 255 ? 255 : v);
+}
+
+/**
+ * RGB565 to YUV422 (Y0 U Y1 V, BT.601), the layout of the YUV modes.
+ */
+static void toYuv422(const uint16_t* rgb, uint32_t pixels, uint8_t* yuv)
+{
+    for (uint32_t i = 0; i + 1U < pixels; i += 2U)
+    {
+        int32_t y[2], u = 0, v = 0;
+
+        for (uint32_t k = 0; k < 2U; ++k)
+        {
+            uint16_t p = rgb[i + k];
+            int32_t r  = ((p >> 11) & 0x1F) * 255 / 31;
+            int32_t g  = ((p >> 5) & 0x3F) * 255 / 63;
+            int32_t b  = (p & 0x1F) * 255 / 31;
+
+            y[k] = (66 * r + 129 * g + 25 * b + 128) / 256 + 16;
+            u += (-38 * r - 74 * g + 112 * b + 128) / 256 + 128;
+            v += (112 * r - 94 * g - 18 * b + 128) / 256 + 128;
+        }
+        yuv[i * 2U]      = clampByte(y[0]);
+        yuv[i * 2U + 1U] = clampByte(u / 2);
+        yuv[i * 2U + 2U] = clampByte(y[1]);
+        yuv[i * 2U + 3U] = clampByte(v / 2);
+    }
+}
+
+static int benchmark(int argc, char** argv)
+{
+    static JPEG_Decoder dec;
+    int iterations = 20;
+    int failed     = 0;
+    int i          = 2;
+
+    if (i + 1 < argc && strcmp(argv[i], "-n") == 0)
+    {
+        iterations = atoi(argv[i + 1]);
+        i += 2;
+    }
+    if (i == argc || iterations < 1)
+    {
+        fprintf(stderr, "usage: %s -b [-n iterations] image.jpg ...\n",
+                argv[0]);
+        return 2;
+    }
+
+    printf("Blocks of %u bytes, hash table %zu bytes\n", LZ_BLOCK_SIZE,
+           (size_t)LZ_HASH_SIZE * sizeof(uint16_t));
+    for (; i < argc; ++i)
+    {
+        const char* name = strrchr(argv[i], '/') ? strrchr(argv[i], '/') + 1
+                                                 : argv[i];
+        uint32_t length;
+        uint8_t* data = readFile(argv[i], &length);
+        Canvas canvas = {0};
+        uint8_t* yuv;
+        uint32_t pixels;
+
+        if (data == NULL)
+        {
+            fprintf(stderr, "%s: cannot read\n", argv[i]);
+            failed = 1;
+            continue;
+        }
+        failed |= bench(name, "JPEG", data, length, iterations);
+
+        // Size from a first pass, then decoded into the canvas
+        JPEG_Init(&dec, 0);
+        JPEG_Decode(&dec, data, length, NULL, NULL);
+        pixels       = (uint32_t)dec.width * dec.height;
+        canvas.width = dec.width;
+        canvas.rgb   = calloc(pixels, sizeof(uint16_t));
+        yuv          = malloc(pixels * 2U);
+        JPEG_Init(&dec, 0);
+        if (pixels == 0U || canvas.rgb == NULL || yuv == NULL ||
+            JPEG_Decode(&dec, data, length, canvasSink, &canvas) != JPEG_OK)
+        {
+            fprintf(stderr, "%s: cannot decode\n", argv[i]);
+            failed = 1;
+        }
+        else
+        {
+            toYuv422(canvas.rgb, pixels, yuv);
+            failed |= bench(name, "RGB565", (const uint8_t*)canvas.rgb,
+                            pixels * 2U, iterations);
+            failed |= bench(name, "YUV422", yuv, pixels * 2U, iterations);
+        }
+        free(canvas.rgb);
+        free(yuv);
+        free(data);
+    }
+    return failed;
+}
+
+static int decompress(const char* in, const char* prefix)
+{
+    uint32_t size, frames = 0, errors = 0;
+    uint8_t* data = readFile(in, &size);
+
+    if (data == NULL)
+    {
+        fprintf(stderr, "%s: cannot read\n", in);
+        return 1;
+    }
+    for (uint32_t at = 0; at + 4U <= size; ++at)
+    {
+        uint8_t* content;
+        uint32_t length, used;
+        const char* ext;
+        char path[512];
+        FILE* f;
+
+        if (get32(&data[at]) != LZ_FRAME_MAGIC)
+            continue;
+        used = decodeFrame(&data[at], size - at, &content, &length);
+        if (used == 0U)
+        {
+            fprintf(stderr, "offset %u: damaged frame\n", at);
+            errors++;
+            continue;
+        }
+        ext = length >= 2U && content[0] == 0xFF && content[1] == 0xD8
+                  ? "jpg"
+              : length >= 4U && memcmp(content, "FDLT", 4) == 0 ? "fdlt"
+                                                                 : "bin";
+        snprintf(path, sizeof(path), "%s_%04u.%s", prefix, frames, ext);
+        f = fopen(path, "wb");
+        if (f == NULL || fwrite(content, 1, length, f) != length)
+        {
+            fprintf(stderr, "%s: cannot write\n", path);
+            errors++;
+        }
+        if (f != NULL)
+            fclose(f);
+        printf("%s: %u bytes from %u, %.1f%%\n", path, length, used,
+               length ? used * 100.0 / length : 0.0);
+        free(content);
+        frames++;
+        at += used - 1U;
+    }
+    free(data);
+    if (frames == 0U)
+        fprintf(stderr, "%s: no LZ4 frame found\n", in);
+    return errors != 0U || frames == 0U;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc >= 2 && strcmp(argv[1], "-b") == 0)
+        return benchmark(argc, argv);
+    if (argc == 3)
+        return decompress(argv[1], argv[2]);
+    fprintf(stderr,
+            "usage: %s -b [-n iterations] image.jpg ...\n"
+            "       %s capture.bin prefix\n",
+            argv[0], argv[0]);
+    return 2;
+}
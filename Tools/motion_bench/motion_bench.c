@@ -0,0 +1,151 @@
+/*
+ * motion_bench.c
+ *
+ *  Created on: Oct 19, 2026
+ *
+ * Host check and benchmark of the motion detector (Src/motion.c).
+ *
+ * Build and run from the repository root:
+ *
+ *   cc -O2 -IInc -o motion_bench Tools/motion_bench/motion_bench.c \
+ *      Src/motion.c
+ *   ./motion_bench [-n iterations]
+ *
+ * Feeds synthetic 160x120 YUV422 frames (textured background with sensor
+ * noise) and checks that a still scene raises no event, that a square
+ * moving across it is reported with a bounding box around it, and that it
+ * becomes background once it stops. Then times MOTION_Process() per
+ * frame.
+ */
+
+#include "motion.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define W 160U
+#define H 120U
+#define SQUARE 24U
+
+static uint32_t frameWords[W * H / 2];
+static uint8_t* const frame = (uint8_t*)frameWords;
+static uint32_t seed        = 1;
+
+static double nowMs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static int check(int ok, const char* what)
+{
+    if (!ok)
+        fprintf(stderr, "FAILED: %s\n", what);
+    return ok ? 0 : 1;
+}
+
+/**
+ * Renders the scene, with a bright square at (sx, sy) when sx >= 0.
+ */
+static void render(int sx, int sy)
+{
+    for (uint32_t y = 0; y < H; ++y)
+    {
+        for (uint32_t x = 0; x < W; ++x)
+        {
+            int inside = sx >= 0 && (int)x >= sx && (int)x < sx + (int)SQUARE &&
+                         (int)y >= sy && (int)y < sy + (int)SQUARE;
+            int32_t luma =
+                inside ? 230 : 60 + (int32_t)((x / 8 + y / 8) % 4) * 20;
+
+            seed = seed * 1103515245U + 12345U;
+            luma += (int32_t)((seed >> 16) % 9U) - 4;
+            frame[(y * W + x) * 2]     = (uint8_t)luma;
+            frame[(y * W + x) * 2 + 1] = 128;
+        }
+    }
+}
+
+static int selfTest(void)
+{
+    MOTION_Event event;
+    MOTION_Stats stats;
+    int failed = 0, events = 0, boxed = 0;
+
+    MOTION_Init(NULL);
+    for (int n = 0; n < 30; ++n)
+    {
+        render(-1, 0);
+        events += MOTION_Process(frame, W, H, &event) == MOTION_DETECTED;
+    }
+    failed += check(events == 0, "still scene with noise");
+
+    render(-1, 0);
+    failed += check(MOTION_Process(frame, W + 1U, H, &event) ==
+                        MOTION_BAD_FRAME,
+                    "odd width rejected");
+
+    // Moves right by 8 pixels a frame, events are held off in between
+    for (int n = 0; n < 12; ++n)
+    {
+        int sx = 10 + n * 8, sy = 50;
+
+        render(sx, sy);
+        if (MOTION_Process(frame, W, H, &event) != MOTION_DETECTED)
+            continue;
+        events++;
+        boxed += event.x <= sx + SQUARE && event.x + event.width >= sx &&
+                 event.y <= sy && event.y + event.height >= sy + SQUARE &&
+                 event.height <= SQUARE + 2U * 12U;
+    }
+    failed += check(events >= 1, "moving square detected");
+    failed += check(boxed == events, "bounding box covers the square");
+
+    // Parked, absorbed by the background at the slow rate
+    events = 0;
+    for (int n = 0; n < 2000; ++n)
+    {
+        render(98, 50);
+        events += MOTION_Process(frame, W, H, &event) == MOTION_DETECTED &&
+                  n >= 1500;
+    }
+    MOTION_GetStats(&stats);
+    failed += check(events == 0 && stats.lastBlocks == 0,
+                    "stopped square becomes background");
+    return failed;
+}
+
+int main(int argc, char** argv)
+{
+    MOTION_Event event;
+    int iterations = 2000;
+    int failed;
+    double start;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+            iterations = atoi(argv[++i]);
+        else
+        {
+            fprintf(stderr, "usage: %s [-n iterations]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    failed = selfTest();
+    printf("Self test: %s\n", failed ? "FAILED" : "passed");
+
+    MOTION_Init(NULL);
+    render(40, 40);
+    start = nowMs();
+    for (int n = 0; n < iterations; ++n)
+        MOTION_Process(frame, W, H, &event);
+    printf("%ux%u YUV422 to %ux%u luma, %u blocks: %.2f us per frame\n", W,
+           H, MOTION_WIDTH, MOTION_HEIGHT, MOTION_BLOCKS_X * MOTION_BLOCKS_Y,
+           (nowMs() - start) * 1e3 / iterations);
+    return failed != 0;
+}
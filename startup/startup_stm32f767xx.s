@@ -105,6 +105,51 @@ LoopFillZerobss:
   cmp  r2, r3
   bcc  FillZerobss
 
+/* Copy the hot code from flash to ITCM RAM */
+  ldr  r0, =_sitcm
+  ldr  r1, =_eitcm
+  ldr  r2, =_siitcm
+  b  LoopCopyItcm
+
+CopyItcm:
+  ldr  r3, [r2], #4
+  str  r3, [r0], #4
+
+LoopCopyItcm:
+  cmp  r0, r1
+  bcc  CopyItcm
+
+/* Copy the DTCM data initializers from flash */
+  ldr  r0, =_sdtcm
+  ldr  r1, =_edtcm
+  ldr  r2, =_sidtcm
+  b  LoopCopyDtcm
+
+CopyDtcm:
+  ldr  r3, [r2], #4
+  str  r3, [r0], #4
+
+LoopCopyDtcm:
+  cmp  r0, r1
+  bcc  CopyDtcm
+
+/* Zero fill the DTCM bss segment. */
+  ldr  r2, =_sdtcm_bss
+  ldr  r1, =_edtcm_bss
+  movs  r3, #0
+  b  LoopFillZeroDtcm
+
+FillZeroDtcm:
+  str  r3, [r2], #4
+
+LoopFillZeroDtcm:
+  cmp  r2, r1
+  bcc  FillZeroDtcm
+
+/* Make the copied code visible to instruction fetch */
+  dsb
+  isb
+
 /* Call the clock system initialization function.*/
   bl  SystemInit   
 /* Call static constructors */